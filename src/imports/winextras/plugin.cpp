@@ -48,6 +48,7 @@
 #include "qquickthumbnailtoolbar_p.h"
 #include "qquickthumbnailtoolbutton_p.h"
 #include "qquickwin_p.h"
+#include "qquickshellmetrics_p.h"
 
 #include <QtQml/QtQml>
 
@@ -72,6 +73,7 @@ public:
         qmlRegisterType<QQuickJumpListCategory>(uri, 1, 0, "JumpListCategory");
         qmlRegisterType<QQuickThumbnailToolBar>(uri, 1, 0, "ThumbnailToolBar");
         qmlRegisterType<QQuickThumbnailToolButton>(uri, 1, 0, "ThumbnailToolButton");
+        qmlRegisterSingletonType<QQuickShellMetrics>(uri, 1, 0, "ShellMetrics", QQuickShellMetrics::create);
     }
 };
 
@@ -44,8 +44,10 @@
 #include "qquickdwmfeatures_p_p.h"
 
 #include <QtWinExtras/private/qwineventfilter_p.h>
+#include <QtWinExtras/private/qwindwmattributebatch_p.h>
 #include <QWinEvent>
 #include <QQuickWindow>
+#include <QMargins>
 
 QT_BEGIN_NAMESPACE
 
@@ -99,9 +101,7 @@ QColor QQuickDwmFeatures::realColorizationColor() const
 
 bool QQuickDwmFeatures::colorizationOpaqueBlend() const
 {
-    bool opaque;
-    QtWin::colorizationColor(&opaque);
-    return opaque;
+    return QtWin::isCompositionOpaque();
 }
 
 /*!
@@ -116,8 +116,7 @@ void QQuickDwmFeatures::setTopGlassMargin(int margin)
         return;
 
     d->topMargin = margin;
-    if (window())
-        QtWin::extendFrameIntoClientArea(window(), d->leftMargin, d->topMargin, d->rightMargin, d->bottomMargin);
+    d->updateFrameMargins();
     emit topGlassMarginChanged();
 }
 
@@ -133,8 +132,7 @@ void QQuickDwmFeatures::setRightGlassMargin(int margin)
         return;
 
     d->rightMargin = margin;
-    if (window())
-        QtWin::extendFrameIntoClientArea(window(), d->leftMargin, d->topMargin, d->rightMargin, d->bottomMargin);
+    d->updateFrameMargins();
     emit rightGlassMarginChanged();
 }
 
@@ -150,8 +148,7 @@ void QQuickDwmFeatures::setBottomGlassMargin(int margin)
         return;
 
     d->bottomMargin = margin;
-    if (window())
-        QtWin::extendFrameIntoClientArea(window(), d->leftMargin, d->topMargin, d->rightMargin, d->bottomMargin);
+    d->updateFrameMargins();
     emit bottomGlassMarginChanged();
 }
 
@@ -167,8 +164,7 @@ void QQuickDwmFeatures::setLeftGlassMargin(int margin)
         return;
 
     d->leftMargin = margin;
-    if (window())
-        QtWin::extendFrameIntoClientArea(window(), d->leftMargin, d->topMargin, d->rightMargin, d->bottomMargin);
+    d->updateFrameMargins();
     emit leftGlassMarginChanged();
 }
 
@@ -214,12 +210,7 @@ void QQuickDwmFeatures::setBlurBehindEnabled(bool enabled)
         return;
 
     d->blurBehindEnabled = enabled;
-    if (window()) {
-        if (d->blurBehindEnabled)
-            QtWin::enableBlurBehindWindow(window());
-        else
-            QtWin::disableBlurBehindWindow(window());
-    }
+    d->updateAttribute(QWinDwmAttributeBatch::BlurBehind, d->blurBehindEnabled);
     emit blurBehindEnabledChanged();
 }
 
@@ -232,10 +223,12 @@ void QQuickDwmFeatures::setBlurBehindEnabled(bool enabled)
 bool QQuickDwmFeatures::isExcludedFromPeek() const
 {
     Q_D(const QQuickDwmFeatures);
-    if (window())
+    if (window()) {
+        qt_winDwmAttributeBatch()->flush(window());
         return QtWin::isWindowExcludedFromPeek(window());
-    else
+    } else {
         return d->peekExcluded;
+    }
 }
 
 void QQuickDwmFeatures::setExcludedFromPeek(bool exclude)
@@ -245,8 +238,7 @@ void QQuickDwmFeatures::setExcludedFromPeek(bool exclude)
         return;
 
     d->peekExcluded = exclude;
-    if (window())
-        QtWin::setWindowExcludedFromPeek(window(), d->peekExcluded);
+    d->updateAttribute(QWinDwmAttributeBatch::ExcludedFromPeek, d->peekExcluded);
     emit excludedFromPeekChanged();
 }
 
@@ -259,10 +251,12 @@ void QQuickDwmFeatures::setExcludedFromPeek(bool exclude)
 bool QQuickDwmFeatures::isPeekDisallowed() const
 {
     Q_D(const QQuickDwmFeatures);
-    if (window())
+    if (window()) {
+        qt_winDwmAttributeBatch()->flush(window());
         return QtWin::isWindowPeekDisallowed(window());
-    else
+    } else {
         return d->peekDisallowed;
+    }
 }
 
 void QQuickDwmFeatures::setPeekDisallowed(bool disallow)
@@ -272,8 +266,7 @@ void QQuickDwmFeatures::setPeekDisallowed(bool disallow)
         return;
 
     d->peekDisallowed = disallow;
-    if (window())
-        QtWin::setWindowDisallowPeek(window(), d->peekDisallowed);
+    d->updateAttribute(QWinDwmAttributeBatch::PeekDisallowed, d->peekDisallowed);
     emit peekDisallowedChanged();
 }
 
@@ -285,10 +278,12 @@ void QQuickDwmFeatures::setPeekDisallowed(bool disallow)
 QQuickWin::WindowFlip3DPolicy QQuickDwmFeatures::flip3DPolicy() const
 {
     Q_D(const QQuickDwmFeatures);
-    if (window())
+    if (window()) {
+        qt_winDwmAttributeBatch()->flush(window());
         return static_cast<QQuickWin::WindowFlip3DPolicy>(QtWin::windowFlip3DPolicy(window()));
-    else
+    } else {
         return d->flipPolicy;
+    }
 }
 
 void QQuickDwmFeatures::setFlip3DPolicy(QQuickWin::WindowFlip3DPolicy policy)
@@ -298,8 +293,7 @@ void QQuickDwmFeatures::setFlip3DPolicy(QQuickWin::WindowFlip3DPolicy policy)
         return;
 
     d->flipPolicy = policy;
-    if (window())
-        QtWin::setWindowFlip3DPolicy(window(), static_cast<QtWin::WindowFlip3DPolicy>(d->flipPolicy));
+    d->updateAttribute(QWinDwmAttributeBatch::Flip3DPolicy, int(d->flipPolicy));
     emit flip3DPolicyChanged();
 }
 
@@ -309,8 +303,11 @@ bool QQuickDwmFeatures::eventFilter(QObject *object, QEvent *event)
     if (object == window()) {
         if (event->type() == QWinEvent::CompositionChange) {
             d->updateSurfaceFormat();
-            if (static_cast<QWinCompositionChangeEvent *>(event)->isCompositionEnabled())
+            if (static_cast<QWinCompositionChangeEvent *>(event)->isCompositionEnabled()) {
+                // the window manager does not keep the attributes while composition is off
+                qt_winDwmAttributeBatch()->forget(window());
                 d->updateAll();
+            }
             emit compositionEnabledChanged();
         } else if (event->type() == QWinEvent::ColorizationChange) {
             emit colorizationColorChanged();
@@ -356,20 +353,34 @@ QQuickDwmFeaturesPrivate::QQuickDwmFeaturesPrivate(QQuickDwmFeatures *parent) :
 void QQuickDwmFeaturesPrivate::updateAll()
 {
     Q_Q(QQuickDwmFeatures);
-    QWindow *w = q->window();
-    if (w) {
+    if (q->window()) {
         updateSurfaceFormat();
-        QtWin::setWindowExcludedFromPeek(w, peekExcluded);
-        QtWin::setWindowDisallowPeek(w, peekDisallowed);
-        QtWin::setWindowFlip3DPolicy(w, static_cast<QtWin::WindowFlip3DPolicy>(flipPolicy));
-        if (blurBehindEnabled)
-            QtWin::enableBlurBehindWindow(w);
-        else
-            QtWin::disableBlurBehindWindow(w);
-        QtWin::extendFrameIntoClientArea(w, leftMargin, topMargin, rightMargin, bottomMargin);
+        updateAttribute(QWinDwmAttributeBatch::ExcludedFromPeek, peekExcluded);
+        updateAttribute(QWinDwmAttributeBatch::PeekDisallowed, peekDisallowed);
+        updateAttribute(QWinDwmAttributeBatch::Flip3DPolicy, int(flipPolicy));
+        updateAttribute(QWinDwmAttributeBatch::BlurBehind, blurBehindEnabled);
+        updateFrameMargins();
     }
 }
 
+/*
+    Queues setting \a attribute of the window to \a value. Setting several
+    attributes, or the same one several times, from QML costs one native
+    call for each attribute that did change when control returns to the
+    event loop.
+ */
+void QQuickDwmFeaturesPrivate::updateAttribute(int attribute, const QVariant &value)
+{
+    Q_Q(QQuickDwmFeatures);
+    if (q->window())
+        qt_winDwmAttributeBatch()->setAttribute(q->window(), QWinDwmAttributeBatch::Attribute(attribute), value);
+}
+
+void QQuickDwmFeaturesPrivate::updateFrameMargins()
+{
+    updateAttribute(QWinDwmAttributeBatch::FrameMargins, QVariant::fromValue(QMargins(leftMargin, topMargin, rightMargin, bottomMargin)));
+}
+
 void QQuickDwmFeaturesPrivate::updateSurfaceFormat()
 {
     Q_Q(QQuickDwmFeatures);
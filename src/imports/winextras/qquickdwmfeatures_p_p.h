@@ -65,6 +65,8 @@ public:
 
     void updateAll();
     void updateSurfaceFormat();
+    void updateAttribute(int attribute, const QVariant &value);
+    void updateFrameMargins();
 
 private:
     QQuickDwmFeatures *q_ptr;
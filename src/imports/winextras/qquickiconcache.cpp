@@ -0,0 +1,417 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickiconcache_p.h"
+
+#include <QCoreApplication>
+#include <QPointer>
+#include <QQmlEngine>
+#include <QQmlFile>
+#include <QNetworkAccessManager>
+#include <QNetworkRequest>
+#include <QNetworkReply>
+#include <QQuickImageProvider>
+#include <QImageReader>
+#include <QFile>
+#include <QBuffer>
+#include <QRunnable>
+#include <QPixmap>
+#include <QTimer>
+#include <QDebug>
+
+QT_BEGIN_NAMESPACE
+
+static const QEvent::Type iconDecodedEventType = QEvent::Type(QEvent::registerEventType());
+
+// Carries the images decoded on the thread pool back to the GUI thread.
+class QQuickIconDecodedEvent : public QEvent
+{
+public:
+    QQuickIconDecodedEvent(const QString &key, uint serial, const QList<QImage> &images) :
+        QEvent(iconDecodedEventType), key(key), serial(serial), images(images) {}
+
+    const QString key;
+    const uint serial;
+    const QList<QImage> images;
+};
+
+// Decodes a file, or data received from the network, on the thread pool.
+class QQuickIconDecoder : public QRunnable
+{
+public:
+    QQuickIconDecoder(QQuickIconCache *cache, const QString &key, uint serial, const QString &fileName, const QByteArray &data, const QSize &size) :
+        m_cache(cache), m_key(key), m_serial(serial), m_fileName(fileName), m_data(data), m_size(size) {}
+
+    void run()
+    {
+        QList<QImage> images;
+        if (m_fileName.isEmpty()) {
+            QBuffer buffer(&m_data);
+            if (buffer.open(QIODevice::ReadOnly))
+                images = QQuickIconCache::readImages(&buffer, m_size);
+        } else {
+            QFile file(m_fileName);
+            if (file.open(QIODevice::ReadOnly))
+                images = QQuickIconCache::readImages(&file, m_size);
+        }
+        // the cache waits for its decoders before it is destroyed
+        QCoreApplication::postEvent(m_cache, new QQuickIconDecodedEvent(m_key, m_serial, images));
+    }
+
+private:
+    QQuickIconCache *m_cache;
+    const QString m_key;
+    const uint m_serial;
+    const QString m_fileName;
+    QByteArray m_data;
+    const QSize m_size;
+};
+
+QQuickIconCache::QQuickIconCache(int maxCost, QObject *parent) :
+    QObject(parent), m_icons(maxCost), m_delivery(0), m_nextSerial(0), m_decodingCount(0),
+    m_maxActiveReplies(DefaultMaxActiveReplies), m_networkTimeout(DefaultNetworkTimeout),
+    m_hitCount(0), m_missCount(0), m_loadCount(0), m_mergedCount(0), m_cancelledCount(0), m_timedOutCount(0)
+{
+}
+
+QQuickIconCache::~QQuickIconCache()
+{
+    m_decoders.waitForDone();
+}
+
+/*
+    The cache shared by all icon loaders. It is owned by the application, so
+    that the pixmaps are released before the GUI is torn down.
+ */
+QQuickIconCache *QQuickIconCache::instance()
+{
+    static QPointer<QQuickIconCache> cache;
+    if (!cache)
+        cache = new QQuickIconCache(DefaultMaxCost, QCoreApplication::instance());
+    return cache;
+}
+
+/*
+    Returns the icon loaded from \a url at \a size, or a null icon if it is
+    not in the cache.
+ */
+QIcon QQuickIconCache::find(const QUrl &url, const QSize &size)
+{
+    if (QIcon *icon = m_icons.object(cacheKey(url, size))) {
+        ++m_hitCount;
+        return *icon;
+    }
+    ++m_missCount;
+    return QIcon();
+}
+
+/*
+    Loads the icon at \a url, scaled down to \a size if it is valid, for
+    \a receiver, unless it is being loaded already. The receiver is called
+    when the load finishes, with a null icon if it failed, once the images
+    have been decoded. Image providers are asked for the image right away.
+
+    Each call has to be matched by a cancel() if the receiver stops waiting
+    for the icon before it is called, or goes away.
+ */
+void QQuickIconCache::load(const QUrl &url, const QSize &size, QQmlEngine *engine, QQuickIconReceiver *receiver)
+{
+    const QString key = cacheKey(url, size);
+    QHash<QString, Load>::iterator it = m_loads.find(key);
+    if (it != m_loads.end()) {
+        it->receivers.append(receiver);
+        ++m_mergedCount;
+        return;
+    }
+    ++m_loadCount;
+    Load load = { url, size, QList<QQuickIconReceiver *>(), engine, 0, m_nextSerial++ };
+    load.receivers.append(receiver);
+    m_loads.insert(key, load);
+
+    const QString scheme = url.scheme();
+    if (scheme == QLatin1String("qrc") || scheme == QLatin1String("file")) {
+        const QString fileName = QQmlFile::urlToLocalFileOrQrc(url);
+        if (fileName.isEmpty())
+            finishLoading(key, QList<QImage>());
+        else
+            decode(key, load.serial, fileName, QByteArray(), size);
+    } else if ((scheme == QLatin1String("http") || scheme == QLatin1String("https")) && engine) {
+        m_queue.enqueue(key);
+        startQueuedReplies();
+    } else if (scheme == QLatin1String("image") && engine) {
+        finishLoading(key, loadFromImageProvider(url, size, engine));
+    } else {
+        finishLoading(key, QList<QImage>());
+    }
+}
+
+/*
+    Stops \a receiver waiting for the icon at \a url and \a size. The network
+    request for it is aborted, or taken out of the queue, once nobody waits
+    for it. Images being decoded are dropped when they arrive.
+ */
+void QQuickIconCache::cancel(const QUrl &url, const QSize &size, QQuickIconReceiver *receiver)
+{
+    const QString key = cacheKey(url, size);
+    // a receiver may go away while the receivers of its load are called
+    for (Delivery *delivery = m_delivery; delivery; delivery = delivery->previous) {
+        if (delivery->key == key && delivery->receivers.removeOne(receiver))
+            return;
+    }
+    QHash<QString, Load>::iterator it = m_loads.find(key);
+    if (it == m_loads.end() || !it->receivers.removeOne(receiver) || !it->receivers.isEmpty())
+        return;
+
+    ++m_cancelledCount;
+    QNetworkReply *reply = it->reply;
+    m_loads.erase(it);
+    if (reply) {
+        dropReply(reply);
+        startQueuedReplies();
+    } else {
+        m_queue.removeOne(key);
+    }
+}
+
+bool QQuickIconCache::isLoading(const QUrl &url, const QSize &size) const
+{
+    return m_loads.contains(cacheKey(url, size));
+}
+
+/*
+    Removes all icons. Loads in progress are not affected.
+ */
+void QQuickIconCache::clear()
+{
+    m_icons.clear();
+}
+
+void QQuickIconCache::setMaxActiveReplies(int maxActiveReplies)
+{
+    m_maxActiveReplies = qMax(1, maxActiveReplies);
+    startQueuedReplies();
+}
+
+/*
+    Returns the share of find() calls that were answered from the cache.
+ */
+qreal QQuickIconCache::hitRate() const
+{
+    const int lookups = m_hitCount + m_missCount;
+    return lookups ? qreal(m_hitCount) / lookups : qreal(0);
+}
+
+void QQuickIconCache::onReplyFinished()
+{
+    QNetworkReply *reply = qobject_cast<QNetworkReply *>(sender());
+    const QString key = m_replies.value(reply);
+    QHash<QString, Load>::iterator it = m_loads.find(key);
+    if (it == m_loads.end()) {
+        dropReply(reply);
+        return;
+    }
+    it->reply = 0;
+    if (reply->error() == QNetworkReply::NoError) {
+        decode(key, it->serial, QString(), reply->readAll(), it->size);
+        dropReply(reply);
+    } else {
+        qWarning().nospace() << "Cannot load " << reply->url().toString() << " (" << qPrintable(reply->errorString()) << ")";
+        dropReply(reply);
+        finishLoading(key, QList<QImage>());
+    }
+    startQueuedReplies();
+}
+
+void QQuickIconCache::onReplyTimeout()
+{
+    QNetworkReply *reply = static_cast<QNetworkReply *>(sender()->parent());
+    const QString key = m_replies.value(reply);
+    qWarning().nospace() << "Cannot load " << reply->url().toString() << " (timed out after " << m_networkTimeout << " ms)";
+    ++m_timedOutCount;
+    dropReply(reply);
+    finishLoading(key, QList<QImage>());
+    startQueuedReplies();
+}
+
+void QQuickIconCache::customEvent(QEvent *event)
+{
+    if (event->type() != iconDecodedEventType)
+        return;
+    const QQuickIconDecodedEvent *decoded = static_cast<QQuickIconDecodedEvent *>(event);
+    --m_decodingCount;
+    // the load may have been cancelled in the meantime, and even been
+    // started again
+    QHash<QString, Load>::const_iterator it = m_loads.constFind(decoded->key);
+    if (it != m_loads.constEnd() && it->serial == decoded->serial)
+        finishLoading(decoded->key, decoded->images);
+}
+
+QString QQuickIconCache::cacheKey(const QUrl &url, const QSize &size)
+{
+    return url.toString() + QLatin1Char('@') + QString::number(size.width()) + QLatin1Char('x') + QString::number(size.height());
+}
+
+/*
+    Reads the images of an icon from \a device. Without a requested \a size,
+    all the sizes stored in an icon file are read; otherwise only the first
+    image is, scaled down to \a size.
+ */
+QList<QImage> QQuickIconCache::readImages(QIODevice *device, const QSize &size)
+{
+    QList<QImage> images;
+    QImageReader reader(device);
+    const QSize imageSize = reader.size();
+    // decoding right at the requested size saves scaling large images
+    if (size.isValid() && imageSize.isValid()
+            && (imageSize.width() > size.width() || imageSize.height() > size.height()))
+        reader.setScaledSize(imageSize.scaled(size, Qt::KeepAspectRatio));
+    do {
+        const QImage image = reader.read();
+        if (image.isNull())
+            break;
+        images.append(image);
+    } while (!size.isValid() && !reader.supportsAnimation() && reader.jumpToNextImage());
+    return images;
+}
+
+QList<QImage> QQuickIconCache::loadFromImageProvider(const QUrl &url, const QSize &size, QQmlEngine *engine)
+{
+    const QString providerId = url.host();
+    const QString imageId = url.toString(QUrl::RemoveScheme | QUrl::RemoveAuthority).mid(1);
+    QQuickImageProvider *provider = static_cast<QQuickImageProvider *>(engine->imageProvider(providerId));
+    QList<QImage> images;
+    if (!provider)
+        return images;
+
+    QSize providedSize;
+    QImage image;
+    if (provider->imageType() == QQuickImageProvider::Image)
+        image = provider->requestImage(imageId, &providedSize, size);
+    else if (provider->imageType() == QQuickImageProvider::Pixmap)
+        image = provider->requestPixmap(imageId, &providedSize, size).toImage();
+    if (!image.isNull())
+        images.append(image);
+    return images;
+}
+
+/*
+    Decodes the images of the icon \a key from \a fileName, or from \a data if
+    \a fileName is empty, on the thread pool, for the load numbered \a serial.
+ */
+void QQuickIconCache::decode(const QString &key, uint serial, const QString &fileName, const QByteArray &data, const QSize &size)
+{
+    ++m_decodingCount;
+    m_decoders.start(new QQuickIconDecoder(this, key, serial, fileName, data, size));
+}
+
+/*
+    Sends the queued network requests as long as fewer than
+    maxActiveReplies() are in progress.
+ */
+void QQuickIconCache::startQueuedReplies()
+{
+    while (m_replies.count() < m_maxActiveReplies && !m_queue.isEmpty()) {
+        const QString key = m_queue.dequeue();
+        QHash<QString, Load>::iterator it = m_loads.find(key);
+        if (it == m_loads.end())
+            continue;
+        Load &load = *it;
+        if (!load.engine) {
+            finishLoading(key, QList<QImage>());
+            continue;
+        }
+        load.reply = load.engine->networkAccessManager()->get(QNetworkRequest(load.url));
+        m_replies.insert(load.reply, key);
+        connect(load.reply, SIGNAL(finished()), SLOT(onReplyFinished()));
+        if (m_networkTimeout > 0) {
+            QTimer *timer = new QTimer(load.reply);
+            timer->setSingleShot(true);
+            connect(timer, SIGNAL(timeout()), SLOT(onReplyTimeout()));
+            timer->start(m_networkTimeout);
+        }
+    }
+}
+
+/*
+    Forgets \a reply, aborting it if it is still running.
+ */
+void QQuickIconCache::dropReply(QNetworkReply *reply)
+{
+    m_replies.remove(reply);
+    disconnect(reply, 0, this, 0);
+    if (QTimer *timer = reply->findChild<QTimer *>())
+        timer->stop();
+    if (reply->isRunning())
+        reply->abort();
+    reply->deleteLater();
+}
+
+/*
+    Caches the icon made of \a images, which costs the memory taken by their
+    pixels, and hands it to the receivers waiting for it. Failed loads are not
+    cached, so that they are tried again.
+ */
+void QQuickIconCache::finishLoading(const QString &key, const QList<QImage> &images)
+{
+    QHash<QString, Load>::iterator it = m_loads.find(key);
+    if (it == m_loads.end())
+        return;
+    Delivery delivery = { key, it->receivers, m_delivery };
+    m_loads.erase(it);
+    QIcon icon;
+    if (!images.isEmpty()) {
+        int cost = 0;
+        for (int i = 0; i < images.size(); ++i) {
+            icon.addPixmap(QPixmap::fromImage(images.at(i)));
+            cost += images.at(i).byteCount();
+        }
+        m_icons.insert(key, new QIcon(icon), cost);
+    }
+    // receivers may load other icons, or cancel the ones still to be called
+    m_delivery = &delivery;
+    while (!delivery.receivers.isEmpty()) {
+        if (QQuickIconReceiver *receiver = delivery.receivers.takeFirst())
+            receiver->iconLoaded(icon);
+    }
+    m_delivery = delivery.previous;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,180 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKICONCACHE_P_H
+#define QQUICKICONCACHE_P_H
+
+#include <QObject>
+#include <QCache>
+#include <QHash>
+#include <QIcon>
+#include <QImage>
+#include <QList>
+#include <QPointer>
+#include <QQueue>
+#include <QSize>
+#include <QThreadPool>
+#include <QUrl>
+
+QT_BEGIN_NAMESPACE
+
+class QQmlEngine;
+class QNetworkReply;
+class QIODevice;
+
+// Gets the icon it asked QQuickIconCache for, once it is loaded.
+class QQuickIconReceiver
+{
+public:
+    virtual ~QQuickIconReceiver() {}
+    virtual void iconLoaded(const QIcon &icon) = 0;
+};
+
+// Icons loaded for QQuickIconLoader, shared by all loaders and bounded by the
+// memory taken by their pixels. Icons are identified by their URL and the
+// size they were requested at. Concurrent loads of the same icon are merged,
+// the loaded icon is handed to the receivers of that load only, and network
+// loads nobody waits for any longer are cancelled. Files and
+// network data are decoded on a thread pool; only turning the decoded images
+// into an icon is done on the GUI thread. At most
+// maxActiveReplies() network images are loaded at a time, the others wait
+// in a queue; a reply taking longer than networkTimeout() fails.
+class QQuickIconCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum {
+        DefaultMaxCost = 4 * 1024 * 1024,
+        DefaultMaxActiveReplies = 6,
+        DefaultNetworkTimeout = 30000
+    };
+
+    explicit QQuickIconCache(int maxCost = DefaultMaxCost, QObject *parent = 0);
+    ~QQuickIconCache();
+
+    static QQuickIconCache *instance();
+
+    QIcon find(const QUrl &url, const QSize &size);
+    void load(const QUrl &url, const QSize &size, QQmlEngine *engine, QQuickIconReceiver *receiver);
+    void cancel(const QUrl &url, const QSize &size, QQuickIconReceiver *receiver);
+    bool isLoading(const QUrl &url, const QSize &size) const;
+    void clear();
+
+    int count() const { return m_icons.count(); }
+    int totalCost() const { return m_icons.totalCost(); }
+    int maxCost() const { return m_icons.maxCost(); }
+    void setMaxCost(int maxCost) { m_icons.setMaxCost(maxCost); }
+
+    int maxActiveReplies() const { return m_maxActiveReplies; }
+    void setMaxActiveReplies(int maxActiveReplies);
+    int networkTimeout() const { return m_networkTimeout; }
+    void setNetworkTimeout(int msecs) { m_networkTimeout = msecs; }
+    int activeReplyCount() const { return m_replies.count(); }
+    int queuedCount() const { return m_queue.count(); }
+    int decodingCount() const { return m_decodingCount; }
+
+    int hitCount() const { return m_hitCount; }
+    int missCount() const { return m_missCount; }
+    int loadCount() const { return m_loadCount; }
+    int mergedCount() const { return m_mergedCount; }
+    int cancelledCount() const { return m_cancelledCount; }
+    int timedOutCount() const { return m_timedOutCount; }
+    qreal hitRate() const;
+
+protected:
+    void customEvent(QEvent *event);
+
+private Q_SLOTS:
+    void onReplyFinished();
+    void onReplyTimeout();
+
+private:
+    struct Load
+    {
+        QUrl url;
+        QSize size;
+        QList<QQuickIconReceiver *> receivers;
+        QPointer<QQmlEngine> engine;
+        QNetworkReply *reply;
+        // tells the decoded images of this load from those of a cancelled one
+        uint serial;
+    };
+
+    // the receivers of a finished load that have not been called yet
+    struct Delivery
+    {
+        QString key;
+        QList<QQuickIconReceiver *> receivers;
+        Delivery *previous;
+    };
+
+    static QString cacheKey(const QUrl &url, const QSize &size);
+    static QList<QImage> readImages(QIODevice *device, const QSize &size);
+    static QList<QImage> loadFromImageProvider(const QUrl &url, const QSize &size, QQmlEngine *engine);
+    void decode(const QString &key, uint serial, const QString &fileName, const QByteArray &data, const QSize &size);
+    void startQueuedReplies();
+    void dropReply(QNetworkReply *reply);
+    void finishLoading(const QString &key, const QList<QImage> &images);
+
+    QCache<QString, QIcon> m_icons;
+    QHash<QString, Load> m_loads;
+    QHash<QNetworkReply *, QString> m_replies;
+    QQueue<QString> m_queue;
+    QThreadPool m_decoders;
+    Delivery *m_delivery;
+    uint m_nextSerial;
+    int m_decodingCount;
+    int m_maxActiveReplies;
+    int m_networkTimeout;
+    int m_hitCount;
+    int m_missCount;
+    int m_loadCount;
+    int m_mergedCount;
+    int m_cancelledCount;
+    int m_timedOutCount;
+
+    friend class QQuickIconDecoder;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKICONCACHE_P_H
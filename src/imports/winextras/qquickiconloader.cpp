@@ -41,106 +41,73 @@
  ****************************************************************************/
 
 #include "qquickiconloader_p.h"
+#include "qquickiconcache_p.h"
 
-#include <QUrl>
-#include <QQmlEngine>
-#include <QNetworkAccessManager>
-#include <QFileInfo>
-#include <QNetworkRequest>
-#include <QNetworkReply>
-#include <QPixmap>
-#include <QQuickImageProvider>
-#include <QQmlFile>
 #include <qt_windows.h>
-#include <QDebug>
 
 QT_BEGIN_NAMESPACE
 
 QQuickIconLoader::QQuickIconLoader(QObject *parent) :
-    QObject(parent)
+    QObject(parent), m_waiting(false)
 {
 }
 
-void QQuickIconLoader::load(const QUrl &url, QQmlEngine *engine)
+QQuickIconLoader::~QQuickIconLoader()
 {
-    m_icon = QIcon();
-    QString scheme = url.scheme();
-    if (scheme == QLatin1String("qrc") || scheme == QLatin1String("file"))
-        loadFromFile(url);
-    else if (scheme == QLatin1String("http") || scheme == QLatin1String("https"))
-        loadFromNetwork(url, engine);
-    else if (scheme == QLatin1String("image"))
-        loadFromImageProvider(url, engine);
+    cancel();
 }
 
-QIcon QQuickIconLoader::icon() const
+/*
+    Loads the icon at \a url through the shared icon cache. finished() is
+    emitted once the icon is available, right away if it is cached already.
+    Loading another icon cancels waiting for the previous one.
+ */
+void QQuickIconLoader::load(const QUrl &url, QQmlEngine *engine)
 {
-    return m_icon;
-}
+    // image providers are asked for icons at the size of the system icons
+    QSize size;
+    if (url.scheme() == QLatin1String("image"))
+        size = QSize(GetSystemMetrics(SM_CXICON), GetSystemMetrics(SM_CYICON));
+    if (m_waiting && url == m_url && size == m_size)
+        return;
 
-void QQuickIconLoader::onRequestFinished(QNetworkReply *reply)
-{
-    disconnect(reply->manager(), 0, this, 0);
-    if (reply->error() == QNetworkReply::NoError) {
-        QByteArray data = reply->readAll();
-        QPixmap pixmap;
-        if (pixmap.loadFromData(data)) {
-            m_icon = QIcon(pixmap);
-            emit finished();
-        }
-    } else {
-        qWarning().nospace() << "Cannot load " << reply->url().toString() << " (" << qPrintable(reply->errorString()) << ")";
-    }
-    reply->deleteLater();
-}
+    cancel();
+    m_icon = QIcon();
+    m_url = url;
+    m_size = size;
 
-void QQuickIconLoader::loadFromFile(const QUrl &url)
-{
-    QString path = QQmlFile::urlToLocalFileOrQrc(url);
-    if (QFileInfo(path).exists()) {
-        m_icon = QIcon(path);
+    m_cache = QQuickIconCache::instance();
+    const QIcon icon = m_cache->find(m_url, m_size);
+    if (!icon.isNull()) {
+        m_icon = icon;
         emit finished();
+        return;
     }
+    m_waiting = true;
+    m_cache->load(m_url, m_size, engine, this);
 }
 
-void QQuickIconLoader::loadFromNetwork(const QUrl &url, QQmlEngine *engine)
-{
-    QNetworkRequest request(url);
-    QNetworkAccessManager *manager = engine->networkAccessManager();
-    connect(manager, SIGNAL(finished(QNetworkReply*)), SLOT(onRequestFinished(QNetworkReply*)));
-    manager->get(request);
-}
-
-static inline QString imageProviderId(const QUrl &url)
+QIcon QQuickIconLoader::icon() const
 {
-    return url.host();
+    return m_icon;
 }
 
-static inline QString imageId(const QUrl &url)
+void QQuickIconLoader::iconLoaded(const QIcon &icon)
 {
-    return url.toString(QUrl::RemoveScheme | QUrl::RemoveAuthority).mid(1);
+    m_waiting = false;
+    m_icon = icon;
+    if (!m_icon.isNull())
+        emit finished();
 }
 
-void QQuickIconLoader::loadFromImageProvider(const QUrl &url, QQmlEngine *engine)
+void QQuickIconLoader::cancel()
 {
-    const QString providerId = url.host();
-    const QString imageId = url.toString(QUrl::RemoveScheme | QUrl::RemoveAuthority).mid(1);
-    QQuickImageProvider::ImageType imageType = QQuickImageProvider::Invalid;
-    QQuickImageProvider *provider = static_cast<QQuickImageProvider *>(engine->imageProvider(providerId));
-    QSize size;
-    QSize requestSize(GetSystemMetrics(SM_CXICON), GetSystemMetrics(SM_CYICON));
-    if (provider)
-        imageType = provider->imageType();
-    if (imageType == QQuickImageProvider::Image) {
-        QImage image = provider->requestImage(imageId, &size, requestSize);
-        if (!image.isNull())
-            m_icon = QIcon(QPixmap::fromImage(image));
-    } else if (imageType == QQuickImageProvider::Pixmap) {
-        QPixmap pixmap = provider->requestPixmap(imageId, &size, requestSize);
-        if (!pixmap.isNull())
-            m_icon = QIcon(pixmap);
-    }
-    emit finished();
+    if (!m_waiting)
+        return;
+    m_waiting = false;
+    // the cache goes away with the application
+    if (m_cache)
+        m_cache->cancel(m_url, m_size, this);
 }
 
 QT_END_NAMESPACE
@@ -43,36 +43,41 @@
 #ifndef QQUICKICONLOADER_P_H
 #define QQUICKICONLOADER_P_H
 
+#include "qquickiconcache_p.h"
+
 #include <QObject>
+#include <QPointer>
 #include <QIcon>
+#include <QUrl>
+#include <QSize>
 
 QT_BEGIN_NAMESPACE
 
 class QIcon;
 class QQmlEngine;
-class QNetworkReply;
 
-class QQuickIconLoader : public QObject
+class QQuickIconLoader : public QObject, public QQuickIconReceiver
 {
     Q_OBJECT
 
 public:
     explicit QQuickIconLoader(QObject *parent = 0);
+    ~QQuickIconLoader();
     void load(const QUrl &url, QQmlEngine *engine);
     QIcon icon() const;
 
 Q_SIGNALS:
     void finished();
 
-private Q_SLOTS:
-    void onRequestFinished(QNetworkReply*);
-
 private:
-    void loadFromFile(const QUrl &url);
-    void loadFromNetwork(const QUrl &url, QQmlEngine *engine);
-    void loadFromImageProvider(const QUrl &url, QQmlEngine *engine);
+    void iconLoaded(const QIcon &icon) Q_DECL_OVERRIDE;
+    void cancel();
 
     QIcon m_icon;
+    QUrl m_url;
+    QSize m_size;
+    bool m_waiting;
+    QPointer<QQuickIconCache> m_cache;
 };
 
 QT_END_NAMESPACE
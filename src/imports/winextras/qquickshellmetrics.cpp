@@ -0,0 +1,133 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickshellmetrics_p.h"
+
+#include <QtWin>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \qmltype ShellMetrics
+    \instantiates QQuickShellMetrics
+    \inqmlmodule QtWinExtras
+
+    \brief Counts and times the calls made into the Windows shell and DWM.
+
+    \since QtWinExtras 1.0
+
+    ShellMetrics is a singleton giving access to the metrics recorded by
+    QtWin::setShellMetricsEnabled():
+
+    \qml
+    Component.onCompleted: ShellMetrics.enabled = true
+    onClosing: console.log(ShellMetrics.toJson())
+    \endqml
+ */
+
+/*!
+    \class QQuickShellMetrics
+    \internal
+ */
+
+QQuickShellMetrics::QQuickShellMetrics(QObject *parent) :
+    QObject(parent)
+{
+}
+
+QObject *QQuickShellMetrics::create(QQmlEngine *engine, QJSEngine *scriptEngine)
+{
+    Q_UNUSED(engine)
+    Q_UNUSED(scriptEngine)
+    return new QQuickShellMetrics;
+}
+
+/*!
+    \qmlproperty bool ShellMetrics::enabled
+
+    Whether the calls are recorded. The default value is \c false, unless the
+    \c QT_WINEXTRAS_SHELL_METRICS environment variable is set.
+ */
+bool QQuickShellMetrics::isEnabled() const
+{
+    return QtWin::isShellMetricsEnabled();
+}
+
+void QQuickShellMetrics::setEnabled(bool enabled)
+{
+    if (enabled == isEnabled())
+        return;
+    QtWin::setShellMetricsEnabled(enabled);
+    emit enabledChanged();
+}
+
+/*!
+    \qmlmethod object ShellMetrics::metrics()
+
+    Returns the metrics recorded so far, as described for
+    QtWin::shellMetrics().
+ */
+QVariantMap QQuickShellMetrics::metrics() const
+{
+    return QtWin::shellMetrics();
+}
+
+/*!
+    \qmlmethod string ShellMetrics::toJson()
+
+    Returns the metrics recorded so far as a JSON document.
+ */
+QString QQuickShellMetrics::toJson() const
+{
+    return QString::fromUtf8(QtWin::shellMetricsToJson());
+}
+
+/*!
+    \qmlmethod void ShellMetrics::reset()
+
+    Discards the metrics recorded so far.
+ */
+void QQuickShellMetrics::reset()
+{
+    QtWin::resetShellMetrics();
+}
+
+QT_END_NAMESPACE
@@ -20,6 +20,8 @@ HEADERS += \
     qquickthumbnailtoolbar_p.h \
     qquickthumbnailtoolbutton_p.h \
     qquickiconloader_p.h \
+    qquickiconcache_p.h \
+    qquickshellmetrics_p.h \
     qquickwin_p.h
 
 SOURCES += \
@@ -31,7 +33,9 @@ SOURCES += \
     qquickjumplistcategory.cpp \
     qquickthumbnailtoolbar.cpp \
     qquickthumbnailtoolbutton.cpp \
-    qquickiconloader.cpp
+    qquickiconloader.cpp \
+    qquickiconcache.cpp \
+    qquickshellmetrics.cpp
 
 OTHER_FILES += \
     qmldir \
@@ -0,0 +1,115 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwincommandline_p.h"
+
+QT_BEGIN_NAMESPACE
+
+static inline bool needsQuotes(const QString &argument)
+{
+    return argument.isEmpty() || argument.contains(QLatin1Char(' ')) || argument.contains(QLatin1Char('\t'));
+}
+
+// The length of \a argument once its quotes are escaped.
+static int escapedLength(const QString &argument)
+{
+    int length = argument.size();
+    int backslashes = 0;
+    for (const QChar *c = argument.constBegin(), *end = argument.constEnd(); c != end; ++c) {
+        if (*c == QLatin1Char('\\')) {
+            ++backslashes;
+        } else {
+            if (*c == QLatin1Char('"'))
+                length += backslashes + 1;
+            backslashes = 0;
+        }
+    }
+    return length;
+}
+
+/*
+    Returns \a arguments as a command line, each of them preceded by a space.
+    This is a partial copy of qprocess_win.cpp:qt_create_commandline(): quotes
+    are escaped and their preceding backslashes are doubled, and arguments
+    that are empty or contain whitespace are quoted. Everything is written in
+    a single pass into a string of the exact final length.
+ */
+QString qt_winCreateArguments(const QStringList &arguments)
+{
+    int length = 0;
+    foreach (const QString &argument, arguments)
+        length += 1 + escapedLength(argument) + (needsQuotes(argument) ? 2 : 0);
+
+    QString result(length, Qt::Uninitialized);
+    QChar *out = result.data();
+    foreach (const QString &argument, arguments) {
+        *out++ = QLatin1Char(' ');
+        const bool quote = needsQuotes(argument);
+        if (quote)
+            *out++ = QLatin1Char('"');
+        int backslashes = 0;
+        for (const QChar *c = argument.constBegin(), *end = argument.constEnd(); c != end; ++c) {
+            if (*c == QLatin1Char('\\')) {
+                ++backslashes;
+            } else {
+                if (*c == QLatin1Char('"')) {
+                    for (int i = 0; i < backslashes + 1; ++i)
+                        *out++ = QLatin1Char('\\');
+                }
+                backslashes = 0;
+            }
+            *out++ = *c;
+        }
+        if (quote) {
+            // The argument must not end with a \ since this would be interpreted
+            // as escaping the quote -- rather put the \ behind the quote: e.g.
+            // rather use "foo"\ than "foo\"
+            out[-backslashes] = QLatin1Char('"');
+            for (int i = 0; i < backslashes; ++i)
+                out[-i] = QLatin1Char('\\');
+            ++out;
+        }
+    }
+    Q_ASSERT(out == result.constData() + length);
+    return result;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,164 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwindwmattributebatch_p.h"
+
+QT_BEGIN_NAMESPACE
+
+QWinDwmAttributeBatch::QWinDwmAttributeBatch(ApplyFunction apply, QObject *parent) :
+    QObject(parent), m_apply(apply), m_requestCount(0), m_applyCount(0)
+{
+    m_timer.setSingleShot(true);
+    m_timer.setInterval(0);
+    connect(&m_timer, SIGNAL(timeout()), this, SLOT(flush()));
+}
+
+/*
+    Sets \a attribute of \a window to \a value the next time control returns
+    to the event loop.
+ */
+void QWinDwmAttributeBatch::setAttribute(QObject *window, Attribute attribute, const QVariant &value)
+{
+    QHash<QObject *, WindowAttributes>::iterator it = m_windows.find(window);
+    if (it == m_windows.end()) {
+        it = m_windows.insert(window, WindowAttributes());
+        connect(window, SIGNAL(destroyed(QObject*)), this, SLOT(windowDestroyed(QObject*)));
+    }
+    ++m_requestCount;
+    it->pending |= 1u << attribute;
+    it->pendingValues[attribute] = value;
+    if (!m_timer.isActive())
+        m_timer.start();
+}
+
+bool QWinDwmAttributeBatch::isPending(QObject *window) const
+{
+    QHash<QObject *, WindowAttributes>::const_iterator it = m_windows.constFind(window);
+    return it != m_windows.constEnd() && it->pending;
+}
+
+/*
+    Applies the pending attributes of all windows.
+ */
+void QWinDwmAttributeBatch::flush()
+{
+    m_timer.stop();
+    for (QHash<QObject *, WindowAttributes>::iterator it = m_windows.begin(); it != m_windows.end(); ++it)
+        apply(it.key(), &it.value());
+}
+
+/*
+    Applies the pending attributes of \a window right away, for reading them
+    back from the window.
+ */
+void QWinDwmAttributeBatch::flush(QObject *window)
+{
+    QHash<QObject *, WindowAttributes>::iterator it = m_windows.find(window);
+    if (it != m_windows.end())
+        apply(window, &it.value());
+}
+
+/*
+    Forgets which attributes have been applied to \a window, so that the next
+    values set are applied even if they have not changed. Used when the window
+    manager may have reset them, like when composition is enabled again.
+ */
+void QWinDwmAttributeBatch::forget(QObject *window)
+{
+    QHash<QObject *, WindowAttributes>::iterator it = m_windows.find(window);
+    if (it != m_windows.end()) {
+        it->applied = 0;
+        for (int i = 0; i < AttributeCount; ++i)
+            it->appliedValues[i] = QVariant();
+    }
+}
+
+/*
+    Forgets whether \a attribute has been applied to \a window, as when it has
+    been set on the window directly, bypassing the batch.
+ */
+void QWinDwmAttributeBatch::forget(QObject *window, Attribute attribute)
+{
+    QHash<QObject *, WindowAttributes>::iterator it = m_windows.find(window);
+    if (it != m_windows.end()) {
+        it->applied &= ~(1u << attribute);
+        it->appliedValues[attribute] = QVariant();
+    }
+}
+
+/*
+    Forgets which attributes have been applied to all windows. Used when a
+    native window is created or destroyed, as a window whose native window is
+    recreated loses its attributes.
+ */
+void QWinDwmAttributeBatch::invalidate()
+{
+    for (QHash<QObject *, WindowAttributes>::iterator it = m_windows.begin(); it != m_windows.end(); ++it) {
+        it->applied = 0;
+        for (int i = 0; i < AttributeCount; ++i)
+            it->appliedValues[i] = QVariant();
+    }
+}
+
+void QWinDwmAttributeBatch::apply(QObject *window, WindowAttributes *attributes)
+{
+    for (int i = 0; attributes->pending && i < AttributeCount; ++i) {
+        const quint32 bit = 1u << i;
+        if (!(attributes->pending & bit))
+            continue;
+        attributes->pending &= ~bit;
+        QVariant &value = attributes->pendingValues[i];
+        if (!(attributes->applied & bit) || attributes->appliedValues[i] != value) {
+            m_apply(window, Attribute(i), value);
+            ++m_applyCount;
+            attributes->applied |= bit;
+            attributes->appliedValues[i] = value;
+        }
+        value = QVariant();
+    }
+}
+
+void QWinDwmAttributeBatch::windowDestroyed(QObject *window)
+{
+    m_windows.remove(window);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,120 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINDWMATTRIBUTEBATCH_P_H
+#define QWINDWMATTRIBUTEBATCH_P_H
+
+#include <QtWinExtras/qwinextrasglobal.h>
+#include <QtCore/QObject>
+#include <QtCore/QHash>
+#include <QtCore/QMargins>
+#include <QtCore/QTimer>
+#include <QtCore/QVariant>
+
+QT_BEGIN_NAMESPACE
+
+// Collects the DWM attributes set on windows and applies them once per event
+// loop turn. Only the last value set for an attribute is applied, and not at
+// all if it is the value that has been applied last.
+class Q_WINEXTRAS_EXPORT QWinDwmAttributeBatch : public QObject
+{
+    Q_OBJECT
+
+public:
+    // In the order they are applied.
+    enum Attribute
+    {
+        ExcludedFromPeek,   // bool
+        PeekDisallowed,     // bool
+        Flip3DPolicy,       // int, QtWin::WindowFlip3DPolicy
+        BlurBehind,         // bool
+        FrameMargins,       // QMargins
+        AttributeCount
+    };
+
+    typedef void (*ApplyFunction)(QObject *window, Attribute attribute, const QVariant &value);
+
+    explicit QWinDwmAttributeBatch(ApplyFunction apply, QObject *parent = 0);
+
+    void setAttribute(QObject *window, Attribute attribute, const QVariant &value);
+    bool isPending(QObject *window) const;
+    void flush(QObject *window);
+    void forget(QObject *window);
+    void forget(QObject *window, Attribute attribute);
+    void invalidate();
+
+    int requestCount() const { return m_requestCount; }
+    int applyCount() const { return m_applyCount; }
+    int avoidedCount() const { return m_requestCount - m_applyCount; }
+
+public Q_SLOTS:
+    void flush();
+
+private Q_SLOTS:
+    void windowDestroyed(QObject *window);
+
+private:
+    struct WindowAttributes
+    {
+        WindowAttributes() : pending(0), applied(0) {}
+
+        quint32 pending;
+        quint32 applied;
+        QVariant pendingValues[AttributeCount];
+        QVariant appliedValues[AttributeCount];
+    };
+
+    void apply(QObject *window, WindowAttributes *attributes);
+
+    ApplyFunction m_apply;
+    QHash<QObject *, WindowAttributes> m_windows;
+    QTimer m_timer;
+    int m_requestCount;
+    int m_applyCount;
+};
+
+Q_WINEXTRAS_EXPORT QWinDwmAttributeBatch *qt_winDwmAttributeBatch();
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QMargins)
+
+#endif // QWINDWMATTRIBUTEBATCH_P_H
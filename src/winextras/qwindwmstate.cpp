@@ -0,0 +1,135 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwindwmstate_p.h"
+
+QT_BEGIN_NAMESPACE
+
+QWinDwmState::QWinDwmState(ColorizationQuery colorization, RealColorizationQuery realColorization, CompositionQuery composition) :
+    m_queryColorization(colorization), m_queryRealColorization(realColorization), m_queryComposition(composition),
+    m_valid(0), m_colorization(0), m_opaqueBlend(false), m_realColorization(0), m_compositionEnabled(false),
+    m_queryCount(0)
+{
+}
+
+/*
+    Returns the colorization color in \a argb and whether it is an opaque
+    blend in \a opaqueBlend, which may be null. Returns false if the color
+    could not be queried; failures are not cached.
+ */
+bool QWinDwmState::colorization(quint32 *argb, bool *opaqueBlend)
+{
+    if (!(m_valid & Colorization)) {
+        ++m_queryCount;
+        if (!m_queryColorization(&m_colorization, &m_opaqueBlend)) {
+            *argb = 0;
+            if (opaqueBlend)
+                *opaqueBlend = false;
+            return false;
+        }
+        m_valid |= Colorization;
+    }
+    *argb = m_colorization;
+    if (opaqueBlend)
+        *opaqueBlend = m_opaqueBlend;
+    return true;
+}
+
+/*
+    Returns the colorization color chosen by the user in \a argb, or false if
+    it could not be queried.
+ */
+bool QWinDwmState::realColorization(quint32 *argb)
+{
+    if (!(m_valid & RealColorization)) {
+        ++m_queryCount;
+        if (!m_queryRealColorization(&m_realColorization)) {
+            *argb = 0;
+            return false;
+        }
+        m_valid |= RealColorization;
+    }
+    *argb = m_realColorization;
+    return true;
+}
+
+/*
+    Returns whether composition is enabled, false if the state could not be
+    queried.
+ */
+bool QWinDwmState::isCompositionEnabled()
+{
+    if (!(m_valid & Composition)) {
+        ++m_queryCount;
+        if (!m_queryComposition(&m_compositionEnabled))
+            return false;
+        m_valid |= Composition;
+    }
+    return m_compositionEnabled;
+}
+
+/*
+    Takes the new colorization color from WM_DWMCOLORIZATIONCOLORCHANGED. The
+    message does not tell the color chosen by the user, which is queried
+    again on the next read.
+ */
+void QWinDwmState::colorizationChanged(quint32 argb, bool opaqueBlend)
+{
+    m_colorization = argb;
+    m_opaqueBlend = opaqueBlend;
+    m_valid = (m_valid | Colorization) & ~RealColorization;
+}
+
+/*
+    Handles WM_DWMCOMPOSITIONCHANGED, which does not carry the new state.
+    The colorization color depends on the composition state, too.
+ */
+void QWinDwmState::compositionChanged()
+{
+    m_valid &= ~(Composition | Colorization);
+}
+
+void QWinDwmState::invalidate()
+{
+    m_valid = 0;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,95 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINDWMSTATE_P_H
+#define QWINDWMSTATE_P_H
+
+#include <QtCore/qglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+// Caches the colorization color and the composition state of the desktop
+// window manager. Each value is queried the first time it is read after an
+// invalidation; the DWM change messages received by QWinEventFilter keep the
+// cached values up to date. Colors are 0xAARRGGBB.
+class QWinDwmState
+{
+public:
+    typedef bool (*ColorizationQuery)(quint32 *argb, bool *opaqueBlend);
+    typedef bool (*RealColorizationQuery)(quint32 *argb);
+    typedef bool (*CompositionQuery)(bool *enabled);
+
+    QWinDwmState(ColorizationQuery colorization, RealColorizationQuery realColorization, CompositionQuery composition);
+
+    bool colorization(quint32 *argb, bool *opaqueBlend);
+    bool realColorization(quint32 *argb);
+    bool isCompositionEnabled();
+
+    void colorizationChanged(quint32 argb, bool opaqueBlend);
+    void compositionChanged();
+    void invalidate();
+
+    int queryCount() const { return m_queryCount; }
+
+private:
+    Q_DISABLE_COPY(QWinDwmState)
+
+    enum Value
+    {
+        Colorization = 0x1,
+        RealColorization = 0x2,
+        Composition = 0x4
+    };
+
+    ColorizationQuery m_queryColorization;
+    RealColorizationQuery m_queryRealColorization;
+    CompositionQuery m_queryComposition;
+    int m_valid;
+    quint32 m_colorization;
+    bool m_opaqueBlend;
+    quint32 m_realColorization;
+    bool m_compositionEnabled;
+    int m_queryCount;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINDWMSTATE_P_H
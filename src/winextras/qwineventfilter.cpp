@@ -41,6 +41,9 @@
 
 #include "qwineventfilter_p.h"
 #include "qwinfunctions.h"
+#include "qwinfunctions_p.h"
+#include "qwindwmstate_p.h"
+#include "qwindwmattributebatch_p.h"
 #include "qwinevent.h"
 #include <QGuiApplication>
 #include <QWindow>
@@ -55,8 +58,20 @@
 
 QWinEventFilter *QWinEventFilter::instance = 0;
 
+static void scanTopLevelWindows(QWinWindowIndex *index)
+{
+    const QWindowList windows = QGuiApplication::topLevelWindows();
+    for (int i = 0; i < windows.size(); ++i) {
+        QWindow *window = windows.at(i);
+        // winId() would create the native window of those that have none yet
+        if (window->handle())
+            index->insert(quintptr(window->winId()), window);
+    }
+}
+
 QWinEventFilter::QWinEventFilter() :
-    tbButtonCreatedMsgId(RegisterWindowMessageW(L"TaskbarButtonCreated"))
+    tbButtonCreatedMsgId(RegisterWindowMessageW(L"TaskbarButtonCreated")),
+    windowIndex(scanTopLevelWindows)
 {
 }
 
@@ -74,14 +89,32 @@ bool QWinEventFilter::nativeEventFilter(const QByteArray &, void *message, long
     QWindow *window = 0;
     switch (msg->message) {
     case WM_DWMCOLORIZATIONCOLORCHANGED :
+        qt_winDwmState()->colorizationChanged(quint32(msg->wParam), msg->lParam != 0);
         event = new QWinColorizationChangeEvent(msg->wParam, msg->lParam);
         break;
     case WM_DWMCOMPOSITIONCHANGED :
+        qt_winDwmState()->compositionChanged();
         event = new QWinCompositionChangeEvent(QtWin::isCompositionEnabled());
         break;
     case WM_THEMECHANGED :
         event = new QWinEvent(QWinEvent::ThemeChange);
         break;
+    case WM_CREATE :
+        // the DWM messages are only sent to top level windows, so the state
+        // may have changed unnoticed while there were none
+        qt_winDwmState()->invalidate();
+        // a recreated native window has lost the attributes of the old one
+        qt_winDwmAttributeBatch()->invalidate();
+        // fall through
+    case WM_SHOWWINDOW :
+        windowIndex.handleCreated(quintptr(msg->hwnd));
+        break;
+    case WM_DESTROY :
+        windowIndex.handleDestroyed(quintptr(msg->hwnd));
+        break;
+    case WM_NCDESTROY :
+        qt_winDwmAttributeBatch()->invalidate();
+        break;
     default :
         if (tbButtonCreatedMsgId == msg->message) {
             event = new QWinEvent(QWinEvent::TaskbarButtonCreated);
@@ -114,13 +147,5 @@ void QWinEventFilter::setup()
 
 QWindow *QWinEventFilter::findWindow(HWND handle)
 {
-    QWindow *w = 0;
-    QWindowList list = qApp->topLevelWindows();
-    for (int i = 0; i < list.size(); i++) {
-        if (list.at(i)->winId() == reinterpret_cast<WId>(handle)) {
-            w = list.at(i);
-            break;
-        }
-    }
-    return w;
+    return static_cast<QWindow *>(windowIndex.find(quintptr(handle)));
 }
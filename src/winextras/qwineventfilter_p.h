@@ -46,6 +46,8 @@
 #include <QAbstractNativeEventFilter>
 #include <qt_windows.h>
 
+#include "qwinwindowindex_p.h"
+
 QT_BEGIN_NAMESPACE
 
 class QWindow;
@@ -63,6 +65,7 @@ private:
     static QWinEventFilter *instance;
     QWindow *findWindow(HWND);
     UINT tbButtonCreatedMsgId;
+    QWinWindowIndex windowIndex;
 };
 
 QT_END_NAMESPACE
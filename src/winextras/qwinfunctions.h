@@ -47,6 +47,7 @@
 #endif
 
 #include <QtCore/qobject.h>
+#include <QtCore/qvariant.h>
 #include <QtCore/qt_windows.h>
 #include <QtWinExtras/qwinextrasglobal.h>
 #ifdef QT_WIDGETS_LIB
@@ -122,6 +123,12 @@ namespace QtWin
     Q_WINEXTRAS_EXPORT void taskbarAddTab(QWindow *);
     Q_WINEXTRAS_EXPORT void taskbarDeleteTab(QWindow *);
 
+    Q_WINEXTRAS_EXPORT void setShellMetricsEnabled(bool enabled);
+    Q_WINEXTRAS_EXPORT bool isShellMetricsEnabled();
+    Q_WINEXTRAS_EXPORT void resetShellMetrics();
+    Q_WINEXTRAS_EXPORT QVariantMap shellMetrics();
+    Q_WINEXTRAS_EXPORT QByteArray shellMetricsToJson();
+
 #ifdef QT_WIDGETS_LIB
     inline void setWindowExcludedFromPeek(QWidget *window, bool exclude)
     {
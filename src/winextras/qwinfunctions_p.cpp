@@ -40,6 +40,7 @@
  ****************************************************************************/
 
 #include "qwinfunctions_p.h"
+#include "qwinshellexecutor_p.h"
 
 #include <qt_windows.h>
 
@@ -179,4 +180,27 @@ void qt_winextras_init()
     }
 }
 
+class QWinDestroyIconJob : public QWinShellJob
+{
+public:
+    explicit QWinDestroyIconJob(quintptr icon) : m_icon(icon) {}
+
+    void run() Q_DECL_OVERRIDE
+    {
+        DestroyIcon(reinterpret_cast<HICON>(m_icon));
+    }
+
+private:
+    const quintptr m_icon;
+};
+
+/*
+    Destroys \a icon once the calls to the shell posted before have run, as
+    they may still use it.
+ */
+void qt_winDestroyIconOnShellThread(quintptr icon)
+{
+    qt_winShellExecutor()->post(new QWinDestroyIconJob(icon));
+}
+
 QT_END_NAMESPACE
@@ -48,6 +48,8 @@
 
 QT_BEGIN_NAMESPACE
 
+class QWinDwmState;
+
 enum qt_DWMWINDOWATTRIBUTE
 {
     qt_DWMWA_NCRENDERING_ENABLED = 1,
@@ -100,6 +102,9 @@ HRESULT qt_DwmEnableComposition(UINT enabled);
 HRESULT qt_SHCreateItemFromParsingName(PCWSTR, IBindCtx *, REFIID, void **);
 HRESULT qt_SetCurrentProcessExplicitAppUserModelID(PCWSTR appId);
 
+QWinDwmState *qt_winDwmState();
+void qt_winDestroyIconOnShellThread(quintptr icon);
+
 inline void qt_qstringToNullTerminated(const QString &src, wchar_t *dst)
 {
     dst[src.toWCharArray(dst)] = 0;
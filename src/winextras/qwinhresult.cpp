@@ -0,0 +1,1355 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinhresult_p.h"
+
+#include <QtCore/QMutex>
+#include <QtCore/QVector>
+
+#include <algorithm>
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+// Keep sorted by code, lookups are binary searches.
+const QWinHresultName qt_winHresultNames[] = {
+    { 0x00030200, "STG_S_CONVERTED" },
+    { 0x00030201, "STG_S_BLOCK" },
+    { 0x00030202, "STG_S_RETRYNOW" },
+    { 0x00030203, "STG_S_MONITORING" },
+    { 0x00030204, "STG_S_MULTIPLEOPENS" },
+    { 0x00030205, "STG_S_CONSOLIDATIONFAILED" },
+    { 0x00030206, "STG_S_CANNOTCONSOLIDATE" },
+    { 0x00040000, "OLE_S_USEREG" },
+    { 0x00040001, "OLE_S_STATIC" },
+    { 0x00040002, "OLE_S_MAC_CLIPFORMAT" },
+    { 0x00040100, "DRAGDROP_S_DROP" },
+    { 0x00040101, "DRAGDROP_S_CANCEL" },
+    { 0x00040102, "DRAGDROP_S_USEDEFAULTCURSORS" },
+    { 0x00040130, "DATA_S_SAMEFORMATETC" },
+    { 0x00040140, "VIEW_S_ALREADY_FROZEN" },
+    { 0x00040170, "CACHE_S_FORMATETC_NOTSUPPORTED" },
+    { 0x00040171, "CACHE_S_SAMECACHE" },
+    { 0x00040172, "CACHE_S_SOMECACHES_NOTUPDATED" },
+    { 0x00040180, "OLEOBJ_S_INVALIDVERB" },
+    { 0x00040181, "OLEOBJ_S_CANNOT_DOVERB_NOW" },
+    { 0x00040182, "OLEOBJ_S_INVALIDHWND" },
+    { 0x000401A0, "INPLACE_S_TRUNCATED" },
+    { 0x000401C0, "CONVERT10_S_NO_PRESENTATION" },
+    { 0x000401E2, "MK_S_REDUCED_TO_SELF" },
+    { 0x000401E4, "MK_S_ME" },
+    { 0x000401E5, "MK_S_HIM" },
+    { 0x000401E6, "MK_S_US" },
+    { 0x000401E7, "MK_S_MONIKERALREADYREGISTERED" },
+    { 0x00040200, "EVENT_S_SOME_SUBSCRIBERS_FAILED" },
+    { 0x00040202, "EVENT_S_NOSUBSCRIBERS" },
+    { 0x00041300, "SCHED_S_TASK_READY" },
+    { 0x00041301, "SCHED_S_TASK_RUNNING" },
+    { 0x00041302, "SCHED_S_TASK_DISABLED" },
+    { 0x00041303, "SCHED_S_TASK_HAS_NOT_RUN" },
+    { 0x00041304, "SCHED_S_TASK_NO_MORE_RUNS" },
+    { 0x00041305, "SCHED_S_TASK_NOT_SCHEDULED" },
+    { 0x00041306, "SCHED_S_TASK_TERMINATED" },
+    { 0x00041307, "SCHED_S_TASK_NO_VALID_TRIGGERS" },
+    { 0x00041308, "SCHED_S_EVENT_TRIGGER" },
+    { 0x0004D000, "XACT_S_ASYNC" },
+    { 0x0004D001, "XACT_S_DEFECT" },
+    { 0x0004D002, "XACT_S_READONLY" },
+    { 0x0004D003, "XACT_S_SOMENORETAIN" },
+    { 0x0004D004, "XACT_S_OKINFORM" },
+    { 0x0004D005, "XACT_S_MADECHANGESCONTENT" },
+    { 0x0004D006, "XACT_S_MADECHANGESINFORM" },
+    { 0x0004D007, "XACT_S_ALLNORETAIN" },
+    { 0x0004D008, "XACT_S_ABORTING" },
+    { 0x0004D009, "XACT_S_SINGLEPHASE" },
+    { 0x0004D00A, "XACT_S_LOCALLY_OK" },
+    { 0x0004D010, "XACT_S_LASTRESOURCEMANAGER" },
+    { 0x00080012, "CO_S_NOTALLINTERFACES" },
+    { 0x00080013, "CO_S_MACHINENAMENOTFOUND" },
+    { 0x00090312, "SEC_I_CONTINUE_NEEDED" },
+    { 0x00090313, "SEC_I_COMPLETE_NEEDED" },
+    { 0x00090314, "SEC_I_COMPLETE_AND_CONTINUE" },
+    { 0x00090315, "SEC_I_LOCAL_LOGON" },
+    { 0x00090317, "SEC_I_CONTEXT_EXPIRED" },
+    { 0x00090320, "SEC_I_INCOMPLETE_CREDENTIALS" },
+    { 0x00090321, "SEC_I_RENEGOTIATE" },
+    { 0x00090323, "SEC_I_NO_LSA_CONTEXT" },
+    { 0x00091012, "CRYPT_I_NEW_PROTECTION_REQUIRED" },
+    { 0x8000000A, "E_PENDING" },
+    { 0x80004001, "E_NOTIMPL" },
+    { 0x80004002, "E_NOINTERFACE" },
+    { 0x80004003, "E_POINTER" },
+    { 0x80004004, "E_ABORT" },
+    { 0x80004005, "E_FAIL" },
+    { 0x80004006, "CO_E_INIT_TLS" },
+    { 0x80004007, "CO_E_INIT_SHARED_ALLOCATOR" },
+    { 0x80004008, "CO_E_INIT_MEMORY_ALLOCATOR" },
+    { 0x80004009, "CO_E_INIT_CLASS_CACHE" },
+    { 0x8000400A, "CO_E_INIT_RPC_CHANNEL" },
+    { 0x8000400B, "CO_E_INIT_TLS_SET_CHANNEL_CONTROL" },
+    { 0x8000400C, "CO_E_INIT_TLS_CHANNEL_CONTROL" },
+    { 0x8000400D, "CO_E_INIT_UNACCEPTED_USER_ALLOCATOR" },
+    { 0x8000400E, "CO_E_INIT_SCM_MUTEX_EXISTS" },
+    { 0x8000400F, "CO_E_INIT_SCM_FILE_MAPPING_EXISTS" },
+    { 0x80004010, "CO_E_INIT_SCM_MAP_VIEW_OF_FILE" },
+    { 0x80004011, "CO_E_INIT_SCM_EXEC_FAILURE" },
+    { 0x80004012, "CO_E_INIT_ONLY_SINGLE_THREADED" },
+    { 0x80004013, "CO_E_CANT_REMOTE" },
+    { 0x80004014, "CO_E_BAD_SERVER_NAME" },
+    { 0x80004015, "CO_E_WRONG_SERVER_IDENTITY" },
+    { 0x80004016, "CO_E_OLE1DDE_DISABLED" },
+    { 0x80004017, "CO_E_RUNAS_SYNTAX" },
+    { 0x80004018, "CO_E_CREATEPROCESS_FAILURE" },
+    { 0x80004019, "CO_E_RUNAS_CREATEPROCESS_FAILURE" },
+    { 0x8000401A, "CO_E_RUNAS_LOGON_FAILURE" },
+    { 0x8000401B, "CO_E_LAUNCH_PERMSSION_DENIED" },
+    { 0x8000401C, "CO_E_START_SERVICE_FAILURE" },
+    { 0x8000401D, "CO_E_REMOTE_COMMUNICATION_FAILURE" },
+    { 0x8000401E, "CO_E_SERVER_START_TIMEOUT" },
+    { 0x8000401F, "CO_E_CLSREG_INCONSISTENT" },
+    { 0x80004020, "CO_E_IIDREG_INCONSISTENT" },
+    { 0x80004021, "CO_E_NOT_SUPPORTED" },
+    { 0x80004022, "CO_E_RELOAD_DLL" },
+    { 0x80004023, "CO_E_MSI_ERROR" },
+    { 0x80004024, "CO_E_ATTEMPT_TO_CREATE_OUTSIDE_CLIENT_CONTEXT" },
+    { 0x80004025, "CO_E_SERVER_PAUSED" },
+    { 0x80004026, "CO_E_SERVER_NOT_PAUSED" },
+    { 0x80004027, "CO_E_CLASS_DISABLED" },
+    { 0x80004028, "CO_E_CLRNOTAVAILABLE" },
+    { 0x80004029, "CO_E_ASYNC_WORK_REJECTED" },
+    { 0x8000402A, "CO_E_SERVER_INIT_TIMEOUT" },
+    { 0x8000402B, "CO_E_NO_SECCTX_IN_ACTIVATE" },
+    { 0x80004030, "CO_E_TRACKER_CONFIG" },
+    { 0x80004031, "CO_E_THREADPOOL_CONFIG" },
+    { 0x80004032, "CO_E_SXS_CONFIG" },
+    { 0x80004033, "CO_E_MALFORMED_SPN" },
+    { 0x8000FFFF, "E_UNEXPECTED" },
+    { 0x80010001, "RPC_E_CALL_REJECTED" },
+    { 0x80010002, "RPC_E_CALL_CANCELED" },
+    { 0x80010003, "RPC_E_CANTPOST_INSENDCALL" },
+    { 0x80010004, "RPC_E_CANTCALLOUT_INASYNCCALL" },
+    { 0x80010005, "RPC_E_CANTCALLOUT_INEXTERNALCALL" },
+    { 0x80010006, "RPC_E_CONNECTION_TERMINATED" },
+    { 0x80010007, "RPC_E_SERVER_DIED" },
+    { 0x80010008, "RPC_E_CLIENT_DIED" },
+    { 0x80010009, "RPC_E_INVALID_DATAPACKET" },
+    { 0x8001000A, "RPC_E_CANTTRANSMIT_CALL" },
+    { 0x8001000B, "RPC_E_CLIENT_CANTMARSHAL_DATA" },
+    { 0x8001000C, "RPC_E_CLIENT_CANTUNMARSHAL_DATA" },
+    { 0x8001000D, "RPC_E_SERVER_CANTMARSHAL_DATA" },
+    { 0x8001000E, "RPC_E_SERVER_CANTUNMARSHAL_DATA" },
+    { 0x8001000F, "RPC_E_INVALID_DATA" },
+    { 0x80010010, "RPC_E_INVALID_PARAMETER" },
+    { 0x80010011, "RPC_E_CANTCALLOUT_AGAIN" },
+    { 0x80010012, "RPC_E_SERVER_DIED_DNE" },
+    { 0x80010100, "RPC_E_SYS_CALL_FAILED" },
+    { 0x80010101, "RPC_E_OUT_OF_RESOURCES" },
+    { 0x80010102, "RPC_E_ATTEMPTED_MULTITHREAD" },
+    { 0x80010103, "RPC_E_NOT_REGISTERED" },
+    { 0x80010104, "RPC_E_FAULT" },
+    { 0x80010105, "RPC_E_SERVERFAULT" },
+    { 0x80010106, "RPC_E_CHANGED_MODE" },
+    { 0x80010107, "RPC_E_INVALIDMETHOD" },
+    { 0x80010108, "RPC_E_DISCONNECTED" },
+    { 0x80010109, "RPC_E_RETRY" },
+    { 0x8001010A, "RPC_E_SERVERCALL_RETRYLATER" },
+    { 0x8001010B, "RPC_E_SERVERCALL_REJECTED" },
+    { 0x8001010C, "RPC_E_INVALID_CALLDATA" },
+    { 0x8001010D, "RPC_E_CANTCALLOUT_ININPUTSYNCCALL" },
+    { 0x8001010E, "RPC_E_WRONG_THREAD" },
+    { 0x8001010F, "RPC_E_THREAD_NOT_INIT" },
+    { 0x80010110, "RPC_E_VERSION_MISMATCH" },
+    { 0x80010111, "RPC_E_INVALID_HEADER" },
+    { 0x80010112, "RPC_E_INVALID_EXTENSION" },
+    { 0x80010113, "RPC_E_INVALID_IPID" },
+    { 0x80010114, "RPC_E_INVALID_OBJECT" },
+    { 0x80010115, "RPC_S_CALLPENDING" },
+    { 0x80010116, "RPC_S_WAITONTIMER" },
+    { 0x80010117, "RPC_E_CALL_COMPLETE" },
+    { 0x80010118, "RPC_E_UNSECURE_CALL" },
+    { 0x80010119, "RPC_E_TOO_LATE" },
+    { 0x8001011A, "RPC_E_NO_GOOD_SECURITY_PACKAGES" },
+    { 0x8001011B, "RPC_E_ACCESS_DENIED" },
+    { 0x8001011C, "RPC_E_REMOTE_DISABLED" },
+    { 0x8001011D, "RPC_E_INVALID_OBJREF" },
+    { 0x8001011E, "RPC_E_NO_CONTEXT" },
+    { 0x8001011F, "RPC_E_TIMEOUT" },
+    { 0x80010120, "RPC_E_NO_SYNC" },
+    { 0x80010121, "RPC_E_FULLSIC_REQUIRED" },
+    { 0x80010122, "RPC_E_INVALID_STD_NAME" },
+    { 0x80010123, "CO_E_FAILEDTOIMPERSONATE" },
+    { 0x80010124, "CO_E_FAILEDTOGETSECCTX" },
+    { 0x80010125, "CO_E_FAILEDTOOPENTHREADTOKEN" },
+    { 0x80010126, "CO_E_FAILEDTOGETTOKENINFO" },
+    { 0x80010127, "CO_E_TRUSTEEDOESNTMATCHCLIENT" },
+    { 0x80010128, "CO_E_FAILEDTOQUERYCLIENTBLANKET" },
+    { 0x80010129, "CO_E_FAILEDTOSETDACL" },
+    { 0x8001012A, "CO_E_ACCESSCHECKFAILED" },
+    { 0x8001012B, "CO_E_NETACCESSAPIFAILED" },
+    { 0x8001012C, "CO_E_WRONGTRUSTEENAMESYNTAX" },
+    { 0x8001012D, "CO_E_INVALIDSID" },
+    { 0x8001012E, "CO_E_CONVERSIONFAILED" },
+    { 0x8001012F, "CO_E_NOMATCHINGSIDFOUND" },
+    { 0x80010130, "CO_E_LOOKUPACCSIDFAILED" },
+    { 0x80010131, "CO_E_NOMATCHINGNAMEFOUND" },
+    { 0x80010132, "CO_E_LOOKUPACCNAMEFAILED" },
+    { 0x80010133, "CO_E_SETSERLHNDLFAILED" },
+    { 0x80010134, "CO_E_FAILEDTOGETWINDIR" },
+    { 0x80010135, "CO_E_PATHTOOLONG" },
+    { 0x80010136, "CO_E_FAILEDTOGENUUID" },
+    { 0x80010137, "CO_E_FAILEDTOCREATEFILE" },
+    { 0x80010138, "CO_E_FAILEDTOCLOSEHANDLE" },
+    { 0x80010139, "CO_E_EXCEEDSYSACLLIMIT" },
+    { 0x8001013A, "CO_E_ACESINWRONGORDER" },
+    { 0x8001013B, "CO_E_INCOMPATIBLESTREAMVERSION" },
+    { 0x8001013C, "CO_E_FAILEDTOOPENPROCESSTOKEN" },
+    { 0x8001013D, "CO_E_DECODEFAILED" },
+    { 0x8001013F, "CO_E_ACNOTINITIALIZED" },
+    { 0x80010140, "CO_E_CANCEL_DISABLED" },
+    { 0x8001FFFF, "RPC_E_UNEXPECTED" },
+    { 0x80020001, "DISP_E_UNKNOWNINTERFACE" },
+    { 0x80020003, "DISP_E_MEMBERNOTFOUND" },
+    { 0x80020004, "DISP_E_PARAMNOTFOUND" },
+    { 0x80020005, "DISP_E_TYPEMISMATCH" },
+    { 0x80020006, "DISP_E_UNKNOWNNAME" },
+    { 0x80020007, "DISP_E_NONAMEDARGS" },
+    { 0x80020008, "DISP_E_BADVARTYPE" },
+    { 0x80020009, "DISP_E_EXCEPTION" },
+    { 0x8002000A, "DISP_E_OVERFLOW" },
+    { 0x8002000B, "DISP_E_BADINDEX" },
+    { 0x8002000C, "DISP_E_UNKNOWNLCID" },
+    { 0x8002000D, "DISP_E_ARRAYISLOCKED" },
+    { 0x8002000E, "DISP_E_BADPARAMCOUNT" },
+    { 0x8002000F, "DISP_E_PARAMNOTOPTIONAL" },
+    { 0x80020010, "DISP_E_BADCALLEE" },
+    { 0x80020011, "DISP_E_NOTACOLLECTION" },
+    { 0x80020012, "DISP_E_DIVBYZERO" },
+    { 0x80020013, "DISP_E_BUFFERTOOSMALL" },
+    { 0x80028016, "TYPE_E_BUFFERTOOSMALL" },
+    { 0x80028017, "TYPE_E_FIELDNOTFOUND" },
+    { 0x80028018, "TYPE_E_INVDATAREAD" },
+    { 0x80028019, "TYPE_E_UNSUPFORMAT" },
+    { 0x8002801C, "TYPE_E_REGISTRYACCESS" },
+    { 0x8002801D, "TYPE_E_LIBNOTREGISTERED" },
+    { 0x80028027, "TYPE_E_UNDEFINEDTYPE" },
+    { 0x80028028, "TYPE_E_QUALIFIEDNAMEDISALLOWED" },
+    { 0x80028029, "TYPE_E_INVALIDSTATE" },
+    { 0x8002802A, "TYPE_E_WRONGTYPEKIND" },
+    { 0x8002802B, "TYPE_E_ELEMENTNOTFOUND" },
+    { 0x8002802C, "TYPE_E_AMBIGUOUSNAME" },
+    { 0x8002802D, "TYPE_E_NAMECONFLICT" },
+    { 0x8002802E, "TYPE_E_UNKNOWNLCID" },
+    { 0x8002802F, "TYPE_E_DLLFUNCTIONNOTFOUND" },
+    { 0x800288BD, "TYPE_E_BADMODULEKIND" },
+    { 0x800288C5, "TYPE_E_SIZETOOBIG" },
+    { 0x800288C6, "TYPE_E_DUPLICATEID" },
+    { 0x800288CF, "TYPE_E_INVALIDID" },
+    { 0x80028CA0, "TYPE_E_TYPEMISMATCH" },
+    { 0x80028CA1, "TYPE_E_OUTOFBOUNDS" },
+    { 0x80028CA2, "TYPE_E_IOERROR" },
+    { 0x80028CA3, "TYPE_E_CANTCREATETMPFILE" },
+    { 0x80029C4A, "TYPE_E_CANTLOADLIBRARY" },
+    { 0x80029C83, "TYPE_E_INCONSISTENTPROPFUNCS" },
+    { 0x80029C84, "TYPE_E_CIRCULARTYPE" },
+    { 0x80030001, "STG_E_INVALIDFUNCTION" },
+    { 0x80030002, "STG_E_FILENOTFOUND" },
+    { 0x80030003, "STG_E_PATHNOTFOUND" },
+    { 0x80030004, "STG_E_TOOMANYOPENFILES" },
+    { 0x80030005, "STG_E_ACCESSDENIED" },
+    { 0x80030006, "STG_E_INVALIDHANDLE" },
+    { 0x80030008, "STG_E_INSUFFICIENTMEMORY" },
+    { 0x80030009, "STG_E_INVALIDPOINTER" },
+    { 0x80030012, "STG_E_NOMOREFILES" },
+    { 0x80030013, "STG_E_DISKISWRITEPROTECTED" },
+    { 0x80030019, "STG_E_SEEKERROR" },
+    { 0x8003001D, "STG_E_WRITEFAULT" },
+    { 0x8003001E, "STG_E_READFAULT" },
+    { 0x80030020, "STG_E_SHAREVIOLATION" },
+    { 0x80030021, "STG_E_LOCKVIOLATION" },
+    { 0x80030050, "STG_E_FILEALREADYEXISTS" },
+    { 0x80030057, "STG_E_INVALIDPARAMETER" },
+    { 0x80030070, "STG_E_MEDIUMFULL" },
+    { 0x800300F0, "STG_E_PROPSETMISMATCHED" },
+    { 0x800300FA, "STG_E_ABNORMALAPIEXIT" },
+    { 0x800300FB, "STG_E_INVALIDHEADER" },
+    { 0x800300FC, "STG_E_INVALIDNAME" },
+    { 0x800300FD, "STG_E_UNKNOWN" },
+    { 0x800300FE, "STG_E_UNIMPLEMENTEDFUNCTION" },
+    { 0x800300FF, "STG_E_INVALIDFLAG" },
+    { 0x80030100, "STG_E_INUSE" },
+    { 0x80030101, "STG_E_NOTCURRENT" },
+    { 0x80030102, "STG_E_REVERTED" },
+    { 0x80030103, "STG_E_CANTSAVE" },
+    { 0x80030104, "STG_E_OLDFORMAT" },
+    { 0x80030105, "STG_E_OLDDLL" },
+    { 0x80030106, "STG_E_SHAREREQUIRED" },
+    { 0x80030107, "STG_E_NOTFILEBASEDSTORAGE" },
+    { 0x80030108, "STG_E_EXTANTMARSHALLINGS" },
+    { 0x80030109, "STG_E_DOCFILECORRUPT" },
+    { 0x80030110, "STG_E_BADBASEADDRESS" },
+    { 0x80030111, "STG_E_DOCFILETOOLARGE" },
+    { 0x80030112, "STG_E_NOTSIMPLEFORMAT" },
+    { 0x80030201, "STG_E_INCOMPLETE" },
+    { 0x80030202, "STG_E_TERMINATED" },
+    { 0x80030305, "STG_E_STATUS_COPY_PROTECTION_FAILURE" },
+    { 0x80030306, "STG_E_CSS_AUTHENTICATION_FAILURE" },
+    { 0x80030307, "STG_E_CSS_KEY_NOT_PRESENT" },
+    { 0x80030308, "STG_E_CSS_KEY_NOT_ESTABLISHED" },
+    { 0x80030309, "STG_E_CSS_SCRAMBLED_SECTOR" },
+    { 0x8003030A, "STG_E_CSS_REGION_MISMATCH" },
+    { 0x8003030B, "STG_E_RESETS_EXHAUSTED" },
+    { 0x80040000, "OLE_E_OLEVERB" },
+    { 0x80040001, "OLE_E_ADVF" },
+    { 0x80040002, "OLE_E_ENUM_NOMORE" },
+    { 0x80040003, "OLE_E_ADVISENOTSUPPORTED" },
+    { 0x80040004, "OLE_E_NOCONNECTION" },
+    { 0x80040005, "OLE_E_NOTRUNNING" },
+    { 0x80040006, "OLE_E_NOCACHE" },
+    { 0x80040007, "OLE_E_BLANK" },
+    { 0x80040008, "OLE_E_CLASSDIFF" },
+    { 0x80040009, "OLE_E_CANT_GETMONIKER" },
+    { 0x8004000A, "OLE_E_CANT_BINDTOSOURCE" },
+    { 0x8004000B, "OLE_E_STATIC" },
+    { 0x8004000C, "OLE_E_PROMPTSAVECANCELLED" },
+    { 0x8004000D, "OLE_E_INVALIDRECT" },
+    { 0x8004000E, "OLE_E_WRONGCOMPOBJ" },
+    { 0x8004000F, "OLE_E_INVALIDHWND" },
+    { 0x80040010, "OLE_E_NOT_INPLACEACTIVE" },
+    { 0x80040011, "OLE_E_CANTCONVERT" },
+    { 0x80040012, "OLE_E_NOSTORAGE" },
+    { 0x80040064, "DV_E_FORMATETC" },
+    { 0x80040065, "DV_E_DVTARGETDEVICE" },
+    { 0x80040066, "DV_E_STGMEDIUM" },
+    { 0x80040067, "DV_E_STATDATA" },
+    { 0x80040068, "DV_E_LINDEX" },
+    { 0x80040069, "DV_E_TYMED" },
+    { 0x8004006A, "DV_E_CLIPFORMAT" },
+    { 0x8004006B, "DV_E_DVASPECT" },
+    { 0x8004006C, "DV_E_DVTARGETDEVICE_SIZE" },
+    { 0x8004006D, "DV_E_NOIVIEWOBJECT" },
+    { 0x80040100, "DRAGDROP_E_NOTREGISTERED" },
+    { 0x80040101, "DRAGDROP_E_ALREADYREGISTERED" },
+    { 0x80040102, "DRAGDROP_E_INVALIDHWND" },
+    { 0x80040110, "CLASS_E_NOAGGREGATION" },
+    { 0x80040111, "CLASS_E_CLASSNOTAVAILABLE" },
+    { 0x80040112, "CLASS_E_NOTLICENSED" },
+    { 0x80040140, "VIEW_E_DRAW" },
+    { 0x80040150, "REGDB_E_READREGDB" },
+    { 0x80040151, "REGDB_E_WRITEREGDB" },
+    { 0x80040152, "REGDB_E_KEYMISSING" },
+    { 0x80040153, "REGDB_E_INVALIDVALUE" },
+    { 0x80040154, "REGDB_E_CLASSNOTREG" },
+    { 0x80040155, "REGDB_E_IIDNOTREG" },
+    { 0x80040156, "REGDB_E_BADTHREADINGMODEL" },
+    { 0x80040160, "CAT_E_CATIDNOEXIST" },
+    { 0x80040161, "CAT_E_NODESCRIPTION" },
+    { 0x80040164, "CS_E_PACKAGE_NOTFOUND" },
+    { 0x80040165, "CS_E_NOT_DELETABLE" },
+    { 0x80040166, "CS_E_CLASS_NOTFOUND" },
+    { 0x80040167, "CS_E_INVALID_VERSION" },
+    { 0x80040168, "CS_E_NO_CLASSSTORE" },
+    { 0x80040169, "CS_E_OBJECT_NOTFOUND" },
+    { 0x8004016A, "CS_E_OBJECT_ALREADY_EXISTS" },
+    { 0x8004016B, "CS_E_INVALID_PATH" },
+    { 0x8004016C, "CS_E_NETWORK_ERROR" },
+    { 0x8004016D, "CS_E_ADMIN_LIMIT_EXCEEDED" },
+    { 0x8004016E, "CS_E_SCHEMA_MISMATCH" },
+    { 0x8004016F, "CS_E_INTERNAL_ERROR" },
+    { 0x80040170, "CACHE_E_NOCACHE_UPDATED" },
+    { 0x80040180, "OLEOBJ_E_NOVERBS" },
+    { 0x80040181, "OLEOBJ_E_INVALIDVERB" },
+    { 0x800401A0, "INPLACE_E_NOTUNDOABLE" },
+    { 0x800401A1, "INPLACE_E_NOTOOLSPACE" },
+    { 0x800401C0, "CONVERT10_E_OLESTREAM_GET" },
+    { 0x800401C1, "CONVERT10_E_OLESTREAM_PUT" },
+    { 0x800401C2, "CONVERT10_E_OLESTREAM_FMT" },
+    { 0x800401C3, "CONVERT10_E_OLESTREAM_BITMAP_TO_DIB" },
+    { 0x800401C4, "CONVERT10_E_STG_FMT" },
+    { 0x800401C5, "CONVERT10_E_STG_NO_STD_STREAM" },
+    { 0x800401C6, "CONVERT10_E_STG_DIB_TO_BITMAP" },
+    { 0x800401D0, "CLIPBRD_E_CANT_OPEN" },
+    { 0x800401D1, "CLIPBRD_E_CANT_EMPTY" },
+    { 0x800401D2, "CLIPBRD_E_CANT_SET" },
+    { 0x800401D3, "CLIPBRD_E_BAD_DATA" },
+    { 0x800401D4, "CLIPBRD_E_CANT_CLOSE" },
+    { 0x800401E0, "MK_E_CONNECTMANUALLY" },
+    { 0x800401E1, "MK_E_EXCEEDEDDEADLINE" },
+    { 0x800401E2, "MK_E_NEEDGENERIC" },
+    { 0x800401E3, "MK_E_UNAVAILABLE" },
+    { 0x800401E4, "MK_E_SYNTAX" },
+    { 0x800401E5, "MK_E_NOOBJECT" },
+    { 0x800401E6, "MK_E_INVALIDEXTENSION" },
+    { 0x800401E7, "MK_E_INTERMEDIATEINTERFACENOTSUPPORTED" },
+    { 0x800401E8, "MK_E_NOTBINDABLE" },
+    { 0x800401E9, "MK_E_NOTBOUND" },
+    { 0x800401EA, "MK_E_CANTOPENFILE" },
+    { 0x800401EB, "MK_E_MUSTBOTHERUSER" },
+    { 0x800401EC, "MK_E_NOINVERSE" },
+    { 0x800401ED, "MK_E_NOSTORAGE" },
+    { 0x800401EE, "MK_E_NOPREFIX" },
+    { 0x800401EF, "MK_E_ENUMERATION_FAILED" },
+    { 0x800401F0, "CO_E_NOTINITIALIZED" },
+    { 0x800401F1, "CO_E_ALREADYINITIALIZED" },
+    { 0x800401F2, "CO_E_CANTDETERMINECLASS" },
+    { 0x800401F3, "CO_E_CLASSSTRING" },
+    { 0x800401F4, "CO_E_IIDSTRING" },
+    { 0x800401F5, "CO_E_APPNOTFOUND" },
+    { 0x800401F6, "CO_E_APPSINGLEUSE" },
+    { 0x800401F7, "CO_E_ERRORINAPP" },
+    { 0x800401F8, "CO_E_DLLNOTFOUND" },
+    { 0x800401F9, "CO_E_ERRORINDLL" },
+    { 0x800401FA, "CO_E_WRONGOSFORAPP" },
+    { 0x800401FB, "CO_E_OBJNOTREG" },
+    { 0x800401FC, "CO_E_OBJISREG" },
+    { 0x800401FD, "CO_E_OBJNOTCONNECTED" },
+    { 0x800401FE, "CO_E_APPDIDNTREG" },
+    { 0x800401FF, "CO_E_RELEASED" },
+    { 0x80040201, "EVENT_E_ALL_SUBSCRIBERS_FAILED" },
+    { 0x80040203, "EVENT_E_QUERYSYNTAX" },
+    { 0x80040204, "EVENT_E_QUERYFIELD" },
+    { 0x80040205, "EVENT_E_INTERNALEXCEPTION" },
+    { 0x80040206, "EVENT_E_INTERNALERROR" },
+    { 0x80040207, "EVENT_E_INVALID_PER_USER_SID" },
+    { 0x80040208, "EVENT_E_USER_EXCEPTION" },
+    { 0x80040209, "EVENT_E_TOO_MANY_METHODS" },
+    { 0x8004020A, "EVENT_E_MISSING_EVENTCLASS" },
+    { 0x8004020B, "EVENT_E_NOT_ALL_REMOVED" },
+    { 0x8004020C, "EVENT_E_COMPLUS_NOT_INSTALLED" },
+    { 0x8004020D, "EVENT_E_CANT_MODIFY_OR_DELETE_UNCONFIGURED_OBJECT" },
+    { 0x8004020E, "EVENT_E_CANT_MODIFY_OR_DELETE_CONFIGURED_OBJECT" },
+    { 0x8004020F, "EVENT_E_INVALID_EVENT_CLASS_PARTITION" },
+    { 0x80040210, "EVENT_E_PER_USER_SID_NOT_LOGGED_ON" },
+    { 0x80041309, "SCHED_E_TRIGGER_NOT_FOUND" },
+    { 0x8004130A, "SCHED_E_TASK_NOT_READY" },
+    { 0x8004130B, "SCHED_E_TASK_NOT_RUNNING" },
+    { 0x8004130C, "SCHED_E_SERVICE_NOT_INSTALLED" },
+    { 0x8004130D, "SCHED_E_CANNOT_OPEN_TASK" },
+    { 0x8004130E, "SCHED_E_INVALID_TASK" },
+    { 0x8004130F, "SCHED_E_ACCOUNT_INFORMATION_NOT_SET" },
+    { 0x80041310, "SCHED_E_ACCOUNT_NAME_NOT_FOUND" },
+    { 0x80041311, "SCHED_E_ACCOUNT_DBASE_CORRUPT" },
+    { 0x80041312, "SCHED_E_NO_SECURITY_SERVICES" },
+    { 0x80041313, "SCHED_E_UNKNOWN_OBJECT_VERSION" },
+    { 0x80041314, "SCHED_E_UNSUPPORTED_ACCOUNT_OPTION" },
+    { 0x80041315, "SCHED_E_SERVICE_NOT_RUNNING" },
+    { 0x80042301, "VSS_E_BAD_STATE" },
+    { 0x80042302, "VSS_E_UNEXPECTED" },
+    { 0x80042304, "VSS_E_PROVIDER_NOT_REGISTERED" },
+    { 0x80042306, "VSS_E_PROVIDER_VETO" },
+    { 0x80042308, "VSS_E_OBJECT_NOT_FOUND" },
+    { 0x8004230C, "VSS_E_VOLUME_NOT_SUPPORTED" },
+    { 0x8004230D, "VSS_E_OBJECT_ALREADY_EXISTS" },
+    { 0x8004230E, "VSS_E_VOLUME_NOT_SUPPORTED_BY_PROVIDER" },
+    { 0x8004230F, "VSS_E_UNEXPECTED_PROVIDER_ERROR" },
+    { 0x80042311, "VSS_E_INVALID_XML_DOCUMENT" },
+    { 0x80042312, "VSS_E_MAXIMUM_NUMBER_OF_VOLUMES_REACHED" },
+    { 0x80042317, "VSS_E_MAXIMUM_NUMBER_OF_SNAPSHOTS_REACHED" },
+    { 0x8004232A, "VSS_E_UNSELECTED_VOLUME" },
+    { 0x8004232B, "VSS_E_SNAPSHOT_NOT_IN_SET" },
+    { 0x8004232C, "VSS_E_NESTED_VOLUME_LIMIT" },
+    { 0x800423F7, "VSS_E_LEGACY_PROVIDER" },
+    { 0x800423FE, "VSS_E_CANNOT_REVERT_DISKID" },
+    { 0x800423FF, "VSS_E_RESYNC_IN_PROGRESS" },
+    { 0x8004D000, "XACT_E_ALREADYOTHERSINGLEPHASE" },
+    { 0x8004D001, "XACT_E_CANTRETAIN" },
+    { 0x8004D002, "XACT_E_COMMITFAILED" },
+    { 0x8004D003, "XACT_E_COMMITPREVENTED" },
+    { 0x8004D004, "XACT_E_HEURISTICABORT" },
+    { 0x8004D005, "XACT_E_HEURISTICCOMMIT" },
+    { 0x8004D006, "XACT_E_HEURISTICDAMAGE" },
+    { 0x8004D007, "XACT_E_HEURISTICDANGER" },
+    { 0x8004D008, "XACT_E_ISOLATIONLEVEL" },
+    { 0x8004D009, "XACT_E_NOASYNC" },
+    { 0x8004D00A, "XACT_E_NOENLIST" },
+    { 0x8004D00B, "XACT_E_NOISORETAIN" },
+    { 0x8004D00C, "XACT_E_NORESOURCE" },
+    { 0x8004D00D, "XACT_E_NOTCURRENT" },
+    { 0x8004D00E, "XACT_E_NOTRANSACTION" },
+    { 0x8004D00F, "XACT_E_NOTSUPPORTED" },
+    { 0x8004D010, "XACT_E_UNKNOWNRMGRID" },
+    { 0x8004D011, "XACT_E_WRONGSTATE" },
+    { 0x8004D012, "XACT_E_WRONGUOW" },
+    { 0x8004D013, "XACT_E_XTIONEXISTS" },
+    { 0x8004D014, "XACT_E_NOIMPORTOBJECT" },
+    { 0x8004D015, "XACT_E_INVALIDCOOKIE" },
+    { 0x8004D016, "XACT_E_INDOUBT" },
+    { 0x8004D017, "XACT_E_NOTIMEOUT" },
+    { 0x8004D018, "XACT_E_ALREADYINPROGRESS" },
+    { 0x8004D019, "XACT_E_ABORTED" },
+    { 0x8004D01A, "XACT_E_LOGFULL" },
+    { 0x8004D01B, "XACT_E_TMNOTAVAILABLE" },
+    { 0x8004D01C, "XACT_E_CONNECTION_DOWN" },
+    { 0x8004D01D, "XACT_E_CONNECTION_DENIED" },
+    { 0x8004D01E, "XACT_E_REENLISTTIMEOUT" },
+    { 0x8004D01F, "XACT_E_TIP_CONNECT_FAILED" },
+    { 0x8004D020, "XACT_E_TIP_PROTOCOL_ERROR" },
+    { 0x8004D021, "XACT_E_TIP_PULL_FAILED" },
+    { 0x8004D022, "XACT_E_DEST_TMNOTAVAILABLE" },
+    { 0x8004D023, "XACT_E_TIP_DISABLED" },
+    { 0x8004D024, "XACT_E_NETWORK_TX_DISABLED" },
+    { 0x8004D025, "XACT_E_PARTNER_NETWORK_TX_DISABLED" },
+    { 0x8004D026, "XACT_E_XA_TX_DISABLED" },
+    { 0x8004D027, "XACT_E_UNABLE_TO_READ_DTC_CONFIG" },
+    { 0x8004D028, "XACT_E_UNABLE_TO_LOAD_DTC_PROXY" },
+    { 0x8004D029, "XACT_E_ABORTING" },
+    { 0x8004D080, "XACT_E_CLERKNOTFOUND" },
+    { 0x8004D081, "XACT_E_CLERKEXISTS" },
+    { 0x8004D082, "XACT_E_RECOVERYINPROGRESS" },
+    { 0x8004D083, "XACT_E_TRANSACTIONCLOSED" },
+    { 0x8004D084, "XACT_E_INVALIDLSN" },
+    { 0x8004D085, "XACT_E_REPLAYREQUEST" },
+    { 0x8004E002, "CONTEXT_E_ABORTED" },
+    { 0x8004E003, "CONTEXT_E_ABORTING" },
+    { 0x8004E004, "CONTEXT_E_NOCONTEXT" },
+    { 0x8004E005, "CONTEXT_E_WOULD_DEADLOCK" },
+    { 0x8004E006, "CONTEXT_E_SYNCH_TIMEOUT" },
+    { 0x8004E007, "CONTEXT_E_OLDREF" },
+    { 0x8004E00C, "CONTEXT_E_ROLENOTFOUND" },
+    { 0x8004E00F, "CONTEXT_E_TMNOTAVAILABLE" },
+    { 0x8004E021, "CO_E_ACTIVATIONFAILED" },
+    { 0x8004E022, "CO_E_ACTIVATIONFAILED_EVENTLOGGED" },
+    { 0x8004E023, "CO_E_ACTIVATIONFAILED_CATALOGERROR" },
+    { 0x8004E024, "CO_E_ACTIVATIONFAILED_TIMEOUT" },
+    { 0x8004E025, "CO_E_INITIALIZATIONFAILED" },
+    { 0x8004E026, "CONTEXT_E_NOJIT" },
+    { 0x8004E027, "CONTEXT_E_NOTRANSACTION" },
+    { 0x8004E028, "CO_E_THREADINGMODEL_CHANGED" },
+    { 0x8004E029, "CO_E_NOIISINTRINSICS" },
+    { 0x8004E02A, "CO_E_NOCOOKIES" },
+    { 0x8004E02B, "CO_E_DBERROR" },
+    { 0x8004E02C, "CO_E_NOTPOOLED" },
+    { 0x8004E02D, "CO_E_NOTCONSTRUCTED" },
+    { 0x8004E02E, "CO_E_NOSYNCHRONIZATION" },
+    { 0x8004E02F, "CO_E_ISOLEVELMISMATCH" },
+    { 0x80070005, "E_ACCESSDENIED" },
+    { 0x80070006, "E_HANDLE" },
+    { 0x8007000E, "E_OUTOFMEMORY" },
+    { 0x80070057, "E_INVALIDARG" },
+    { 0x80080001, "CO_E_CLASS_CREATE_FAILED" },
+    { 0x80080002, "CO_E_SCM_ERROR" },
+    { 0x80080003, "CO_E_SCM_RPC_FAILURE" },
+    { 0x80080004, "CO_E_BAD_PATH" },
+    { 0x80080005, "CO_E_SERVER_EXEC_FAILURE" },
+    { 0x80080006, "CO_E_OBJSRV_RPC_FAILURE" },
+    { 0x80080007, "MK_E_NO_NORMALIZED" },
+    { 0x80080008, "CO_E_SERVER_STOPPING" },
+    { 0x80080009, "MEM_E_INVALID_ROOT" },
+    { 0x80080010, "MEM_E_INVALID_LINK" },
+    { 0x80080011, "MEM_E_INVALID_SIZE" },
+    { 0x80090001, "NTE_BAD_UID" },
+    { 0x80090002, "NTE_BAD_HASH" },
+    { 0x80090003, "NTE_BAD_KEY" },
+    { 0x80090004, "NTE_BAD_LEN" },
+    { 0x80090005, "NTE_BAD_DATA" },
+    { 0x80090006, "NTE_BAD_SIGNATURE" },
+    { 0x80090007, "NTE_BAD_VER" },
+    { 0x80090008, "NTE_BAD_ALGID" },
+    { 0x80090009, "NTE_BAD_FLAGS" },
+    { 0x8009000A, "NTE_BAD_TYPE" },
+    { 0x8009000B, "NTE_BAD_KEY_STATE" },
+    { 0x8009000C, "NTE_BAD_HASH_STATE" },
+    { 0x8009000D, "NTE_NO_KEY" },
+    { 0x8009000E, "NTE_NO_MEMORY" },
+    { 0x8009000F, "NTE_EXISTS" },
+    { 0x80090010, "NTE_PERM" },
+    { 0x80090011, "NTE_NOT_FOUND" },
+    { 0x80090012, "NTE_DOUBLE_ENCRYPT" },
+    { 0x80090013, "NTE_BAD_PROVIDER" },
+    { 0x80090014, "NTE_BAD_PROV_TYPE" },
+    { 0x80090015, "NTE_BAD_PUBLIC_KEY" },
+    { 0x80090016, "NTE_BAD_KEYSET" },
+    { 0x80090017, "NTE_PROV_TYPE_NOT_DEF" },
+    { 0x80090018, "NTE_PROV_TYPE_ENTRY_BAD" },
+    { 0x80090019, "NTE_KEYSET_NOT_DEF" },
+    { 0x8009001A, "NTE_KEYSET_ENTRY_BAD" },
+    { 0x8009001B, "NTE_PROV_TYPE_NO_MATCH" },
+    { 0x8009001C, "NTE_SIGNATURE_FILE_BAD" },
+    { 0x8009001D, "NTE_PROVIDER_DLL_FAIL" },
+    { 0x8009001E, "NTE_PROV_DLL_NOT_FOUND" },
+    { 0x8009001F, "NTE_BAD_KEYSET_PARAM" },
+    { 0x80090020, "NTE_FAIL" },
+    { 0x80090021, "NTE_SYS_ERR" },
+    { 0x80090022, "NTE_SILENT_CONTEXT" },
+    { 0x80090023, "NTE_TOKEN_KEYSET_STORAGE_FULL" },
+    { 0x80090024, "NTE_TEMPORARY_PROFILE" },
+    { 0x80090025, "NTE_FIXEDPARAMETER" },
+    { 0x80090300, "SEC_E_INSUFFICIENT_MEMORY" },
+    { 0x80090301, "SEC_E_INVALID_HANDLE" },
+    { 0x80090302, "SEC_E_UNSUPPORTED_FUNCTION" },
+    { 0x80090303, "SEC_E_TARGET_UNKNOWN" },
+    { 0x80090304, "SEC_E_INTERNAL_ERROR" },
+    { 0x80090305, "SEC_E_SECPKG_NOT_FOUND" },
+    { 0x80090306, "SEC_E_NOT_OWNER" },
+    { 0x80090307, "SEC_E_CANNOT_INSTALL" },
+    { 0x80090308, "SEC_E_INVALID_TOKEN" },
+    { 0x80090309, "SEC_E_CANNOT_PACK" },
+    { 0x8009030A, "SEC_E_QOP_NOT_SUPPORTED" },
+    { 0x8009030B, "SEC_E_NO_IMPERSONATION" },
+    { 0x8009030C, "SEC_E_LOGON_DENIED" },
+    { 0x8009030D, "SEC_E_UNKNOWN_CREDENTIALS" },
+    { 0x8009030E, "SEC_E_NO_CREDENTIALS" },
+    { 0x8009030F, "SEC_E_MESSAGE_ALTERED" },
+    { 0x80090310, "SEC_E_OUT_OF_SEQUENCE" },
+    { 0x80090311, "SEC_E_NO_AUTHENTICATING_AUTHORITY" },
+    { 0x80090316, "SEC_E_BAD_PKGID" },
+    { 0x80090317, "SEC_E_CONTEXT_EXPIRED" },
+    { 0x80090318, "SEC_E_INCOMPLETE_MESSAGE" },
+    { 0x80090320, "SEC_E_INCOMPLETE_CREDENTIALS" },
+    { 0x80090321, "SEC_E_BUFFER_TOO_SMALL" },
+    { 0x80090322, "SEC_E_WRONG_PRINCIPAL" },
+    { 0x80090324, "SEC_E_TIME_SKEW" },
+    { 0x80090325, "SEC_E_UNTRUSTED_ROOT" },
+    { 0x80090326, "SEC_E_ILLEGAL_MESSAGE" },
+    { 0x80090327, "SEC_E_CERT_UNKNOWN" },
+    { 0x80090328, "SEC_E_CERT_EXPIRED" },
+    { 0x80090329, "SEC_E_ENCRYPT_FAILURE" },
+    { 0x80090330, "SEC_E_DECRYPT_FAILURE" },
+    { 0x80090331, "SEC_E_ALGORITHM_MISMATCH" },
+    { 0x80090332, "SEC_E_SECURITY_QOS_FAILED" },
+    { 0x80090333, "SEC_E_UNFINISHED_CONTEXT_DELETED" },
+    { 0x80090334, "SEC_E_NO_TGT_REPLY" },
+    { 0x80090335, "SEC_E_NO_IP_ADDRESSES" },
+    { 0x80090336, "SEC_E_WRONG_CREDENTIAL_HANDLE" },
+    { 0x80090337, "SEC_E_CRYPTO_SYSTEM_INVALID" },
+    { 0x80090338, "SEC_E_MAX_REFERRALS_EXCEEDED" },
+    { 0x80090339, "SEC_E_MUST_BE_KDC" },
+    { 0x8009033A, "SEC_E_STRONG_CRYPTO_NOT_SUPPORTED" },
+    { 0x8009033B, "SEC_E_TOO_MANY_PRINCIPALS" },
+    { 0x8009033C, "SEC_E_NO_PA_DATA" },
+    { 0x8009033D, "SEC_E_PKINIT_NAME_MISMATCH" },
+    { 0x8009033E, "SEC_E_SMARTCARD_LOGON_REQUIRED" },
+    { 0x8009033F, "SEC_E_SHUTDOWN_IN_PROGRESS" },
+    { 0x80090340, "SEC_E_KDC_INVALID_REQUEST" },
+    { 0x80090341, "SEC_E_KDC_UNABLE_TO_REFER" },
+    { 0x80090342, "SEC_E_KDC_UNKNOWN_ETYPE" },
+    { 0x80090343, "SEC_E_UNSUPPORTED_PREAUTH" },
+    { 0x80090345, "SEC_E_DELEGATION_REQUIRED" },
+    { 0x80090346, "SEC_E_BAD_BINDINGS" },
+    { 0x80090347, "SEC_E_MULTIPLE_ACCOUNTS" },
+    { 0x80090348, "SEC_E_NO_KERB_KEY" },
+    { 0x80090349, "SEC_E_CERT_WRONG_USAGE" },
+    { 0x80090350, "SEC_E_DOWNGRADE_DETECTED" },
+    { 0x80090351, "SEC_E_SMARTCARD_CERT_REVOKED" },
+    { 0x80090352, "SEC_E_ISSUING_CA_UNTRUSTED" },
+    { 0x80090353, "SEC_E_REVOCATION_OFFLINE_C" },
+    { 0x80090354, "SEC_E_PKINIT_CLIENT_FAILURE" },
+    { 0x80090355, "SEC_E_SMARTCARD_CERT_EXPIRED" },
+    { 0x80090356, "SEC_E_NO_S4U_PROT_SUPPORT" },
+    { 0x80090357, "SEC_E_CROSSREALM_DELEGATION_FAILURE" },
+    { 0x80090358, "SEC_E_REVOCATION_OFFLINE_KDC" },
+    { 0x80090359, "SEC_E_ISSUING_CA_UNTRUSTED_KDC" },
+    { 0x8009035A, "SEC_E_KDC_CERT_EXPIRED" },
+    { 0x8009035B, "SEC_E_KDC_CERT_REVOKED" },
+    { 0x80091001, "CRYPT_E_MSG_ERROR" },
+    { 0x80091002, "CRYPT_E_UNKNOWN_ALGO" },
+    { 0x80091003, "CRYPT_E_OID_FORMAT" },
+    { 0x80091004, "CRYPT_E_INVALID_MSG_TYPE" },
+    { 0x80091005, "CRYPT_E_UNEXPECTED_ENCODING" },
+    { 0x80091006, "CRYPT_E_AUTH_ATTR_MISSING" },
+    { 0x80091007, "CRYPT_E_HASH_VALUE" },
+    { 0x80091008, "CRYPT_E_INVALID_INDEX" },
+    { 0x80091009, "CRYPT_E_ALREADY_DECRYPTED" },
+    { 0x8009100A, "CRYPT_E_NOT_DECRYPTED" },
+    { 0x8009100B, "CRYPT_E_RECIPIENT_NOT_FOUND" },
+    { 0x8009100C, "CRYPT_E_CONTROL_TYPE" },
+    { 0x8009100D, "CRYPT_E_ISSUER_SERIALNUMBER" },
+    { 0x8009100E, "CRYPT_E_SIGNER_NOT_FOUND" },
+    { 0x8009100F, "CRYPT_E_ATTRIBUTES_MISSING" },
+    { 0x80091010, "CRYPT_E_STREAM_MSG_NOT_READY" },
+    { 0x80091011, "CRYPT_E_STREAM_INSUFFICIENT_DATA" },
+    { 0x80092001, "CRYPT_E_BAD_LEN" },
+    { 0x80092002, "CRYPT_E_BAD_ENCODE" },
+    { 0x80092003, "CRYPT_E_FILE_ERROR" },
+    { 0x80092004, "CRYPT_E_NOT_FOUND" },
+    { 0x80092005, "CRYPT_E_EXISTS" },
+    { 0x80092006, "CRYPT_E_NO_PROVIDER" },
+    { 0x80092007, "CRYPT_E_SELF_SIGNED" },
+    { 0x80092008, "CRYPT_E_DELETED_PREV" },
+    { 0x80092009, "CRYPT_E_NO_MATCH" },
+    { 0x8009200A, "CRYPT_E_UNEXPECTED_MSG_TYPE" },
+    { 0x8009200B, "CRYPT_E_NO_KEY_PROPERTY" },
+    { 0x8009200C, "CRYPT_E_NO_DECRYPT_CERT" },
+    { 0x8009200D, "CRYPT_E_BAD_MSG" },
+    { 0x8009200E, "CRYPT_E_NO_SIGNER" },
+    { 0x8009200F, "CRYPT_E_PENDING_CLOSE" },
+    { 0x80092010, "CRYPT_E_REVOKED" },
+    { 0x80092011, "CRYPT_E_NO_REVOCATION_DLL" },
+    { 0x80092012, "CRYPT_E_NO_REVOCATION_CHECK" },
+    { 0x80092013, "CRYPT_E_REVOCATION_OFFLINE" },
+    { 0x80092014, "CRYPT_E_NOT_IN_REVOCATION_DATABASE" },
+    { 0x80092020, "CRYPT_E_INVALID_NUMERIC_STRING" },
+    { 0x80092021, "CRYPT_E_INVALID_PRINTABLE_STRING" },
+    { 0x80092022, "CRYPT_E_INVALID_IA5_STRING" },
+    { 0x80092023, "CRYPT_E_INVALID_X500_STRING" },
+    { 0x80092024, "CRYPT_E_NOT_CHAR_STRING" },
+    { 0x80092025, "CRYPT_E_FILERESIZED" },
+    { 0x80092026, "CRYPT_E_SECURITY_SETTINGS" },
+    { 0x80092027, "CRYPT_E_NO_VERIFY_USAGE_DLL" },
+    { 0x80092028, "CRYPT_E_NO_VERIFY_USAGE_CHECK" },
+    { 0x80092029, "CRYPT_E_VERIFY_USAGE_OFFLINE" },
+    { 0x8009202A, "CRYPT_E_NOT_IN_CTL" },
+    { 0x8009202B, "CRYPT_E_NO_TRUSTED_SIGNER" },
+    { 0x8009202C, "CRYPT_E_MISSING_PUBKEY_PARA" },
+    { 0x80093000, "CRYPT_E_OSS_ERROR" },
+    { 0x80093001, "OSS_MORE_BUF" },
+    { 0x80093002, "OSS_NEGATIVE_UINTEGER" },
+    { 0x80093003, "OSS_PDU_RANGE" },
+    { 0x80093004, "OSS_MORE_INPUT" },
+    { 0x80093005, "OSS_DATA_ERROR" },
+    { 0x80093006, "OSS_BAD_ARG" },
+    { 0x80093007, "OSS_BAD_VERSION" },
+    { 0x80093008, "OSS_OUT_MEMORY" },
+    { 0x80093009, "OSS_PDU_MISMATCH" },
+    { 0x8009300A, "OSS_LIMITED" },
+    { 0x8009300B, "OSS_BAD_PTR" },
+    { 0x8009300C, "OSS_BAD_TIME" },
+    { 0x8009300D, "OSS_INDEFINITE_NOT_SUPPORTED" },
+    { 0x8009300E, "OSS_MEM_ERROR" },
+    { 0x8009300F, "OSS_BAD_TABLE" },
+    { 0x80093010, "OSS_TOO_LONG" },
+    { 0x80093011, "OSS_CONSTRAINT_VIOLATED" },
+    { 0x80093012, "OSS_FATAL_ERROR" },
+    { 0x80093013, "OSS_ACCESS_SERIALIZATION_ERROR" },
+    { 0x80093014, "OSS_NULL_TBL" },
+    { 0x80093015, "OSS_NULL_FCN" },
+    { 0x80093016, "OSS_BAD_ENCRULES" },
+    { 0x80093017, "OSS_UNAVAIL_ENCRULES" },
+    { 0x80093018, "OSS_CANT_OPEN_TRACE_WINDOW" },
+    { 0x80093019, "OSS_UNIMPLEMENTED" },
+    { 0x8009301A, "OSS_OID_DLL_NOT_LINKED" },
+    { 0x8009301B, "OSS_CANT_OPEN_TRACE_FILE" },
+    { 0x8009301C, "OSS_TRACE_FILE_ALREADY_OPEN" },
+    { 0x8009301D, "OSS_TABLE_MISMATCH" },
+    { 0x8009301E, "OSS_TYPE_NOT_SUPPORTED" },
+    { 0x8009301F, "OSS_REAL_DLL_NOT_LINKED" },
+    { 0x80093020, "OSS_REAL_CODE_NOT_LINKED" },
+    { 0x80093021, "OSS_OUT_OF_RANGE" },
+    { 0x80093022, "OSS_COPIER_DLL_NOT_LINKED" },
+    { 0x80093023, "OSS_CONSTRAINT_DLL_NOT_LINKED" },
+    { 0x80093024, "OSS_COMPARATOR_DLL_NOT_LINKED" },
+    { 0x80093025, "OSS_COMPARATOR_CODE_NOT_LINKED" },
+    { 0x80093026, "OSS_MEM_MGR_DLL_NOT_LINKED" },
+    { 0x80093027, "OSS_PDV_DLL_NOT_LINKED" },
+    { 0x80093028, "OSS_PDV_CODE_NOT_LINKED" },
+    { 0x80093029, "OSS_API_DLL_NOT_LINKED" },
+    { 0x8009302A, "OSS_BERDER_DLL_NOT_LINKED" },
+    { 0x8009302B, "OSS_PER_DLL_NOT_LINKED" },
+    { 0x8009302C, "OSS_OPEN_TYPE_ERROR" },
+    { 0x8009302D, "OSS_MUTEX_NOT_CREATED" },
+    { 0x8009302E, "OSS_CANT_CLOSE_TRACE_FILE" },
+    { 0x80093100, "CRYPT_E_ASN1_ERROR" },
+    { 0x80093101, "CRYPT_E_ASN1_INTERNAL" },
+    { 0x80093102, "CRYPT_E_ASN1_EOD" },
+    { 0x80093103, "CRYPT_E_ASN1_CORRUPT" },
+    { 0x80093104, "CRYPT_E_ASN1_LARGE" },
+    { 0x80093105, "CRYPT_E_ASN1_CONSTRAINT" },
+    { 0x80093106, "CRYPT_E_ASN1_MEMORY" },
+    { 0x80093107, "CRYPT_E_ASN1_OVERFLOW" },
+    { 0x80093108, "CRYPT_E_ASN1_BADPDU" },
+    { 0x80093109, "CRYPT_E_ASN1_BADARGS" },
+    { 0x8009310A, "CRYPT_E_ASN1_BADREAL" },
+    { 0x8009310B, "CRYPT_E_ASN1_BADTAG" },
+    { 0x8009310C, "CRYPT_E_ASN1_CHOICE" },
+    { 0x8009310D, "CRYPT_E_ASN1_RULE" },
+    { 0x8009310E, "CRYPT_E_ASN1_UTF8" },
+    { 0x80093133, "CRYPT_E_ASN1_PDU_TYPE" },
+    { 0x80093134, "CRYPT_E_ASN1_NYI" },
+    { 0x80093201, "CRYPT_E_ASN1_EXTENDED" },
+    { 0x80093202, "CRYPT_E_ASN1_NOEOD" },
+    { 0x80094001, "CERTSRV_E_BAD_REQUESTSUBJECT" },
+    { 0x80094002, "CERTSRV_E_NO_REQUEST" },
+    { 0x80094003, "CERTSRV_E_BAD_REQUESTSTATUS" },
+    { 0x80094004, "CERTSRV_E_PROPERTY_EMPTY" },
+    { 0x80094005, "CERTSRV_E_INVALID_CA_CERTIFICATE" },
+    { 0x80094006, "CERTSRV_E_SERVER_SUSPENDED" },
+    { 0x80094007, "CERTSRV_E_ENCODING_LENGTH" },
+    { 0x80094008, "CERTSRV_E_ROLECONFLICT" },
+    { 0x80094009, "CERTSRV_E_RESTRICTEDOFFICER" },
+    { 0x8009400A, "CERTSRV_E_KEY_ARCHIVAL_NOT_CONFIGURED" },
+    { 0x8009400B, "CERTSRV_E_NO_VALID_KRA" },
+    { 0x8009400C, "CERTSRV_E_BAD_REQUEST_KEY_ARCHIVAL" },
+    { 0x8009400D, "CERTSRV_E_NO_CAADMIN_DEFINED" },
+    { 0x8009400E, "CERTSRV_E_BAD_RENEWAL_CERT_ATTRIBUTE" },
+    { 0x8009400F, "CERTSRV_E_NO_DB_SESSIONS" },
+    { 0x80094010, "CERTSRV_E_ALIGNMENT_FAULT" },
+    { 0x80094011, "CERTSRV_E_ENROLL_DENIED" },
+    { 0x80094012, "CERTSRV_E_TEMPLATE_DENIED" },
+    { 0x80094013, "CERTSRV_E_DOWNLEVEL_DC_SSL_OR_UPGRADE" },
+    { 0x80094800, "CERTSRV_E_UNSUPPORTED_CERT_TYPE" },
+    { 0x80094801, "CERTSRV_E_NO_CERT_TYPE" },
+    { 0x80094802, "CERTSRV_E_TEMPLATE_CONFLICT" },
+    { 0x80094803, "CERTSRV_E_SUBJECT_ALT_NAME_REQUIRED" },
+    { 0x80094804, "CERTSRV_E_ARCHIVED_KEY_REQUIRED" },
+    { 0x80094805, "CERTSRV_E_SMIME_REQUIRED" },
+    { 0x80094806, "CERTSRV_E_BAD_RENEWAL_SUBJECT" },
+    { 0x80094807, "CERTSRV_E_BAD_TEMPLATE_VERSION" },
+    { 0x80094808, "CERTSRV_E_TEMPLATE_POLICY_REQUIRED" },
+    { 0x80094809, "CERTSRV_E_SIGNATURE_POLICY_REQUIRED" },
+    { 0x8009480A, "CERTSRV_E_SIGNATURE_COUNT" },
+    { 0x8009480B, "CERTSRV_E_SIGNATURE_REJECTED" },
+    { 0x8009480C, "CERTSRV_E_ISSUANCE_POLICY_REQUIRED" },
+    { 0x8009480D, "CERTSRV_E_SUBJECT_UPN_REQUIRED" },
+    { 0x8009480E, "CERTSRV_E_SUBJECT_DIRECTORY_GUID_REQUIRED" },
+    { 0x8009480F, "CERTSRV_E_SUBJECT_DNS_REQUIRED" },
+    { 0x80094810, "CERTSRV_E_ARCHIVED_KEY_UNEXPECTED" },
+    { 0x80094811, "CERTSRV_E_KEY_LENGTH" },
+    { 0x80094812, "CERTSRV_E_SUBJECT_EMAIL_REQUIRED" },
+    { 0x80094813, "CERTSRV_E_UNKNOWN_CERT_TYPE" },
+    { 0x80094814, "CERTSRV_E_CERT_TYPE_OVERLAP" },
+    { 0x80095000, "XENROLL_E_KEY_NOT_EXPORTABLE" },
+    { 0x80095001, "XENROLL_E_CANNOT_ADD_ROOT_CERT" },
+    { 0x80095002, "XENROLL_E_RESPONSE_KA_HASH_NOT_FOUND" },
+    { 0x80095003, "XENROLL_E_RESPONSE_UNEXPECTED_KA_HASH" },
+    { 0x80095004, "XENROLL_E_RESPONSE_KA_HASH_MISMATCH" },
+    { 0x80095005, "XENROLL_E_KEYSPEC_SMIME_MISMATCH" },
+    { 0x80096001, "TRUST_E_SYSTEM_ERROR" },
+    { 0x80096002, "TRUST_E_NO_SIGNER_CERT" },
+    { 0x80096003, "TRUST_E_COUNTER_SIGNER" },
+    { 0x80096004, "TRUST_E_CERT_SIGNATURE" },
+    { 0x80096005, "TRUST_E_TIME_STAMP" },
+    { 0x80096010, "TRUST_E_BAD_DIGEST" },
+    { 0x80096019, "TRUST_E_BASIC_CONSTRAINTS" },
+    { 0x8009601E, "TRUST_E_FINANCIAL_CRITERIA" },
+    { 0x80097001, "MSSIPOTF_E_OUTOFMEMRANGE" },
+    { 0x80097002, "MSSIPOTF_E_CANTGETOBJECT" },
+    { 0x80097003, "MSSIPOTF_E_NOHEADTABLE" },
+    { 0x80097004, "MSSIPOTF_E_BAD_MAGICNUMBER" },
+    { 0x80097005, "MSSIPOTF_E_BAD_OFFSET_TABLE" },
+    { 0x80097006, "MSSIPOTF_E_TABLE_TAGORDER" },
+    { 0x80097007, "MSSIPOTF_E_TABLE_LONGWORD" },
+    { 0x80097008, "MSSIPOTF_E_BAD_FIRST_TABLE_PLACEMENT" },
+    { 0x80097009, "MSSIPOTF_E_TABLES_OVERLAP" },
+    { 0x8009700A, "MSSIPOTF_E_TABLE_PADBYTES" },
+    { 0x8009700B, "MSSIPOTF_E_FILETOOSMALL" },
+    { 0x8009700C, "MSSIPOTF_E_TABLE_CHECKSUM" },
+    { 0x8009700D, "MSSIPOTF_E_FILE_CHECKSUM" },
+    { 0x80097010, "MSSIPOTF_E_FAILED_POLICY" },
+    { 0x80097011, "MSSIPOTF_E_FAILED_HINTS_CHECK" },
+    { 0x80097012, "MSSIPOTF_E_NOT_OPENTYPE" },
+    { 0x80097013, "MSSIPOTF_E_FILE" },
+    { 0x80097014, "MSSIPOTF_E_CRYPT" },
+    { 0x80097015, "MSSIPOTF_E_BADVERSION" },
+    { 0x80097016, "MSSIPOTF_E_DSIG_STRUCTURE" },
+    { 0x80097017, "MSSIPOTF_E_PCONST_CHECK" },
+    { 0x80097018, "MSSIPOTF_E_STRUCTURE" },
+    { 0x800B0001, "TRUST_E_PROVIDER_UNKNOWN" },
+    { 0x800B0002, "TRUST_E_ACTION_UNKNOWN" },
+    { 0x800B0003, "TRUST_E_SUBJECT_FORM_UNKNOWN" },
+    { 0x800B0004, "TRUST_E_SUBJECT_NOT_TRUSTED" },
+    { 0x800B0005, "DIGSIG_E_ENCODE" },
+    { 0x800B0006, "DIGSIG_E_DECODE" },
+    { 0x800B0007, "DIGSIG_E_EXTENSIBILITY" },
+    { 0x800B0008, "DIGSIG_E_CRYPTO" },
+    { 0x800B0009, "PERSIST_E_SIZEDEFINITE" },
+    { 0x800B000A, "PERSIST_E_SIZEINDEFINITE" },
+    { 0x800B000B, "PERSIST_E_NOTSELFSIZING" },
+    { 0x800B0100, "TRUST_E_NOSIGNATURE" },
+    { 0x800B0101, "CERT_E_EXPIRED" },
+    { 0x800B0102, "CERT_E_VALIDITYPERIODNESTING" },
+    { 0x800B0103, "CERT_E_ROLE" },
+    { 0x800B0104, "CERT_E_PATHLENCONST" },
+    { 0x800B0105, "CERT_E_CRITICAL" },
+    { 0x800B0106, "CERT_E_PURPOSE" },
+    { 0x800B0107, "CERT_E_ISSUERCHAINING" },
+    { 0x800B0108, "CERT_E_MALFORMED" },
+    { 0x800B0109, "CERT_E_UNTRUSTEDROOT" },
+    { 0x800B010A, "CERT_E_CHAINING" },
+    { 0x800B010B, "TRUST_E_FAIL" },
+    { 0x800B010C, "CERT_E_REVOKED" },
+    { 0x800B010D, "CERT_E_UNTRUSTEDTESTROOT" },
+    { 0x800B010E, "CERT_E_REVOCATION_FAILURE" },
+    { 0x800B010F, "CERT_E_CN_NO_MATCH" },
+    { 0x800B0110, "CERT_E_WRONG_USAGE" },
+    { 0x800B0111, "TRUST_E_EXPLICIT_DISTRUST" },
+    { 0x800B0112, "CERT_E_UNTRUSTEDCA" },
+    { 0x800B0113, "CERT_E_INVALID_POLICY" },
+    { 0x800B0114, "CERT_E_INVALID_NAME" },
+    { 0x800F0000, "SPAPI_E_EXPECTED_SECTION_NAME" },
+    { 0x800F0001, "SPAPI_E_BAD_SECTION_NAME_LINE" },
+    { 0x800F0002, "SPAPI_E_SECTION_NAME_TOO_LONG" },
+    { 0x800F0003, "SPAPI_E_GENERAL_SYNTAX" },
+    { 0x800F0100, "SPAPI_E_WRONG_INF_STYLE" },
+    { 0x800F0101, "SPAPI_E_SECTION_NOT_FOUND" },
+    { 0x800F0102, "SPAPI_E_LINE_NOT_FOUND" },
+    { 0x800F0103, "SPAPI_E_NO_BACKUP" },
+    { 0x800F0200, "SPAPI_E_NO_ASSOCIATED_CLASS" },
+    { 0x800F0201, "SPAPI_E_CLASS_MISMATCH" },
+    { 0x800F0202, "SPAPI_E_DUPLICATE_FOUND" },
+    { 0x800F0203, "SPAPI_E_NO_DRIVER_SELECTED" },
+    { 0x800F0204, "SPAPI_E_KEY_DOES_NOT_EXIST" },
+    { 0x800F0205, "SPAPI_E_INVALID_DEVINST_NAME" },
+    { 0x800F0206, "SPAPI_E_INVALID_CLASS" },
+    { 0x800F0207, "SPAPI_E_DEVINST_ALREADY_EXISTS" },
+    { 0x800F0208, "SPAPI_E_DEVINFO_NOT_REGISTERED" },
+    { 0x800F0209, "SPAPI_E_INVALID_REG_PROPERTY" },
+    { 0x800F020A, "SPAPI_E_NO_INF" },
+    { 0x800F020B, "SPAPI_E_NO_SUCH_DEVINST" },
+    { 0x800F020C, "SPAPI_E_CANT_LOAD_CLASS_ICON" },
+    { 0x800F020D, "SPAPI_E_INVALID_CLASS_INSTALLER" },
+    { 0x800F020E, "SPAPI_E_DI_DO_DEFAULT" },
+    { 0x800F020F, "SPAPI_E_DI_NOFILECOPY" },
+    { 0x800F0210, "SPAPI_E_INVALID_HWPROFILE" },
+    { 0x800F0211, "SPAPI_E_NO_DEVICE_SELECTED" },
+    { 0x800F0212, "SPAPI_E_DEVINFO_LIST_LOCKED" },
+    { 0x800F0213, "SPAPI_E_DEVINFO_DATA_LOCKED" },
+    { 0x800F0214, "SPAPI_E_DI_BAD_PATH" },
+    { 0x800F0215, "SPAPI_E_NO_CLASSINSTALL_PARAMS" },
+    { 0x800F0216, "SPAPI_E_FILEQUEUE_LOCKED" },
+    { 0x800F0217, "SPAPI_E_BAD_SERVICE_INSTALLSECT" },
+    { 0x800F0218, "SPAPI_E_NO_CLASS_DRIVER_LIST" },
+    { 0x800F0219, "SPAPI_E_NO_ASSOCIATED_SERVICE" },
+    { 0x800F021A, "SPAPI_E_NO_DEFAULT_DEVICE_INTERFACE" },
+    { 0x800F021B, "SPAPI_E_DEVICE_INTERFACE_ACTIVE" },
+    { 0x800F021C, "SPAPI_E_DEVICE_INTERFACE_REMOVED" },
+    { 0x800F021D, "SPAPI_E_BAD_INTERFACE_INSTALLSECT" },
+    { 0x800F021E, "SPAPI_E_NO_SUCH_INTERFACE_CLASS" },
+    { 0x800F021F, "SPAPI_E_INVALID_REFERENCE_STRING" },
+    { 0x800F0220, "SPAPI_E_INVALID_MACHINENAME" },
+    { 0x800F0221, "SPAPI_E_REMOTE_COMM_FAILURE" },
+    { 0x800F0222, "SPAPI_E_MACHINE_UNAVAILABLE" },
+    { 0x800F0223, "SPAPI_E_NO_CONFIGMGR_SERVICES" },
+    { 0x800F0224, "SPAPI_E_INVALID_PROPPAGE_PROVIDER" },
+    { 0x800F0225, "SPAPI_E_NO_SUCH_DEVICE_INTERFACE" },
+    { 0x800F0226, "SPAPI_E_DI_POSTPROCESSING_REQUIRED" },
+    { 0x800F0227, "SPAPI_E_INVALID_COINSTALLER" },
+    { 0x800F0228, "SPAPI_E_NO_COMPAT_DRIVERS" },
+    { 0x800F0229, "SPAPI_E_NO_DEVICE_ICON" },
+    { 0x800F022A, "SPAPI_E_INVALID_INF_LOGCONFIG" },
+    { 0x800F022B, "SPAPI_E_DI_DONT_INSTALL" },
+    { 0x800F022C, "SPAPI_E_INVALID_FILTER_DRIVER" },
+    { 0x800F022D, "SPAPI_E_NON_WINDOWS_NT_DRIVER" },
+    { 0x800F022E, "SPAPI_E_NON_WINDOWS_DRIVER" },
+    { 0x800F022F, "SPAPI_E_NO_CATALOG_FOR_OEM_INF" },
+    { 0x800F0230, "SPAPI_E_DEVINSTALL_QUEUE_NONNATIVE" },
+    { 0x800F0231, "SPAPI_E_NOT_DISABLEABLE" },
+    { 0x800F0232, "SPAPI_E_CANT_REMOVE_DEVINST" },
+    { 0x800F0233, "SPAPI_E_INVALID_TARGET" },
+    { 0x800F0234, "SPAPI_E_DRIVER_NONNATIVE" },
+    { 0x800F0235, "SPAPI_E_IN_WOW64" },
+    { 0x800F0236, "SPAPI_E_SET_SYSTEM_RESTORE_POINT" },
+    { 0x800F0237, "SPAPI_E_INCORRECTLY_COPIED_INF" },
+    { 0x800F0238, "SPAPI_E_SCE_DISABLED" },
+    { 0x800F0239, "SPAPI_E_UNKNOWN_EXCEPTION" },
+    { 0x800F023A, "SPAPI_E_PNP_REGISTRY_ERROR" },
+    { 0x800F023B, "SPAPI_E_REMOTE_REQUEST_UNSUPPORTED" },
+    { 0x800F023C, "SPAPI_E_NOT_AN_INSTALLED_OEM_INF" },
+    { 0x800F023D, "SPAPI_E_INF_IN_USE_BY_DEVICES" },
+    { 0x800F023E, "SPAPI_E_DI_FUNCTION_OBSOLETE" },
+    { 0x800F023F, "SPAPI_E_NO_AUTHENTICODE_CATALOG" },
+    { 0x800F0240, "SPAPI_E_AUTHENTICODE_DISALLOWED" },
+    { 0x800F0241, "SPAPI_E_AUTHENTICODE_TRUSTED_PUBLISHER" },
+    { 0x800F0242, "SPAPI_E_AUTHENTICODE_TRUST_NOT_ESTABLISHED" },
+    { 0x800F0243, "SPAPI_E_AUTHENTICODE_PUBLISHER_NOT_TRUSTED" },
+    { 0x800F0244, "SPAPI_E_SIGNATURE_OSATTRIBUTE_MISMATCH" },
+    { 0x800F0245, "SPAPI_E_ONLY_VALIDATE_VIA_AUTHENTICODE" },
+    { 0x800F0300, "SPAPI_E_UNRECOVERABLE_STACK_OVERFLOW" },
+    { 0x800F1000, "SPAPI_E_ERROR_NOT_INSTALLED" },
+    { 0x80100001, "SCARD_F_INTERNAL_ERROR" },
+    { 0x80100002, "SCARD_E_CANCELLED" },
+    { 0x80100003, "SCARD_E_INVALID_HANDLE" },
+    { 0x80100004, "SCARD_E_INVALID_PARAMETER" },
+    { 0x80100005, "SCARD_E_INVALID_TARGET" },
+    { 0x80100006, "SCARD_E_NO_MEMORY" },
+    { 0x80100007, "SCARD_F_WAITED_TOO_LONG" },
+    { 0x80100008, "SCARD_E_INSUFFICIENT_BUFFER" },
+    { 0x80100009, "SCARD_E_UNKNOWN_READER" },
+    { 0x8010000A, "SCARD_E_TIMEOUT" },
+    { 0x8010000B, "SCARD_E_SHARING_VIOLATION" },
+    { 0x8010000C, "SCARD_E_NO_SMARTCARD" },
+    { 0x8010000D, "SCARD_E_UNKNOWN_CARD" },
+    { 0x8010000E, "SCARD_E_CANT_DISPOSE" },
+    { 0x8010000F, "SCARD_E_PROTO_MISMATCH" },
+    { 0x80100010, "SCARD_E_NOT_READY" },
+    { 0x80100011, "SCARD_E_INVALID_VALUE" },
+    { 0x80100012, "SCARD_E_SYSTEM_CANCELLED" },
+    { 0x80100013, "SCARD_F_COMM_ERROR" },
+    { 0x80100014, "SCARD_F_UNKNOWN_ERROR" },
+    { 0x80100015, "SCARD_E_INVALID_ATR" },
+    { 0x80100016, "SCARD_E_NOT_TRANSACTED" },
+    { 0x80100017, "SCARD_E_READER_UNAVAILABLE" },
+    { 0x80100018, "SCARD_P_SHUTDOWN" },
+    { 0x80100019, "SCARD_E_PCI_TOO_SMALL" },
+    { 0x8010001A, "SCARD_E_READER_UNSUPPORTED" },
+    { 0x8010001B, "SCARD_E_DUPLICATE_READER" },
+    { 0x8010001C, "SCARD_E_CARD_UNSUPPORTED" },
+    { 0x8010001D, "SCARD_E_NO_SERVICE" },
+    { 0x8010001E, "SCARD_E_SERVICE_STOPPED" },
+    { 0x8010001F, "SCARD_E_UNEXPECTED" },
+    { 0x80100020, "SCARD_E_ICC_INSTALLATION" },
+    { 0x80100021, "SCARD_E_ICC_CREATEORDER" },
+    { 0x80100022, "SCARD_E_UNSUPPORTED_FEATURE" },
+    { 0x80100023, "SCARD_E_DIR_NOT_FOUND" },
+    { 0x80100024, "SCARD_E_FILE_NOT_FOUND" },
+    { 0x80100025, "SCARD_E_NO_DIR" },
+    { 0x80100026, "SCARD_E_NO_FILE" },
+    { 0x80100027, "SCARD_E_NO_ACCESS" },
+    { 0x80100028, "SCARD_E_WRITE_TOO_MANY" },
+    { 0x80100029, "SCARD_E_BAD_SEEK" },
+    { 0x8010002A, "SCARD_E_INVALID_CHV" },
+    { 0x8010002B, "SCARD_E_UNKNOWN_RES_MNG" },
+    { 0x8010002C, "SCARD_E_NO_SUCH_CERTIFICATE" },
+    { 0x8010002D, "SCARD_E_CERTIFICATE_UNAVAILABLE" },
+    { 0x8010002E, "SCARD_E_NO_READERS_AVAILABLE" },
+    { 0x8010002F, "SCARD_E_COMM_DATA_LOST" },
+    { 0x80100030, "SCARD_E_NO_KEY_CONTAINER" },
+    { 0x80100031, "SCARD_E_SERVER_TOO_BUSY" },
+    { 0x80100065, "SCARD_W_UNSUPPORTED_CARD" },
+    { 0x80100066, "SCARD_W_UNRESPONSIVE_CARD" },
+    { 0x80100067, "SCARD_W_UNPOWERED_CARD" },
+    { 0x80100068, "SCARD_W_RESET_CARD" },
+    { 0x80100069, "SCARD_W_REMOVED_CARD" },
+    { 0x8010006A, "SCARD_W_SECURITY_VIOLATION" },
+    { 0x8010006B, "SCARD_W_WRONG_CHV" },
+    { 0x8010006C, "SCARD_W_CHV_BLOCKED" },
+    { 0x8010006D, "SCARD_W_EOF" },
+    { 0x8010006E, "SCARD_W_CANCELLED_BY_USER" },
+    { 0x8010006F, "SCARD_W_CARD_NOT_AUTHENTICATED" },
+    { 0x80100070, "SCARD_W_CACHE_ITEM_NOT_FOUND" },
+    { 0x80100071, "SCARD_W_CACHE_ITEM_STALE" },
+    { 0x80110401, "COMADMIN_E_OBJECTERRORS" },
+    { 0x80110402, "COMADMIN_E_OBJECTINVALID" },
+    { 0x80110403, "COMADMIN_E_KEYMISSING" },
+    { 0x80110404, "COMADMIN_E_ALREADYINSTALLED" },
+    { 0x80110407, "COMADMIN_E_APP_FILE_WRITEFAIL" },
+    { 0x80110408, "COMADMIN_E_APP_FILE_READFAIL" },
+    { 0x80110409, "COMADMIN_E_APP_FILE_VERSION" },
+    { 0x8011040A, "COMADMIN_E_BADPATH" },
+    { 0x8011040B, "COMADMIN_E_APPLICATIONEXISTS" },
+    { 0x8011040C, "COMADMIN_E_ROLEEXISTS" },
+    { 0x8011040D, "COMADMIN_E_CANTCOPYFILE" },
+    { 0x8011040F, "COMADMIN_E_NOUSER" },
+    { 0x80110410, "COMADMIN_E_INVALIDUSERIDS" },
+    { 0x80110411, "COMADMIN_E_NOREGISTRYCLSID" },
+    { 0x80110412, "COMADMIN_E_BADREGISTRYPROGID" },
+    { 0x80110413, "COMADMIN_E_AUTHENTICATIONLEVEL" },
+    { 0x80110414, "COMADMIN_E_USERPASSWDNOTVALID" },
+    { 0x80110418, "COMADMIN_E_CLSIDORIIDMISMATCH" },
+    { 0x80110419, "COMADMIN_E_REMOTEINTERFACE" },
+    { 0x8011041A, "COMADMIN_E_DLLREGISTERSERVER" },
+    { 0x8011041B, "COMADMIN_E_NOSERVERSHARE" },
+    { 0x8011041D, "COMADMIN_E_DLLLOADFAILED" },
+    { 0x8011041E, "COMADMIN_E_BADREGISTRYLIBID" },
+    { 0x8011041F, "COMADMIN_E_APPDIRNOTFOUND" },
+    { 0x80110423, "COMADMIN_E_REGISTRARFAILED" },
+    { 0x80110424, "COMADMIN_E_COMPFILE_DOESNOTEXIST" },
+    { 0x80110425, "COMADMIN_E_COMPFILE_LOADDLLFAIL" },
+    { 0x80110426, "COMADMIN_E_COMPFILE_GETCLASSOBJ" },
+    { 0x80110427, "COMADMIN_E_COMPFILE_CLASSNOTAVAIL" },
+    { 0x80110428, "COMADMIN_E_COMPFILE_BADTLB" },
+    { 0x80110429, "COMADMIN_E_COMPFILE_NOTINSTALLABLE" },
+    { 0x8011042A, "COMADMIN_E_NOTCHANGEABLE" },
+    { 0x8011042B, "COMADMIN_E_NOTDELETEABLE" },
+    { 0x8011042C, "COMADMIN_E_SESSION" },
+    { 0x8011042D, "COMADMIN_E_COMP_MOVE_LOCKED" },
+    { 0x8011042E, "COMADMIN_E_COMP_MOVE_BAD_DEST" },
+    { 0x80110430, "COMADMIN_E_REGISTERTLB" },
+    { 0x80110433, "COMADMIN_E_SYSTEMAPP" },
+    { 0x80110434, "COMADMIN_E_COMPFILE_NOREGISTRAR" },
+    { 0x80110435, "COMADMIN_E_COREQCOMPINSTALLED" },
+    { 0x80110436, "COMADMIN_E_SERVICENOTINSTALLED" },
+    { 0x80110437, "COMADMIN_E_PROPERTYSAVEFAILED" },
+    { 0x80110438, "COMADMIN_E_OBJECTEXISTS" },
+    { 0x80110439, "COMADMIN_E_COMPONENTEXISTS" },
+    { 0x8011043B, "COMADMIN_E_REGFILE_CORRUPT" },
+    { 0x8011043C, "COMADMIN_E_PROPERTY_OVERFLOW" },
+    { 0x8011043E, "COMADMIN_E_NOTINREGISTRY" },
+    { 0x8011043F, "COMADMIN_E_OBJECTNOTPOOLABLE" },
+    { 0x80110446, "COMADMIN_E_APPLID_MATCHES_CLSID" },
+    { 0x80110447, "COMADMIN_E_ROLE_DOES_NOT_EXIST" },
+    { 0x80110448, "COMADMIN_E_START_APP_NEEDS_COMPONENTS" },
+    { 0x80110449, "COMADMIN_E_REQUIRES_DIFFERENT_PLATFORM" },
+    { 0x8011044A, "COMADMIN_E_CAN_NOT_EXPORT_APP_PROXY" },
+    { 0x8011044B, "COMADMIN_E_CAN_NOT_START_APP" },
+    { 0x8011044C, "COMADMIN_E_CAN_NOT_EXPORT_SYS_APP" },
+    { 0x8011044D, "COMADMIN_E_CANT_SUBSCRIBE_TO_COMPONENT" },
+    { 0x8011044E, "COMADMIN_E_EVENTCLASS_CANT_BE_SUBSCRIBER" },
+    { 0x8011044F, "COMADMIN_E_LIB_APP_PROXY_INCOMPATIBLE" },
+    { 0x80110450, "COMADMIN_E_BASE_PARTITION_ONLY" },
+    { 0x80110451, "COMADMIN_E_START_APP_DISABLED" },
+    { 0x80110457, "COMADMIN_E_CAT_DUPLICATE_PARTITION_NAME" },
+    { 0x80110458, "COMADMIN_E_CAT_INVALID_PARTITION_NAME" },
+    { 0x80110459, "COMADMIN_E_CAT_PARTITION_IN_USE" },
+    { 0x8011045A, "COMADMIN_E_FILE_PARTITION_DUPLICATE_FILES" },
+    { 0x8011045B, "COMADMIN_E_CAT_IMPORTED_COMPONENTS_NOT_ALLOWED" },
+    { 0x8011045C, "COMADMIN_E_AMBIGUOUS_APPLICATION_NAME" },
+    { 0x8011045D, "COMADMIN_E_AMBIGUOUS_PARTITION_NAME" },
+    { 0x80110472, "COMADMIN_E_REGDB_NOTINITIALIZED" },
+    { 0x80110473, "COMADMIN_E_REGDB_NOTOPEN" },
+    { 0x80110474, "COMADMIN_E_REGDB_SYSTEMERR" },
+    { 0x80110475, "COMADMIN_E_REGDB_ALREADYRUNNING" },
+    { 0x80110480, "COMADMIN_E_MIG_VERSIONNOTSUPPORTED" },
+    { 0x80110481, "COMADMIN_E_MIG_SCHEMANOTFOUND" },
+    { 0x80110482, "COMADMIN_E_CAT_BITNESSMISMATCH" },
+    { 0x80110483, "COMADMIN_E_CAT_UNACCEPTABLEBITNESS" },
+    { 0x80110484, "COMADMIN_E_CAT_WRONGAPPBITNESS" },
+    { 0x80110485, "COMADMIN_E_CAT_PAUSE_RESUME_NOT_SUPPORTED" },
+    { 0x80110486, "COMADMIN_E_CAT_SERVERFAULT" },
+    { 0x80110600, "COMQC_E_APPLICATION_NOT_QUEUED" },
+    { 0x80110601, "COMQC_E_NO_QUEUEABLE_INTERFACES" },
+    { 0x80110602, "COMQC_E_QUEUING_SERVICE_NOT_AVAILABLE" },
+    { 0x80110603, "COMQC_E_NO_IPERSISTSTREAM" },
+    { 0x80110604, "COMQC_E_BAD_MESSAGE" },
+    { 0x80110605, "COMQC_E_UNAUTHENTICATED" },
+    { 0x80110606, "COMQC_E_UNTRUSTED_ENQUEUER" },
+    { 0x80110701, "MSDTC_E_DUPLICATE_RESOURCE" },
+    { 0x80110808, "COMADMIN_E_OBJECT_PARENT_MISSING" },
+    { 0x80110809, "COMADMIN_E_OBJECT_DOES_NOT_EXIST" },
+    { 0x8011080A, "COMADMIN_E_APP_NOT_RUNNING" },
+    { 0x8011080B, "COMADMIN_E_INVALID_PARTITION" },
+    { 0x8011080D, "COMADMIN_E_SVCAPP_NOT_POOLABLE_OR_RECYCLABLE" },
+    { 0x8011080E, "COMADMIN_E_USER_IN_SET" },
+    { 0x8011080F, "COMADMIN_E_CANTRECYCLELIBRARYAPPS" },
+    { 0x80110811, "COMADMIN_E_CANTRECYCLESERVICEAPPS" },
+    { 0x80110812, "COMADMIN_E_PROCESSALREADYRECYCLED" },
+    { 0x80110813, "COMADMIN_E_PAUSEDPROCESSMAYNOTBERECYCLED" },
+    { 0x80110814, "COMADMIN_E_CANTMAKEINPROCSERVICE" },
+    { 0x80110815, "COMADMIN_E_PROGIDINUSEBYCLSID" },
+    { 0x80110816, "COMADMIN_E_DEFAULT_PARTITION_NOT_IN_SET" },
+    { 0x80110817, "COMADMIN_E_RECYCLEDPROCESSMAYNOTBEPAUSED" },
+    { 0x80110818, "COMADMIN_E_PARTITION_ACCESSDENIED" },
+    { 0x80110819, "COMADMIN_E_PARTITION_MSI_ONLY" },
+    { 0x8011081A, "COMADMIN_E_LEGACYCOMPS_NOT_ALLOWED_IN_1_0_FORMAT" },
+    { 0x8011081B, "COMADMIN_E_LEGACYCOMPS_NOT_ALLOWED_IN_NONBASE_PARTITIONS" },
+    { 0x8011081C, "COMADMIN_E_COMP_MOVE_SOURCE" },
+    { 0x8011081D, "COMADMIN_E_COMP_MOVE_DEST" },
+    { 0x8011081E, "COMADMIN_E_COMP_MOVE_PRIVATE" },
+    { 0x8011081F, "COMADMIN_E_BASEPARTITION_REQUIRED_IN_SET" },
+    { 0x80110820, "COMADMIN_E_CANNOT_ALIAS_EVENTCLASS" },
+    { 0x80110821, "COMADMIN_E_PRIVATE_ACCESSDENIED" },
+    { 0x80110822, "COMADMIN_E_SAFERINVALID" },
+    { 0x80110823, "COMADMIN_E_REGISTRY_ACCESSDENIED" },
+    { 0x80110824, "COMADMIN_E_PARTITIONS_DISABLED" },
+    { 0x80284001, "TBS_E_INTERNAL_ERROR" },
+    { 0x80284002, "TBS_E_BAD_PARAMETER" },
+    { 0x80284003, "TBS_E_INVALID_OUTPUT_POINTER" },
+    { 0x80284005, "TBS_E_INSUFFICIENT_BUFFER" },
+    { 0x80284006, "TBS_E_IOERROR" },
+    { 0x80284007, "TBS_E_INVALID_CONTEXT_PARAM" },
+    { 0x80284008, "TBS_E_SERVICE_NOT_RUNNING" },
+    { 0x80284009, "TBS_E_TOO_MANY_TBS_CONTEXTS" },
+    { 0x8028400B, "TBS_E_SERVICE_START_PENDING" },
+    { 0x8028400E, "TBS_E_BUFFER_TOO_LARGE" },
+    { 0x8028400F, "TBS_E_TPM_NOT_FOUND" },
+    { 0x80284010, "TBS_E_SERVICE_DISABLED" },
+    { 0x80284016, "TBS_E_DEACTIVATED" },
+    { 0x80320001, "FWP_E_CALLOUT_NOT_FOUND" },
+    { 0x80320002, "FWP_E_CONDITION_NOT_FOUND" },
+    { 0x80320003, "FWP_E_FILTER_NOT_FOUND" },
+    { 0x80320004, "FWP_E_LAYER_NOT_FOUND" },
+    { 0x80320005, "FWP_E_PROVIDER_NOT_FOUND" },
+    { 0x80320006, "FWP_E_PROVIDER_CONTEXT_NOT_FOUND" },
+    { 0x80320007, "FWP_E_SUBLAYER_NOT_FOUND" },
+    { 0x80320008, "FWP_E_NOT_FOUND" },
+    { 0x80320009, "FWP_E_ALREADY_EXISTS" },
+    { 0x8032000A, "FWP_E_IN_USE" },
+    { 0x8032000B, "FWP_E_DYNAMIC_SESSION_IN_PROGRESS" },
+    { 0x8032000C, "FWP_E_WRONG_SESSION" },
+    { 0x8032000D, "FWP_E_NO_TXN_IN_PROGRESS" },
+    { 0x8032000E, "FWP_E_TXN_IN_PROGRESS" },
+    { 0x8032000F, "FWP_E_TXN_ABORTED" },
+    { 0x80320010, "FWP_E_SESSION_ABORTED" },
+    { 0x80320011, "FWP_E_INCOMPATIBLE_TXN" },
+    { 0x80320012, "FWP_E_TIMEOUT" },
+    { 0x80320013, "FWP_E_NET_EVENTS_DISABLED" },
+    { 0x80320014, "FWP_E_INCOMPATIBLE_LAYER" },
+    { 0x80320015, "FWP_E_KM_CLIENTS_ONLY" },
+    { 0x80320016, "FWP_E_LIFETIME_MISMATCH" },
+    { 0x80320017, "FWP_E_BUILTIN_OBJECT" },
+    { 0x80320018, "FWP_E_TOO_MANY_CALLOUTS" },
+    { 0x80320019, "FWP_E_NOTIFICATION_DROPPED" },
+    { 0x8032001A, "FWP_E_TRAFFIC_MISMATCH" },
+    { 0x8032001B, "FWP_E_INCOMPATIBLE_SA_STATE" },
+    { 0x8032001C, "FWP_E_NULL_POINTER" },
+    { 0x8032001D, "FWP_E_INVALID_ENUMERATOR" },
+    { 0x8032001E, "FWP_E_INVALID_FLAGS" },
+    { 0x8032001F, "FWP_E_INVALID_NET_MASK" },
+    { 0x80320020, "FWP_E_INVALID_RANGE" },
+    { 0x80320021, "FWP_E_INVALID_INTERVAL" },
+    { 0x80320022, "FWP_E_ZERO_LENGTH_ARRAY" },
+    { 0x80320023, "FWP_E_NULL_DISPLAY_NAME" },
+    { 0x80320024, "FWP_E_INVALID_ACTION_TYPE" },
+    { 0x80320025, "FWP_E_INVALID_WEIGHT" },
+    { 0x80320026, "FWP_E_MATCH_TYPE_MISMATCH" },
+    { 0x80320027, "FWP_E_TYPE_MISMATCH" },
+    { 0x80320028, "FWP_E_OUT_OF_BOUNDS" },
+    { 0x80320029, "FWP_E_RESERVED" },
+    { 0x8032002A, "FWP_E_DUPLICATE_CONDITION" },
+    { 0x8032002B, "FWP_E_DUPLICATE_KEYMOD" },
+    { 0x8032002C, "FWP_E_ACTION_INCOMPATIBLE_WITH_LAYER" },
+    { 0x8032002D, "FWP_E_ACTION_INCOMPATIBLE_WITH_SUBLAYER" },
+    { 0x8032002E, "FWP_E_CONTEXT_INCOMPATIBLE_WITH_LAYER" },
+    { 0x8032002F, "FWP_E_CONTEXT_INCOMPATIBLE_WITH_CALLOUT" },
+    { 0x80320030, "FWP_E_INCOMPATIBLE_AUTH_METHOD" },
+    { 0x80320031, "FWP_E_INCOMPATIBLE_DH_GROUP" },
+    { 0x80320032, "FWP_E_EM_NOT_SUPPORTED" },
+    { 0x80320033, "FWP_E_NEVER_MATCH" },
+    { 0x80320034, "FWP_E_PROVIDER_CONTEXT_MISMATCH" },
+    { 0x80320035, "FWP_E_INVALID_PARAMETER" },
+    { 0x80320036, "FWP_E_TOO_MANY_SUBLAYERS" },
+    { 0x80320037, "FWP_E_CALLOUT_NOTIFICATION_FAILED" },
+    { 0x80320038, "FWP_E_INVALID_AUTH_TRANSFORM" },
+    { 0x80320039, "FWP_E_INVALID_CIPHER_TRANSFORM" },
+    { 0xC0090001, "ERROR_AUDITING_DISABLED" },
+    { 0xC0090002, "ERROR_ALL_SIDS_FILTERED" },
+};
+
+const int qt_winHresultNameCount = sizeof(qt_winHresultNames) / sizeof(qt_winHresultNames[0]);
+
+namespace {
+
+struct HresultCodeLessThan
+{
+    bool operator()(const QWinHresultName &lhs, const QWinHresultName &rhs) const
+    {
+        return lhs.code < rhs.code;
+    }
+    bool operator()(const QWinHresultName &lhs, quint32 rhs) const
+    {
+        return lhs.code < rhs;
+    }
+    bool operator()(quint32 lhs, const QWinHresultName &rhs) const
+    {
+        return lhs < rhs.code;
+    }
+};
+
+} // namespace
+
+/*
+    Returns the table entry for \a hresult, or 0 if it is unknown.
+ */
+const QWinHresultName *qt_winFindHresult(quint32 hresult)
+{
+    const QWinHresultName *end = qt_winHresultNames + qt_winHresultNameCount;
+    const QWinHresultName *entry = std::lower_bound(qt_winHresultNames, end, hresult, HresultCodeLessThan());
+    return (entry != end && entry->code == hresult) ? entry : 0;
+}
+
+namespace {
+
+// The names are converted to QString once and then shared by all callers,
+// the index sorted by name serves the reverse lookups.
+class QWinHresultNameCache
+{
+public:
+    QWinHresultNameCache();
+
+    QString name(int index);
+    const QWinHresultName *find(const QByteArray &name) const;
+
+private:
+    QMutex m_mutex;
+    QVector<QString> m_names;
+    QVector<quint16> m_byName;
+};
+
+struct HresultNameIndexLessThan
+{
+    bool operator()(quint16 lhs, quint16 rhs) const
+    {
+        return strcmp(qt_winHresultNames[lhs].name, qt_winHresultNames[rhs].name) < 0;
+    }
+    bool operator()(quint16 lhs, const char *rhs) const
+    {
+        return strcmp(qt_winHresultNames[lhs].name, rhs) < 0;
+    }
+    bool operator()(const char *lhs, quint16 rhs) const
+    {
+        return strcmp(lhs, qt_winHresultNames[rhs].name) < 0;
+    }
+};
+
+QWinHresultNameCache::QWinHresultNameCache()
+    : m_names(qt_winHresultNameCount)
+    , m_byName(qt_winHresultNameCount)
+{
+    for (int i = 0; i < qt_winHresultNameCount; ++i)
+        m_byName[i] = quint16(i);
+    std::sort(m_byName.begin(), m_byName.end(), HresultNameIndexLessThan());
+}
+
+QString QWinHresultNameCache::name(int index)
+{
+    QMutexLocker locker(&m_mutex);
+    QString &name = m_names[index];
+    if (name.isNull())
+        name = QString::fromLatin1(qt_winHresultNames[index].name);
+    return name;
+}
+
+const QWinHresultName *QWinHresultNameCache::find(const QByteArray &name) const
+{
+    const QVector<quint16>::const_iterator it =
+            std::lower_bound(m_byName.constBegin(), m_byName.constEnd(), name.constData(), HresultNameIndexLessThan());
+    if (it == m_byName.constEnd() || name != qt_winHresultNames[*it].name)
+        return 0;
+    return qt_winHresultNames + *it;
+}
+
+} // namespace
+
+Q_GLOBAL_STATIC(QWinHresultNameCache, hresultNameCache)
+
+/*
+    Returns the code name of \a hresult or a null string if it is unknown.
+ */
+QString qt_winHresultName(quint32 hresult)
+{
+    const QWinHresultName *entry = qt_winFindHresult(hresult);
+    if (!entry)
+        return QString();
+    return hresultNameCache()->name(int(entry - qt_winHresultNames));
+}
+
+/*
+    Looks up the HRESULT named \a name, such as "E_INVALIDARG".
+ */
+bool qt_winHresultFromName(const QString &name, quint32 *hresult)
+{
+    const QWinHresultName *entry = hresultNameCache()->find(name.toLatin1());
+    if (!entry)
+        return false;
+    if (hresult)
+        *hresult = entry->code;
+    return true;
+}
+
+QT_END_NAMESPACE
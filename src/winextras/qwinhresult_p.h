@@ -0,0 +1,83 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINHRESULT_P_H
+#define QWINHRESULT_P_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/QString>
+
+QT_BEGIN_NAMESPACE
+
+// The code names of the HRESULTs known to QtWin::errorStringFromHresult(),
+// as a table sorted by code.
+struct QWinHresultName
+{
+    quint32 code;
+    const char *name;
+};
+
+extern const QWinHresultName qt_winHresultNames[];
+extern const int qt_winHresultNameCount;
+
+const QWinHresultName *qt_winFindHresult(quint32 hresult);
+QString qt_winHresultName(quint32 hresult);
+bool qt_winHresultFromName(const QString &name, quint32 *hresult);
+
+// The fields of an HRESULT, see HRESULT_SEVERITY(), HRESULT_FACILITY() and HRESULT_CODE().
+inline bool qt_winHresultIsFailure(quint32 hresult)
+{
+    return (hresult >> 31) != 0;
+}
+
+inline int qt_winHresultFacility(quint32 hresult)
+{
+    return (hresult >> 16) & 0x1fff;
+}
+
+inline int qt_winHresultCode(quint32 hresult)
+{
+    return hresult & 0xffff;
+}
+
+QT_END_NAMESPACE
+
+#endif // QWINHRESULT_P_H
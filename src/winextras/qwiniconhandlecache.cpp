@@ -0,0 +1,133 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwiniconhandlecache_p.h"
+
+QT_BEGIN_NAMESPACE
+
+QWinIconHandleCache::QWinIconHandleCache(int capacity, DestroyFunction destroy) :
+    m_capacity(qMax(0, capacity)), m_destroy(destroy), m_hitCount(0), m_missCount(0)
+{
+    m_entries.reserve(m_capacity);
+}
+
+QWinIconHandleCache::~QWinIconHandleCache()
+{
+    clear();
+}
+
+int QWinIconHandleCache::indexOf(qint64 cacheKey, int size) const
+{
+    for (int i = 0; i < m_entries.size(); ++i) {
+        const Entry &entry = m_entries.at(i);
+        if (entry.cacheKey == cacheKey && entry.size == size)
+            return i;
+    }
+    return -1;
+}
+
+/*
+    Returns the handle cached for the icon with \a cacheKey at \a size and
+    marks it as the most recently used one, or returns 0. The handle stays
+    owned by the cache.
+ */
+quintptr QWinIconHandleCache::find(qint64 cacheKey, int size)
+{
+    const int index = indexOf(cacheKey, size);
+    if (index < 0) {
+        ++m_missCount;
+        return 0;
+    }
+    ++m_hitCount;
+    const Entry entry = m_entries.at(index);
+    if (index > 0) {
+        Entry *entries = m_entries.data();
+        for (int i = index; i > 0; --i)
+            entries[i] = entries[i - 1];
+        entries[0] = entry;
+    }
+    return entry.handle;
+}
+
+/*
+    Takes ownership of \a handle and caches it for the icon with \a cacheKey
+    at \a size, evicting the least recently used handle if the cache is full.
+    A handle cached for the same key before is destroyed.
+ */
+void QWinIconHandleCache::insert(qint64 cacheKey, int size, quintptr handle)
+{
+    if (!handle)
+        return;
+    const int index = indexOf(cacheKey, size);
+    if (index >= 0) {
+        if (m_entries.at(index).handle != handle)
+            m_destroy(m_entries.at(index).handle);
+        m_entries.remove(index);
+    }
+    if (m_capacity == 0) {
+        m_destroy(handle);
+        return;
+    }
+    trim(m_capacity - 1);
+    const Entry entry = { cacheKey, size, handle };
+    m_entries.prepend(entry);
+}
+
+void QWinIconHandleCache::clear()
+{
+    trim(0);
+}
+
+void QWinIconHandleCache::setCapacity(int capacity)
+{
+    m_capacity = qMax(0, capacity);
+    trim(m_capacity);
+}
+
+void QWinIconHandleCache::trim(int capacity)
+{
+    while (m_entries.size() > capacity) {
+        m_destroy(m_entries.last().handle);
+        m_entries.removeLast();
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,96 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINICONHANDLECACHE_P_H
+#define QWINICONHANDLECACHE_P_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/QVector>
+
+QT_BEGIN_NAMESPACE
+
+// A small least recently used cache of native icon handles, keyed by
+// QIcon::cacheKey() and the size the icon was rendered at. The cache owns
+// the handles and releases them through the destroy function, DestroyIcon
+// on Windows.
+class QWinIconHandleCache
+{
+public:
+    typedef void (*DestroyFunction)(quintptr handle);
+
+    QWinIconHandleCache(int capacity, DestroyFunction destroy);
+    ~QWinIconHandleCache();
+
+    quintptr find(qint64 cacheKey, int size);
+    void insert(qint64 cacheKey, int size, quintptr handle);
+    void clear();
+
+    int capacity() const { return m_capacity; }
+    void setCapacity(int capacity);
+    int count() const { return m_entries.size(); }
+
+    quint64 hitCount() const { return m_hitCount; }
+    quint64 missCount() const { return m_missCount; }
+
+private:
+    Q_DISABLE_COPY(QWinIconHandleCache)
+
+    struct Entry
+    {
+        qint64 cacheKey;
+        int size;
+        quintptr handle;
+    };
+
+    int indexOf(qint64 cacheKey, int size) const;
+    void trim(int capacity);
+
+    // most recently used first; the capacity is small enough for a linear search
+    QVector<Entry> m_entries;
+    int m_capacity;
+    DestroyFunction m_destroy;
+    quint64 m_hitCount;
+    quint64 m_missCount;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINICONHANDLECACHE_P_H
@@ -0,0 +1,214 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwiniconstore_p.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QLockFile>
+#include <QtCore/QSaveFile>
+#include <QtCore/QtEndian>
+#include <QtGui/QImage>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    The store lives in a directory of its own below \a directoryPath, which
+    is shared by all the instances of an application. Each store locks its
+    directory for as long as it exists, so that two instances never remove
+    the icons of each other; the directory of an instance that is gone is
+    taken over by the next store.
+
+    Icons are added with insert() and marked with reference() while a jump
+    list is built. Once the list is committed, commitReferences() records
+    them as the ones in use by the list of its AppID, and collectGarbage()
+    removes all files of the directory that no list refers to anymore,
+    including the leftovers of the instance that used it before.
+ */
+QWinIconStore::QWinIconStore(const QString &directoryPath) :
+    m_garbage(true), m_writeCount(0), m_reuseCount(0)
+{
+    QString root = directoryPath;
+    if (!root.endsWith(QLatin1Char('/')))
+        root += QLatin1Char('/');
+    QDir().mkpath(root);
+    for (int instance = 0; ; ++instance) {
+        const QString name = QString::number(instance);
+        QScopedPointer<QLockFile> lock(new QLockFile(root + name + QLatin1String(".lock")));
+        // a live instance keeps its lock however old it is
+        lock->setStaleLockTime(0);
+        if (lock->tryLock(0)) {
+            m_lock.swap(lock);
+            m_directoryPath = root + name + QLatin1Char('/');
+            return;
+        }
+        if (lock->error() != QLockFile::LockFailedError)
+            break;
+    }
+    // without a lock the files may belong to someone else, and are never removed
+    qWarning("QWinIconStore: Cannot lock a directory below %s.", qPrintable(QDir::toNativeSeparators(root)));
+    m_directoryPath = root;
+}
+
+QWinIconStore::~QWinIconStore()
+{
+}
+
+/*
+    Returns the file name for \a image: a hash of its size and its pixels in
+    ARGB32, so that equal icons map to the same file regardless of the format
+    or padding they were rendered with.
+ */
+QString QWinIconStore::fileName(const QImage &image)
+{
+    const QImage argb = image.convertToFormat(QImage::Format_ARGB32);
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    const quint32 size[2] = { qToLittleEndian(quint32(argb.width())), qToLittleEndian(quint32(argb.height())) };
+    hash.addData(reinterpret_cast<const char *>(size), sizeof(size));
+    const int bytesPerLine = argb.width() * 4;
+    for (int y = 0; y < argb.height(); ++y)
+        hash.addData(reinterpret_cast<const char *>(argb.constScanLine(y)), bytesPerLine);
+    return QString::fromLatin1(hash.result().toHex()) + QLatin1String(".ico");
+}
+
+/*
+    Returns the path of the file holding \a image, writing it if it does not
+    exist yet, or an empty string if it cannot be written. The file is
+    written to a temporary file first, so that a half written icon never
+    shows up under its final name.
+ */
+QString QWinIconStore::insert(const QImage &image)
+{
+    if (image.isNull())
+        return QString();
+
+    const QString path = m_directoryPath + fileName(image);
+    if (QFile::exists(path)) {
+        ++m_reuseCount;
+    } else {
+        QDir().mkpath(m_directoryPath);
+        QSaveFile file(path);
+        if (!file.open(QIODevice::WriteOnly) || !image.save(&file, "ico") || !file.commit())
+            return QString();
+        ++m_writeCount;
+    }
+    return path;
+}
+
+/*
+    Marks the icon at \a path as used by the list being built.
+ */
+void QWinIconStore::reference(const QString &path)
+{
+    m_pending.insert(path);
+}
+
+/*
+    Makes the icons referenced since the last commit the ones used by the list
+    of \a appId, replacing the ones of the list committed before for the same
+    AppID, as the shell does. \a owner is the committer of the list.
+ */
+void QWinIconStore::commitReferences(const QString &appId, const void *owner)
+{
+    References &references = m_references[appId];
+    references.owner = owner;
+    if (references.paths != m_pending) {
+        if (!(references.paths - m_pending).isEmpty())
+            m_garbage = true;
+        references.paths.swap(m_pending);
+    }
+    m_pending.clear();
+}
+
+void QWinIconStore::discardPending()
+{
+    if (!m_pending.isEmpty()) {
+        m_garbage = true;
+        m_pending.clear();
+    }
+}
+
+/*
+    Releases the icons of the list of \a appId, unless another committer than
+    \a owner has replaced that list since.
+ */
+void QWinIconStore::releaseReferences(const QString &appId, const void *owner)
+{
+    QHash<QString, References>::iterator it = m_references.find(appId);
+    if (it != m_references.end() && it->owner == owner) {
+        m_references.erase(it);
+        m_garbage = true;
+    }
+}
+
+/*
+    Removes the icon files nobody refers to and returns how many were removed.
+    Files that cannot be removed, for example because the shell has them
+    open, are tried again on the next collection. Nothing is removed from a
+    directory the store could not lock.
+ */
+int QWinIconStore::collectGarbage()
+{
+    if (!m_garbage || !m_lock)
+        return 0;
+
+    QSet<QString> referenced = m_pending;
+    foreach (const References &references, m_references)
+        referenced.unite(references.paths);
+
+    int removed = 0;
+    bool failed = false;
+    QDir directory(m_directoryPath);
+    const QStringList files = directory.entryList(QStringList(QStringLiteral("*.ico")), QDir::Files);
+    foreach (const QString &file, files) {
+        if (referenced.contains(m_directoryPath + file))
+            continue;
+        if (directory.remove(file))
+            ++removed;
+        else
+            failed = true;
+    }
+    m_garbage = failed;
+    return removed;
+}
+
+QT_END_NAMESPACE
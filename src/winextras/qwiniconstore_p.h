@@ -0,0 +1,101 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINICONSTORE_P_H
+#define QWINICONSTORE_P_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/QHash>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+
+QT_BEGIN_NAMESPACE
+
+class QImage;
+class QLockFile;
+
+// A directory of .ico files named after a hash of their pixels, so that an
+// icon is only written once no matter how often it is referenced. Every
+// instance of an application has a directory of its own.
+class QWinIconStore
+{
+public:
+    explicit QWinIconStore(const QString &directoryPath);
+    ~QWinIconStore();
+
+    QString directoryPath() const { return m_directoryPath; }
+
+    static QString fileName(const QImage &image);
+
+    QString insert(const QImage &image);
+    void reference(const QString &path);
+    void commitReferences(const QString &appId, const void *owner);
+    void discardPending();
+    void releaseReferences(const QString &appId, const void *owner);
+    int collectGarbage();
+
+    int writeCount() const { return m_writeCount; }
+    int reuseCount() const { return m_reuseCount; }
+
+private:
+    Q_DISABLE_COPY(QWinIconStore)
+
+    QString m_directoryPath;
+    QScopedPointer<QLockFile> m_lock;
+    struct References
+    {
+        References() : owner(0) {}
+
+        const void *owner;
+        QSet<QString> paths;
+    };
+
+    QSet<QString> m_pending;
+    QHash<QString, References> m_references;
+    bool m_garbage;
+    int m_writeCount;
+    int m_reuseCount;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINICONSTORE_P_H
@@ -0,0 +1,254 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwininstrumentedshellbackend_p.h"
+#include "qwinshellmetrics_p.h"
+
+#include <QtCore/QElapsedTimer>
+
+QT_BEGIN_NAMESPACE
+
+// Recorded for the functions creating objects when they return none.
+static const qint32 failedResult = qint32(0x80004005);  // E_FAIL
+
+namespace {
+
+// Times a call if the metrics are enabled when it starts.
+class Measurement
+{
+public:
+    Measurement(QWinShellMetrics *metrics, QWinShellBackend::Call call) :
+        m_metrics(metrics->isEnabled() ? metrics : 0), m_call(call)
+    {
+        if (m_metrics)
+            m_timer.start();
+    }
+
+    qint32 result(qint32 hresult)
+    {
+        if (m_metrics)
+            m_metrics->record(m_call, hresult, m_timer.nsecsElapsed());
+        return hresult;
+    }
+
+    QWinShellBackend::Object object(QWinShellBackend::Object created)
+    {
+        result(created ? 0 : failedResult);
+        return created;
+    }
+
+    void done()
+    {
+        result(0);
+    }
+
+private:
+    QWinShellMetrics *m_metrics;
+    QWinShellBackend::Call m_call;
+    QElapsedTimer m_timer;
+};
+
+} // namespace
+
+QWinInstrumentedShellBackend::QWinInstrumentedShellBackend(QWinShellBackend *backend, QWinShellMetrics *metrics) :
+    m_backend(backend), m_metrics(metrics)
+{
+}
+
+qint32 QWinInstrumentedShellBackend::setProgressValue(quintptr window, quint64 completed, quint64 total)
+{
+    Measurement measurement(m_metrics, SetProgressValue);
+    return measurement.result(m_backend->setProgressValue(window, completed, total));
+}
+
+qint32 QWinInstrumentedShellBackend::setProgressState(quintptr window, QWinTaskbarProgressState state)
+{
+    Measurement measurement(m_metrics, SetProgressState);
+    return measurement.result(m_backend->setProgressState(window, state));
+}
+
+qint32 QWinInstrumentedShellBackend::setOverlayIcon(quintptr window, quintptr icon, const QString &description)
+{
+    Measurement measurement(m_metrics, SetOverlayIcon);
+    return measurement.result(m_backend->setOverlayIcon(window, icon, description));
+}
+
+qint32 QWinInstrumentedShellBackend::addThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count)
+{
+    Measurement measurement(m_metrics, AddThumbnailButtons);
+    return measurement.result(m_backend->addThumbnailButtons(window, buttons, count));
+}
+
+qint32 QWinInstrumentedShellBackend::updateThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count)
+{
+    Measurement measurement(m_metrics, UpdateThumbnailButtons);
+    return measurement.result(m_backend->updateThumbnailButtons(window, buttons, count));
+}
+
+qint32 QWinInstrumentedShellBackend::beginList(const QString &appId)
+{
+    Measurement measurement(m_metrics, BeginList);
+    return measurement.result(m_backend->beginList(appId));
+}
+
+qint32 QWinInstrumentedShellBackend::appendKnownCategory(KnownCategory category)
+{
+    Measurement measurement(m_metrics, AppendKnownCategory);
+    return measurement.result(m_backend->appendKnownCategory(category));
+}
+
+qint32 QWinInstrumentedShellBackend::appendCategory(const QString &title, Object collection)
+{
+    Measurement measurement(m_metrics, AppendCategory);
+    return measurement.result(m_backend->appendCategory(title, collection));
+}
+
+qint32 QWinInstrumentedShellBackend::addUserTasks(Object collection)
+{
+    Measurement measurement(m_metrics, AddUserTasks);
+    return measurement.result(m_backend->addUserTasks(collection));
+}
+
+qint32 QWinInstrumentedShellBackend::commitList()
+{
+    Measurement measurement(m_metrics, CommitList);
+    return measurement.result(m_backend->commitList());
+}
+
+QWinShellBackend::Object QWinInstrumentedShellBackend::createLink(const QWinJumpListItemSnapshot &item, const QString &iconPath)
+{
+    Measurement measurement(m_metrics, CreateLink);
+    return measurement.object(m_backend->createLink(item, iconPath));
+}
+
+QWinShellBackend::Object QWinInstrumentedShellBackend::createDestination(const QString &filePath)
+{
+    Measurement measurement(m_metrics, CreateDestination);
+    return measurement.object(m_backend->createDestination(filePath));
+}
+
+QWinShellBackend::Object QWinInstrumentedShellBackend::createSeparator()
+{
+    Measurement measurement(m_metrics, CreateSeparator);
+    return measurement.object(m_backend->createSeparator());
+}
+
+QWinShellBackend::Object QWinInstrumentedShellBackend::createCollection(const Object *objects, int count)
+{
+    Measurement measurement(m_metrics, CreateCollection);
+    return measurement.object(m_backend->createCollection(objects, count));
+}
+
+void QWinInstrumentedShellBackend::addRef(Object object)
+{
+    Measurement measurement(m_metrics, AddRef);
+    m_backend->addRef(object);
+    measurement.done();
+}
+
+void QWinInstrumentedShellBackend::release(Object object)
+{
+    Measurement measurement(m_metrics, Release);
+    m_backend->release(object);
+    measurement.done();
+}
+
+qint32 QWinInstrumentedShellBackend::documents(const QString &appId, DocumentList list, QVector<QWinShellDocument> *documents)
+{
+    Measurement measurement(m_metrics, Documents);
+    return measurement.result(m_backend->documents(appId, list, documents));
+}
+
+qint32 QWinInstrumentedShellBackend::addRecentDocument(const QString &appId, const QWinJumpListItemSnapshot &item, const QString &iconPath)
+{
+    Measurement measurement(m_metrics, AddRecentDocument);
+    return measurement.result(m_backend->addRecentDocument(appId, item, iconPath));
+}
+
+qint32 QWinInstrumentedShellBackend::clearDocuments(const QString &appId)
+{
+    Measurement measurement(m_metrics, ClearDocuments);
+    return measurement.result(m_backend->clearDocuments(appId));
+}
+
+qint32 QWinInstrumentedShellBackend::setWindowAttribute(quintptr window, quint32 attribute, const void *value, quint32 size)
+{
+    Measurement measurement(m_metrics, SetWindowAttribute);
+    return measurement.result(m_backend->setWindowAttribute(window, attribute, value, size));
+}
+
+qint32 QWinInstrumentedShellBackend::windowAttribute(quintptr window, quint32 attribute, void *value, quint32 size)
+{
+    Measurement measurement(m_metrics, WindowAttribute);
+    return measurement.result(m_backend->windowAttribute(window, attribute, value, size));
+}
+
+qint32 QWinInstrumentedShellBackend::extendFrameIntoClientArea(quintptr window, int left, int top, int right, int bottom)
+{
+    Measurement measurement(m_metrics, ExtendFrameIntoClientArea);
+    return measurement.result(m_backend->extendFrameIntoClientArea(window, left, top, right, bottom));
+}
+
+qint32 QWinInstrumentedShellBackend::enableBlurBehindWindow(quintptr window, bool enable, quintptr region)
+{
+    Measurement measurement(m_metrics, EnableBlurBehindWindow);
+    return measurement.result(m_backend->enableBlurBehindWindow(window, enable, region));
+}
+
+qint32 QWinInstrumentedShellBackend::isCompositionEnabled(bool *enabled)
+{
+    Measurement measurement(m_metrics, IsCompositionEnabled);
+    return measurement.result(m_backend->isCompositionEnabled(enabled));
+}
+
+qint32 QWinInstrumentedShellBackend::enableComposition(bool enable)
+{
+    Measurement measurement(m_metrics, EnableComposition);
+    return measurement.result(m_backend->enableComposition(enable));
+}
+
+qint32 QWinInstrumentedShellBackend::colorizationColor(quint32 *argb, bool *opaqueBlend)
+{
+    Measurement measurement(m_metrics, ColorizationColor);
+    return measurement.result(m_backend->colorizationColor(argb, opaqueBlend));
+}
+
+QT_END_NAMESPACE
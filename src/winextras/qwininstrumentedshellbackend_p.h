@@ -0,0 +1,102 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWININSTRUMENTEDSHELLBACKEND_P_H
+#define QWININSTRUMENTEDSHELLBACKEND_P_H
+
+#include "qwinshellbackend_p.h"
+
+QT_BEGIN_NAMESPACE
+
+class QWinShellMetrics;
+
+// Passes every call on to another backend, and records it in the metrics
+// while they are enabled. While they are not, a call costs one more virtual
+// call and the load of a flag.
+class Q_WINEXTRAS_EXPORT QWinInstrumentedShellBackend : public QWinShellBackend
+{
+public:
+    QWinInstrumentedShellBackend(QWinShellBackend *backend, QWinShellMetrics *metrics);
+
+    QWinShellBackend *backend() const { return m_backend; }
+    QWinShellMetrics *metrics() const { return m_metrics; }
+
+    qint32 setProgressValue(quintptr window, quint64 completed, quint64 total) Q_DECL_OVERRIDE;
+    qint32 setProgressState(quintptr window, QWinTaskbarProgressState state) Q_DECL_OVERRIDE;
+    qint32 setOverlayIcon(quintptr window, quintptr icon, const QString &description) Q_DECL_OVERRIDE;
+    qint32 addThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count) Q_DECL_OVERRIDE;
+    qint32 updateThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count) Q_DECL_OVERRIDE;
+
+    qint32 beginList(const QString &appId) Q_DECL_OVERRIDE;
+    qint32 appendKnownCategory(KnownCategory category) Q_DECL_OVERRIDE;
+    qint32 appendCategory(const QString &title, Object collection) Q_DECL_OVERRIDE;
+    qint32 addUserTasks(Object collection) Q_DECL_OVERRIDE;
+    qint32 commitList() Q_DECL_OVERRIDE;
+
+    Object createLink(const QWinJumpListItemSnapshot &item, const QString &iconPath) Q_DECL_OVERRIDE;
+    Object createDestination(const QString &filePath) Q_DECL_OVERRIDE;
+    Object createSeparator() Q_DECL_OVERRIDE;
+    Object createCollection(const Object *objects, int count) Q_DECL_OVERRIDE;
+    void addRef(Object object) Q_DECL_OVERRIDE;
+    void release(Object object) Q_DECL_OVERRIDE;
+
+    qint32 documents(const QString &appId, DocumentList list, QVector<QWinShellDocument> *documents) Q_DECL_OVERRIDE;
+    qint32 addRecentDocument(const QString &appId, const QWinJumpListItemSnapshot &item, const QString &iconPath) Q_DECL_OVERRIDE;
+    qint32 clearDocuments(const QString &appId) Q_DECL_OVERRIDE;
+
+    qint32 setWindowAttribute(quintptr window, quint32 attribute, const void *value, quint32 size) Q_DECL_OVERRIDE;
+    qint32 windowAttribute(quintptr window, quint32 attribute, void *value, quint32 size) Q_DECL_OVERRIDE;
+    qint32 extendFrameIntoClientArea(quintptr window, int left, int top, int right, int bottom) Q_DECL_OVERRIDE;
+    qint32 enableBlurBehindWindow(quintptr window, bool enable, quintptr region) Q_DECL_OVERRIDE;
+    qint32 isCompositionEnabled(bool *enabled) Q_DECL_OVERRIDE;
+    qint32 enableComposition(bool enable) Q_DECL_OVERRIDE;
+    qint32 colorizationColor(quint32 *argb, bool *opaqueBlend) Q_DECL_OVERRIDE;
+
+private:
+    Q_DISABLE_COPY(QWinInstrumentedShellBackend)
+
+    QWinShellBackend *m_backend;
+    QWinShellMetrics *m_metrics;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWININSTRUMENTEDSHELLBACKEND_P_H
@@ -45,15 +45,16 @@
 #include "qwinjumplistitem.h"
 #include "qwinjumplistcategory.h"
 #include "qwinjumplistcategory_p.h"
+#include "qwiniconstore_p.h"
+#include "qwinshelltrace_p.h"
+#include "qwinshellexecutor_p.h"
 
 #include <QDir>
 #include <QCoreApplication>
 #include <qt_windows.h>
-#include <propvarutil.h>
 
 #include "qwinfunctions.h"
 #include "qwinfunctions_p.h"
-#include "winpropkey_p.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -74,29 +75,6 @@ QT_BEGIN_NAMESPACE
     \externalpage http://msdn.microsoft.com/en-us/library/windows/desktop/dd378459%28v=vs.85%29.aspx
  */
 
-// partial copy of qprocess_win.cpp:qt_create_commandline()
-static QString createArguments(const QStringList &arguments)
-{
-    QString args;
-    for (int i=0; i<arguments.size(); ++i) {
-        QString tmp = arguments.at(i);
-        // Quotes are escaped and their preceding backslashes are doubled.
-        tmp.replace(QRegExp(QLatin1String("(\\\\*)\"")), QLatin1String("\\1\\1\\\""));
-        if (tmp.isEmpty() || tmp.contains(QLatin1Char(' ')) || tmp.contains(QLatin1Char('\t'))) {
-            // The argument must not end with a \ since this would be interpreted
-            // as escaping the quote -- rather put the \ behind the quote: e.g.
-            // rather use "foo"\ than "foo\"
-            int i = tmp.length();
-            while (i > 0 && tmp.at(i - 1) == QLatin1Char('\\'))
-                --i;
-            tmp.insert(i, QLatin1Char('"'));
-            tmp.prepend(QLatin1Char('"'));
-        }
-        args += QLatin1Char(' ') + tmp;
-    }
-    return args;
-}
-
 static QString defaultIdentifier()
 {
     // CompanyName.ProductName(.SubProduct).VersionInformation
@@ -109,7 +87,8 @@ static QString defaultIdentifier()
 }
 
 QWinJumpListPrivate::QWinJumpListPrivate() :
-    pDestList(0), recent(0), frequent(0), tasks(0), dirty(false)
+    backend(qt_winShellBackend()), committer(new QWinJumpListCommitter(backend, iconStore())),
+    recent(0), frequent(0), tasks(0), dirty(false)
 {
 }
 
@@ -126,300 +105,174 @@ QString QWinJumpListPrivate::iconsDirPath()
     return iconDirPath;
 }
 
-void QWinJumpListPrivate::invalidate()
-{
-    Q_Q(QWinJumpList);
-    if (!pDestList)
-        return;
-
-    if (!dirty) {
-        dirty = true;
-        QMetaObject::invokeMethod(q, "_q_rebuild", Qt::QueuedConnection);
-    }
-}
-
-void QWinJumpListPrivate::_q_rebuild()
-{
-    if (beginList()) {
-        if (recent && recent->isVisible())
-            appendKnownCategory(KDC_RECENT);
-        if (frequent && frequent->isVisible())
-            appendKnownCategory(KDC_FREQUENT);
-        foreach (QWinJumpListCategory *category, categories) {
-            if (category->isVisible())
-                appendCustomCategory(category);
-        }
-        if (tasks && tasks->isVisible())
-            appendTasks(tasks->items());
-        commitList();
-    }
-    dirty = false;
-}
-
-void QWinJumpListPrivate::destroy()
-{
-    delete recent;
-    recent = 0;
-    delete frequent;
-    frequent = 0;
-    delete tasks;
-    tasks = 0;
-    qDeleteAll(categories);
-    categories.clear();
-    invalidate();
-}
-
-bool QWinJumpListPrivate::beginList()
-{
-    HRESULT hresult = S_OK;
-    if (!identifier.isEmpty()) {
-        wchar_t *id = qt_qstringToNullTerminated(identifier);
-        hresult = pDestList->SetAppID(id);
-        delete[] id;
-    }
-    if (SUCCEEDED(hresult)) {
-        UINT maxSlots = 0;
-        IUnknown *array = 0;
-        hresult = pDestList->BeginList(&maxSlots, IID_IUnknown, reinterpret_cast<void **>(&array));
-        if (array)
-            array->Release();
-    }
-    if (FAILED(hresult))
-        QWinJumpListPrivate::warning("BeginList", hresult);
-    return SUCCEEDED(hresult);
-}
+Q_GLOBAL_STATIC_WITH_ARGS(QWinIconStore, jumpListIconStore, (QWinJumpListPrivate::iconsDirPath()))
+Q_GLOBAL_STATIC_WITH_ARGS(QWinIconStore, jumpListRecentIconStore, (QWinJumpListPrivate::iconsDirPath() + QLatin1String("recent/")))
 
-bool QWinJumpListPrivate::commitList()
+// The icons of the links in custom categories and tasks, removed once no jump list uses them anymore.
+QWinIconStore *QWinJumpListPrivate::iconStore()
 {
-    HRESULT hresult = pDestList->CommitList();
-    if (FAILED(hresult))
-        QWinJumpListPrivate::warning("CommitList", hresult);
-    return SUCCEEDED(hresult);
+    return jumpListIconStore();
 }
 
-void QWinJumpListPrivate::appendKnownCategory(KNOWNDESTCATEGORY category)
+// The icons of recent items, which the shell keeps beyond the lifetime of the jump list;
+// removed once the shell does not list the items anymore.
+QWinIconStore *QWinJumpListPrivate::recentIconStore()
 {
-    HRESULT hresult = pDestList->AppendKnownCategory(category);
-    if (FAILED(hresult))
-        QWinJumpListPrivate::warning("AppendKnownCategory", hresult);
+    return jumpListRecentIconStore();
 }
 
-void QWinJumpListPrivate::appendCustomCategory(QWinJumpListCategory *category)
+void QWinJumpListPrivate::invalidate()
 {
-    IObjectCollection *collection = toComCollection(category->items());
-    if (collection) {
-        wchar_t *title = qt_qstringToNullTerminated(category->title());
-        HRESULT hresult = pDestList->AppendCategory(title, collection);
-        if (FAILED(hresult))
-            QWinJumpListPrivate::warning("AppendCategory", hresult);
-        delete[] title;
-        collection->Release();
+    Q_Q(QWinJumpList);
+    if (!dirty) {
+        dirty = true;
+        QMetaObject::invokeMethod(q, "_q_rebuild", Qt::QueuedConnection);
     }
 }
 
-void QWinJumpListPrivate::appendTasks(const QList<QWinJumpListItem *> &items)
+QWinJumpListItemSnapshot QWinJumpListPrivate::snapshot(const QWinJumpListItem *item)
 {
-    IObjectCollection *collection = toComCollection(items);
-    if (collection) {
-        HRESULT hresult = pDestList->AddUserTasks(collection);
-        if (FAILED(hresult))
-            QWinJumpListPrivate::warning("AddUserTasks", hresult);
-        collection->Release();
-    }
+    QWinJumpListItemSnapshot itemSnapshot;
+    itemSnapshot.type = item->type();
+    itemSnapshot.filePath = item->filePath();
+    itemSnapshot.workingDirectory = item->workingDirectory();
+    itemSnapshot.title = item->title();
+    itemSnapshot.description = item->description();
+    itemSnapshot.arguments = item->arguments();
+    itemSnapshot.iconKey = item->icon().cacheKey();
+    return itemSnapshot;
 }
 
-QList<QWinJumpListItem *> QWinJumpListPrivate::fromComCollection(IObjectArray *array)
+static void appendCategorySnapshot(QWinJumpListCategory *category, QWinJumpListSnapshot *snapshot, QList<QWinJumpListItem *> *items)
 {
-    QList<QWinJumpListItem *> list;
-    UINT count = 0;
-    array->GetCount(&count);
-    for (UINT i = 0; i < count; ++i) {
-        IUnknown *collectionItem = 0;
-        HRESULT hresult = array->GetAt(i, IID_IUnknown, reinterpret_cast<void **>(&collectionItem));
-        if (FAILED(hresult)) {
-            QWinJumpListPrivate::warning("GetAt", hresult);
-            continue;
-        }
-        IShellItem2 *shellItem = 0;
-        IShellLinkW *shellLink = 0;
-        QWinJumpListItem *jumplistItem = 0;
-        if (SUCCEEDED(collectionItem->QueryInterface(IID_IShellItem2, reinterpret_cast<void **>(&shellItem)))) {
-            jumplistItem = fromIShellItem(shellItem);
-            shellItem->Release();
-        } else if (SUCCEEDED(collectionItem->QueryInterface(IID_IShellLinkW, reinterpret_cast<void **>(&shellLink)))) {
-            jumplistItem = fromIShellLink(shellLink);
-            shellLink->Release();
-        } else {
-            qWarning("QWinJumpList: object of unexpected class found");
+    QWinJumpListCategorySnapshot categorySnapshot;
+    categorySnapshot.type = category->type();
+    if (categorySnapshot.type == QWinJumpListCategory::Custom)
+        categorySnapshot.title = category->title();
+    if (categorySnapshot.type == QWinJumpListCategory::Custom || categorySnapshot.type == QWinJumpListCategory::Tasks) {
+        foreach (QWinJumpListItem *item, category->items()) {
+            categorySnapshot.items.append(QWinJumpListPrivate::snapshot(item));
+            items->append(item);
         }
-        collectionItem->Release();
-        if (jumplistItem)
-            list.append(jumplistItem);
     }
-    return list;
+    snapshot->categories.append(categorySnapshot);
 }
 
-IObjectCollection *QWinJumpListPrivate::toComCollection(const QList<QWinJumpListItem *> &list)
-{
-    if (list.isEmpty())
-        return 0;
-    IObjectCollection *collection = 0;
-    HRESULT hresult = CoCreateInstance(CLSID_EnumerableObjectCollection, 0, CLSCTX_INPROC_SERVER, IID_IObjectCollection, reinterpret_cast<void **>(&collection));
-    if (FAILED(hresult)) {
-        QWinJumpListPrivate::warning("QWinJumpList: failed to instantiate IObjectCollection", hresult);
-        return 0;
-    }
-    Q_FOREACH (QWinJumpListItem *item, list) {
-        IUnknown *iitem = toICustomDestinationListItem(item);
-        if (iitem) {
-            collection->AddObject(iitem);
-            iitem->Release();
-        }
+/*
+    Captures the visible categories in the order they are appended to the
+    list, and their items in \a items.
+ */
+void QWinJumpListPrivate::takeSnapshot(QWinJumpListSnapshot *snapshot, QList<QWinJumpListItem *> *items) const
+{
+    snapshot->identifier = identifier;
+    if (recent && recent->isVisible())
+        appendCategorySnapshot(recent, snapshot, items);
+    if (frequent && frequent->isVisible())
+        appendCategorySnapshot(frequent, snapshot, items);
+    foreach (QWinJumpListCategory *category, categories) {
+        if (category->isVisible())
+            appendCategorySnapshot(category, snapshot, items);
     }
-    return collection;
+    if (tasks && tasks->isVisible())
+        appendCategorySnapshot(tasks, snapshot, items);
 }
 
-QWinJumpListItem *QWinJumpListPrivate::fromIShellLink(IShellLinkW *link)
+// Passes a snapshot to the committer on the shell thread. Icons can only be
+// rendered on the GUI thread, so the icons of the links come along with it.
+class QWinJumpListCommitJob : public QWinShellJob, public QWinJumpListIconSource
 {
-    QWinJumpListItem *item = new QWinJumpListItem(QWinJumpListItem::Link);
+public:
+    QWinJumpListCommitJob(QWinJumpListCommitter *committer, const QWinJumpListSnapshot &snapshot, const QVector<QImage> &icons) :
+        m_committer(committer), m_snapshot(snapshot), m_icons(icons) {}
 
-    IPropertyStore *linkProps;
-    link->QueryInterface(IID_IPropertyStore, reinterpret_cast<void **>(&linkProps));
-    PROPVARIANT var;
-    linkProps->GetValue(PKEY_Link_Arguments, &var);
-    item->setArguments(QStringList(QString::fromWCharArray(var.pwszVal)));
-    PropVariantClear(&var);
-    linkProps->Release();
-
-    const int buffersize = 2048;
-    wchar_t buffer[buffersize];
-
-    link->GetDescription(buffer, INFOTIPSIZE);
-    item->setDescription(QString::fromWCharArray(buffer));
-
-    int dummyindex;
-    link->GetIconLocation(buffer, buffersize-1, &dummyindex);
-    item->setIcon(QIcon(QString::fromWCharArray(buffer)));
-
-    link->GetPath(buffer, buffersize-1, 0, 0);
-    item->setFilePath(QDir::fromNativeSeparators(QString::fromWCharArray(buffer)));
-
-    return item;
-}
-
-QWinJumpListItem *QWinJumpListPrivate::fromIShellItem(IShellItem2 *shellitem)
-{
-    QWinJumpListItem *item = new QWinJumpListItem(QWinJumpListItem::Destination);
-    wchar_t *strPtr;
-    shellitem->GetDisplayName(SIGDN_FILESYSPATH, &strPtr);
-    item->setFilePath(QDir::fromNativeSeparators(QString::fromWCharArray(strPtr)));
-    CoTaskMemFree(strPtr);
-    return item;
-}
-
-IUnknown *QWinJumpListPrivate::toICustomDestinationListItem(const QWinJumpListItem *item)
-{
-    switch (item->type()) {
-    case QWinJumpListItem::Destination :
-        return toIShellItem(item);
-    case QWinJumpListItem::Link :
-        return toIShellLink(item);
-    case QWinJumpListItem::Separator :
-        return makeSeparatorShellItem();
-    default:
-        return 0;
+    void run() Q_DECL_OVERRIDE
+    {
+        m_committer->commit(m_snapshot, this);
     }
-}
 
-IShellLinkW *QWinJumpListPrivate::toIShellLink(const QWinJumpListItem *item)
-{
-    IShellLinkW *link = 0;
-    HRESULT hresult = CoCreateInstance(CLSID_ShellLink, 0, CLSCTX_INPROC_SERVER, IID_IShellLinkW, reinterpret_cast<void **>(&link));
-    if (FAILED(hresult)) {
-        QWinJumpListPrivate::warning("QWinJumpList: failed to instantiate IShellLinkW", hresult);
-        return 0;
+    QImage icon(int item) Q_DECL_OVERRIDE
+    {
+        return m_icons.at(item);
     }
 
-    const QString args = createArguments(item->arguments());
-    const int iconPathSize = QWinJumpListPrivate::iconsDirPath().size() + sizeof(void *)*2 + 4; // path + ptr-name-in-hex + .ico
-    const int bufferSize = qMax(args.size(), qMax(item->workingDirectory().size(), qMax(item->description().size(), qMax(item->title().size(), qMax(item->filePath().size(), iconPathSize))))) + 1;
-    wchar_t *buffer = new wchar_t[bufferSize];
-
-    if (!item->description().isEmpty()) {
-        qt_qstringToNullTerminated(item->description(), buffer);
-        link->SetDescription(buffer);
-    }
+private:
+    QWinJumpListCommitter *m_committer;
+    const QWinJumpListSnapshot m_snapshot;
+    const QVector<QImage> m_icons;
+};
 
-    qt_qstringToNullTerminated(item->filePath(), buffer);
-    link->SetPath(buffer);
+// Releases what the shell got on the last commit, and the committer with it.
+class QWinJumpListReleaseJob : public QWinShellJob
+{
+public:
+    explicit QWinJumpListReleaseJob(QWinJumpListCommitter *committer) : m_committer(committer) {}
 
-    if (!item->workingDirectory().isEmpty()) {
-        qt_qstringToNullTerminated(item->workingDirectory(), buffer);
-        link->SetWorkingDirectory(buffer);
+    void run() Q_DECL_OVERRIDE
+    {
+        m_committer->releaseCommitted();
+        delete m_committer;
     }
 
-    qt_qstringToNullTerminated(args, buffer);
-    link->SetArguments(buffer);
+private:
+    QWinJumpListCommitter *m_committer;
+};
 
-    if (!item->icon().isNull()) {
-        QString iconPath = QWinJumpListPrivate::iconsDirPath() + QString::number(reinterpret_cast<quintptr>(item), 16) + QLatin1String(".ico");
-        bool iconSaved = item->icon().pixmap(GetSystemMetrics(SM_CXICON)).save(iconPath, "ico");
-        if (iconSaved) {
-            qt_qstringToNullTerminated(iconPath, buffer);
-            link->SetIconLocation(buffer, 0);
-        }
-    }
-
-    IPropertyStore *properties;
-    PROPVARIANT titlepv;
-    hresult = link->QueryInterface(IID_IPropertyStore, reinterpret_cast<void **>(&properties));
-    if (FAILED(hresult)) {
-        link->Release();
-        return 0;
+/*
+    The committer is only used on the shell thread. The icons of the links
+    are rendered here, those that were rendered for the previous commit are
+    reused.
+ */
+void QWinJumpListPrivate::_q_rebuild()
+{
+    QWinJumpListSnapshot snapshot;
+    QList<QWinJumpListItem *> items;
+    takeSnapshot(&snapshot, &items);
+    if (QWinShellTraceWriter *trace = qt_winShellTraceWriter())
+        trace->writeJumpList(this, snapshot);
+
+    const int iconSize = GetSystemMetrics(SM_CXICON);
+    QHash<qint64, QImage> images;
+    QVector<QImage> icons(items.size());
+    for (int i = 0; i < items.size(); ++i) {
+        const QIcon icon = items.at(i)->icon();
+        if (items.at(i)->type() != QWinJumpListItem::Link || icon.isNull())
+            continue;
+        QImage &image = images[icon.cacheKey()];
+        if (image.isNull())
+            image = iconImages.value(icon.cacheKey());
+        if (image.isNull())
+            image = icon.pixmap(iconSize).toImage();
+        icons[i] = image;
     }
+    iconImages = images;
 
-    qt_qstringToNullTerminated(item->title(), buffer);
-    InitPropVariantFromString(buffer, &titlepv);
-    properties->SetValue(PKEY_Title, titlepv);
-    properties->Commit();
-    properties->Release();
-    PropVariantClear(&titlepv);
-
-    delete[] buffer;
-    return link;
+    qt_winShellExecutor()->post(new QWinJumpListCommitJob(committer, snapshot, icons));
+    dirty = false;
 }
 
-IShellItem2 *QWinJumpListPrivate::toIShellItem(const QWinJumpListItem *item)
+void QWinJumpListPrivate::destroy()
 {
-    IShellItem2 *shellitem = 0;
-    wchar_t *buffer = qt_qstringToNullTerminated(item->filePath());
-    qt_SHCreateItemFromParsingName(buffer, 0, IID_IShellItem2, reinterpret_cast<void **>(&shellitem));
-    delete[] buffer;
-    return shellitem;
+    delete recent;
+    recent = 0;
+    delete frequent;
+    frequent = 0;
+    delete tasks;
+    tasks = 0;
+    qDeleteAll(categories);
+    categories.clear();
+    invalidate();
 }
 
-IShellLinkW *QWinJumpListPrivate::makeSeparatorShellItem()
+QWinJumpListItem *QWinJumpListPrivate::fromDocument(const QWinShellDocument &document)
 {
-    IShellLinkW *separator;
-    HRESULT res = CoCreateInstance(CLSID_ShellLink, 0, CLSCTX_INPROC_SERVER, IID_IShellLinkW, reinterpret_cast<void **>(&separator));
-    if (FAILED(res))
-        return 0;
-
-    IPropertyStore *properties;
-    res = separator->QueryInterface(IID_IPropertyStore, reinterpret_cast<void **>(&properties));
-    if (FAILED(res)) {
-        separator->Release();
-        return 0;
+    QWinJumpListItem *item = new QWinJumpListItem(document.type);
+    item->setFilePath(document.filePath);
+    if (document.type == QWinJumpListItem::Link) {
+        item->setArguments(QStringList(document.arguments));
+        item->setDescription(document.description);
+        item->setIcon(QIcon(document.iconPath));
     }
-
-    PROPVARIANT isSeparator;
-    InitPropVariantFromBoolean(TRUE, &isSeparator);
-    properties->SetValue(PKEY_AppUserModel_IsDestListSeparator, isSeparator);
-    properties->Commit();
-    properties->Release();
-    PropVariantClear(&isSeparator);
-
-    return separator;
+    return item;
 }
 
 /*!
@@ -430,9 +283,6 @@ QWinJumpList::QWinJumpList(QObject *parent) :
 {
     Q_D(QWinJumpList);
     d->q_ptr = this;
-    HRESULT hresult = CoCreateInstance(CLSID_DestinationList, 0, CLSCTX_INPROC_SERVER, IID_ICustomDestinationList, reinterpret_cast<void **>(&d_ptr->pDestList));
-    if (FAILED(hresult))
-        QWinJumpListPrivate::warning("CoCreateInstance", hresult);
     setIdentifier(defaultIdentifier());
     d->invalidate();
 }
@@ -445,10 +295,10 @@ QWinJumpList::~QWinJumpList()
     Q_D(QWinJumpList);
     if (d->dirty)
         d->_q_rebuild();
-    if (d->pDestList) {
-        d->pDestList->Release();
-        d->pDestList = 0;
-    }
+    if (QWinShellTraceWriter *trace = qt_winShellTraceWriter())
+        trace->writeDestroyed(d);
+    qt_winShellExecutor()->post(new QWinJumpListReleaseJob(d->committer));
+    d->committer = 0;
     d->destroy();
 }
 
@@ -491,6 +341,10 @@ void QWinJumpList::setIdentifier(const QString &identifier)
 
 /*!
     Returns the recent items category in the jump list.
+
+    Its items are only listed when they are first accessed.
+
+    \sa QWinJumpListCategory::loadAsync()
  */
 QWinJumpListCategory *QWinJumpList::recent() const
 {
@@ -504,6 +358,10 @@ QWinJumpListCategory *QWinJumpList::recent() const
 
 /*!
     Returns the frequent items category in the jump list.
+
+    Its items are only listed when they are first accessed.
+
+    \sa QWinJumpListCategory::loadAsync()
  */
 QWinJumpListCategory *QWinJumpList::frequent() const
 {
@@ -565,6 +423,16 @@ QWinJumpListCategory *QWinJumpList::addCategory(const QString &title, const QLis
     return category;
 }
 
+/*!
+    \fn void QWinJumpList::categoryLoaded(QWinJumpListCategory *category)
+
+    This signal is emitted when the items of the recent or frequent
+    \a category have been listed in the background.
+
+    \sa QWinJumpListCategory::loadAsync()
+    \since 5.2
+ */
+
 /*!
     Clears the jump list.
 
@@ -77,6 +77,9 @@ public:
 public Q_SLOTS:
     void clear();
 
+Q_SIGNALS:
+    void categoryLoaded(QWinJumpListCategory *category);
+
 private:
     Q_DISABLE_COPY(QWinJumpList)
     Q_DECLARE_PRIVATE(QWinJumpList)
@@ -44,10 +44,20 @@
 #define QWINJUMPLIST_P_H
 
 #include "qwinjumplist.h"
-#include "winshobjidl_p.h"
+#include "qwinjumplistsnapshot_p.h"
+#include "qwinjumplistcommitter_p.h"
+#include "qwinshellbackend_p.h"
+
+#include <qt_windows.h>
+
+#include <QtCore/QHash>
+#include <QtCore/QVector>
+#include <QtGui/QImage>
 
 QT_BEGIN_NAMESPACE
 
+class QWinIconStore;
+
 class QWinJumpListPrivate
 {
     Q_DECLARE_PUBLIC(QWinJumpList)
@@ -62,34 +72,27 @@ public:
 
     static void warning(const char *function, HRESULT hresult);
     static QString iconsDirPath();
+    static QWinIconStore *iconStore();
+    static QWinIconStore *recentIconStore();
 
     void invalidate();
     void _q_rebuild();
     void destroy();
+    void takeSnapshot(QWinJumpListSnapshot *snapshot, QList<QWinJumpListItem *> *items) const;
 
-    bool beginList();
-    bool commitList();
-
-    void appendKnownCategory(KNOWNDESTCATEGORY category);
-    void appendCustomCategory(QWinJumpListCategory *category);
-    void appendTasks(const QList<QWinJumpListItem *> &items);
-
-    static QList<QWinJumpListItem *> fromComCollection(IObjectArray *array);
-    static IObjectCollection *toComCollection(const QList<QWinJumpListItem *> &list);
-    static QWinJumpListItem *fromIShellLink(IShellLinkW *link);
-    static QWinJumpListItem *fromIShellItem(IShellItem2 *shellitem);
-    static IUnknown *toICustomDestinationListItem(const QWinJumpListItem *item);
-    static IShellLinkW *toIShellLink(const QWinJumpListItem *item);
-    static IShellItem2 *toIShellItem(const QWinJumpListItem *item);
-    static IShellLinkW *makeSeparatorShellItem();
+    static QWinJumpListItemSnapshot snapshot(const QWinJumpListItem *item);
+    static QWinJumpListItem *fromDocument(const QWinShellDocument &document);
 
     QWinJumpList *q_ptr;
-    ICustomDestinationList *pDestList;
+    QWinShellBackend *backend;
+    // owned by the jobs of the shell thread once the list is destroyed
+    QWinJumpListCommitter *committer;
     QWinJumpListCategory *recent;
     QWinJumpListCategory *frequent;
     QWinJumpListCategory *tasks;
     QList<QWinJumpListCategory *> categories;
     QString identifier;
+    QHash<qint64, QImage> iconImages;
     bool dirty;
 };
 
@@ -45,9 +45,11 @@
 #include "qwinjumplistitem_p.h"
 #include "qwinfunctions_p.h"
 #include "qwinjumplist_p.h"
-#include "winshobjidl_p.h"
+#include "qwiniconstore_p.h"
+#include "qwinshellbackend_p.h"
+#include "qwinshellexecutor_p.h"
 
-#include <shlobj.h>
+#include <QtCore/QDir>
 
 QT_BEGIN_NAMESPACE
 
@@ -74,17 +76,20 @@ QT_BEGIN_NAMESPACE
  */
 
 QWinJumpListCategoryPrivate::QWinJumpListCategoryPrivate() :
-    visible(false), jumpList(0), type(QWinJumpListCategory::Custom)
+    q_ptr(0), visible(false), loaded(true), jumpList(0), type(QWinJumpListCategory::Custom)
 {
 }
 
+/*
+    The items of the recent and frequent categories are only listed when
+    they are first needed, as the shell resolves every one of them.
+ */
 QWinJumpListCategory *QWinJumpListCategoryPrivate::create(QWinJumpListCategory::Type type, QWinJumpList *jumpList)
 {
     QWinJumpListCategory *category = new QWinJumpListCategory;
     category->d_func()->type = type;
     category->d_func()->jumpList = jumpList;
-    if (type == QWinJumpListCategory::Recent || type == QWinJumpListCategory::Frequent)
-        category->d_func()->loadRecents();
+    category->d_func()->loaded = !category->d_func()->isKnown();
     return category;
 }
 
@@ -94,64 +99,157 @@ void QWinJumpListCategoryPrivate::invalidate()
         QWinJumpListPrivate::get(jumpList)->invalidate();
 }
 
+bool QWinJumpListCategoryPrivate::isKnown() const
+{
+    return type == QWinJumpListCategory::Recent || type == QWinJumpListCategory::Frequent;
+}
+
+QWinShellBackend::DocumentList QWinJumpListCategoryPrivate::documentList() const
+{
+    return type == QWinJumpListCategory::Recent ? QWinShellBackend::RecentDocuments : QWinShellBackend::FrequentDocuments;
+}
+
+/*
+    Lists the items right away if they have not been listed yet, even if an
+    asynchronous load is pending.
+ */
+void QWinJumpListCategoryPrivate::ensureLoaded()
+{
+    if (!loaded) {
+        loaded = true;
+        loadRecents();
+    }
+}
+
+QWinJumpListDocumentLoader *QWinJumpListCategoryPrivate::documentLoader()
+{
+    if (!loader)
+        loader.reset(new QWinJumpListDocumentLoader(qt_winShellExecutor(), qt_winShellBackend(), this));
+    return loader.data();
+}
+
 void QWinJumpListCategoryPrivate::loadRecents()
 {
     Q_ASSERT(jumpList);
-    IApplicationDocumentLists *pDocList = 0;
-    HRESULT hresult = CoCreateInstance(CLSID_ApplicationDocumentLists, 0, CLSCTX_INPROC_SERVER, IID_IApplicationDocumentLists, reinterpret_cast<void **>(&pDocList));
-    if (SUCCEEDED(hresult)) {
-        if (!jumpList->identifier().isEmpty()) {
-            wchar_t *id = qt_qstringToNullTerminated(jumpList->identifier());
-            hresult = pDocList->SetAppID(id);
-            delete[] id;
+    QVector<QWinShellDocument> documents;
+    HRESULT hresult = documentLoader()->load(jumpList->identifier(), documentList(), &documents);
+    if (FAILED(hresult)) {
+        QWinJumpListPrivate::warning("loadRecents", hresult);
+        return;
+    }
+    foreach (const QWinShellDocument &document, documents)
+        items.append(QWinJumpListPrivate::fromDocument(document));
+}
+
+void QWinJumpListCategoryPrivate::documentsLoaded(qint32 hresult, const QVector<QWinShellDocument> &documents)
+{
+    Q_Q(QWinJumpListCategory);
+    Q_ASSERT(!loaded);
+    loaded = true;
+    if (FAILED(hresult)) {
+        QWinJumpListPrivate::warning("loadRecents", hresult);
+    } else {
+        foreach (const QWinShellDocument &document, documents)
+            items.append(QWinJumpListPrivate::fromDocument(document));
+    }
+    if (jumpList)
+        emit jumpList->categoryLoaded(q);
+}
+
+/*
+    The icons of recent items are in use for as long as the shell lists the
+    items, as recent or as frequent ones. The icons of the items listed for
+    \a identifier are kept, together with \a addedIconPath, which the shell
+    may not list yet, and the others are removed. Nothing is removed if the
+    shell cannot be asked.
+ */
+static void collectRecentIcons(QWinShellBackend *backend, const QString &identifier, const QString &addedIconPath = QString())
+{
+    QWinIconStore *store = QWinJumpListPrivate::recentIconStore();
+    const QWinShellBackend::DocumentList lists[] = { QWinShellBackend::RecentDocuments, QWinShellBackend::FrequentDocuments };
+    for (int i = 0; i < 2; ++i) {
+        QVector<QWinShellDocument> documents;
+        if (FAILED(backend->documents(identifier, lists[i], &documents))) {
+            store->discardPending();
+            return;
         }
-        if (SUCCEEDED(hresult)) {
-            IObjectArray *array = 0;
-            hresult = pDocList->GetList(type == QWinJumpListCategory::Recent ? ADLT_RECENT : ADLT_FREQUENT,
-                                        0, IID_IObjectArray, reinterpret_cast<void **>(&array));
-            if (SUCCEEDED(hresult)) {
-                items = QWinJumpListPrivate::fromComCollection(array);
-                array->Release();
-            }
+        foreach (const QWinShellDocument &document, documents) {
+            if (!document.iconPath.isEmpty())
+                store->reference(QDir::fromNativeSeparators(document.iconPath));
         }
-        pDocList->Release();
     }
-    if (FAILED(hresult))
-        QWinJumpListPrivate::warning("loadRecents", hresult);
+    if (!addedIconPath.isEmpty())
+        store->reference(addedIconPath);
+    // the shell owns the recent items, so nobody releases these references
+    store->commitReferences(identifier, 0);
+    store->collectGarbage();
 }
 
+// Stores the icon of a recent item and passes the item to the shell.
+class QWinJumpListAddRecentJob : public QWinShellJob
+{
+public:
+    QWinJumpListAddRecentJob(QWinShellBackend *backend, const QString &identifier,
+                             const QWinJumpListItemSnapshot &item, const QImage &icon) :
+        m_backend(backend), m_identifier(identifier), m_item(item), m_icon(icon) {}
+
+    void run() Q_DECL_OVERRIDE
+    {
+        QString iconPath;
+        if (!m_icon.isNull())
+            iconPath = QWinJumpListPrivate::recentIconStore()->insert(m_icon);
+        HRESULT hresult = m_backend->addRecentDocument(m_identifier, m_item, iconPath);
+        if (FAILED(hresult))
+            QWinJumpListPrivate::warning("addRecent", hresult);
+        else if (!iconPath.isEmpty())
+            collectRecentIcons(m_backend, m_identifier, iconPath);
+    }
+
+private:
+    QWinShellBackend *m_backend;
+    const QString m_identifier;
+    const QWinJumpListItemSnapshot m_item;
+    const QImage m_icon;
+};
+
+class QWinJumpListClearRecentsJob : public QWinShellJob
+{
+public:
+    QWinJumpListClearRecentsJob(QWinShellBackend *backend, const QString &identifier) :
+        m_backend(backend), m_identifier(identifier) {}
+
+    void run() Q_DECL_OVERRIDE
+    {
+        HRESULT hresult = m_backend->clearDocuments(m_identifier);
+        if (FAILED(hresult))
+            QWinJumpListPrivate::warning("clearRecents", hresult);
+        else
+            collectRecentIcons(m_backend, m_identifier);
+    }
+
+private:
+    QWinShellBackend *m_backend;
+    const QString m_identifier;
+};
+
+/*
+    The icon is rendered here, it is written to the icon store and the item
+    passed to the shell on the shell thread.
+ */
 void QWinJumpListCategoryPrivate::addRecent(QWinJumpListItem *item)
 {
     Q_ASSERT(item->type() == QWinJumpListItem::Link);
     const QString identifier = jumpList ? jumpList->identifier() : QString();
-    wchar_t *id = qt_qstringToNullTerminated(identifier);
-
-    SHARDAPPIDINFOLINK info;
-    info.pszAppID = id;
-    info.psl =  QWinJumpListPrivate::toIShellLink(item);
-    if (info.psl) {
-        SHAddToRecentDocs(SHARD_APPIDINFOLINK, &info);
-        info.psl->Release();
-    }
-    delete[] id;
+    QImage icon;
+    if (!item->icon().isNull())
+        icon = item->icon().pixmap(GetSystemMetrics(SM_CXICON)).toImage();
+    qt_winShellExecutor()->post(new QWinJumpListAddRecentJob(qt_winShellBackend(), identifier, QWinJumpListPrivate::snapshot(item), icon));
 }
 
 void QWinJumpListCategoryPrivate::clearRecents()
 {
-    IApplicationDestinations *pDest = 0;
-    HRESULT hresult = CoCreateInstance(CLSID_ApplicationDestinations, 0, CLSCTX_INPROC_SERVER, IID_IApplicationDestinations, reinterpret_cast<void **>(&pDest));
-    if (SUCCEEDED(hresult)) {
-        const QString identifier = jumpList ? jumpList->identifier() : QString();
-        if (!identifier.isEmpty()) {
-            wchar_t *id = qt_qstringToNullTerminated(identifier);
-            hresult = pDest->SetAppID(id);
-            delete[] id;
-        }
-        hresult = pDest->RemoveAllDestinations();
-        pDest->Release();
-    }
-    if (FAILED(hresult))
-        QWinJumpListPrivate::warning("clearRecents", hresult);
+    const QString identifier = jumpList ? jumpList->identifier() : QString();
+    qt_winShellExecutor()->post(new QWinJumpListClearRecentsJob(qt_winShellBackend(), identifier));
 }
 
 /*!
@@ -160,6 +258,7 @@ void QWinJumpListCategoryPrivate::clearRecents()
 QWinJumpListCategory::QWinJumpListCategory(const QString &title) :
     d_ptr(new QWinJumpListCategoryPrivate)
 {
+    d_ptr->q_ptr = this;
     d_ptr->title = title;
 }
 
@@ -169,6 +268,7 @@ QWinJumpListCategory::QWinJumpListCategory(const QString &title) :
 QWinJumpListCategory::~QWinJumpListCategory()
 {
     Q_D(QWinJumpListCategory);
+    d->loader.reset();
     qDeleteAll(d->items);
     d->items.clear();
 }
@@ -224,12 +324,52 @@ void QWinJumpListCategory::setTitle(const QString &title)
     }
 }
 
+/*!
+    Returns whether the items of the category have been listed.
+
+    The items of the \l{QWinJumpList::recent()}{recent} and
+    \l{QWinJumpList::frequent()}{frequent} categories are maintained by
+    Windows. They are listed when they are first accessed, or in the
+    background after a call to loadAsync(). The items of other categories are
+    always loaded.
+
+    \sa loadAsync()
+    \since 5.2
+ */
+bool QWinJumpListCategory::isLoaded() const
+{
+    Q_D(const QWinJumpListCategory);
+    return d->loaded;
+}
+
+/*!
+    Starts listing the items of a recent or frequent category on the thread
+    that QtWinExtras talks to Windows from, so that the GUI thread does not
+    wait for Windows to resolve them. QWinJumpList::categoryLoaded() is
+    emitted once they are available.
+
+    Does nothing if the items have been listed already or are being listed.
+    Accessing the items before the background load finishes lists them right
+    away instead.
+
+    \sa isLoaded()
+    \since 5.2
+ */
+void QWinJumpListCategory::loadAsync()
+{
+    Q_D(QWinJumpListCategory);
+    if (d->loaded || (d->loader && d->loader->isLoading()) || !d->jumpList)
+        return;
+    d->documentLoader()->loadAsync(d->jumpList->identifier(), d->documentList());
+}
+
 /*!
     Returns the amount of items in the category.
  */
 int QWinJumpListCategory::count() const
 {
     Q_D(const QWinJumpListCategory);
+    const_cast<QWinJumpListCategoryPrivate *>(d)->ensureLoaded();
     return d->items.count();
 }
 
@@ -239,6 +379,7 @@ int QWinJumpListCategory::count() const
 bool QWinJumpListCategory::isEmpty() const
 {
     Q_D(const QWinJumpListCategory);
+    const_cast<QWinJumpListCategoryPrivate *>(d)->ensureLoaded();
     return d->items.isEmpty();
 }
 
@@ -248,6 +389,7 @@ bool QWinJumpListCategory::isEmpty() const
 QList<QWinJumpListItem *> QWinJumpListCategory::items() const
 {
     Q_D(const QWinJumpListCategory);
+    const_cast<QWinJumpListCategoryPrivate *>(d)->ensureLoaded();
     return d->items;
 }
 
@@ -273,9 +415,10 @@ void QWinJumpListCategory::addItem(QWinJumpListItem *item)
 
     QWinJumpListItemPrivate *p = QWinJumpListItemPrivate::get(item);
     if (p->category != this) {
+        d->ensureLoaded();
         p->category = this;
         d->items.append(item);
-        if (d->type == QWinJumpListCategory::Recent || d->type == QWinJumpListCategory::Frequent)
+        if (d->isKnown())
             d->addRecent(item);
         d->invalidate();
     }
@@ -336,10 +479,17 @@ QWinJumpListItem *QWinJumpListCategory::addSeparator()
 void QWinJumpListCategory::clear()
 {
     Q_D(QWinJumpListCategory);
-    if (!d->items.isEmpty()) {
+    if (!d->loaded) {
+        // no need to list the items just to drop them
+        if (d->loader)
+            d->loader->cancel();
+        d->loaded = true;
+        d->clearRecents();
+        d->invalidate();
+    } else if (!d->items.isEmpty()) {
         qDeleteAll(d->items);
         d->items.clear();
-        if (d->type == QWinJumpListCategory::Recent || d->type == QWinJumpListCategory::Frequent)
+        if (d->isKnown())
             d->clearRecents();
         d->invalidate();
     }
@@ -75,6 +75,9 @@ public:
     QString title() const;
     void setTitle(const QString &title);
 
+    bool isLoaded() const;
+    void loadAsync();
+
     int count() const;
     bool isEmpty() const;
     QList<QWinJumpListItem *> items() const;
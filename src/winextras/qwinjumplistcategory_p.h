@@ -44,13 +44,18 @@
 #define QWINJUMPLISTCATEGORY_P_H
 
 #include "qwinjumplistcategory.h"
+#include "qwinjumplistdocumentloader_p.h"
+
+#include <QtCore/QScopedPointer>
 
 QT_BEGIN_NAMESPACE
 
 class QWinJumpList;
 
-class QWinJumpListCategoryPrivate
+class QWinJumpListCategoryPrivate : public QWinJumpListDocumentReceiver
 {
+    Q_DECLARE_PUBLIC(QWinJumpListCategory)
+
 public:
     QWinJumpListCategoryPrivate();
 
@@ -62,15 +67,23 @@ public:
     static QWinJumpListCategory *create(QWinJumpListCategory::Type type, QWinJumpList *jumpList);
 
     void invalidate();
+    bool isKnown() const;
+    QWinShellBackend::DocumentList documentList() const;
+    void ensureLoaded();
+    QWinJumpListDocumentLoader *documentLoader();
     void loadRecents();
+    void documentsLoaded(qint32 hresult, const QVector<QWinShellDocument> &documents) Q_DECL_OVERRIDE;
     void addRecent(QWinJumpListItem *item);
     void clearRecents();
 
+    QWinJumpListCategory *q_ptr;
     bool visible;
+    bool loaded;
     QString title;
     QWinJumpList *jumpList;
     QWinJumpListCategory::Type type;
     QList<QWinJumpListItem *> items;
+    QScopedPointer<QWinJumpListDocumentLoader> loader;
 };
 
 QT_END_NAMESPACE
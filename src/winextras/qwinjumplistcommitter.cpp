@@ -0,0 +1,217 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinjumplistcommitter_p.h"
+#include "qwiniconstore_p.h"
+#include "qwinhresult_p.h"
+
+QT_BEGIN_NAMESPACE
+
+static void warning(const char *function, qint32 hresult)
+{
+    qWarning("QWinJumpList: %s() failed: %#010x, %s.", function, unsigned(hresult), qPrintable(qt_winHresultName(quint32(hresult))));
+}
+
+QWinJumpListCommitter::QWinJumpListCommitter(QWinShellBackend *backend, QWinIconStore *iconStore) :
+    m_backend(backend), m_iconStore(iconStore), m_committed(false),
+    m_createdObjectCount(0), m_reusedObjectCount(0)
+{
+}
+
+QWinJumpListCommitter::~QWinJumpListCommitter()
+{
+    releaseCommitted();
+}
+
+void QWinJumpListCommitter::releaseAll(const QVector<QWinShellBackend::Object> &objects)
+{
+    foreach (QWinShellBackend::Object object, objects) {
+        if (object)
+            m_backend->release(object);
+    }
+}
+
+/*
+    Releases the objects of the last commit, and its icons to the garbage
+    collection of the icon store. The next commit passes the whole list again.
+ */
+void QWinJumpListCommitter::releaseCommitted()
+{
+    if (m_committed)
+        m_iconStore->releaseReferences(m_committedSnapshot.identifier, this);
+    releaseAll(m_committedCollections);
+    releaseAll(m_committedItems);
+    m_committed = false;
+    m_committedSnapshot = QWinJumpListSnapshot();
+    m_committedCollections.clear();
+    m_committedItems.clear();
+    m_committedIconPaths.clear();
+}
+
+QWinShellBackend::Object QWinJumpListCommitter::createItem(const QWinJumpListItemSnapshot &item, int index,
+                                                           QWinJumpListIconSource *icons, QString *iconPath)
+{
+    QWinShellBackend::Object object = 0;
+    switch (item.type) {
+    case QWinJumpListItem::Destination:
+        object = m_backend->createDestination(item.filePath);
+        break;
+    case QWinJumpListItem::Link:
+        if (item.iconKey && icons) {
+            const QImage image = icons->icon(index);
+            if (!image.isNull())
+                *iconPath = m_iconStore->insert(image);
+        }
+        object = m_backend->createLink(item, *iconPath);
+        break;
+    case QWinJumpListItem::Separator:
+        object = m_backend->createSeparator();
+        break;
+    }
+    if (object)
+        ++m_createdObjectCount;
+    else
+        iconPath->clear();
+    return object;
+}
+
+/*
+    The shell only takes complete lists, so every change means another
+    BeginList(), AppendCategory() and CommitList() round.
+ */
+QWinJumpListCommitter::Result QWinJumpListCommitter::commit(const QWinJumpListSnapshot &snapshot, QWinJumpListIconSource *icons)
+{
+    const QWinJumpListDiff diff = qt_winDiffJumpLists(m_committedSnapshot, snapshot);
+    if (m_committed && !diff.changed)
+        return Unchanged;
+
+    qint32 hresult = m_backend->beginList(snapshot.identifier);
+    if (qt_winHresultIsFailure(quint32(hresult))) {
+        warning("BeginList", hresult);
+        return Failed;
+    }
+
+    const int itemCount = snapshot.itemCount();
+    QVector<QWinShellBackend::Object> collections(snapshot.categories.size(), 0);
+    QVector<QWinShellBackend::Object> objects(itemCount, 0);
+    QVector<QString> iconPaths(itemCount);
+    for (int c = 0, first = 0; c < snapshot.categories.size(); ++c) {
+        const QWinJumpListCategorySnapshot &category = snapshot.categories.at(c);
+        const int count = category.items.size();
+        const int previousCategory = diff.categories.at(c);
+        const bool reuseCategory = previousCategory >= 0 && m_committedCollections.at(previousCategory);
+        for (int i = first; i < first + count; ++i) {
+            const int previousItem = diff.items.at(i);
+            if (previousItem >= 0 && m_committedItems.at(previousItem)) {
+                objects[i] = m_committedItems.at(previousItem);
+                m_backend->addRef(objects.at(i));
+                iconPaths[i] = m_committedIconPaths.at(previousItem);
+                ++m_reusedObjectCount;
+            } else if (!reuseCategory) {
+                objects[i] = createItem(category.items.at(i - first), i, icons, &iconPaths[i]);
+            }
+            if (!iconPaths.at(i).isEmpty())
+                m_iconStore->reference(iconPaths.at(i));
+        }
+        if (reuseCategory) {
+            collections[c] = m_committedCollections.at(previousCategory);
+            m_backend->addRef(collections.at(c));
+            ++m_reusedObjectCount;
+        } else if (count) {
+            collections[c] = m_backend->createCollection(objects.constData() + first, count);
+            if (collections.at(c))
+                ++m_createdObjectCount;
+        }
+        first += count;
+
+        switch (category.type) {
+        case QWinJumpListCategory::Recent:
+            hresult = m_backend->appendKnownCategory(QWinShellBackend::RecentCategory);
+            if (qt_winHresultIsFailure(quint32(hresult)))
+                warning("AppendKnownCategory", hresult);
+            break;
+        case QWinJumpListCategory::Frequent:
+            hresult = m_backend->appendKnownCategory(QWinShellBackend::FrequentCategory);
+            if (qt_winHresultIsFailure(quint32(hresult)))
+                warning("AppendKnownCategory", hresult);
+            break;
+        case QWinJumpListCategory::Tasks:
+            if (collections.at(c)) {
+                hresult = m_backend->addUserTasks(collections.at(c));
+                if (qt_winHresultIsFailure(quint32(hresult)))
+                    warning("AddUserTasks", hresult);
+            }
+            break;
+        case QWinJumpListCategory::Custom:
+            if (collections.at(c)) {
+                hresult = m_backend->appendCategory(category.title, collections.at(c));
+                if (qt_winHresultIsFailure(quint32(hresult)))
+                    warning("AppendCategory", hresult);
+            }
+            break;
+        }
+    }
+
+    hresult = m_backend->commitList();
+    if (qt_winHresultIsFailure(quint32(hresult))) {
+        warning("CommitList", hresult);
+        releaseAll(collections);
+        releaseAll(objects);
+        m_iconStore->discardPending();
+        return Failed;
+    }
+
+    // the icons of the previous list are replaced by commitReferences() below
+    if (m_committed && m_committedSnapshot.identifier != snapshot.identifier)
+        m_iconStore->releaseReferences(m_committedSnapshot.identifier, this);
+    releaseAll(m_committedCollections);
+    releaseAll(m_committedItems);
+    m_committed = true;
+    m_committedSnapshot = snapshot;
+    m_committedCollections = collections;
+    m_committedItems = objects;
+    m_committedIconPaths = iconPaths;
+    m_iconStore->commitReferences(snapshot.identifier, this);
+    m_iconStore->collectGarbage();
+    return Committed;
+}
+
+QT_END_NAMESPACE
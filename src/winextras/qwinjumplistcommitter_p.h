@@ -0,0 +1,113 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINJUMPLISTCOMMITTER_P_H
+#define QWINJUMPLISTCOMMITTER_P_H
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+#include <QtGui/QImage>
+
+#include "qwinshellbackend_p.h"
+#include "qwinjumplistsnapshot_p.h"
+
+QT_BEGIN_NAMESPACE
+
+class QWinIconStore;
+
+// Provides the icons of the links of a jump list, only asked for those that
+// are not reused. Items are numbered across all categories.
+class QWinJumpListIconSource
+{
+public:
+    virtual ~QWinJumpListIconSource() {}
+    virtual QImage icon(int item) = 0;
+};
+
+// Passes jump list snapshots to the shell. Nothing is committed if nothing
+// changed since the last commit, and the shell objects of unchanged
+// categories and items are reused instead of being created again.
+class QWinJumpListCommitter
+{
+public:
+    enum Result
+    {
+        Unchanged,
+        Committed,
+        Failed
+    };
+
+    QWinJumpListCommitter(QWinShellBackend *backend, QWinIconStore *iconStore);
+    ~QWinJumpListCommitter();
+
+    Result commit(const QWinJumpListSnapshot &snapshot, QWinJumpListIconSource *icons);
+    void releaseCommitted();
+
+    bool isCommitted() const { return m_committed; }
+    const QWinJumpListSnapshot &committedSnapshot() const { return m_committedSnapshot; }
+
+    int createdObjectCount() const { return m_createdObjectCount; }
+    int reusedObjectCount() const { return m_reusedObjectCount; }
+
+private:
+    Q_DISABLE_COPY(QWinJumpListCommitter)
+
+    QWinShellBackend::Object createItem(const QWinJumpListItemSnapshot &item, int index,
+                                        QWinJumpListIconSource *icons, QString *iconPath);
+    void releaseAll(const QVector<QWinShellBackend::Object> &objects);
+
+    QWinShellBackend *m_backend;
+    QWinIconStore *m_iconStore;
+
+    // what the shell got on the last successful commit
+    bool m_committed;
+    QWinJumpListSnapshot m_committedSnapshot;
+    QVector<QWinShellBackend::Object> m_committedCollections;
+    QVector<QWinShellBackend::Object> m_committedItems;
+    QVector<QString> m_committedIconPaths;
+
+    int m_createdObjectCount;
+    int m_reusedObjectCount;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINJUMPLISTCOMMITTER_P_H
@@ -0,0 +1,133 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinjumplistdocumentloader_p.h"
+
+QT_BEGIN_NAMESPACE
+
+// Lists the documents on the shell thread. The loader is only called back
+// for asynchronous loads.
+class QWinJumpListDocumentJob : public QWinShellJob
+{
+public:
+    QWinJumpListDocumentJob(QWinJumpListDocumentLoader *loader, QWinShellBackend *backend,
+                            const QString &appId, QWinShellBackend::DocumentList list) :
+        m_loader(loader), m_backend(backend), m_appId(appId), m_list(list), m_hresult(0) {}
+
+    void run() Q_DECL_OVERRIDE
+    {
+        m_hresult = m_backend->documents(m_appId, m_list, &m_documents);
+    }
+
+    void finish() Q_DECL_OVERRIDE
+    {
+        if (!m_loader)
+            return;
+        m_loader->m_loading = false;
+        m_loader->m_receiver->documentsLoaded(m_hresult, m_documents);
+    }
+
+    qint32 result() const { return m_hresult; }
+    const QVector<QWinShellDocument> &documents() const { return m_documents; }
+
+private:
+    QWinJumpListDocumentLoader *m_loader;
+    QWinShellBackend *m_backend;
+    const QString m_appId;
+    const QWinShellBackend::DocumentList m_list;
+    qint32 m_hresult;
+    QVector<QWinShellDocument> m_documents;
+};
+
+QWinJumpListDocumentLoader::QWinJumpListDocumentLoader(QWinShellExecutor *executor, QWinShellBackend *backend, QWinJumpListDocumentReceiver *receiver) :
+    m_executor(executor), m_backend(backend), m_receiver(receiver), m_loading(false)
+{
+}
+
+QWinJumpListDocumentLoader::~QWinJumpListDocumentLoader()
+{
+    cancel();
+}
+
+/*
+    Lists the documents once the jobs queued on the shell thread have run,
+    and waits for them. A pending asynchronous load is cancelled, the
+    receiver is not called.
+ */
+qint32 QWinJumpListDocumentLoader::load(const QString &appId, QWinShellBackend::DocumentList list, QVector<QWinShellDocument> *documents)
+{
+    cancel();
+    QWinJumpListDocumentJob job(0, m_backend, appId, list);
+    if (m_executor)
+        m_executor->call(&job);
+    else
+        job.run();
+    *documents = job.documents();
+    return job.result();
+}
+
+/*
+    Lists the documents on the shell thread, and calls the receiver once
+    they have been listed. A pending load is cancelled first.
+ */
+void QWinJumpListDocumentLoader::loadAsync(const QString &appId, QWinShellBackend::DocumentList list)
+{
+    cancel();
+    if (!m_executor)
+        return;
+    m_loading = true;
+    m_executor->post(new QWinJumpListDocumentJob(this, m_backend, appId, list), this);
+}
+
+/*
+    Stops waiting for the documents being listed. The shell is not
+    interrupted, but its result is dropped.
+ */
+void QWinJumpListDocumentLoader::cancel()
+{
+    if (!m_loading)
+        return;
+    m_loading = false;
+    if (m_executor)
+        m_executor->cancel(this);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,89 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINJUMPLISTDOCUMENTLOADER_P_H
+#define QWINJUMPLISTDOCUMENTLOADER_P_H
+
+#include <QtCore/QPointer>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "qwinshellbackend_p.h"
+#include "qwinshellexecutor_p.h"
+
+QT_BEGIN_NAMESPACE
+
+// Receives the documents loaded by a QWinJumpListDocumentLoader.
+class QWinJumpListDocumentReceiver
+{
+public:
+    virtual ~QWinJumpListDocumentReceiver() {}
+    virtual void documentsLoaded(qint32 hresult, const QVector<QWinShellDocument> &documents) = 0;
+};
+
+// Lists the recent or frequent documents of an application. Listing them
+// makes the shell resolve every item, so it can be left to the shell
+// thread. The receiver is then called back on the GUI thread, unless the
+// load was cancelled or the loader destroyed in the meantime.
+class Q_WINEXTRAS_EXPORT QWinJumpListDocumentLoader
+{
+public:
+    QWinJumpListDocumentLoader(QWinShellExecutor *executor, QWinShellBackend *backend, QWinJumpListDocumentReceiver *receiver);
+    ~QWinJumpListDocumentLoader();
+
+    qint32 load(const QString &appId, QWinShellBackend::DocumentList list, QVector<QWinShellDocument> *documents);
+    void loadAsync(const QString &appId, QWinShellBackend::DocumentList list);
+    bool isLoading() const { return m_loading; }
+    void cancel();
+
+private:
+    Q_DISABLE_COPY(QWinJumpListDocumentLoader)
+    friend class QWinJumpListDocumentJob;
+
+    QPointer<QWinShellExecutor> m_executor;
+    QWinShellBackend *m_backend;
+    QWinJumpListDocumentReceiver *m_receiver;
+    bool m_loading;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINJUMPLISTDOCUMENTLOADER_P_H
@@ -0,0 +1,172 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinjumplistsnapshot_p.h"
+
+#include <QtCore/QHash>
+
+QT_BEGIN_NAMESPACE
+
+bool operator==(const QWinJumpListItemSnapshot &lhs, const QWinJumpListItemSnapshot &rhs)
+{
+    return lhs.type == rhs.type
+        && lhs.iconKey == rhs.iconKey
+        && lhs.filePath == rhs.filePath
+        && lhs.workingDirectory == rhs.workingDirectory
+        && lhs.title == rhs.title
+        && lhs.description == rhs.description
+        && lhs.arguments == rhs.arguments;
+}
+
+uint qHash(const QWinJumpListItemSnapshot &item, uint seed)
+{
+    uint hash = seed ^ uint(item.type) ^ qHash(item.iconKey);
+    hash = 31 * hash + qHash(item.filePath);
+    hash = 31 * hash + qHash(item.title);
+    foreach (const QString &argument, item.arguments)
+        hash = 31 * hash + qHash(argument);
+    return hash;
+}
+
+bool operator==(const QWinJumpListCategorySnapshot &lhs, const QWinJumpListCategorySnapshot &rhs)
+{
+    return lhs.type == rhs.type && lhs.title == rhs.title && lhs.items == rhs.items;
+}
+
+bool operator==(const QWinJumpListSnapshot &lhs, const QWinJumpListSnapshot &rhs)
+{
+    return lhs.identifier == rhs.identifier && lhs.categories == rhs.categories;
+}
+
+int QWinJumpListSnapshot::itemCount() const
+{
+    int count = 0;
+    foreach (const QWinJumpListCategorySnapshot &category, categories)
+        count += category.items.size();
+    return count;
+}
+
+int QWinJumpListDiff::reusedCategoryCount() const
+{
+    return categories.size() - categories.count(-1);
+}
+
+int QWinJumpListDiff::reusedItemCount() const
+{
+    return items.size() - items.count(-1);
+}
+
+/*
+    Compares the snapshot of the last commit, \a from, to the current one, \a to.
+
+    Categories are matched as a whole first, so that an unchanged category
+    keeps its items. The remaining items are matched by value, wherever they
+    were before, so that moving an item or changing its neighbours does not
+    require converting it again.
+ */
+QWinJumpListDiff qt_winDiffJumpLists(const QWinJumpListSnapshot &from, const QWinJumpListSnapshot &to)
+{
+    QWinJumpListDiff diff;
+    diff.changed = from != to;
+    diff.categories.fill(-1, to.categories.size());
+    diff.items.fill(-1, to.itemCount());
+
+    QVector<int> firstItem(from.categories.size());
+    for (int c = 0, item = 0; c < from.categories.size(); ++c) {
+        firstItem[c] = item;
+        item += from.categories.at(c).items.size();
+    }
+
+    QVector<bool> categoryUsed(from.categories.size(), false);
+    QVector<bool> itemUsed(from.itemCount(), false);
+    for (int c = 0, item = 0; c < to.categories.size(); ++c) {
+        const QWinJumpListCategorySnapshot &category = to.categories.at(c);
+        // Usually the categories stay where they are.
+        int match = -1;
+        if (c < from.categories.size() && !categoryUsed.at(c) && from.categories.at(c) == category) {
+            match = c;
+        } else {
+            for (int i = 0; i < from.categories.size(); ++i) {
+                if (!categoryUsed.at(i) && from.categories.at(i) == category) {
+                    match = i;
+                    break;
+                }
+            }
+        }
+        if (match >= 0) {
+            categoryUsed[match] = true;
+            diff.categories[c] = match;
+            for (int i = 0; i < category.items.size(); ++i) {
+                diff.items[item + i] = firstItem.at(match) + i;
+                itemUsed[firstItem.at(match) + i] = true;
+            }
+        }
+        item += category.items.size();
+    }
+
+    QMultiHash<QWinJumpListItemSnapshot, int> available;
+    for (int c = from.categories.size() - 1; c >= 0; --c) {
+        const QVector<QWinJumpListItemSnapshot> &items = from.categories.at(c).items;
+        for (int i = items.size() - 1; i >= 0; --i) {
+            if (!itemUsed.at(firstItem.at(c) + i))
+                available.insert(items.at(i), firstItem.at(c) + i);
+        }
+    }
+    if (available.isEmpty())
+        return diff;
+
+    for (int c = 0, item = 0; c < to.categories.size(); ++c) {
+        const QVector<QWinJumpListItemSnapshot> &items = to.categories.at(c).items;
+        if (diff.categories.at(c) < 0) {
+            for (int i = 0; i < items.size(); ++i) {
+                const QMultiHash<QWinJumpListItemSnapshot, int>::iterator it = available.find(items.at(i));
+                if (it != available.end()) {
+                    diff.items[item + i] = it.value();
+                    available.erase(it);
+                }
+            }
+        }
+        item += items.size();
+    }
+    return diff;
+}
+
+QT_END_NAMESPACE
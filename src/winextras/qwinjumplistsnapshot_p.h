@@ -0,0 +1,127 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINJUMPLISTSNAPSHOT_P_H
+#define QWINJUMPLISTSNAPSHOT_P_H
+
+#include "qwinjumplistitem.h"
+#include "qwinjumplistcategory.h"
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+QT_BEGIN_NAMESPACE
+
+// The state of a jump list as it was passed to the shell, used to find out
+// what changed between two commits.
+struct QWinJumpListItemSnapshot
+{
+    QWinJumpListItemSnapshot() : type(QWinJumpListItem::Link), iconKey(0) {}
+
+    QWinJumpListItem::Type type;
+    QString filePath;
+    QString workingDirectory;
+    QString title;
+    QString description;
+    QStringList arguments;
+    qint64 iconKey;
+};
+
+bool operator==(const QWinJumpListItemSnapshot &lhs, const QWinJumpListItemSnapshot &rhs);
+inline bool operator!=(const QWinJumpListItemSnapshot &lhs, const QWinJumpListItemSnapshot &rhs)
+{
+    return !(lhs == rhs);
+}
+uint qHash(const QWinJumpListItemSnapshot &item, uint seed = 0);
+
+// Known categories (recent, frequent) are maintained by the shell,
+// only their visibility is part of the snapshot.
+struct QWinJumpListCategorySnapshot
+{
+    QWinJumpListCategorySnapshot() : type(QWinJumpListCategory::Custom) {}
+
+    QWinJumpListCategory::Type type;
+    QString title;
+    QVector<QWinJumpListItemSnapshot> items;
+};
+
+bool operator==(const QWinJumpListCategorySnapshot &lhs, const QWinJumpListCategorySnapshot &rhs);
+inline bool operator!=(const QWinJumpListCategorySnapshot &lhs, const QWinJumpListCategorySnapshot &rhs)
+{
+    return !(lhs == rhs);
+}
+
+// The visible categories, in the order they are appended to the list.
+struct QWinJumpListSnapshot
+{
+    QString identifier;
+    QVector<QWinJumpListCategorySnapshot> categories;
+
+    int itemCount() const;
+};
+
+bool operator==(const QWinJumpListSnapshot &lhs, const QWinJumpListSnapshot &rhs);
+inline bool operator!=(const QWinJumpListSnapshot &lhs, const QWinJumpListSnapshot &rhs)
+{
+    return !(lhs == rhs);
+}
+
+// For every category and item of the new snapshot, the index of an equal
+// one in the old snapshot whose native object can be reused, or -1. Items
+// are numbered across all categories.
+struct QWinJumpListDiff
+{
+    QWinJumpListDiff() : changed(false) {}
+
+    bool changed;
+    QVector<int> categories;
+    QVector<int> items;
+
+    int reusedCategoryCount() const;
+    int reusedItemCount() const;
+};
+
+QWinJumpListDiff qt_winDiffJumpLists(const QWinJumpListSnapshot &from, const QWinJumpListSnapshot &to);
+
+QT_END_NAMESPACE
+
+#endif // QWINJUMPLISTSNAPSHOT_P_H
@@ -0,0 +1,647 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinnativeshellbackend_p.h"
+#include "qwininstrumentedshellbackend_p.h"
+#include "qwinshellmetrics_p.h"
+#include "qwinshellexecutor_p.h"
+#include "qwinfunctions.h"
+#include "qwinfunctions_p.h"
+#include "qwincommandline_p.h"
+#include "winshobjidl_p.h"
+#include "winpropkey_p.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QVarLengthArray>
+#include <qt_windows.h>
+#include <propvarutil.h>
+#include <shlobj.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_STATIC_ASSERT(QWinShellBackend::FrequentCategory == KDC_FREQUENT);
+Q_STATIC_ASSERT(QWinShellBackend::RecentCategory == KDC_RECENT);
+Q_STATIC_ASSERT(QWinShellBackend::RecentDocuments == ADLT_RECENT);
+Q_STATIC_ASSERT(QWinShellBackend::FrequentDocuments == ADLT_FREQUENT);
+
+static void warning(const char *message, HRESULT hresult)
+{
+    const QString err = QtWin::errorStringFromHresult(hresult);
+    qWarning("%s: %#010x, %s.", message, (unsigned)hresult, qPrintable(err));
+}
+
+static TBPFLAG nativeProgressState(QWinTaskbarProgressState state)
+{
+    switch (state) {
+    case QWinTaskbarProgressIndeterminate:
+        return TBPF_INDETERMINATE;
+    case QWinTaskbarProgressNormal:
+        return TBPF_NORMAL;
+    case QWinTaskbarProgressError:
+        return TBPF_ERROR;
+    case QWinTaskbarProgressPaused:
+        return TBPF_PAUSED;
+    default:
+        return TBPF_NOPROGRESS;
+    }
+}
+
+static void toNativeButtons(const QWinThumbnailButton *buttons, int count, THUMBBUTTON *nativeButtons)
+{
+    for (int i = 0; i < count; ++i) {
+        THUMBBUTTON &button = nativeButtons[i];
+        memset(&button, 0, sizeof button);
+        button.iId = buttons[i].id;
+        button.dwMask = THUMBBUTTONMASK(buttons[i].mask);
+        button.dwFlags = THUMBBUTTONFLAGS(buttons[i].flags);
+        button.hIcon = reinterpret_cast<HICON>(buttons[i].icon);
+        const QString toolTip = buttons[i].toolTip.left(sizeof(button.szTip) / sizeof(button.szTip[0]) - 1);
+        button.szTip[toolTip.toWCharArray(button.szTip)] = 0;
+    }
+}
+
+static inline IUnknown *toUnknown(QWinShellBackend::Object object)
+{
+    return reinterpret_cast<IUnknown *>(object);
+}
+
+static inline QWinShellBackend::Object toObject(IUnknown *unknown)
+{
+    return reinterpret_cast<QWinShellBackend::Object>(unknown);
+}
+
+static HRESULT setAppId(IApplicationDocumentLists *lists, const QString &appId)
+{
+    if (appId.isEmpty())
+        return S_OK;
+    wchar_t *id = qt_qstringToNullTerminated(appId);
+    const HRESULT hresult = lists->SetAppID(id);
+    delete[] id;
+    return hresult;
+}
+
+static bool fromIShellLink(IShellLinkW *link, QWinShellDocument *document)
+{
+    document->type = QWinJumpListItem::Link;
+
+    IPropertyStore *linkProps;
+    if (SUCCEEDED(link->QueryInterface(IID_IPropertyStore, reinterpret_cast<void **>(&linkProps)))) {
+        PROPVARIANT var;
+        linkProps->GetValue(PKEY_Link_Arguments, &var);
+        document->arguments = QString::fromWCharArray(var.pwszVal);
+        PropVariantClear(&var);
+        linkProps->Release();
+    }
+
+    const int buffersize = 2048;
+    wchar_t buffer[buffersize];
+
+    link->GetDescription(buffer, INFOTIPSIZE);
+    document->description = QString::fromWCharArray(buffer);
+
+    int dummyindex;
+    link->GetIconLocation(buffer, buffersize-1, &dummyindex);
+    document->iconPath = QString::fromWCharArray(buffer);
+
+    link->GetPath(buffer, buffersize-1, 0, 0);
+    document->filePath = QDir::fromNativeSeparators(QString::fromWCharArray(buffer));
+    return true;
+}
+
+static bool fromIShellItem(IShellItem2 *shellitem, QWinShellDocument *document)
+{
+    document->type = QWinJumpListItem::Destination;
+    wchar_t *strPtr = 0;
+    if (FAILED(shellitem->GetDisplayName(SIGDN_FILESYSPATH, &strPtr)))
+        return false;
+    document->filePath = QDir::fromNativeSeparators(QString::fromWCharArray(strPtr));
+    CoTaskMemFree(strPtr);
+    return true;
+}
+
+static void fromComCollection(IObjectArray *array, QVector<QWinShellDocument> *documents)
+{
+    UINT count = 0;
+    array->GetCount(&count);
+    documents->reserve(count);
+    for (UINT i = 0; i < count; ++i) {
+        IUnknown *collectionItem = 0;
+        HRESULT hresult = array->GetAt(i, IID_IUnknown, reinterpret_cast<void **>(&collectionItem));
+        if (FAILED(hresult)) {
+            warning("QWinJumpList: GetAt() failed", hresult);
+            continue;
+        }
+        IShellItem2 *shellItem = 0;
+        IShellLinkW *shellLink = 0;
+        QWinShellDocument document;
+        bool ok = false;
+        if (SUCCEEDED(collectionItem->QueryInterface(IID_IShellItem2, reinterpret_cast<void **>(&shellItem)))) {
+            ok = fromIShellItem(shellItem, &document);
+            shellItem->Release();
+        } else if (SUCCEEDED(collectionItem->QueryInterface(IID_IShellLinkW, reinterpret_cast<void **>(&shellLink)))) {
+            ok = fromIShellLink(shellLink, &document);
+            shellLink->Release();
+        } else {
+            qWarning("QWinJumpList: object of unexpected class found");
+        }
+        collectionItem->Release();
+        if (ok)
+            documents->append(document);
+    }
+}
+
+static void releaseNativeShellInterfaces();
+
+QWinNativeShellBackend::QWinNativeShellBackend() :
+    m_taskbarList(0), m_taskbarListResult(S_OK),
+    m_destinationList(0), m_destinationListResult(S_OK)
+{
+    // COM is uninitialized with the platform integration, after the post routines
+    qAddPostRoutine(releaseNativeShellInterfaces);
+}
+
+QWinNativeShellBackend::~QWinNativeShellBackend()
+{
+    releaseInterfaces();
+}
+
+void QWinNativeShellBackend::releaseInterfaces()
+{
+    if (m_taskbarList) {
+        m_taskbarList->Release();
+        m_taskbarList = 0;
+    }
+    releaseDestinationList();
+}
+
+qint32 QWinNativeShellBackend::taskbarList(ITaskbarList4 **taskbarList)
+{
+    if (!m_taskbarList && SUCCEEDED(m_taskbarListResult)) {
+        HRESULT hresult = CoCreateInstance(CLSID_TaskbarList, 0, CLSCTX_INPROC_SERVER, IID_ITaskbarList4, reinterpret_cast<void **>(&m_taskbarList));
+        if (FAILED(hresult)) {
+            m_taskbarList = 0;
+            warning("QtWinExtras: IID_ITaskbarList4 was not created", hresult);
+        } else if (FAILED(hresult = m_taskbarList->HrInit())) {
+            m_taskbarList->Release();
+            m_taskbarList = 0;
+            warning("QtWinExtras: IID_ITaskbarList4 was not initialized", hresult);
+        }
+        m_taskbarListResult = hresult;
+    }
+    *taskbarList = m_taskbarList;
+    return m_taskbarList ? S_OK : m_taskbarListResult;
+}
+
+/*
+    Returns the destination list begun by beginList(). Each list gets a
+    destination list of its own, which is released once it is committed, so
+    that a list is never committed under the AppID of another one.
+ */
+qint32 QWinNativeShellBackend::destinationList(ICustomDestinationList **destinationList)
+{
+    *destinationList = m_destinationList;
+    return m_destinationList ? S_OK : E_UNEXPECTED;
+}
+
+void QWinNativeShellBackend::releaseDestinationList()
+{
+    if (m_destinationList) {
+        m_destinationList->Release();
+        m_destinationList = 0;
+    }
+}
+
+qint32 QWinNativeShellBackend::setProgressValue(quintptr window, quint64 completed, quint64 total)
+{
+    ITaskbarList4 *list;
+    HRESULT hresult = taskbarList(&list);
+    if (SUCCEEDED(hresult))
+        hresult = list->SetProgressValue(reinterpret_cast<HWND>(window), completed, total);
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::setProgressState(quintptr window, QWinTaskbarProgressState state)
+{
+    ITaskbarList4 *list;
+    HRESULT hresult = taskbarList(&list);
+    if (SUCCEEDED(hresult))
+        hresult = list->SetProgressState(reinterpret_cast<HWND>(window), nativeProgressState(state));
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::setOverlayIcon(quintptr window, quintptr icon, const QString &description)
+{
+    ITaskbarList4 *list;
+    HRESULT hresult = taskbarList(&list);
+    if (SUCCEEDED(hresult)) {
+        wchar_t *descrPtr = description.isEmpty() ? 0 : qt_qstringToNullTerminated(description);
+        hresult = list->SetOverlayIcon(reinterpret_cast<HWND>(window), reinterpret_cast<HICON>(icon), descrPtr);
+        delete[] descrPtr;
+    }
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::addThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count)
+{
+    ITaskbarList4 *list;
+    HRESULT hresult = taskbarList(&list);
+    if (SUCCEEDED(hresult)) {
+        QVarLengthArray<THUMBBUTTON, QWinThumbnailToolBarState::SlotCount> nativeButtons(count);
+        toNativeButtons(buttons, count, nativeButtons.data());
+        hresult = list->ThumbBarAddButtons(reinterpret_cast<HWND>(window), count, nativeButtons.data());
+    }
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::updateThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count)
+{
+    ITaskbarList4 *list;
+    HRESULT hresult = taskbarList(&list);
+    if (SUCCEEDED(hresult)) {
+        QVarLengthArray<THUMBBUTTON, QWinThumbnailToolBarState::SlotCount> nativeButtons(count);
+        toNativeButtons(buttons, count, nativeButtons.data());
+        hresult = list->ThumbBarUpdateButtons(reinterpret_cast<HWND>(window), count, nativeButtons.data());
+    }
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::beginList(const QString &appId)
+{
+    // a list that has not been committed is abandoned
+    if (m_destinationList) {
+        m_destinationList->AbortList();
+        releaseDestinationList();
+    }
+    if (FAILED(m_destinationListResult))
+        return m_destinationListResult;
+
+    ICustomDestinationList *list = 0;
+    HRESULT hresult = CoCreateInstance(CLSID_DestinationList, 0, CLSCTX_INPROC_SERVER, IID_ICustomDestinationList, reinterpret_cast<void **>(&list));
+    if (FAILED(hresult)) {
+        warning("QWinJumpList: IID_ICustomDestinationList was not created", hresult);
+        m_destinationListResult = hresult;
+        return hresult;
+    }
+    if (!appId.isEmpty()) {
+        wchar_t *id = qt_qstringToNullTerminated(appId);
+        hresult = list->SetAppID(id);
+        delete[] id;
+    }
+    if (SUCCEEDED(hresult)) {
+        UINT maxSlots = 0;
+        IUnknown *array = 0;
+        hresult = list->BeginList(&maxSlots, IID_IUnknown, reinterpret_cast<void **>(&array));
+        if (array)
+            array->Release();
+    }
+    if (SUCCEEDED(hresult))
+        m_destinationList = list;
+    else
+        list->Release();
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::appendKnownCategory(KnownCategory category)
+{
+    ICustomDestinationList *list;
+    HRESULT hresult = destinationList(&list);
+    if (SUCCEEDED(hresult))
+        hresult = list->AppendKnownCategory(KNOWNDESTCATEGORY(category));
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::appendCategory(const QString &title, Object collection)
+{
+    ICustomDestinationList *list;
+    HRESULT hresult = destinationList(&list);
+    if (SUCCEEDED(hresult)) {
+        wchar_t *wtitle = qt_qstringToNullTerminated(title);
+        hresult = list->AppendCategory(wtitle, static_cast<IObjectCollection *>(toUnknown(collection)));
+        delete[] wtitle;
+    }
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::addUserTasks(Object collection)
+{
+    ICustomDestinationList *list;
+    HRESULT hresult = destinationList(&list);
+    if (SUCCEEDED(hresult))
+        hresult = list->AddUserTasks(static_cast<IObjectCollection *>(toUnknown(collection)));
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::commitList()
+{
+    ICustomDestinationList *list;
+    HRESULT hresult = destinationList(&list);
+    if (SUCCEEDED(hresult)) {
+        hresult = list->CommitList();
+        releaseDestinationList();
+    }
+    return hresult;
+}
+
+QWinShellBackend::Object QWinNativeShellBackend::createLink(const QWinJumpListItemSnapshot &item, const QString &iconPath)
+{
+    IShellLinkW *link = 0;
+    HRESULT hresult = CoCreateInstance(CLSID_ShellLink, 0, CLSCTX_INPROC_SERVER, IID_IShellLinkW, reinterpret_cast<void **>(&link));
+    if (FAILED(hresult)) {
+        warning("QWinJumpList: IID_IShellLinkW was not created", hresult);
+        return 0;
+    }
+
+    const QString args = qt_winCreateArguments(item.arguments);
+    const int bufferSize = qMax(args.size(), qMax(item.workingDirectory.size(), qMax(item.description.size(), qMax(item.title.size(), qMax(item.filePath.size(), iconPath.size()))))) + 1;
+    wchar_t *buffer = new wchar_t[bufferSize];
+
+    if (!item.description.isEmpty()) {
+        qt_qstringToNullTerminated(item.description, buffer);
+        link->SetDescription(buffer);
+    }
+
+    qt_qstringToNullTerminated(item.filePath, buffer);
+    link->SetPath(buffer);
+
+    if (!item.workingDirectory.isEmpty()) {
+        qt_qstringToNullTerminated(item.workingDirectory, buffer);
+        link->SetWorkingDirectory(buffer);
+    }
+
+    qt_qstringToNullTerminated(args, buffer);
+    link->SetArguments(buffer);
+
+    if (!iconPath.isEmpty()) {
+        qt_qstringToNullTerminated(QDir::toNativeSeparators(iconPath), buffer);
+        link->SetIconLocation(buffer, 0);
+    }
+
+    IPropertyStore *properties;
+    PROPVARIANT titlepv;
+    hresult = link->QueryInterface(IID_IPropertyStore, reinterpret_cast<void **>(&properties));
+    if (FAILED(hresult)) {
+        delete[] buffer;
+        link->Release();
+        return 0;
+    }
+
+    qt_qstringToNullTerminated(item.title, buffer);
+    InitPropVariantFromString(buffer, &titlepv);
+    properties->SetValue(PKEY_Title, titlepv);
+    properties->Commit();
+    properties->Release();
+    PropVariantClear(&titlepv);
+
+    delete[] buffer;
+    return toObject(link);
+}
+
+QWinShellBackend::Object QWinNativeShellBackend::createDestination(const QString &filePath)
+{
+    IShellItem2 *shellitem = 0;
+    wchar_t *buffer = qt_qstringToNullTerminated(filePath);
+    qt_SHCreateItemFromParsingName(buffer, 0, IID_IShellItem2, reinterpret_cast<void **>(&shellitem));
+    delete[] buffer;
+    return toObject(shellitem);
+}
+
+QWinShellBackend::Object QWinNativeShellBackend::createSeparator()
+{
+    IShellLinkW *separator;
+    HRESULT res = CoCreateInstance(CLSID_ShellLink, 0, CLSCTX_INPROC_SERVER, IID_IShellLinkW, reinterpret_cast<void **>(&separator));
+    if (FAILED(res))
+        return 0;
+
+    IPropertyStore *properties;
+    res = separator->QueryInterface(IID_IPropertyStore, reinterpret_cast<void **>(&properties));
+    if (FAILED(res)) {
+        separator->Release();
+        return 0;
+    }
+
+    PROPVARIANT isSeparator;
+    InitPropVariantFromBoolean(TRUE, &isSeparator);
+    properties->SetValue(PKEY_AppUserModel_IsDestListSeparator, isSeparator);
+    properties->Commit();
+    properties->Release();
+    PropVariantClear(&isSeparator);
+
+    return toObject(separator);
+}
+
+QWinShellBackend::Object QWinNativeShellBackend::createCollection(const Object *objects, int count)
+{
+    IObjectCollection *collection = 0;
+    HRESULT hresult = CoCreateInstance(CLSID_EnumerableObjectCollection, 0, CLSCTX_INPROC_SERVER, IID_IObjectCollection, reinterpret_cast<void **>(&collection));
+    if (FAILED(hresult)) {
+        warning("QWinJumpList: IID_IObjectCollection was not created", hresult);
+        return 0;
+    }
+    for (int i = 0; i < count; ++i) {
+        if (objects[i])
+            collection->AddObject(toUnknown(objects[i]));
+    }
+    return toObject(collection);
+}
+
+void QWinNativeShellBackend::addRef(Object object)
+{
+    toUnknown(object)->AddRef();
+}
+
+void QWinNativeShellBackend::release(Object object)
+{
+    toUnknown(object)->Release();
+}
+
+qint32 QWinNativeShellBackend::documents(const QString &appId, DocumentList list, QVector<QWinShellDocument> *documents)
+{
+    // the shell thread is an apartment already, but not every caller is
+    const HRESULT initialized = CoInitializeEx(0, COINIT_APARTMENTTHREADED);
+    IApplicationDocumentLists *pDocList = 0;
+    HRESULT hresult = CoCreateInstance(CLSID_ApplicationDocumentLists, 0, CLSCTX_INPROC_SERVER, IID_IApplicationDocumentLists, reinterpret_cast<void **>(&pDocList));
+    if (SUCCEEDED(hresult)) {
+        hresult = setAppId(pDocList, appId);
+        if (SUCCEEDED(hresult)) {
+            IObjectArray *array = 0;
+            hresult = pDocList->GetList(APPDOCLISTTYPE(list), 0, IID_IObjectArray, reinterpret_cast<void **>(&array));
+            if (SUCCEEDED(hresult)) {
+                fromComCollection(array, documents);
+                array->Release();
+            }
+        }
+        pDocList->Release();
+    }
+    if (initialized != RPC_E_CHANGED_MODE)
+        CoUninitialize();
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::addRecentDocument(const QString &appId, const QWinJumpListItemSnapshot &item, const QString &iconPath)
+{
+    IShellLinkW *link = static_cast<IShellLinkW *>(toUnknown(createLink(item, iconPath)));
+    if (!link)
+        return E_FAIL;
+    wchar_t *id = qt_qstringToNullTerminated(appId);
+    SHARDAPPIDINFOLINK info;
+    info.pszAppID = id;
+    info.psl = link;
+    SHAddToRecentDocs(SHARD_APPIDINFOLINK, &info);
+    link->Release();
+    delete[] id;
+    return S_OK;
+}
+
+qint32 QWinNativeShellBackend::clearDocuments(const QString &appId)
+{
+    IApplicationDestinations *pDest = 0;
+    HRESULT hresult = CoCreateInstance(CLSID_ApplicationDestinations, 0, CLSCTX_INPROC_SERVER, IID_IApplicationDestinations, reinterpret_cast<void **>(&pDest));
+    if (SUCCEEDED(hresult)) {
+        if (!appId.isEmpty()) {
+            wchar_t *id = qt_qstringToNullTerminated(appId);
+            hresult = pDest->SetAppID(id);
+            delete[] id;
+        }
+        if (SUCCEEDED(hresult))
+            hresult = pDest->RemoveAllDestinations();
+        pDest->Release();
+    }
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::setWindowAttribute(quintptr window, quint32 attribute, const void *value, quint32 size)
+{
+    return qt_DwmSetWindowAttribute(reinterpret_cast<HWND>(window), attribute, value, size);
+}
+
+qint32 QWinNativeShellBackend::windowAttribute(quintptr window, quint32 attribute, void *value, quint32 size)
+{
+    return qt_DwmGetWindowAttribute(reinterpret_cast<HWND>(window), attribute, value, size);
+}
+
+qint32 QWinNativeShellBackend::extendFrameIntoClientArea(quintptr window, int left, int top, int right, int bottom)
+{
+    MARGINS margins = {left, right, top, bottom};
+    return qt_DwmExtendFrameIntoClientArea(reinterpret_cast<HWND>(window), &margins);
+}
+
+qint32 QWinNativeShellBackend::enableBlurBehindWindow(quintptr window, bool enable, quintptr region)
+{
+    qt_DWM_BLURBEHIND dwmbb = {0, 0, 0, 0};
+    dwmbb.dwFlags = qt_DWM_BB_ENABLE;
+    dwmbb.fEnable = enable;
+    if (region) {
+        dwmbb.hRgnBlur = reinterpret_cast<HRGN>(region);
+        dwmbb.dwFlags |= qt_DWM_BB_BLURREGION;
+    }
+    return qt_DwmEnableBlurBehindWindow(reinterpret_cast<HWND>(window), &dwmbb);
+}
+
+qint32 QWinNativeShellBackend::isCompositionEnabled(bool *enabled)
+{
+    BOOL dwmEnabled = FALSE;
+    const HRESULT hresult = qt_DwmIsCompositionEnabled(&dwmEnabled);
+    *enabled = dwmEnabled;
+    return hresult;
+}
+
+qint32 QWinNativeShellBackend::enableComposition(bool enable)
+{
+    return qt_DwmEnableComposition(enable);
+}
+
+qint32 QWinNativeShellBackend::colorizationColor(quint32 *argb, bool *opaqueBlend)
+{
+    DWORD colorization = 0;
+    BOOL opaque = FALSE;
+    const HRESULT hresult = qt_DwmGetColorizationColor(&colorization, &opaque);
+    *argb = colorization;
+    *opaqueBlend = opaque;
+    return hresult;
+}
+
+Q_GLOBAL_STATIC(QWinNativeShellBackend, nativeShellBackend)
+
+// The interfaces belong to the apartment of the shell thread they were
+// created in.
+class QWinReleaseInterfacesJob : public QWinShellJob
+{
+public:
+    void run() Q_DECL_OVERRIDE
+    {
+        nativeShellBackend()->releaseInterfaces();
+    }
+};
+
+static void releaseNativeShellInterfaces()
+{
+    if (nativeShellBackend.isDestroyed())
+        return;
+    QWinReleaseInterfacesJob job;
+    qt_winShellExecutor()->call(&job);
+}
+
+Q_GLOBAL_STATIC_WITH_ARGS(QWinInstrumentedShellBackend, instrumentedShellBackend,
+                          (nativeShellBackend(), QWinShellMetrics::instance()))
+
+static QWinShellBackend *shellBackend = 0;
+
+/*
+    The backend all taskbar buttons, thumbnail toolbars, jump lists and QtWin
+    DWM functions go through: QWinNativeShellBackend, instrumented with the
+    shell metrics, unless replaced.
+ */
+QWinShellBackend *qt_winShellBackend()
+{
+    return shellBackend ? shellBackend : instrumentedShellBackend();
+}
+
+/*
+    Replaces the backend, typically with one that records the calls. It is
+    not owned and has to outlive the objects created while it is set.
+ */
+void qt_winSetShellBackend(QWinShellBackend *backend)
+{
+    shellBackend = backend;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,362 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinpixelconversion_p.h"
+
+#include <QtCore/QVarLengthArray>
+#include <QtCore/private/qsimd_p.h>
+
+#include <string.h>
+
+// MSVC does not define __SSE2__, but always has SSE2 on x64 and with /arch:SSE2.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define QT_WIN_PIXEL_SSE2
+#  include <emmintrin.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+const quint32 qt_winInverseAlphaTable[256] = {
+    0x00000000, 0x00ff00ff, 0x007f807f, 0x00550055, 0x003fc03f, 0x00330033,
+    0x002a802a, 0x00246ddb, 0x001fe01f, 0x001c5571, 0x00198019, 0x00172ea2,
+    0x00154015, 0x00139d9d, 0x001236ed, 0x00110011, 0x000ff00f, 0x000f000f,
+    0x000e2ab8, 0x000d6bd7, 0x000cc00c, 0x000c249e, 0x000b9751, 0x000b164d,
+    0x000aa00a, 0x000a333d, 0x0009cece, 0x000971d0, 0x00091b76, 0x0008cb11,
+    0x00088008, 0x000839d6, 0x0007f807, 0x0007ba36, 0x00078007, 0x0007492b,
+    0x0007155c, 0x0006e459, 0x0006b5eb, 0x000689df, 0x00066006, 0x00063838,
+    0x0006124f, 0x0005ee29, 0x0005cba8, 0x0005aab0, 0x00058b26, 0x00056cf5,
+    0x00055005, 0x00053443, 0x0005199e, 0x00050005, 0x0004e767, 0x0004cfb7,
+    0x0004b8e8, 0x0004a2ed, 0x00048dbb, 0x00047947, 0x00046588, 0x00045275,
+    0x00044004, 0x00042e2e, 0x00041ceb, 0x00040c34, 0x0003fc03, 0x0003ec52,
+    0x0003dd1b, 0x0003ce57, 0x0003c003, 0x0003b219, 0x0003a495, 0x00039773,
+    0x00038aae, 0x00037e42, 0x0003722c, 0x00036669, 0x00035af5, 0x00034fce,
+    0x000344ef, 0x00033a57, 0x00033003, 0x000325f0, 0x00031c1c, 0x00031284,
+    0x00030927, 0x00030003, 0x0002f714, 0x0002ee5b, 0x0002e5d4, 0x0002dd7e,
+    0x0002d558, 0x0002cd5f, 0x0002c593, 0x0002bdf2, 0x0002b67a, 0x0002af2b,
+    0x0002a802, 0x0002a0ff, 0x00029a21, 0x00029367, 0x00028ccf, 0x00028658,
+    0x00028002, 0x000279cb, 0x000273b3, 0x00026db9, 0x000267db, 0x0002621a,
+    0x00025c74, 0x000256e8, 0x00025176, 0x00024c1d, 0x000246dd, 0x000241b5,
+    0x00023ca3, 0x000237a9, 0x000232c4, 0x00022df5, 0x0002293a, 0x00022494,
+    0x00022002, 0x00021b83, 0x00021717, 0x000212bd, 0x00020e75, 0x00020a3f,
+    0x0002061a, 0x00020206, 0x0001fe01, 0x0001fa0d, 0x0001f629, 0x0001f254,
+    0x0001ee8d, 0x0001ead5, 0x0001e72b, 0x0001e390, 0x0001e001, 0x0001dc80,
+    0x0001d90c, 0x0001d5a5, 0x0001d24a, 0x0001cefc, 0x0001cbb9, 0x0001c882,
+    0x0001c557, 0x0001c236, 0x0001bf21, 0x0001bc16, 0x0001b916, 0x0001b620,
+    0x0001b334, 0x0001b053, 0x0001ad7a, 0x0001aaac, 0x0001a7e7, 0x0001a52a,
+    0x0001a277, 0x00019fcd, 0x00019d2b, 0x00019a92, 0x00019801, 0x00019578,
+    0x000192f8, 0x0001907f, 0x00018e0e, 0x00018ba4, 0x00018942, 0x000186e7,
+    0x00018493, 0x00018247, 0x00018001, 0x00017dc2, 0x00017b8a, 0x00017958,
+    0x0001772d, 0x00017508, 0x000172ea, 0x000170d1, 0x00016ebf, 0x00016cb2,
+    0x00016aac, 0x000168ab, 0x000166af, 0x000164ba, 0x000162c9, 0x000160de,
+    0x00015ef9, 0x00015d18, 0x00015b3d, 0x00015966, 0x00015795, 0x000155c9,
+    0x00015401, 0x0001523e, 0x0001507f, 0x00014ec6, 0x00014d10, 0x00014b60,
+    0x000149b3, 0x0001480b, 0x00014667, 0x000144c7, 0x0001432c, 0x00014194,
+    0x00014001, 0x00013e71, 0x00013ce5, 0x00013b5d, 0x000139d9, 0x00013859,
+    0x000136dc, 0x00013563, 0x000133ed, 0x0001327b, 0x0001310d, 0x00012fa1,
+    0x00012e3a, 0x00012cd5, 0x00012b74, 0x00012a16, 0x000128bb, 0x00012763,
+    0x0001260e, 0x000124bd, 0x0001236e, 0x00012223, 0x000120da, 0x00011f94,
+    0x00011e51, 0x00011d11, 0x00011bd4, 0x00011a9a, 0x00011962, 0x0001182d,
+    0x000116fa, 0x000115ca, 0x0001149d, 0x00011372, 0x0001124a, 0x00011124,
+    0x00011001, 0x00010ee0, 0x00010dc1, 0x00010ca5, 0x00010b8b, 0x00010a73,
+    0x0001095e, 0x0001084b, 0x0001073a, 0x0001062c, 0x0001051f, 0x00010415,
+    0x0001030d, 0x00010207, 0x00010103, 0x00010001
+};
+
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+void qt_winPremultiplyPixels_avx2(quint32 *dst, const quint32 *src, int count);
+void qt_winUnpremultiplyPixels_avx2(quint32 *dst, const quint32 *src, int count);
+void qt_winSwapRedBluePixels_avx2(quint32 *dst, const quint32 *src, int count);
+#endif
+
+#if defined(QT_WIN_PIXEL_SSE2)
+// Computes (c * alpha + 0x80 + ((c * alpha) >> 8)) >> 8 for the color channels of the
+// two pixels unpacked to 16 bit in \a pixels, the alpha channel is garbage afterwards.
+static inline __m128i byteMul_sse2(__m128i pixels)
+{
+    const __m128i half = _mm_set1_epi16(0x80);
+    __m128i alpha = _mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    pixels = _mm_mullo_epi16(pixels, alpha);
+    pixels = _mm_add_epi16(pixels, _mm_srli_epi16(pixels, 8));
+    pixels = _mm_add_epi16(pixels, half);
+    return _mm_srli_epi16(pixels, 8);
+}
+#endif
+
+void qt_winPremultiplyPixels(quint32 *dst, const quint32 *src, int count)
+{
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+    if (qCpuHasFeature(AVX2)) {
+        qt_winPremultiplyPixels_avx2(dst, src, count);
+        return;
+    }
+#endif
+    int i = 0;
+#if defined(QT_WIN_PIXEL_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32(0xff000000);
+    for (; i + 4 <= count; i += 4) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        const __m128i alpha = _mm_and_si128(pixels, alphaMask);
+        __m128i result;
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) == 0xffff) {
+            result = pixels;
+        } else {
+            const __m128i low = byteMul_sse2(_mm_unpacklo_epi8(pixels, zero));
+            const __m128i high = byteMul_sse2(_mm_unpackhi_epi8(pixels, zero));
+            result = _mm_or_si128(_mm_andnot_si128(alphaMask, _mm_packus_epi16(low, high)), alpha);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), result);
+    }
+#elif defined(__ARM_NEON__)
+    for (; i + 8 <= count; i += 8) {
+        // Deinterleaves into b, g, r, a planes on little endian.
+        uint8x8x4_t pixels = vld4_u8(reinterpret_cast<const uint8_t *>(src + i));
+        for (int c = 0; c < 3; ++c) {
+            const uint16x8_t t = vmull_u8(pixels.val[c], pixels.val[3]);
+            pixels.val[c] = vrshrn_n_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), 8);
+        }
+        vst4_u8(reinterpret_cast<uint8_t *>(dst + i), pixels);
+    }
+#endif
+    for (; i < count; ++i)
+        dst[i] = qt_winPremultiplyPixel(src[i]);
+}
+
+void qt_winUnpremultiplyPixels(quint32 *dst, const quint32 *src, int count)
+{
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+    if (qCpuHasFeature(AVX2)) {
+        qt_winUnpremultiplyPixels_avx2(dst, src, count);
+        return;
+    }
+#endif
+    int i = 0;
+#if defined(QT_WIN_PIXEL_SSE2)
+    // Without a 32 bit multiply there is no point in going wide, but icons
+    // mostly consist of fully opaque and fully transparent runs.
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32(0xff000000);
+    for (; i + 4 <= count; i += 4) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        const __m128i alpha = _mm_and_si128(pixels, alphaMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, alphaMask)) == 0xffff) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), pixels);
+        } else if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero)) == 0xffff) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), zero);
+        } else {
+            for (int j = i; j < i + 4; ++j)
+                dst[j] = qt_winUnpremultiplyPixel(src[j]);
+        }
+    }
+#endif
+    for (; i < count; ++i)
+        dst[i] = qt_winUnpremultiplyPixel(src[i]);
+}
+
+void qt_winSwapRedBluePixels(quint32 *dst, const quint32 *src, int count)
+{
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+    if (qCpuHasFeature(AVX2)) {
+        qt_winSwapRedBluePixels_avx2(dst, src, count);
+        return;
+    }
+#endif
+    int i = 0;
+#if defined(QT_WIN_PIXEL_SSE2)
+    const __m128i agMask = _mm_set1_epi32(0xff00ff00);
+    const __m128i byteMask = _mm_set1_epi32(0x000000ff);
+    for (; i + 4 <= count; i += 4) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        const __m128i ag = _mm_and_si128(pixels, agMask);
+        const __m128i r = _mm_and_si128(_mm_srli_epi32(pixels, 16), byteMask);
+        const __m128i b = _mm_slli_epi32(_mm_and_si128(pixels, byteMask), 16);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_or_si128(ag, _mm_or_si128(r, b)));
+    }
+#elif defined(__ARM_NEON__)
+    for (; i + 16 <= count; i += 16) {
+        uint8x16x4_t pixels = vld4q_u8(reinterpret_cast<const uint8_t *>(src + i));
+        const uint8x16_t blue = pixels.val[0];
+        pixels.val[0] = pixels.val[2];
+        pixels.val[2] = blue;
+        vst4q_u8(reinterpret_cast<uint8_t *>(dst + i), pixels);
+    }
+#endif
+    for (; i < count; ++i)
+        dst[i] = qt_winSwapRedBluePixel(src[i]);
+}
+
+void qt_winForceOpaquePixels(quint32 *dst, const quint32 *src, int count)
+{
+    int i = 0;
+#if defined(QT_WIN_PIXEL_SSE2)
+    const __m128i alphaMask = _mm_set1_epi32(0xff000000);
+    for (; i + 4 <= count; i += 4) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_or_si128(pixels, alphaMask));
+    }
+#elif defined(__ARM_NEON__)
+    const uint32x4_t alphaMask = vdupq_n_u32(0xff000000);
+    for (; i + 4 <= count; i += 4)
+        vst1q_u32(dst + i, vorrq_u32(vld1q_u32(src + i), alphaMask));
+#endif
+    for (; i < count; ++i)
+        dst[i] = src[i] | 0xff000000;
+}
+
+void qt_winFixupDibAlphaPixels(quint32 *dst, const quint32 *src, int count)
+{
+    int i = 0;
+#if defined(QT_WIN_PIXEL_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32(0xff000000);
+    for (; i + 4 <= count; i += 4) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        const __m128i noAlpha = _mm_cmpeq_epi32(_mm_and_si128(pixels, alphaMask), zero);
+        const __m128i noColor = _mm_cmpeq_epi32(_mm_andnot_si128(alphaMask, pixels), zero);
+        const __m128i fixup = _mm_and_si128(_mm_andnot_si128(noColor, noAlpha), alphaMask);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_or_si128(pixels, fixup));
+    }
+#endif
+    for (; i < count; ++i)
+        dst[i] = qt_winFixupDibAlphaPixel(src[i]);
+}
+
+bool qt_winPixelsHaveAlpha(const quint32 *src, int count)
+{
+    int i = 0;
+#if defined(QT_WIN_PIXEL_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alphaMask = _mm_set1_epi32(0xff000000);
+    for (; i + 16 <= count; i += 16) {
+        const __m128i *pixels = reinterpret_cast<const __m128i *>(src + i);
+        __m128i alpha = _mm_or_si128(_mm_loadu_si128(pixels), _mm_loadu_si128(pixels + 1));
+        alpha = _mm_or_si128(alpha, _mm_or_si128(_mm_loadu_si128(pixels + 2), _mm_loadu_si128(pixels + 3)));
+        alpha = _mm_and_si128(alpha, alphaMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(alpha, zero)) != 0xffff)
+            return true;
+    }
+#endif
+    for (; i < count; ++i) {
+        if (src[i] & 0xff000000)
+            return true;
+    }
+    return false;
+}
+
+void qt_winConvertPixels(quint32 *dst, const quint32 *src, int count, QWinPixelOperation operation)
+{
+    switch (operation) {
+    case QWinPixelCopy:
+        if (dst != src)
+            memmove(dst, src, count * sizeof(quint32));
+        break;
+    case QWinPixelPremultiply:
+        qt_winPremultiplyPixels(dst, src, count);
+        break;
+    case QWinPixelUnpremultiply:
+        qt_winUnpremultiplyPixels(dst, src, count);
+        break;
+    case QWinPixelSwapRedBlue:
+        qt_winSwapRedBluePixels(dst, src, count);
+        break;
+    case QWinPixelForceOpaque:
+        qt_winForceOpaquePixels(dst, src, count);
+        break;
+    case QWinPixelFixupDibAlpha:
+        qt_winFixupDibAlphaPixels(dst, src, count);
+        break;
+    }
+}
+
+static inline quint32 *pixelLine(uchar *bits, int bytesPerLine, int y)
+{
+    return reinterpret_cast<quint32 *>(bits + qptrdiff(y) * bytesPerLine);
+}
+
+static inline const quint32 *pixelLine(const uchar *bits, int bytesPerLine, int y)
+{
+    return reinterpret_cast<const quint32 *>(bits + qptrdiff(y) * bytesPerLine);
+}
+
+void qt_winConvertPixelRows(uchar *dst, int dstBytesPerLine,
+                            const uchar *src, int srcBytesPerLine,
+                            int width, int height,
+                            QWinPixelOperation operation, bool flipVertically)
+{
+    if (width <= 0 || height <= 0)
+        return;
+
+    if (!flipVertically) {
+        if (operation == QWinPixelCopy && dstBytesPerLine == srcBytesPerLine
+            && dstBytesPerLine == int(width * sizeof(quint32))) {
+            if (dst != src)
+                memmove(dst, src, qptrdiff(height) * dstBytesPerLine);
+            return;
+        }
+        for (int y = 0; y < height; ++y)
+            qt_winConvertPixels(pixelLine(dst, dstBytesPerLine, y), pixelLine(src, srcBytesPerLine, y), width, operation);
+        return;
+    }
+
+    if (dst != src) {
+        for (int y = 0; y < height; ++y)
+            qt_winConvertPixels(pixelLine(dst, dstBytesPerLine, height - 1 - y), pixelLine(src, srcBytesPerLine, y), width, operation);
+        return;
+    }
+
+    // In place: swap the lines pairwise through a temporary line.
+    Q_ASSERT(dstBytesPerLine == srcBytesPerLine);
+    QVarLengthArray<quint32, 1024> line(width);
+    for (int top = 0, bottom = height - 1; top <= bottom; ++top, --bottom) {
+        quint32 *topLine = pixelLine(dst, dstBytesPerLine, top);
+        if (top == bottom) {
+            qt_winConvertPixels(topLine, topLine, width, operation);
+            break;
+        }
+        quint32 *bottomLine = pixelLine(dst, dstBytesPerLine, bottom);
+        memcpy(line.data(), topLine, width * sizeof(quint32));
+        qt_winConvertPixels(topLine, bottomLine, width, operation);
+        qt_winConvertPixels(bottomLine, line.constData(), width, operation);
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,123 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinpixelconversion_p.h"
+
+#include <QtCore/private/qsimd_p.h>
+
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+
+QT_BEGIN_NAMESPACE
+
+static inline __m256i byteMul_avx2(__m256i pixels)
+{
+    const __m256i half = _mm256_set1_epi16(0x80);
+    __m256i alpha = _mm256_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3));
+    alpha = _mm256_shufflehi_epi16(alpha, _MM_SHUFFLE(3, 3, 3, 3));
+    pixels = _mm256_mullo_epi16(pixels, alpha);
+    pixels = _mm256_add_epi16(pixels, _mm256_srli_epi16(pixels, 8));
+    pixels = _mm256_add_epi16(pixels, half);
+    return _mm256_srli_epi16(pixels, 8);
+}
+
+void qt_winPremultiplyPixels_avx2(quint32 *dst, const quint32 *src, int count)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i alphaMask = _mm256_set1_epi32(0xff000000);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        const __m256i alpha = _mm256_and_si256(pixels, alphaMask);
+        // Unpacking and packing both work per 128 bit lane, so the pixel order is preserved.
+        const __m256i low = byteMul_avx2(_mm256_unpacklo_epi8(pixels, zero));
+        const __m256i high = byteMul_avx2(_mm256_unpackhi_epi8(pixels, zero));
+        const __m256i result = _mm256_or_si256(_mm256_andnot_si256(alphaMask, _mm256_packus_epi16(low, high)), alpha);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), result);
+    }
+    for (; i < count; ++i)
+        dst[i] = qt_winPremultiplyPixel(src[i]);
+}
+
+static inline __m256i unpremultiplyChannel_avx2(__m256i channel, __m256i inverse)
+{
+    const __m256i half = _mm256_set1_epi32(0x8000);
+    const __m256i byteMask = _mm256_set1_epi32(0xff);
+    channel = _mm256_add_epi32(_mm256_mullo_epi32(channel, inverse), half);
+    return _mm256_min_epu32(_mm256_srli_epi32(channel, 16), byteMask);
+}
+
+void qt_winUnpremultiplyPixels_avx2(quint32 *dst, const quint32 *src, int count)
+{
+    const __m256i byteMask = _mm256_set1_epi32(0xff);
+    const int *inverseTable = reinterpret_cast<const int *>(qt_winInverseAlphaTable);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        const __m256i alpha = _mm256_srli_epi32(pixels, 24);
+        // table[255] == 0x10001 leaves opaque pixels untouched, table[0] == 0 clears transparent ones.
+        const __m256i inverse = _mm256_i32gather_epi32(inverseTable, alpha, 4);
+        const __m256i r = unpremultiplyChannel_avx2(_mm256_and_si256(_mm256_srli_epi32(pixels, 16), byteMask), inverse);
+        const __m256i g = unpremultiplyChannel_avx2(_mm256_and_si256(_mm256_srli_epi32(pixels, 8), byteMask), inverse);
+        const __m256i b = unpremultiplyChannel_avx2(_mm256_and_si256(pixels, byteMask), inverse);
+        __m256i result = _mm256_or_si256(_mm256_slli_epi32(alpha, 24), _mm256_slli_epi32(r, 16));
+        result = _mm256_or_si256(result, _mm256_or_si256(_mm256_slli_epi32(g, 8), b));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), result);
+    }
+    for (; i < count; ++i)
+        dst[i] = qt_winUnpremultiplyPixel(src[i]);
+}
+
+void qt_winSwapRedBluePixels_avx2(quint32 *dst, const quint32 *src, int count)
+{
+    const __m256i shuffleMask = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                                 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_shuffle_epi8(pixels, shuffleMask));
+    }
+    for (; i < count; ++i)
+        dst[i] = qt_winSwapRedBluePixel(src[i]);
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_COMPILER_SUPPORTS_AVX2
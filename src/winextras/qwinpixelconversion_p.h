@@ -0,0 +1,124 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINPIXELCONVERSION_P_H
+#define QWINPIXELCONVERSION_P_H
+
+#include <QtCore/qglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+// Pixel operations on 32-bit 0xAARRGGBB pixels, which is both the memory
+// layout of QImage::Format_(A)RGB32 and of a 32bpp BI_RGB DIB section.
+enum QWinPixelOperation
+{
+    QWinPixelCopy,
+    QWinPixelPremultiply,       // straight alpha -> premultiplied alpha
+    QWinPixelUnpremultiply,     // premultiplied alpha -> straight alpha
+    QWinPixelSwapRedBlue,       // 0xAARRGGBB <-> 0xAABBGGRR
+    QWinPixelForceOpaque,       // alpha := 0xff
+    QWinPixelFixupDibAlpha      // alpha := 0xff for colored pixels without alpha
+};
+
+// 0x00ff00ff / alpha, so that (c * table[alpha] + 0x8000) >> 16 == c * 255 / alpha
+extern const quint32 qt_winInverseAlphaTable[256];
+
+inline quint32 qt_winPremultiplyPixel(quint32 p)
+{
+    const quint32 alpha = p >> 24;
+    if (alpha == 255)
+        return p;
+    if (alpha == 0)
+        return 0;
+    quint32 rb = (p & 0x00ff00ff) * alpha;
+    rb = ((rb + ((rb >> 8) & 0x00ff00ff) + 0x00800080) >> 8) & 0x00ff00ff;
+    quint32 g = ((p >> 8) & 0xff) * alpha;
+    g = (g + ((g >> 8) & 0xff) + 0x80) & 0xff00;
+    return (alpha << 24) | rb | g;
+}
+
+inline quint32 qt_winUnpremultiplyPixel(quint32 p)
+{
+    const quint32 alpha = p >> 24;
+    if (alpha == 255)
+        return p;
+    if (alpha == 0)
+        return 0;
+    const quint32 inverse = qt_winInverseAlphaTable[alpha];
+    const quint32 r = qMin<quint32>((((p >> 16) & 0xff) * inverse + 0x8000) >> 16, 255);
+    const quint32 g = qMin<quint32>((((p >> 8) & 0xff) * inverse + 0x8000) >> 16, 255);
+    const quint32 b = qMin<quint32>(((p & 0xff) * inverse + 0x8000) >> 16, 255);
+    return (alpha << 24) | (r << 16) | (g << 8) | b;
+}
+
+inline quint32 qt_winSwapRedBluePixel(quint32 p)
+{
+    return (p & 0xff00ff00) | ((p >> 16) & 0xff) | ((p & 0xff) << 16);
+}
+
+inline quint32 qt_winFixupDibAlphaPixel(quint32 p)
+{
+    // GDI leaves the alpha byte of opaque pixels at 0, but a pixel that is
+    // fully transparent must not carry any color either.
+    return ((p & 0xff000000) == 0 && (p & 0x00ffffff) != 0) ? (p | 0xff000000) : p;
+}
+
+// All functions accept dst == src.
+void qt_winPremultiplyPixels(quint32 *dst, const quint32 *src, int count);
+void qt_winUnpremultiplyPixels(quint32 *dst, const quint32 *src, int count);
+void qt_winSwapRedBluePixels(quint32 *dst, const quint32 *src, int count);
+void qt_winForceOpaquePixels(quint32 *dst, const quint32 *src, int count);
+void qt_winFixupDibAlphaPixels(quint32 *dst, const quint32 *src, int count);
+bool qt_winPixelsHaveAlpha(const quint32 *src, int count);
+
+void qt_winConvertPixels(quint32 *dst, const quint32 *src, int count, QWinPixelOperation operation);
+
+// Converts a width x height block of pixels. If flipVertically is true, the
+// first source line ends up as the last destination line, which is what is
+// needed to go from a bottom-up DIB to a QImage and back.
+void qt_winConvertPixelRows(uchar *dst, int dstBytesPerLine,
+                            const uchar *src, int srcBytesPerLine,
+                            int width, int height,
+                            QWinPixelOperation operation, bool flipVertically = false);
+
+QT_END_NAMESPACE
+
+#endif // QWINPIXELCONVERSION_P_H
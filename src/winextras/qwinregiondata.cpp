@@ -0,0 +1,181 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinregiondata_p.h"
+
+QT_BEGIN_NAMESPACE
+
+int qt_winRegionDataSize(int rectCount)
+{
+    return int(sizeof(QWinRegionDataHeader) + rectCount * sizeof(QWinRegionRect));
+}
+
+static inline void qt_winSetRegionRect(QWinRegionRect *r, const QRect &rect)
+{
+    r->left = rect.left();
+    r->top = rect.top();
+    r->right = rect.right() + 1;
+    r->bottom = rect.bottom() + 1;
+}
+
+/*
+    Writes \a region as RGNDATA into \a buffer, resizing it as needed.
+
+    QRegion keeps its rectangles y-x banded and non-overlapping, which is the
+    form ExtCreateRegion() consumes without further sorting or merging.
+ */
+void qt_winRegionToRegionData(const QRegion &region, QWinRegionDataBuffer *buffer)
+{
+    const QVector<QRect> rects = region.rects();
+    const int count = rects.size();
+    const int size = qt_winRegionDataSize(count);
+    buffer->resize((size + int(sizeof(quint32)) - 1) / int(sizeof(quint32)));
+
+    QWinRegionDataHeader *header = reinterpret_cast<QWinRegionDataHeader *>(buffer->data());
+    header->dwSize = sizeof(QWinRegionDataHeader);
+    header->iType = QWinRegionDataRectangles;
+    header->nCount = count;
+    header->nRgnSize = count * sizeof(QWinRegionRect);
+    qt_winSetRegionRect(&header->rcBound, count ? region.boundingRect() : QRect(0, 0, 0, 0));
+
+    QWinRegionRect *out = reinterpret_cast<QWinRegionRect *>(header + 1);
+    const QRect *in = rects.constData();
+    for (int i = 0; i < count; ++i)
+        qt_winSetRegionRect(out + i, in[i]);
+}
+
+static inline QRect qt_winRegionRectToRect(const QWinRegionRect &r)
+{
+    return QRect(QPoint(r.left, r.top), QPoint(r.right - 1, r.bottom - 1));
+}
+
+// Merges the band starting at \a currentBand into the one directly above it
+// when both have the same horizontal spans, like QRegion does itself.
+// Returns the start of the last band.
+static int qt_winCoalesceBands(QRect *rects, int previousBand, int currentBand, int end)
+{
+    if (previousBand < 0 || end - currentBand != currentBand - previousBand)
+        return currentBand;
+    if (rects[previousBand].bottom() + 1 != rects[currentBand].top())
+        return currentBand;
+    for (int i = 0; i < end - currentBand; ++i) {
+        if (rects[previousBand + i].left() != rects[currentBand + i].left()
+            || rects[previousBand + i].right() != rects[currentBand + i].right())
+            return currentBand;
+    }
+    const int bottom = rects[currentBand].bottom();
+    for (int i = previousBand; i < currentBand; ++i)
+        rects[i].setBottom(bottom);
+    return previousBand;
+}
+
+/*
+    Returns the region described by the RGNDATA in \a regionData.
+
+    GetRegionData() returns y-x banded rectangles, so the region is built in
+    a single pass with QRegion::setRects() instead of one union per rectangle.
+    Rectangles that do not follow the banding fall back to the union.
+ */
+QRegion qt_winRegionFromRegionData(const void *regionData, int size)
+{
+    if (size < int(sizeof(QWinRegionDataHeader)))
+        return QRegion();
+    const QWinRegionDataHeader *header = qt_winRegionDataHeader(regionData);
+    if (header->iType != QWinRegionDataRectangles
+        || header->dwSize < sizeof(QWinRegionDataHeader) || header->dwSize > quint32(size)
+        || header->nCount > (quint32(size) - header->dwSize) / sizeof(QWinRegionRect)) {
+        return QRegion();
+    }
+
+    const QWinRegionRect *in = qt_winRegionDataRects(regionData);
+    const int count = header->nCount;
+    QVarLengthArray<QRect, 64> rects(count);
+    QRect *out = rects.data();
+    int n = 0;
+    int previousBand = -1;
+    int currentBand = 0;
+    bool banded = true;
+    for (int i = 0; i < count; ++i) {
+        const QWinRegionRect &r = in[i];
+        if (r.right <= r.left || r.bottom <= r.top)
+            continue;
+        if (n > 0) {
+            QRect &last = out[n - 1];
+            if (r.top == last.top()) {
+                if (r.bottom != last.bottom() + 1 || r.left < last.right() + 1) {
+                    banded = false;
+                    break;
+                }
+                if (r.left == last.right() + 1)
+                    last.setRight(r.right - 1);
+                else
+                    out[n++] = qt_winRegionRectToRect(r);
+                continue;
+            }
+            if (r.top <= last.bottom()) {
+                banded = false;
+                break;
+            }
+            const int lastBand = qt_winCoalesceBands(out, previousBand, currentBand, n);
+            if (lastBand != currentBand)
+                n = currentBand;
+            previousBand = lastBand;
+        }
+        currentBand = n;
+        out[n++] = qt_winRegionRectToRect(r);
+    }
+
+    QRegion region;
+    if (banded) {
+        if (qt_winCoalesceBands(out, previousBand, currentBand, n) != currentBand)
+            n = currentBand;
+        if (n > 0)
+            region.setRects(out, n);
+    } else {
+        for (int i = 0; i < count; ++i) {
+            if (in[i].right > in[i].left && in[i].bottom > in[i].top)
+                region += qt_winRegionRectToRect(in[i]);
+        }
+    }
+    return region;
+}
+
+QT_END_NAMESPACE
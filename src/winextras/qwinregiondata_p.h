@@ -0,0 +1,92 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINREGIONDATA_P_H
+#define QWINREGIONDATA_P_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/QVarLengthArray>
+#include <QtGui/QRegion>
+
+QT_BEGIN_NAMESPACE
+
+// Layout compatible mirrors of RGNDATAHEADER and RECT. DWORD and LONG are
+// 32 bit on both 32 and 64 bit Windows, which qwinfunctions.cpp asserts.
+struct QWinRegionRect
+{
+    qint32 left;
+    qint32 top;
+    qint32 right;
+    qint32 bottom;
+};
+
+struct QWinRegionDataHeader
+{
+    quint32 dwSize;
+    quint32 iType;
+    quint32 nCount;
+    quint32 nRgnSize;
+    QWinRegionRect rcBound;
+};
+
+enum { QWinRegionDataRectangles = 1 }; // RDH_RECTANGLES
+
+// An RGNDATA buffer; quint32 elements keep it suitably aligned for the structures above.
+typedef QVarLengthArray<quint32, (sizeof(QWinRegionDataHeader) + 16 * sizeof(QWinRegionRect)) / sizeof(quint32)> QWinRegionDataBuffer;
+
+int qt_winRegionDataSize(int rectCount);
+void qt_winRegionToRegionData(const QRegion &region, QWinRegionDataBuffer *buffer);
+QRegion qt_winRegionFromRegionData(const void *regionData, int size);
+
+inline const QWinRegionDataHeader *qt_winRegionDataHeader(const void *regionData)
+{
+    return static_cast<const QWinRegionDataHeader *>(regionData);
+}
+
+inline const QWinRegionRect *qt_winRegionDataRects(const void *regionData)
+{
+    return reinterpret_cast<const QWinRegionRect *>(static_cast<const char *>(regionData)
+                                                    + qt_winRegionDataHeader(regionData)->dwSize);
+}
+
+QT_END_NAMESPACE
+
+#endif // QWINREGIONDATA_P_H
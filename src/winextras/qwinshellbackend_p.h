@@ -0,0 +1,173 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINSHELLBACKEND_P_H
+#define QWINSHELLBACKEND_P_H
+
+#include <QtWinExtras/qwinextrasglobal.h>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "qwintaskbarprogresscoalescer_p.h"
+#include "qwinthumbnailtoolbarstate_p.h"
+#include "qwinjumplistsnapshot_p.h"
+
+QT_BEGIN_NAMESPACE
+
+// A recent or frequent item as the shell lists it.
+struct QWinShellDocument
+{
+    QWinShellDocument() : type(QWinJumpListItem::Destination) {}
+
+    QWinJumpListItem::Type type;
+    QString filePath;
+    QString description;
+    QString arguments;
+    QString iconPath;
+};
+
+// The operations QtWinExtras performs on the taskbar (ITaskbarList4), on
+// jump lists (ICustomDestinationList, IApplicationDocumentLists) and on the
+// desktop window manager. Windows are HWNDs, icons HICONs and regions HRGNs.
+// The results are HRESULTs.
+//
+// Implemented by QWinNativeShellBackend on Windows. Any other implementation
+// allows the code driving it to be tested and benchmarked on any platform.
+// The taskbar, thumbnail toolbar and jump list functions are called from
+// the shell thread of QWinShellExecutor, the DWM ones from the GUI thread.
+class Q_WINEXTRAS_EXPORT QWinShellBackend
+{
+public:
+    // The shell objects a jump list is made of, 0 for none.
+    typedef quintptr Object;
+
+    // Mirrors KNOWNDESTCATEGORY.
+    enum KnownCategory
+    {
+        FrequentCategory = 1,
+        RecentCategory = 2
+    };
+
+    // Mirrors APPDOCLISTTYPE.
+    enum DocumentList
+    {
+        RecentDocuments = 0,
+        FrequentDocuments = 1
+    };
+
+    // One for each function below.
+    enum Call
+    {
+        SetProgressValue,
+        SetProgressState,
+        SetOverlayIcon,
+        AddThumbnailButtons,
+        UpdateThumbnailButtons,
+        BeginList,
+        AppendKnownCategory,
+        AppendCategory,
+        AddUserTasks,
+        CommitList,
+        CreateLink,
+        CreateDestination,
+        CreateSeparator,
+        CreateCollection,
+        AddRef,
+        Release,
+        Documents,
+        AddRecentDocument,
+        ClearDocuments,
+        SetWindowAttribute,
+        WindowAttribute,
+        ExtendFrameIntoClientArea,
+        EnableBlurBehindWindow,
+        IsCompositionEnabled,
+        EnableComposition,
+        ColorizationColor,
+        CallCount
+    };
+
+    // The name of the native function a call maps to.
+    static const char *callName(Call call);
+
+    virtual ~QWinShellBackend() {}
+
+    virtual qint32 setProgressValue(quintptr window, quint64 completed, quint64 total) = 0;
+    virtual qint32 setProgressState(quintptr window, QWinTaskbarProgressState state) = 0;
+    virtual qint32 setOverlayIcon(quintptr window, quintptr icon, const QString &description) = 0;
+    virtual qint32 addThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count) = 0;
+    virtual qint32 updateThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count) = 0;
+
+    virtual qint32 beginList(const QString &appId) = 0;
+    virtual qint32 appendKnownCategory(KnownCategory category) = 0;
+    virtual qint32 appendCategory(const QString &title, Object collection) = 0;
+    virtual qint32 addUserTasks(Object collection) = 0;
+    virtual qint32 commitList() = 0;
+
+    // The objects are created with a reference owned by the caller.
+    virtual Object createLink(const QWinJumpListItemSnapshot &item, const QString &iconPath) = 0;
+    virtual Object createDestination(const QString &filePath) = 0;
+    virtual Object createSeparator() = 0;
+    virtual Object createCollection(const Object *objects, int count) = 0;
+    virtual void addRef(Object object) = 0;
+    virtual void release(Object object) = 0;
+
+    virtual qint32 documents(const QString &appId, DocumentList list, QVector<QWinShellDocument> *documents) = 0;
+    virtual qint32 addRecentDocument(const QString &appId, const QWinJumpListItemSnapshot &item, const QString &iconPath) = 0;
+    virtual qint32 clearDocuments(const QString &appId) = 0;
+
+    virtual qint32 setWindowAttribute(quintptr window, quint32 attribute, const void *value, quint32 size) = 0;
+    virtual qint32 windowAttribute(quintptr window, quint32 attribute, void *value, quint32 size) = 0;
+    virtual qint32 extendFrameIntoClientArea(quintptr window, int left, int top, int right, int bottom) = 0;
+    virtual qint32 enableBlurBehindWindow(quintptr window, bool enable, quintptr region) = 0;
+    virtual qint32 isCompositionEnabled(bool *enabled) = 0;
+    virtual qint32 enableComposition(bool enable) = 0;
+    virtual qint32 colorizationColor(quint32 *argb, bool *opaqueBlend) = 0;
+};
+
+// Defined in qwinnativeshellbackend.cpp. The backend is replaced before any
+// object using it is created, 0 restores the native one.
+Q_WINEXTRAS_EXPORT QWinShellBackend *qt_winShellBackend();
+Q_WINEXTRAS_EXPORT void qt_winSetShellBackend(QWinShellBackend *backend);
+
+QT_END_NAMESPACE
+
+#endif // QWINSHELLBACKEND_P_H
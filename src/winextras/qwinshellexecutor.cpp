@@ -0,0 +1,249 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinshellexecutor_p.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QEvent>
+#include <QtCore/QPointer>
+#include <QtCore/QThread>
+
+#ifdef Q_OS_WIN
+#  include <qt_windows.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+static const QEvent::Type runJobEventType = QEvent::Type(QEvent::registerEventType());
+static const QEvent::Type finishJobEventType = QEvent::Type(QEvent::registerEventType());
+
+// Passes a job to the shell thread, and back once it has run.
+class QWinShellJobEvent : public QEvent
+{
+public:
+    QWinShellJobEvent(QEvent::Type type, QWinShellJob *job) : QEvent(type), job(job) {}
+
+    QWinShellJob * const job;
+};
+
+// Enters a single-threaded apartment on Windows. The event loop of the
+// thread dispatches the window messages the apartment relies on.
+class QWinShellThread : public QThread
+{
+protected:
+    void run() Q_DECL_OVERRIDE
+    {
+#ifdef Q_OS_WIN
+        const HRESULT initialized = CoInitializeEx(0, COINIT_APARTMENTTHREADED);
+#endif
+        exec();
+#ifdef Q_OS_WIN
+        if (SUCCEEDED(initialized))
+            CoUninitialize();
+#endif
+    }
+};
+
+// Lives in the shell thread and runs the jobs posted to it.
+class QWinShellWorker : public QObject
+{
+public:
+    explicit QWinShellWorker(QWinShellExecutor *executor) : m_executor(executor) {}
+
+protected:
+    void customEvent(QEvent *event) Q_DECL_OVERRIDE
+    {
+        if (event->type() != runJobEventType)
+            return;
+        QWinShellJob *job = static_cast<QWinShellJobEvent *>(event)->job;
+        job->run();
+        QMutexLocker locker(&m_executor->m_mutex);
+        --m_executor->m_queuedCount;
+        // a blocking job belongs to the caller waiting for it, and is not
+        // touched once it is done
+        if (job->m_blocking)
+            job->m_done = true;
+        else
+            QCoreApplication::postEvent(m_executor, new QWinShellJobEvent(finishJobEventType, job));
+        m_executor->m_condition.wakeAll();
+    }
+
+private:
+    QWinShellExecutor *m_executor;
+};
+
+QWinShellExecutor::QWinShellExecutor(Mode mode, QObject *parent) :
+    QObject(parent), m_thread(0), m_worker(0), m_queuedCount(0)
+{
+    if (mode == Threaded) {
+        m_thread = new QWinShellThread;
+        m_thread->setObjectName(QStringLiteral("QWinShellThread"));
+        m_worker = new QWinShellWorker(this);
+        m_worker->moveToThread(m_thread);
+        m_thread->start();
+    }
+}
+
+/*
+    Runs the jobs that are still queued and finishes them before the thread
+    is stopped.
+ */
+QWinShellExecutor::~QWinShellExecutor()
+{
+    waitForDone();
+    if (m_thread) {
+        m_thread->quit();
+        m_thread->wait();
+        delete m_worker;
+        delete m_thread;
+    }
+    qDeleteAll(m_jobs);
+}
+
+/*
+    Returns the thread the jobs run in, 0 for a synchronous executor.
+ */
+QThread *QWinShellExecutor::shellThread() const
+{
+    return m_thread;
+}
+
+/*
+    Queues \a job, which is deleted once it has run and finished. The jobs
+    posted for an \a owner can be cancelled together.
+ */
+void QWinShellExecutor::post(QWinShellJob *job, const void *owner)
+{
+    job->m_owner = owner;
+    if (!m_thread) {
+        job->run();
+        job->finish();
+        delete job;
+        return;
+    }
+    m_jobs.append(job);
+    {
+        QMutexLocker locker(&m_mutex);
+        ++m_queuedCount;
+    }
+    QCoreApplication::postEvent(m_worker, new QWinShellJobEvent(runJobEventType, job));
+}
+
+/*
+    Runs \a job after the jobs queued before it, and waits for it. The job
+    is finished before the function returns, and remains owned by the
+    caller.
+ */
+void QWinShellExecutor::call(QWinShellJob *job)
+{
+    if (m_thread) {
+        Q_ASSERT(QThread::currentThread() != m_thread);
+        job->m_blocking = true;
+        job->m_done = false;
+        QMutexLocker locker(&m_mutex);
+        ++m_queuedCount;
+        QCoreApplication::postEvent(m_worker, new QWinShellJobEvent(runJobEventType, job));
+        while (!job->m_done)
+            m_condition.wait(&m_mutex);
+    } else {
+        job->run();
+    }
+    job->finish();
+}
+
+/*
+    Drops the results of the jobs posted for \a owner. The jobs still run,
+    but are not finished.
+ */
+void QWinShellExecutor::cancel(const void *owner)
+{
+    if (!owner)
+        return;
+    foreach (QWinShellJob *job, m_jobs) {
+        if (job->m_owner == owner)
+            job->m_cancelled = true;
+    }
+}
+
+/*
+    Blocks until all the jobs posted so far have run, and finishes them.
+ */
+void QWinShellExecutor::waitForDone()
+{
+    if (!m_thread)
+        return;
+    {
+        QMutexLocker locker(&m_mutex);
+        while (m_queuedCount > 0)
+            m_condition.wait(&m_mutex);
+    }
+    QCoreApplication::sendPostedEvents(this, finishJobEventType);
+}
+
+void QWinShellExecutor::customEvent(QEvent *event)
+{
+    if (event->type() != finishJobEventType)
+        return;
+    QWinShellJob *job = static_cast<QWinShellJobEvent *>(event)->job;
+    m_jobs.removeOne(job);
+    if (!job->m_cancelled)
+        job->finish();
+    delete job;
+}
+
+/*
+    The executor shared by the objects of the module. It is owned by the
+    application, so that the jobs still queued run before the application
+    is gone. Without an application, or with QT_WINEXTRAS_SHELL_THREAD set
+    to 0, the jobs run synchronously on the GUI thread.
+ */
+QWinShellExecutor *qt_winShellExecutor()
+{
+    static QPointer<QWinShellExecutor> executor;
+    if (!executor) {
+        QCoreApplication *application = QCoreApplication::instance();
+        const bool threaded = application && qgetenv("QT_WINEXTRAS_SHELL_THREAD") != "0";
+        executor = new QWinShellExecutor(threaded ? QWinShellExecutor::Threaded : QWinShellExecutor::Synchronous, application);
+    }
+    return executor;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,131 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINSHELLEXECUTOR_P_H
+#define QWINSHELLEXECUTOR_P_H
+
+#include <QtWinExtras/qwinextrasglobal.h>
+#include <QtCore/QObject>
+#include <QtCore/QMutex>
+#include <QtCore/QWaitCondition>
+#include <QtCore/QList>
+
+QT_BEGIN_NAMESPACE
+
+class QThread;
+class QWinShellThread;
+class QWinShellWorker;
+
+// Work for the shell thread. A job carries copies of everything it needs,
+// as the object that posted it may change or be gone by the time it runs.
+class QWinShellJob
+{
+public:
+    QWinShellJob() : m_owner(0), m_cancelled(false), m_blocking(false), m_done(false) {}
+    virtual ~QWinShellJob() {}
+
+    // Called on the shell thread.
+    virtual void run() = 0;
+    // Called back on the thread the job was posted from, once it has run,
+    // unless its owner cancelled it in the meantime.
+    virtual void finish() {}
+
+private:
+    friend class QWinShellExecutor;
+    friend class QWinShellWorker;
+
+    const void *m_owner;
+    bool m_cancelled;
+    bool m_blocking;
+    bool m_done;
+};
+
+// Runs jobs one after the other, in the order they were posted, on a thread
+// of its own, so that a slow shell does not hold up the GUI thread. On
+// Windows the thread is a single-threaded COM apartment. A synchronous
+// executor runs and finishes the jobs right away instead.
+//
+// The executor lives in, and is used from, the GUI thread.
+class Q_WINEXTRAS_EXPORT QWinShellExecutor : public QObject
+{
+public:
+    enum Mode
+    {
+        Synchronous,
+        Threaded
+    };
+
+    explicit QWinShellExecutor(Mode mode = Threaded, QObject *parent = 0);
+    ~QWinShellExecutor();
+
+    Mode mode() const { return m_thread ? Threaded : Synchronous; }
+    QThread *shellThread() const;
+
+    void post(QWinShellJob *job, const void *owner = 0);
+    void call(QWinShellJob *job);
+    void cancel(const void *owner);
+    void waitForDone();
+
+    int pendingCount() const { return m_jobs.size(); }
+
+protected:
+    void customEvent(QEvent *event) Q_DECL_OVERRIDE;
+
+private:
+    Q_DISABLE_COPY(QWinShellExecutor)
+    friend class QWinShellWorker;
+
+    QWinShellThread *m_thread;
+    QWinShellWorker *m_worker;
+    // the jobs posted and not finished yet, in order
+    QList<QWinShellJob *> m_jobs;
+
+    // the number of jobs that have not run yet
+    QMutex m_mutex;
+    QWaitCondition m_condition;
+    int m_queuedCount;
+};
+
+Q_WINEXTRAS_EXPORT QWinShellExecutor *qt_winShellExecutor();
+
+QT_END_NAMESPACE
+
+#endif // QWINSHELLEXECUTOR_P_H
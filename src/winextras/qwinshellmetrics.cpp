@@ -0,0 +1,226 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinshellmetrics_p.h"
+#include "qwinhresult_p.h"
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMap>
+#include <QtCore/QVariantList>
+
+QT_BEGIN_NAMESPACE
+
+Q_GLOBAL_STATIC(QWinShellMetrics, shellMetrics)
+
+QWinShellMetrics::Counters::Counters() :
+    count(0), failureCount(0), nsecs(0)
+{
+    for (int i = 0; i < BucketCount; ++i)
+        histogram[i] = 0;
+}
+
+QWinShellMetrics::QWinShellMetrics() :
+    m_enabled(qEnvironmentVariableIsSet("QT_WINEXTRAS_SHELL_METRICS"))
+{
+}
+
+/*
+    The metrics of the calls made by QtWinExtras itself.
+ */
+QWinShellMetrics *QWinShellMetrics::instance()
+{
+    return shellMetrics();
+}
+
+/*
+    Records a call that returned \a hresult after \a nsecs nanoseconds.
+ */
+void QWinShellMetrics::record(QWinShellBackend::Call call, qint32 hresult, qint64 nsecs)
+{
+    QMutexLocker locker(&m_mutex);
+    Counters &counters = m_counters[call];
+    ++counters.count;
+    counters.nsecs += nsecs;
+    ++counters.histogram[bucket(nsecs)];
+    if (hresult < 0) {
+        ++counters.failureCount;
+        ++counters.failures[hresult];
+    }
+}
+
+void QWinShellMetrics::reset()
+{
+    QMutexLocker locker(&m_mutex);
+    for (int i = 0; i < QWinShellBackend::CallCount; ++i)
+        m_counters[i] = Counters();
+}
+
+int QWinShellMetrics::callCount(QWinShellBackend::Call call) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_counters[call].count;
+}
+
+int QWinShellMetrics::failureCount(QWinShellBackend::Call call) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_counters[call].failureCount;
+}
+
+QHash<qint32, int> QWinShellMetrics::failures(QWinShellBackend::Call call) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_counters[call].failures;
+}
+
+qint64 QWinShellMetrics::elapsed(QWinShellBackend::Call call) const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_counters[call].nsecs;
+}
+
+QVector<int> QWinShellMetrics::histogram(QWinShellBackend::Call call) const
+{
+    QMutexLocker locker(&m_mutex);
+    QVector<int> histogram(BucketCount);
+    for (int i = 0; i < BucketCount; ++i)
+        histogram[i] = m_counters[call].histogram[i];
+    return histogram;
+}
+
+/*
+    Returns the bucket of a call that took \a nsecs nanoseconds.
+ */
+int QWinShellMetrics::bucket(qint64 nsecs)
+{
+    quint64 usecs = nsecs > 0 ? quint64(nsecs) / 1000 : 0;
+    int bucket = 0;
+    while (usecs && bucket < BucketCount - 1) {
+        usecs >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+/*
+    Returns the number of microseconds the calls in \a bucket took less than,
+    or -1 for the last bucket.
+ */
+qint64 QWinShellMetrics::bucketLimit(int bucket)
+{
+    return bucket < BucketCount - 1 ? Q_INT64_C(1) << bucket : -1;
+}
+
+/*
+    Returns the metrics of the calls made at least once, by the name of the
+    native function:
+
+    \code
+    {
+        "enabled": true,
+        "bucketLimits": [1, 2, 4, ..., -1],
+        "calls": {
+            "CommitList": {
+                "count": 3,
+                "failureCount": 1,
+                "elapsed": 5821000,
+                "failures": [ { "hresult": "0x80004005", "name": "E_FAIL", "count": 1 } ],
+                "histogram": [0, 0, ..., 2, 1, 0, ...]
+            }
+        }
+    }
+    \endcode
+
+    The elapsed time is in nanoseconds.
+ */
+QVariantMap QWinShellMetrics::toVariantMap() const
+{
+    QVariantList bucketLimits;
+    for (int i = 0; i < BucketCount; ++i)
+        bucketLimits.append(bucketLimit(i));
+
+    QVariantMap calls;
+    QMutexLocker locker(&m_mutex);
+    for (int i = 0; i < QWinShellBackend::CallCount; ++i) {
+        const Counters &counters = m_counters[i];
+        if (!counters.count)
+            continue;
+
+        // Sorted by HRESULT, for a stable output.
+        QMap<quint32, int> sortedFailures;
+        for (QHash<qint32, int>::const_iterator it = counters.failures.constBegin(); it != counters.failures.constEnd(); ++it)
+            sortedFailures.insert(quint32(it.key()), it.value());
+        QVariantList failures;
+        for (QMap<quint32, int>::const_iterator it = sortedFailures.constBegin(); it != sortedFailures.constEnd(); ++it) {
+            QVariantMap failure;
+            failure.insert(QStringLiteral("hresult"), QStringLiteral("0x%1").arg(it.key(), 8, 16, QLatin1Char('0')));
+            failure.insert(QStringLiteral("name"), qt_winHresultName(it.key()));
+            failure.insert(QStringLiteral("count"), it.value());
+            failures.append(failure);
+        }
+
+        QVariantList histogram;
+        for (int j = 0; j < BucketCount; ++j)
+            histogram.append(counters.histogram[j]);
+
+        QVariantMap call;
+        call.insert(QStringLiteral("count"), counters.count);
+        call.insert(QStringLiteral("failureCount"), counters.failureCount);
+        call.insert(QStringLiteral("elapsed"), counters.nsecs);
+        call.insert(QStringLiteral("failures"), failures);
+        call.insert(QStringLiteral("histogram"), histogram);
+        calls.insert(QLatin1String(QWinShellBackend::callName(QWinShellBackend::Call(i))), call);
+    }
+    locker.unlock();
+
+    QVariantMap metrics;
+    metrics.insert(QStringLiteral("enabled"), isEnabled());
+    metrics.insert(QStringLiteral("bucketLimits"), bucketLimits);
+    metrics.insert(QStringLiteral("calls"), calls);
+    return metrics;
+}
+
+QByteArray QWinShellMetrics::toJson() const
+{
+    return QJsonDocument::fromVariant(toVariantMap()).toJson();
+}
+
+QT_END_NAMESPACE
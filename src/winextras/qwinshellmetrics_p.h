@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINSHELLMETRICS_P_H
+#define QWINSHELLMETRICS_P_H
+
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QVariantMap>
+#include <QtCore/QVector>
+#include <QtCore/qatomic.h>
+
+#include "qwinshellbackend_p.h"
+
+QT_BEGIN_NAMESPACE
+
+// Counts the calls made into the shell and the desktop window manager, their
+// failures by HRESULT, and how long they took, in histograms with one bucket
+// per power of two microseconds: bucket 0 holds the calls that took less than
+// a microsecond, bucket n those that took from 2^(n-1) up to 2^n microseconds,
+// and the last bucket all slower ones.
+//
+// Nothing is recorded until the metrics are enabled, with
+// QtWin::setShellMetricsEnabled() or by setting QT_WINEXTRAS_SHELL_METRICS in
+// the environment of the process. The functions are thread-safe.
+class Q_WINEXTRAS_EXPORT QWinShellMetrics
+{
+public:
+    enum { BucketCount = 24 };
+
+    QWinShellMetrics();
+
+    static QWinShellMetrics *instance();
+
+    bool isEnabled() const { return m_enabled.load() != 0; }
+    void setEnabled(bool enabled) { m_enabled.store(enabled); }
+
+    void record(QWinShellBackend::Call call, qint32 hresult, qint64 nsecs);
+    void reset();
+
+    int callCount(QWinShellBackend::Call call) const;
+    int failureCount(QWinShellBackend::Call call) const;
+    QHash<qint32, int> failures(QWinShellBackend::Call call) const;
+    qint64 elapsed(QWinShellBackend::Call call) const;
+    QVector<int> histogram(QWinShellBackend::Call call) const;
+
+    static int bucket(qint64 nsecs);
+    static qint64 bucketLimit(int bucket);
+
+    QVariantMap toVariantMap() const;
+    QByteArray toJson() const;
+
+private:
+    Q_DISABLE_COPY(QWinShellMetrics)
+
+    struct Counters
+    {
+        Counters();
+
+        int count;
+        int failureCount;
+        qint64 nsecs;
+        int histogram[BucketCount];
+        QHash<qint32, int> failures;
+    };
+
+    QAtomicInt m_enabled;
+    mutable QMutex m_mutex;
+    Counters m_counters[QWinShellBackend::CallCount];
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINSHELLMETRICS_P_H
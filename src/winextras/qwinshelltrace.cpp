@@ -0,0 +1,487 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinshelltrace_p.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QIODevice>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+static const char traceMagic[] = { 'Q', 'W', 'S', 'T' };
+// version 1 traces lack the toolbar and destruction events, and read as
+// they are
+static const char traceVersion = 2;
+static const int traceHeaderSize = sizeof(traceMagic) + 1;
+
+QWinShellTraceWriter::QWinShellTraceWriter(QIODevice *device) :
+    m_device(device), m_size(0), m_time(0), m_nextTarget(0)
+{
+    m_clock.start();
+    m_strings.insert(QString(), 0);
+    m_buffer.append(traceMagic, sizeof(traceMagic));
+    m_buffer.append(traceVersion);
+    flush();
+}
+
+void QWinShellTraceWriter::flush()
+{
+    m_size += m_buffer.size();
+    if (m_device)
+        m_device->write(m_buffer);
+    m_buffer.clear();
+}
+
+quint32 QWinShellTraceWriter::targetId(const void *target)
+{
+    QHash<const void *, quint32>::const_iterator it = m_targets.constFind(target);
+    if (it != m_targets.constEnd())
+        return it.value();
+    const quint32 id = m_nextTarget++;
+    m_targets.insert(target, id);
+    return id;
+}
+
+void QWinShellTraceWriter::beginEvent(QWinShellTraceEvent::Type type, qint64 time, quint32 target)
+{
+    // a clock going backwards is recorded as no time passing
+    const qint64 delta = qMax(time - m_time, qint64(0));
+    m_time += delta;
+    m_buffer.append(char(type));
+    writeNumber(quint64(delta));
+    writeNumber(target);
+}
+
+void QWinShellTraceWriter::writeNumber(quint64 value)
+{
+    while (value >= 0x80) {
+        m_buffer.append(char(value | 0x80));
+        value >>= 7;
+    }
+    m_buffer.append(char(value));
+}
+
+void QWinShellTraceWriter::writeSignedNumber(qint64 value)
+{
+    writeNumber((quint64(value) << 1) ^ quint64(value >> 63));
+}
+
+void QWinShellTraceWriter::writeString(const QString &string)
+{
+    QHash<QString, quint32>::const_iterator it = m_strings.constFind(string);
+    if (it != m_strings.constEnd()) {
+        writeNumber(it.value());
+        return;
+    }
+    const quint32 index = m_strings.size();
+    m_strings.insert(string, index);
+    const QByteArray utf8 = string.toUtf8();
+    writeNumber(index);
+    writeNumber(quint64(utf8.size()));
+    m_buffer.append(utf8);
+}
+
+void QWinShellTraceWriter::writeButtons(const QWinThumbnailButtonState *buttons)
+{
+    for (int i = 0; i < QWinThumbnailToolBarState::SlotCount; ++i) {
+        writeNumber(buttons[i].flags);
+        writeSignedNumber(buttons[i].iconKey);
+        writeString(buttons[i].toolTip);
+    }
+}
+
+void QWinShellTraceWriter::writeJumpListSnapshot(const QWinJumpListSnapshot &snapshot)
+{
+    writeString(snapshot.identifier);
+    writeNumber(quint64(snapshot.categories.size()));
+    foreach (const QWinJumpListCategorySnapshot &category, snapshot.categories) {
+        writeNumber(quint64(category.type));
+        writeString(category.title);
+        writeNumber(quint64(category.items.size()));
+        foreach (const QWinJumpListItemSnapshot &item, category.items) {
+            writeNumber(quint64(item.type));
+            writeString(item.filePath);
+            writeString(item.workingDirectory);
+            writeString(item.title);
+            writeString(item.description);
+            writeNumber(quint64(item.arguments.size()));
+            foreach (const QString &argument, item.arguments)
+                writeString(argument);
+            writeSignedNumber(item.iconKey);
+        }
+    }
+}
+
+void QWinShellTraceWriter::writeProgress(const void *target, QWinTaskbarProgressState state, quint64 completed, quint64 total)
+{
+    beginEvent(QWinShellTraceEvent::Progress, m_clock.elapsed(), targetId(target));
+    writeNumber(quint64(state));
+    writeNumber(completed);
+    writeNumber(total);
+    flush();
+}
+
+void QWinShellTraceWriter::writeProgressInterval(const void *target, int msecs)
+{
+    beginEvent(QWinShellTraceEvent::ProgressInterval, m_clock.elapsed(), targetId(target));
+    writeNumber(quint64(qMax(msecs, 0)));
+    flush();
+}
+
+void QWinShellTraceWriter::writeOverlay(const void *target, qint64 iconKey, const QString &description)
+{
+    beginEvent(QWinShellTraceEvent::Overlay, m_clock.elapsed(), targetId(target));
+    writeSignedNumber(iconKey);
+    writeString(description);
+    flush();
+}
+
+void QWinShellTraceWriter::writeThumbnailButtons(const void *target, const QWinThumbnailButtonState *buttons)
+{
+    beginEvent(QWinShellTraceEvent::ThumbnailButtons, m_clock.elapsed(), targetId(target));
+    writeButtons(buttons);
+    flush();
+}
+
+void QWinShellTraceWriter::writeJumpList(const void *target, const QWinJumpListSnapshot &snapshot)
+{
+    beginEvent(QWinShellTraceEvent::JumpList, m_clock.elapsed(), targetId(target));
+    writeJumpListSnapshot(snapshot);
+    flush();
+}
+
+void QWinShellTraceWriter::writeToolbarAdded(const void *target)
+{
+    beginEvent(QWinShellTraceEvent::ToolbarAdded, m_clock.elapsed(), targetId(target));
+    flush();
+}
+
+void QWinShellTraceWriter::writeToolbarCleared(const void *target)
+{
+    beginEvent(QWinShellTraceEvent::ToolbarCleared, m_clock.elapsed(), targetId(target));
+    flush();
+}
+
+/*
+    Records that \a target is gone, so that an object created at the same
+    address later is a new target. Nothing is written for a target that
+    never appeared in the trace.
+ */
+void QWinShellTraceWriter::writeDestroyed(const void *target)
+{
+    QHash<const void *, quint32>::iterator it = m_targets.find(target);
+    if (it == m_targets.end())
+        return;
+    beginEvent(QWinShellTraceEvent::Destroyed, m_clock.elapsed(), it.value());
+    m_targets.erase(it);
+    flush();
+}
+
+/*
+    Writes \a event as it is, with the target numbers and time it has.
+ */
+void QWinShellTraceWriter::write(const QWinShellTraceEvent &event)
+{
+    beginEvent(event.type, event.time, event.target);
+    switch (event.type) {
+    case QWinShellTraceEvent::Progress:
+        writeNumber(quint64(event.state));
+        writeNumber(event.completed);
+        writeNumber(event.total);
+        break;
+    case QWinShellTraceEvent::ProgressInterval:
+        writeNumber(quint64(qMax(event.interval, 0)));
+        break;
+    case QWinShellTraceEvent::Overlay:
+        writeSignedNumber(event.iconKey);
+        writeString(event.description);
+        break;
+    case QWinShellTraceEvent::ThumbnailButtons: {
+        QWinThumbnailButtonState buttons[QWinThumbnailToolBarState::SlotCount];
+        for (int i = 0; i < qMin(event.buttons.size(), int(QWinThumbnailToolBarState::SlotCount)); ++i)
+            buttons[i] = event.buttons.at(i);
+        writeButtons(buttons);
+        break;
+    }
+    case QWinShellTraceEvent::JumpList:
+        writeJumpListSnapshot(event.jumpList);
+        break;
+    case QWinShellTraceEvent::ToolbarAdded:
+    case QWinShellTraceEvent::ToolbarCleared:
+    case QWinShellTraceEvent::Destroyed:
+        break;
+    }
+    flush();
+}
+
+QWinShellTraceReader::QWinShellTraceReader(const QByteArray &data) :
+    m_data(data), m_position(0), m_time(0)
+{
+    m_strings.append(QString());
+    if (m_data.size() < traceHeaderSize || !m_data.startsWith(QByteArray::fromRawData(traceMagic, sizeof(traceMagic))))
+        fail("not a shell trace");
+    else if (m_data.at(int(sizeof(traceMagic))) < 1 || m_data.at(int(sizeof(traceMagic))) > traceVersion)
+        fail("unsupported version");
+    else
+        m_position = traceHeaderSize;
+}
+
+bool QWinShellTraceReader::fail(const char *error)
+{
+    if (m_errorString.isEmpty())
+        m_errorString = QString::fromLatin1("%1 at offset %2").arg(QLatin1String(error)).arg(m_position);
+    m_position = m_data.size();
+    return false;
+}
+
+bool QWinShellTraceReader::readNumber(quint64 *value)
+{
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (m_position == m_data.size())
+            return fail("truncated number");
+        const uchar byte = uchar(m_data.at(m_position++));
+        *value |= quint64(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+    return fail("number too long");
+}
+
+bool QWinShellTraceReader::readSignedNumber(qint64 *value)
+{
+    quint64 encoded;
+    if (!readNumber(&encoded))
+        return false;
+    *value = qint64(encoded >> 1) ^ -qint64(encoded & 1);
+    return true;
+}
+
+// Sizes and counts may not exceed what the remaining bytes could hold.
+bool QWinShellTraceReader::readSize(int *size)
+{
+    quint64 value;
+    if (!readNumber(&value))
+        return false;
+    if (value > quint64(m_data.size() - m_position))
+        return fail("invalid size");
+    *size = int(value);
+    return true;
+}
+
+bool QWinShellTraceReader::readString(QString *string)
+{
+    quint64 index;
+    if (!readNumber(&index))
+        return false;
+    if (index < quint64(m_strings.size())) {
+        *string = m_strings.at(int(index));
+        return true;
+    }
+    if (index != quint64(m_strings.size()))
+        return fail("invalid string index");
+    int size;
+    if (!readSize(&size))
+        return false;
+    *string = QString::fromUtf8(m_data.constData() + m_position, size);
+    m_position += size;
+    m_strings.append(*string);
+    return true;
+}
+
+bool QWinShellTraceReader::readJumpListSnapshot(QWinJumpListSnapshot *snapshot)
+{
+    int categoryCount;
+    if (!readString(&snapshot->identifier) || !readSize(&categoryCount))
+        return false;
+    snapshot->categories.resize(categoryCount);
+    for (int c = 0; c < categoryCount; ++c) {
+        QWinJumpListCategorySnapshot &category = snapshot->categories[c];
+        quint64 type;
+        int itemCount;
+        if (!readNumber(&type) || !readString(&category.title) || !readSize(&itemCount))
+            return false;
+        if (type > QWinJumpListCategory::Tasks)
+            return fail("invalid category type");
+        category.type = QWinJumpListCategory::Type(type);
+        category.items.resize(itemCount);
+        for (int i = 0; i < itemCount; ++i) {
+            QWinJumpListItemSnapshot &item = category.items[i];
+            int argumentCount;
+            if (!readNumber(&type) || !readString(&item.filePath) || !readString(&item.workingDirectory)
+                    || !readString(&item.title) || !readString(&item.description)
+                    || !readSize(&argumentCount))
+                return false;
+            if (type > QWinJumpListItem::Separator)
+                return fail("invalid item type");
+            item.type = QWinJumpListItem::Type(type);
+            for (int a = 0; a < argumentCount; ++a) {
+                QString argument;
+                if (!readString(&argument))
+                    return false;
+                item.arguments.append(argument);
+            }
+            if (!readSignedNumber(&item.iconKey))
+                return false;
+        }
+    }
+    return true;
+}
+
+/*
+    Reads the next event into \a event. Returns false at the end of the
+    trace, or if it is corrupt, in which case hasError() is true.
+ */
+bool QWinShellTraceReader::readNext(QWinShellTraceEvent *event)
+{
+    if (atEnd())
+        return false;
+
+    *event = QWinShellTraceEvent();
+    const int type = uchar(m_data.at(m_position++));
+    quint64 delta;
+    quint64 target;
+    if (!readNumber(&delta) || !readNumber(&target))
+        return false;
+    if (delta > quint64(std::numeric_limits<qint64>::max() - m_time) || target > 0xffffffffu)
+        return fail("invalid event");
+    m_time += qint64(delta);
+    event->time = m_time;
+    event->target = quint32(target);
+
+    quint64 value;
+    switch (type) {
+    case QWinShellTraceEvent::Progress:
+        event->type = QWinShellTraceEvent::Progress;
+        if (!readNumber(&value) || !readNumber(&event->completed) || !readNumber(&event->total))
+            return false;
+        if (value > QWinTaskbarProgressPaused)
+            return fail("invalid progress state");
+        event->state = QWinTaskbarProgressState(value);
+        return true;
+    case QWinShellTraceEvent::ProgressInterval:
+        event->type = QWinShellTraceEvent::ProgressInterval;
+        if (!readNumber(&value))
+            return false;
+        if (value > quint64(std::numeric_limits<int>::max()))
+            return fail("invalid interval");
+        event->interval = int(value);
+        return true;
+    case QWinShellTraceEvent::Overlay:
+        event->type = QWinShellTraceEvent::Overlay;
+        return readSignedNumber(&event->iconKey) && readString(&event->description);
+    case QWinShellTraceEvent::ThumbnailButtons:
+        event->type = QWinShellTraceEvent::ThumbnailButtons;
+        event->buttons.resize(QWinThumbnailToolBarState::SlotCount);
+        for (int i = 0; i < QWinThumbnailToolBarState::SlotCount; ++i) {
+            QWinThumbnailButtonState &button = event->buttons[i];
+            if (!readNumber(&value) || !readSignedNumber(&button.iconKey) || !readString(&button.toolTip))
+                return false;
+            button.flags = quint32(value);
+        }
+        return true;
+    case QWinShellTraceEvent::JumpList:
+        event->type = QWinShellTraceEvent::JumpList;
+        return readJumpListSnapshot(&event->jumpList);
+    case QWinShellTraceEvent::ToolbarAdded:
+    case QWinShellTraceEvent::ToolbarCleared:
+    case QWinShellTraceEvent::Destroyed:
+        event->type = QWinShellTraceEvent::Type(type);
+        return true;
+    }
+    --m_position;
+    return fail("invalid event type");
+}
+
+namespace {
+
+// The trace file named by QT_WINEXTRAS_SHELL_TRACE, if any.
+class QWinShellTraceFile
+{
+public:
+    QWinShellTraceFile() : writer(0)
+    {
+        const QString fileName = QFile::decodeName(qgetenv("QT_WINEXTRAS_SHELL_TRACE"));
+        if (fileName.isEmpty())
+            return;
+        file.setFileName(fileName);
+        if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+            writer = new QWinShellTraceWriter(&file);
+        else
+            qWarning("QWinShellTrace: Cannot write %s: %s", qPrintable(fileName), qPrintable(file.errorString()));
+    }
+
+    ~QWinShellTraceFile()
+    {
+        delete writer;
+    }
+
+    QFile file;
+    QWinShellTraceWriter *writer;
+};
+
+} // namespace
+
+Q_GLOBAL_STATIC(QWinShellTraceFile, shellTraceFile)
+
+static QWinShellTraceWriter *shellTraceWriter = 0;
+
+/*
+    Returns the writer the taskbar buttons, thumbnail toolbars and jump lists
+    record what they are asked to do into, or 0 if nothing is recorded.
+ */
+QWinShellTraceWriter *qt_winShellTraceWriter()
+{
+    return shellTraceWriter ? shellTraceWriter : shellTraceFile()->writer;
+}
+
+/*
+    Records into \a writer instead of the trace file, 0 restores it. The
+    writer is not owned.
+ */
+void qt_winSetShellTraceWriter(QWinShellTraceWriter *writer)
+{
+    shellTraceWriter = writer;
+}
+
+QT_END_NAMESPACE
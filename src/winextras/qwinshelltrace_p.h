@@ -0,0 +1,202 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINSHELLTRACE_P_H
+#define QWINSHELLTRACE_P_H
+
+#include <QtWinExtras/qwinextrasglobal.h>
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "qwintaskbarprogresscoalescer_p.h"
+#include "qwinthumbnailtoolbarstate_p.h"
+#include "qwinjumplistsnapshot_p.h"
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+
+// What a taskbar button, thumbnail toolbar or jump list asked for, before
+// anything was left out or coalesced on the way to the shell. Targets are
+// numbered in the order they first appear in the trace, and a number is not
+// used again once its target is destroyed; times are in milliseconds since
+// the trace started.
+struct QWinShellTraceEvent
+{
+    enum Type
+    {
+        Progress = 1,
+        ProgressInterval,
+        Overlay,
+        ThumbnailButtons,
+        JumpList,
+        ToolbarAdded,
+        ToolbarCleared,
+        Destroyed
+    };
+
+    QWinShellTraceEvent() :
+        type(Progress), time(0), target(0), state(QWinTaskbarProgressNone),
+        completed(0), total(0), interval(0), iconKey(0) {}
+
+    Type type;
+    qint64 time;
+    quint32 target;
+
+    // Progress, ProgressInterval
+    QWinTaskbarProgressState state;
+    quint64 completed;
+    quint64 total;
+    int interval;
+
+    // Overlay
+    qint64 iconKey;
+    QString description;
+
+    // ThumbnailButtons, QWinThumbnailToolBarState::SlotCount of them
+    QVector<QWinThumbnailButtonState> buttons;
+
+    // JumpList
+    QWinJumpListSnapshot jumpList;
+};
+
+// A trace starts with "QWST" and a version byte, followed by the events.
+// Each event is its type as a byte, then the milliseconds since the previous
+// event and its target, and then:
+//
+//     Progress          state, completed, total
+//     ProgressInterval  milliseconds
+//     Overlay           icon key, description
+//     ThumbnailButtons  for each slot: flags, icon key, tool tip
+//     JumpList          identifier, category count, and for each category:
+//                       type, title, item count, and for each item: type,
+//                       file path, working directory, title, description,
+//                       argument count, arguments, icon key
+//     ToolbarAdded      nothing, the buttons were added to a window
+//     ToolbarCleared    nothing, the buttons were removed from the window
+//     Destroyed         nothing, the target is gone
+//
+// Numbers are LEB128 varints, signed ones zigzag encoded. A string is its
+// index in the table of the strings seen so far in the trace, followed by
+// its UTF-8 length and bytes if it is new. Index 0 is the empty string.
+// Progress ticks take a few bytes, and a jump list that did not change only
+// takes a byte per string.
+//
+// The writer can be given no device, to only count the size of a trace.
+class QWinShellTraceWriter
+{
+public:
+    explicit QWinShellTraceWriter(QIODevice *device);
+
+    void writeProgress(const void *target, QWinTaskbarProgressState state, quint64 completed, quint64 total);
+    void writeProgressInterval(const void *target, int msecs);
+    void writeOverlay(const void *target, qint64 iconKey, const QString &description);
+    void writeThumbnailButtons(const void *target, const QWinThumbnailButtonState *buttons);
+    void writeJumpList(const void *target, const QWinJumpListSnapshot &snapshot);
+    void writeToolbarAdded(const void *target);
+    void writeToolbarCleared(const void *target);
+    void writeDestroyed(const void *target);
+
+    // For writing traces with given times, as a benchmark does.
+    void write(const QWinShellTraceEvent &event);
+
+    qint64 size() const { return m_size; }
+
+private:
+    Q_DISABLE_COPY(QWinShellTraceWriter)
+
+    void beginEvent(QWinShellTraceEvent::Type type, qint64 time, quint32 target);
+    quint32 targetId(const void *target);
+    void writeNumber(quint64 value);
+    void writeSignedNumber(qint64 value);
+    void writeString(const QString &string);
+    void writeButtons(const QWinThumbnailButtonState *buttons);
+    void writeJumpListSnapshot(const QWinJumpListSnapshot &snapshot);
+    void flush();
+
+    QIODevice *m_device;
+    QByteArray m_buffer;
+    qint64 m_size;
+    QElapsedTimer m_clock;
+    qint64 m_time;
+    QHash<const void *, quint32> m_targets;
+    quint32 m_nextTarget;
+    QHash<QString, quint32> m_strings;
+};
+
+class QWinShellTraceReader
+{
+public:
+    explicit QWinShellTraceReader(const QByteArray &data);
+
+    bool readNext(QWinShellTraceEvent *event);
+    bool atEnd() const { return m_position == m_data.size(); }
+    bool hasError() const { return !m_errorString.isEmpty(); }
+    QString errorString() const { return m_errorString; }
+
+private:
+    Q_DISABLE_COPY(QWinShellTraceReader)
+
+    bool fail(const char *error);
+    bool readNumber(quint64 *value);
+    bool readSignedNumber(qint64 *value);
+    bool readSize(int *size);
+    bool readString(QString *string);
+    bool readJumpListSnapshot(QWinJumpListSnapshot *snapshot);
+
+    QByteArray m_data;
+    int m_position;
+    qint64 m_time;
+    QVector<QString> m_strings;
+    QString m_errorString;
+};
+
+// The trace QtWinExtras records into, 0 unless QT_WINEXTRAS_SHELL_TRACE
+// names a file to write it to or a writer has been set.
+QWinShellTraceWriter *qt_winShellTraceWriter();
+Q_WINEXTRAS_EXPORT void qt_winSetShellTraceWriter(QWinShellTraceWriter *writer);
+
+QT_END_NAMESPACE
+
+#endif // QWINSHELLTRACE_P_H
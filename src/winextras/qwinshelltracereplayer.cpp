@@ -0,0 +1,261 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinshelltracereplayer_p.h"
+#include "qwinjumplistcommitter_p.h"
+
+QT_BEGIN_NAMESPACE
+
+// A taskbar button, thumbnail toolbar and jump list at once, whichever the
+// events for it were recorded from.
+class QWinShellTraceReplayer::Target : public QWinTaskbarProgressSink
+{
+public:
+    Target(QWinShellBackend *backend, QWinIconStore *iconStore, quintptr window) :
+        backend(backend), window(window), progressCoalescer(this), progressDeadline(-1),
+        toolbarAdded(false), committer(backend, iconStore)
+    {
+        for (int i = 0; i < TypeCount; ++i)
+            seen[i] = false;
+    }
+
+    void setProgressValue(quint64 completed, quint64 total) Q_DECL_OVERRIDE
+    {
+        backend->setProgressValue(window, completed, total);
+    }
+
+    void setProgressState(QWinTaskbarProgressState state) Q_DECL_OVERRIDE
+    {
+        backend->setProgressState(window, state);
+    }
+
+    // As QWinTaskbarButton's timer would.
+    void scheduleProgressFlush(qint64 now, int msecs)
+    {
+        progressDeadline = msecs < 0 ? -1 : now + msecs;
+    }
+
+    QWinShellBackend *backend;
+    quintptr window;
+
+    QWinTaskbarProgressCoalescer progressCoalescer;
+    qint64 progressDeadline;
+
+    bool toolbarAdded;
+    QWinThumbnailToolBarState toolbarState;
+
+    QWinJumpListCommitter committer;
+
+    bool seen[TypeCount];
+    QWinShellTraceEvent previous[TypeCount];
+};
+
+QWinShellTraceReplayer::QWinShellTraceReplayer(QWinShellBackend *backend, QWinIconStore *iconStore) :
+    m_backend(backend), m_iconStore(iconStore), m_time(0)
+{
+    for (int i = 0; i < TypeCount; ++i) {
+        m_eventCounts[i] = 0;
+        m_redundantCounts[i] = 0;
+    }
+}
+
+QWinShellTraceReplayer::~QWinShellTraceReplayer()
+{
+    qDeleteAll(m_targets);
+}
+
+QWinShellTraceReplayer::Target *QWinShellTraceReplayer::target(quint32 id)
+{
+    Target *&target = m_targets[id];
+    if (!target)
+        target = new Target(m_backend, m_iconStore, quintptr(id) + 1);
+    return target;
+}
+
+bool QWinShellTraceReplayer::isRedundant(const QWinShellTraceEvent &previous, const QWinShellTraceEvent &event)
+{
+    switch (event.type) {
+    case QWinShellTraceEvent::Progress:
+        return previous.state == event.state
+                && qt_winProgressPercentage(previous.completed, previous.total) == qt_winProgressPercentage(event.completed, event.total);
+    case QWinShellTraceEvent::ProgressInterval:
+        return previous.interval == event.interval;
+    case QWinShellTraceEvent::Overlay:
+        return previous.iconKey == event.iconKey && previous.description == event.description;
+    case QWinShellTraceEvent::ThumbnailButtons:
+        if (previous.buttons.size() != event.buttons.size())
+            return false;
+        for (int i = 0; i < event.buttons.size(); ++i) {
+            if (qt_winThumbnailButtonChanges(previous.buttons.at(i), event.buttons.at(i)))
+                return false;
+        }
+        return true;
+    case QWinShellTraceEvent::JumpList:
+        return previous.jumpList == event.jumpList;
+    }
+    return false;
+}
+
+// Sends the progress updates held back until then.
+void QWinShellTraceReplayer::advance(qint64 time)
+{
+    foreach (Target *target, m_targets) {
+        while (target->progressDeadline >= 0 && target->progressDeadline <= time) {
+            const qint64 deadline = target->progressDeadline;
+            target->scheduleProgressFlush(deadline, target->progressCoalescer.flush(deadline));
+        }
+    }
+    m_time = qMax(m_time, time);
+}
+
+void QWinShellTraceReplayer::replay(const QWinShellTraceEvent &event)
+{
+    advance(event.time);
+
+    Target *target = this->target(event.target);
+    ++m_eventCounts[event.type];
+    if (target->seen[event.type] && isRedundant(target->previous[event.type], event))
+        ++m_redundantCounts[event.type];
+    target->seen[event.type] = true;
+    target->previous[event.type] = event;
+
+    switch (event.type) {
+    case QWinShellTraceEvent::Progress:
+        target->scheduleProgressFlush(m_time, target->progressCoalescer.submit(event.state, event.completed, event.total, m_time));
+        break;
+    case QWinShellTraceEvent::ProgressInterval:
+        target->progressCoalescer.setMinimumInterval(event.interval);
+        target->scheduleProgressFlush(m_time, target->progressCoalescer.flush(m_time));
+        break;
+    case QWinShellTraceEvent::Overlay:
+        m_backend->setOverlayIcon(target->window, quintptr(event.iconKey), event.description);
+        break;
+    case QWinShellTraceEvent::ThumbnailButtons: {
+        if (event.buttons.size() != QWinThumbnailToolBarState::SlotCount)
+            break;
+        // version 1 traces do not record when the buttons are added
+        if (!target->toolbarAdded && !addToolbar(target))
+            break;
+        QWinThumbnailButton buttons[QWinThumbnailToolBarState::SlotCount];
+        const int changeCount = target->toolbarState.buttons(event.buttons.constData(), buttons);
+        if (!changeCount)
+            break;
+        for (int i = 0; i < changeCount; ++i) {
+            if (buttons[i].mask & QWinThumbnailButtonIconField)
+                buttons[i].icon = quintptr(event.buttons.at(buttons[i].id).iconKey);
+        }
+        if (m_backend->updateThumbnailButtons(target->window, buttons, changeCount) >= 0)
+            target->toolbarState.commit(event.buttons.constData());
+        break;
+    }
+    case QWinShellTraceEvent::JumpList:
+        target->committer.commit(event.jumpList, 0);
+        break;
+    case QWinShellTraceEvent::ToolbarAdded:
+        addToolbar(target);
+        break;
+    case QWinShellTraceEvent::ToolbarCleared: {
+        QWinThumbnailButton buttons[QWinThumbnailToolBarState::SlotCount];
+        QWinThumbnailToolBarState::resetButtons(buttons);
+        if (target->toolbarAdded)
+            m_backend->updateThumbnailButtons(target->window, buttons, QWinThumbnailToolBarState::SlotCount);
+        target->toolbarAdded = false;
+        target->toolbarState.reset();
+        break;
+    }
+    case QWinShellTraceEvent::Destroyed:
+        m_targets.remove(event.target);
+        delete target;
+        break;
+    }
+}
+
+// As QWinThumbnailToolBar does when it gets a window.
+bool QWinShellTraceReplayer::addToolbar(Target *target)
+{
+    QWinThumbnailButton buttons[QWinThumbnailToolBarState::SlotCount];
+    QWinThumbnailToolBarState::resetButtons(buttons);
+    target->toolbarAdded = m_backend->addThumbnailButtons(target->window, buttons, QWinThumbnailToolBarState::SlotCount) >= 0;
+    target->toolbarState.reset();
+    return target->toolbarAdded;
+}
+
+/*
+    Replays the events of \a reader up to its end, and returns false if the
+    trace is corrupt.
+ */
+bool QWinShellTraceReplayer::replay(QWinShellTraceReader *reader)
+{
+    QWinShellTraceEvent event;
+    while (reader->readNext(&event))
+        replay(event);
+    return !reader->hasError();
+}
+
+/*
+    Sends the progress updates still held back, as if the application had
+    kept running.
+ */
+void QWinShellTraceReplayer::finish()
+{
+    qint64 end = m_time;
+    foreach (Target *target, m_targets)
+        end = qMax(end, target->progressDeadline);
+    advance(end);
+}
+
+int QWinShellTraceReplayer::eventCount() const
+{
+    int count = 0;
+    for (int i = 0; i < TypeCount; ++i)
+        count += m_eventCounts[i];
+    return count;
+}
+
+int QWinShellTraceReplayer::redundantEventCount() const
+{
+    int count = 0;
+    for (int i = 0; i < TypeCount; ++i)
+        count += m_redundantCounts[i];
+    return count;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,102 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINSHELLTRACEREPLAYER_P_H
+#define QWINSHELLTRACEREPLAYER_P_H
+
+#include <QtCore/QHash>
+
+#include "qwinshelltrace_p.h"
+#include "qwinshellbackend_p.h"
+
+QT_BEGIN_NAMESPACE
+
+class QWinIconStore;
+
+// Replays a trace through what lies between the public classes and the
+// shell: the progress coalescers of the taskbar buttons, the states of the
+// thumbnail toolbars and the jump list committers, in the order and at the
+// times the events were recorded, but without waiting for them.
+//
+// An event is redundant if it asks for what the previous event of its type
+// and target already asked for, for progress if it shows the same state and
+// percentage. Jump list icons are not replayed. A destroyed target takes
+// its held back progress updates with it, as the timer of a taskbar button
+// would.
+class QWinShellTraceReplayer
+{
+public:
+    QWinShellTraceReplayer(QWinShellBackend *backend, QWinIconStore *iconStore);
+    ~QWinShellTraceReplayer();
+
+    void replay(const QWinShellTraceEvent &event);
+    bool replay(QWinShellTraceReader *reader);
+    void finish();
+
+    int eventCount() const;
+    int eventCount(QWinShellTraceEvent::Type type) const { return m_eventCounts[type]; }
+    int redundantEventCount() const;
+    int redundantEventCount(QWinShellTraceEvent::Type type) const { return m_redundantCounts[type]; }
+    qint64 duration() const { return m_time; }
+
+private:
+    Q_DISABLE_COPY(QWinShellTraceReplayer)
+
+    enum { TypeCount = QWinShellTraceEvent::Destroyed + 1 };
+
+    class Target;
+
+    Target *target(quint32 id);
+    bool addToolbar(Target *target);
+    void advance(qint64 time);
+    static bool isRedundant(const QWinShellTraceEvent &previous, const QWinShellTraceEvent &event);
+
+    QWinShellBackend *m_backend;
+    QWinIconStore *m_iconStore;
+    QHash<quint32, Target *> m_targets;
+    qint64 m_time;
+    int m_eventCounts[TypeCount];
+    int m_redundantCounts[TypeCount];
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINSHELLTRACEREPLAYER_P_H
@@ -46,14 +46,14 @@
 #include "qwinfunctions.h"
 #include "qwinfunctions_p.h"
 #include "qwineventfilter_p.h"
+#include "qwinshelltrace_p.h"
+#include "qwinshellexecutor_p.h"
 #include "qwinevent.h"
-#include "winshobjidl_p.h"
 
 #include <QWindow>
 #include <QIcon>
 #include <QPair>
 #include <dwmapi.h>
-#include <shobjidl.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -81,37 +81,70 @@ QT_BEGIN_NAMESPACE
     \sa QWinTaskbarProgress
  */
 
-static TBPFLAG nativeProgressState(QWinTaskbarProgress *progress)
+class QWinTaskbarProgressValueJob : public QWinShellJob
 {
-    if (!progress || !progress->isVisible())
-        return TBPF_NOPROGRESS;
-    if (progress->isStopped())
-        return TBPF_ERROR;
-    if (progress->isPaused())
-        return TBPF_PAUSED;
-    if (progress->minimum() == 0 && progress->maximum() == 0)
-        return TBPF_INDETERMINATE;
-    return TBPF_NORMAL;
-}
+public:
+    QWinTaskbarProgressValueJob(QWinShellBackend *backend, quintptr window, quint64 completed, quint64 total) :
+        m_backend(backend), m_window(window), m_completed(completed), m_total(total) {}
+
+    void run() Q_DECL_OVERRIDE
+    {
+        m_backend->setProgressValue(m_window, m_completed, m_total);
+    }
 
-QWinTaskbarButtonPrivate::QWinTaskbarButtonPrivate() : progressBar(0), pTbList(0), window(0)
+private:
+    QWinShellBackend *m_backend;
+    const quintptr m_window;
+    const quint64 m_completed;
+    const quint64 m_total;
+};
+
+class QWinTaskbarProgressStateJob : public QWinShellJob
 {
-    HRESULT hresult = CoCreateInstance(CLSID_TaskbarList, 0, CLSCTX_INPROC_SERVER, IID_ITaskbarList4, reinterpret_cast<void **>(&pTbList));
-    if (FAILED(hresult)) {
-        pTbList = 0;
-        const QString err = QtWin::errorStringFromHresult(hresult);
-        qWarning("QWinTaskbarButton: IID_ITaskbarList4 was not created: %#010x, %s.", (unsigned)hresult, qPrintable(err));
-    } else if (FAILED(pTbList->HrInit())) {
-        pTbList->Release();
-        pTbList = 0;
-        const QString err = QtWin::errorStringFromHresult(hresult);
-        qWarning("QWinTaskbarButton: IID_ITaskbarList4 was not initialized: %#010x, %s.", (unsigned)hresult, qPrintable(err));
+public:
+    QWinTaskbarProgressStateJob(QWinShellBackend *backend, quintptr window, QWinTaskbarProgressState state) :
+        m_backend(backend), m_window(window), m_state(state) {}
+
+    void run() Q_DECL_OVERRIDE
+    {
+        m_backend->setProgressState(m_window, m_state);
     }
-}
 
-QWinTaskbarButtonPrivate::~QWinTaskbarButtonPrivate()
+private:
+    QWinShellBackend *m_backend;
+    const quintptr m_window;
+    const QWinTaskbarProgressState m_state;
+};
+
+// The icon belongs to the cache of the button, which destroys it on the
+// shell thread after this job has run.
+class QWinTaskbarOverlayJob : public QWinShellJob
+{
+public:
+    QWinTaskbarOverlayJob(QWinShellBackend *backend, quintptr window, quintptr icon, const QString &description) :
+        m_backend(backend), m_window(window), m_icon(icon), m_description(description) {}
+
+    void run() Q_DECL_OVERRIDE
+    {
+        m_backend->setOverlayIcon(m_window, m_icon, m_description);
+    }
+
+private:
+    QWinShellBackend *m_backend;
+    const quintptr m_window;
+    const quintptr m_icon;
+    const QString m_description;
+};
+
+// Enough for an application that switches between a few status overlays.
+static const int overlayIconCacheCapacity = 8;
+
+QWinTaskbarButtonPrivate::QWinTaskbarButtonPrivate() :
+    progressBar(0), backend(qt_winShellBackend()), window(0), progressCoalescer(this),
+    overlayIconCache(overlayIconCacheCapacity, qt_winDestroyIconOnShellThread)
 {
-    pTbList->Release();
+    progressClock.start();
+    progressTimer.setSingleShot(true);
 }
 
 HWND QWinTaskbarButtonPrivate::handle()
@@ -126,44 +159,66 @@ int QWinTaskbarButtonPrivate::iconSize() const
 
 void QWinTaskbarButtonPrivate::updateOverlayIcon()
 {
-    if (!pTbList || !window)
+    if (!window)
         return;
 
-    wchar_t *descrPtr = 0;
+    if (QWinShellTraceWriter *trace = qt_winShellTraceWriter())
+        trace->writeOverlay(this, overlayIcon.isNull() ? 0 : overlayIcon.cacheKey(), overlayAccessibleDescription);
+
     HICON hicon = 0;
-    if (!overlayAccessibleDescription.isEmpty())
-        descrPtr = qt_qstringToNullTerminated(overlayAccessibleDescription);
-    if (!overlayIcon.isNull())
-        hicon = QtWin::toHICON(overlayIcon.pixmap(iconSize()));
-
-    if (hicon)
-        pTbList->SetOverlayIcon(handle(), hicon, descrPtr);
-    else if (!hicon && !overlayIcon.isNull())
-        pTbList->SetOverlayIcon(handle(), (HICON)LoadImage(0, IDI_APPLICATION, IMAGE_ICON, SM_CXSMICON, SM_CYSMICON, LR_SHARED), descrPtr);
-    else
-        pTbList->SetOverlayIcon(handle(), NULL, descrPtr);
-
-    if (hicon)
-        DeleteObject(hicon);
-    if (descrPtr)
-        delete[] descrPtr;
+    if (!overlayIcon.isNull()) {
+        const int size = iconSize();
+        hicon = reinterpret_cast<HICON>(overlayIconCache.find(overlayIcon.cacheKey(), size));
+        if (!hicon) {
+            hicon = QtWin::toHICON(overlayIcon.pixmap(size));
+            overlayIconCache.insert(overlayIcon.cacheKey(), size, reinterpret_cast<quintptr>(hicon));
+        }
+    }
+
+    if (!hicon && !overlayIcon.isNull())
+        hicon = (HICON)LoadImage(0, IDI_APPLICATION, IMAGE_ICON, SM_CXSMICON, SM_CYSMICON, LR_SHARED);
+    qt_winShellExecutor()->post(new QWinTaskbarOverlayJob(backend, quintptr(handle()), reinterpret_cast<quintptr>(hicon), overlayAccessibleDescription));
+}
+
+void QWinTaskbarButtonPrivate::setProgressValue(quint64 completed, quint64 total)
+{
+    qt_winShellExecutor()->post(new QWinTaskbarProgressValueJob(backend, quintptr(handle()), completed, total));
+}
+
+void QWinTaskbarButtonPrivate::setProgressState(QWinTaskbarProgressState state)
+{
+    qt_winShellExecutor()->post(new QWinTaskbarProgressStateJob(backend, quintptr(handle()), state));
+}
+
+void QWinTaskbarButtonPrivate::scheduleProgressFlush(int msecs)
+{
+    if (msecs < 0)
+        progressTimer.stop();
+    else if (!progressTimer.isActive())
+        progressTimer.start(msecs);
 }
 
 void QWinTaskbarButtonPrivate::_q_updateProgress()
 {
-    if (!pTbList || !window)
+    if (!window)
         return;
 
-    if (progressBar) {
-        const int min = progressBar->minimum();
-        const int max = progressBar->maximum();
-        const int range = max - min;
-        if (range > 0) {
-            const int value = 100.0 * (progressBar->value() - min) / range;
-            pTbList->SetProgressValue(handle(), value, 100);
-        }
-    }
-    pTbList->SetProgressState(handle(), nativeProgressState(progressBar));
+    quint64 completed = 0;
+    quint64 total = 0;
+    if (progressBar)
+        qt_winProgressSpan(progressBar->minimum64(), progressBar->maximum64(), progressBar->value64(), &completed, &total);
+    const QWinTaskbarProgressState state = qt_winProgressState(progressBar);
+    if (QWinShellTraceWriter *trace = qt_winShellTraceWriter())
+        trace->writeProgress(this, state, completed, total);
+    scheduleProgressFlush(progressCoalescer.submit(state, completed, total, progressClock.elapsed()));
+}
+
+void QWinTaskbarButtonPrivate::_q_flushProgress()
+{
+    if (!window)
+        return;
+
+    scheduleProgressFlush(progressCoalescer.flush(progressClock.elapsed()));
 }
 
 /*!
@@ -175,6 +230,8 @@ void QWinTaskbarButtonPrivate::_q_updateProgress()
 QWinTaskbarButton::QWinTaskbarButton(QObject *parent) :
     QObject(parent), d_ptr(new QWinTaskbarButtonPrivate)
 {
+    Q_D(QWinTaskbarButton);
+    connect(&d->progressTimer, SIGNAL(timeout()), this, SLOT(_q_flushProgress()));
     QWinEventFilter::setup();
     setWindow(qobject_cast<QWindow *>(parent));
 }
@@ -184,6 +241,8 @@ QWinTaskbarButton::QWinTaskbarButton(QObject *parent) :
  */
 QWinTaskbarButton::~QWinTaskbarButton()
 {
+    if (QWinShellTraceWriter *trace = qt_winShellTraceWriter())
+        trace->writeDestroyed(d_func());
 }
 
 /*!
@@ -196,6 +255,7 @@ void QWinTaskbarButton::setWindow(QWindow *window)
     if (d->window)
         d->window->removeEventFilter(this);
     d->window = window;
+    d->progressCoalescer.invalidate();
     if (d->window) {
         d->window->installEventFilter(this);
         if (d->window->isVisible()) {
@@ -268,9 +328,9 @@ QWinTaskbarProgress *QWinTaskbarButton::progress() const
         QWinTaskbarButton *that = const_cast<QWinTaskbarButton *>(this);
         QWinTaskbarProgress *pbar = new QWinTaskbarProgress(that);
         connect(pbar, SIGNAL(destroyed()), this, SLOT(_q_updateProgress()));
-        connect(pbar, SIGNAL(valueChanged(int)), this, SLOT(_q_updateProgress()));
-        connect(pbar, SIGNAL(minimumChanged(int)), this, SLOT(_q_updateProgress()));
-        connect(pbar, SIGNAL(maximumChanged(int)), this, SLOT(_q_updateProgress()));
+        connect(pbar, SIGNAL(value64Changed(qint64)), this, SLOT(_q_updateProgress()));
+        connect(pbar, SIGNAL(minimum64Changed(qint64)), this, SLOT(_q_updateProgress()));
+        connect(pbar, SIGNAL(maximum64Changed(qint64)), this, SLOT(_q_updateProgress()));
         connect(pbar, SIGNAL(visibilityChanged(bool)), this, SLOT(_q_updateProgress()));
         connect(pbar, SIGNAL(pausedChanged(bool)), this, SLOT(_q_updateProgress()));
         connect(pbar, SIGNAL(stoppedChanged(bool)), this, SLOT(_q_updateProgress()));
@@ -280,6 +340,36 @@ QWinTaskbarProgress *QWinTaskbarButton::progress() const
     return d->progressBar;
 }
 
+/*!
+    \property QWinTaskbarButton::progressUpdateInterval
+    \brief the minimum interval in milliseconds between two updates of the
+    progress value on the taskbar
+
+    Updates that do not change the displayed percentage or state are never sent
+    to the taskbar. Of the remaining ones, changes of the value alone are sent at
+    most once per interval, and the latest value is sent when the interval has
+    elapsed. Changes of the state are always sent immediately.
+
+    The default value is \c 0, which sends every visible change immediately.
+
+    \since 5.2
+ */
+int QWinTaskbarButton::progressUpdateInterval() const
+{
+    Q_D(const QWinTaskbarButton);
+    return d->progressCoalescer.minimumInterval();
+}
+
+void QWinTaskbarButton::setProgressUpdateInterval(int msecs)
+{
+    Q_D(QWinTaskbarButton);
+    if (QWinShellTraceWriter *trace = qt_winShellTraceWriter())
+        trace->writeProgressInterval(d, msecs);
+    d->progressCoalescer.setMinimumInterval(msecs);
+    d->progressTimer.stop();
+    d->_q_flushProgress();
+}
+
 /*!
     \internal
     Intercepts TaskbarButtonCreated messages.
@@ -288,6 +378,7 @@ bool QWinTaskbarButton::eventFilter(QObject *object, QEvent *event)
 {
     Q_D(QWinTaskbarButton);
     if (object == d->window && event->type() == QWinEvent::TaskbarButtonCreated) {
+        d->progressCoalescer.invalidate();
         d->_q_updateProgress();
         d->updateOverlayIcon();
     }
@@ -59,6 +59,7 @@ class Q_WINEXTRAS_EXPORT QWinTaskbarButton : public QObject
     Q_PROPERTY(QString overlayAccessibleDescription READ overlayAccessibleDescription WRITE setOverlayAccessibleDescription)
     Q_PROPERTY(QWinTaskbarProgress *progress READ progress)
     Q_PROPERTY(QWindow *window READ window WRITE setWindow)
+    Q_PROPERTY(int progressUpdateInterval READ progressUpdateInterval WRITE setProgressUpdateInterval)
 
 public:
     explicit QWinTaskbarButton(QObject *parent = 0);
@@ -72,6 +73,9 @@ public:
 
     QWinTaskbarProgress *progress() const;
 
+    int progressUpdateInterval() const;
+    void setProgressUpdateInterval(int msecs);
+
     bool eventFilter(QObject *, QEvent *);
 
 public Q_SLOTS:
@@ -86,6 +90,7 @@ private:
     QScopedPointer<QWinTaskbarButtonPrivate> d_ptr;
 
     Q_PRIVATE_SLOT(d_func(), void _q_updateProgress())
+    Q_PRIVATE_SLOT(d_func(), void _q_flushProgress())
 };
 
 QT_END_NAMESPACE
@@ -43,22 +43,24 @@
 #define QWINTASKBARBUTTON_P_H
 
 #include "qwintaskbarbutton.h"
+#include "qwintaskbarprogresscoalescer_p.h"
+#include "qwiniconhandlecache_p.h"
+#include "qwinshellbackend_p.h"
 
 #include <QWindow>
 #include <QPointer>
+#include <QTimer>
+#include <QElapsedTimer>
 #include <qt_windows.h>
 
-struct ITaskbarList4;
-
 QT_BEGIN_NAMESPACE
 
 class QWinTaskbarProgress;
 
-class QWinTaskbarButtonPrivate
+class QWinTaskbarButtonPrivate : public QWinTaskbarProgressSink
 {
 public:
     QWinTaskbarButtonPrivate();
-    ~QWinTaskbarButtonPrivate();
 
     QPointer<QWinTaskbarProgress> progressBar;
     QIcon overlayIcon;
@@ -69,10 +71,21 @@ public:
 
     void updateOverlayIcon();
 
+    void setProgressValue(quint64 completed, quint64 total) Q_DECL_OVERRIDE;
+    void setProgressState(QWinTaskbarProgressState state) Q_DECL_OVERRIDE;
+    void scheduleProgressFlush(int msecs);
+
     void _q_updateProgress();
+    void _q_flushProgress();
 
-    ITaskbarList4 *pTbList;
+    QWinShellBackend *backend;
     QWindow *window;
+
+    QWinTaskbarProgressCoalescer progressCoalescer;
+    QElapsedTimer progressClock;
+    QTimer progressTimer;
+
+    QWinIconHandleCache overlayIconCache;
 };
 
 QT_END_NAMESPACE
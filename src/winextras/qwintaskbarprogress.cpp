@@ -40,6 +40,12 @@
  ****************************************************************************/
 
 #include "qwintaskbarprogress.h"
+#include "qwintaskbarprogressreporter.h"
+#include "qwintaskbarprogressreporter_p.h"
+#include "qwintaskbarprogresscoalescer_p.h"
+
+#include <QTimer>
+#include <limits>
 
 QT_BEGIN_NAMESPACE
 
@@ -63,6 +69,12 @@ QT_BEGIN_NAMESPACE
     and setMaximum(). The current number of steps is set with setValue(). The progress
     indicator can be rewound to the beginning with reset().
 
+    Steps are stored as 64-bit integers, so that for example the bytes of a large
+    file transfer can be used as steps directly. The value64(), minimum64() and
+    maximum64() properties give access to the full range, and the whole range is
+    passed on to the taskbar without losing precision. The \c int properties
+    report values outside the range of \c int clamped to it.
+
     If minimum and maximum both are set to \c 0, the indicator shows up as a busy
     (indeterminate) indicator instead of a percentage of steps. This is useful when
     it is not possible to determine the number of steps.
@@ -95,20 +107,71 @@ QT_BEGIN_NAMESPACE
 
 class QWinTaskbarProgressPrivate
 {
+    Q_DECLARE_PUBLIC(QWinTaskbarProgress)
+
 public:
     QWinTaskbarProgressPrivate();
 
-    int value;
-    int minimum;
-    int maximum;
+    void _q_sampleReporter();
+
+    QWinTaskbarProgress *q_ptr;
+    QWinTaskbarProgressReporter *reporter;
+    QTimer *sampler;
+    qint64 sampledValue;
+    qint64 value;
+    qint64 minimum;
+    qint64 maximum;
     bool visible;
     bool paused;
     bool stopped;
 };
 
 QWinTaskbarProgressPrivate::QWinTaskbarProgressPrivate() :
-    value(0), minimum(0), maximum(100), visible(false), paused(false), stopped(false)
+    q_ptr(0), reporter(0), sampler(0), sampledValue(0), value(0), minimum(0), maximum(100), visible(false), paused(false), stopped(false)
+{
+}
+
+static inline int clampedToInt(qint64 value)
+{
+    return int(qBound(qint64(std::numeric_limits<int>::min()), value, qint64(std::numeric_limits<int>::max())));
+}
+
+/*
+    Returns the state the taskbar shows for \a progress.
+ */
+QWinTaskbarProgressState qt_winProgressState(const QWinTaskbarProgress *progress)
+{
+    if (!progress || !progress->isVisible())
+        return QWinTaskbarProgressNone;
+    if (progress->isStopped())
+        return QWinTaskbarProgressError;
+    if (progress->isPaused())
+        return QWinTaskbarProgressPaused;
+    if (progress->minimum64() == 0 && progress->maximum64() == 0)
+        return QWinTaskbarProgressIndeterminate;
+    return QWinTaskbarProgressNormal;
+}
+
+/*
+    Called by the sampler, and by the reporter when it is updated after the
+    sampler has been stopped because the value did not change.
+ */
+void QWinTaskbarProgressPrivate::_q_sampleReporter()
 {
+    Q_Q(QWinTaskbarProgress);
+    if (!reporter)
+        return;
+    const qint64 sample = reporter->value();
+    if (sample == sampledValue) {
+        sampler->stop();
+        if (!QWinTaskbarProgressReporterPrivate::get(reporter)->sleep(sample))
+            sampler->start();
+        return;
+    }
+    sampledValue = sample;
+    if (!sampler->isActive())
+        sampler->start();
+    q->setValue64(qBound(minimum, sample, maximum));
 }
 
 /*!
@@ -117,6 +180,8 @@ QWinTaskbarProgressPrivate::QWinTaskbarProgressPrivate() :
 QWinTaskbarProgress::QWinTaskbarProgress(QObject *parent) :
     QObject(parent), d_ptr(new QWinTaskbarProgressPrivate)
 {
+    Q_D(QWinTaskbarProgress);
+    d->q_ptr = this;
 }
 
 /*!
@@ -124,6 +189,9 @@ QWinTaskbarProgress::QWinTaskbarProgress(QObject *parent) :
  */
 QWinTaskbarProgress::~QWinTaskbarProgress()
 {
+    Q_D(QWinTaskbarProgress);
+    if (d->reporter)
+        QWinTaskbarProgressReporterPrivate::get(d->reporter)->setProgress(0);
 }
 
 /*!
@@ -131,21 +199,46 @@ QWinTaskbarProgress::~QWinTaskbarProgress()
     \brief the current value of the progress indicator
 
     The default value is \c 0.
+
+    \sa value64
  */
 int QWinTaskbarProgress::value() const
 {
     Q_D(const QWinTaskbarProgress);
-    return d->value;
+    return clampedToInt(d->value);
 }
 
 void QWinTaskbarProgress::setValue(int value)
+{
+    setValue64(value);
+}
+
+/*!
+    \property QWinTaskbarProgress::value64
+    \brief the current value of the progress indicator as a 64-bit integer
+
+    The default value is \c 0.
+
+    \since 5.2
+    \sa value
+ */
+qint64 QWinTaskbarProgress::value64() const
+{
+    Q_D(const QWinTaskbarProgress);
+    return d->value;
+}
+
+void QWinTaskbarProgress::setValue64(qint64 value)
 {
     Q_D(QWinTaskbarProgress);
     if ((value == d->value) || value < d->minimum || value > d->maximum)
         return;
 
+    const int oldValue = clampedToInt(d->value);
     d->value = value;
-    emit valueChanged(d->value);
+    if (clampedToInt(d->value) != oldValue)
+        emit valueChanged(clampedToInt(d->value));
+    emit value64Changed(d->value);
 }
 
 /*!
@@ -153,17 +246,39 @@ void QWinTaskbarProgress::setValue(int value)
     \brief the minimum value of the progress indicator
 
     The default value is \c 0.
+
+    \sa minimum64
  */
 int QWinTaskbarProgress::minimum() const
 {
     Q_D(const QWinTaskbarProgress);
-    return d->minimum;
+    return clampedToInt(d->minimum);
 }
 
 void QWinTaskbarProgress::setMinimum(int minimum)
+{
+    setMinimum64(minimum);
+}
+
+/*!
+    \property QWinTaskbarProgress::minimum64
+    \brief the minimum value of the progress indicator as a 64-bit integer
+
+    The default value is \c 0.
+
+    \since 5.2
+    \sa minimum
+ */
+qint64 QWinTaskbarProgress::minimum64() const
+{
+    Q_D(const QWinTaskbarProgress);
+    return d->minimum;
+}
+
+void QWinTaskbarProgress::setMinimum64(qint64 minimum)
 {
     Q_D(QWinTaskbarProgress);
-    setRange(minimum, qMax(minimum, d->maximum));
+    setRange64(minimum, qMax(minimum, d->maximum));
 }
 
 /*!
@@ -171,17 +286,39 @@ void QWinTaskbarProgress::setMinimum(int minimum)
     \brief the maximum value of the progress indicator
 
     The default value is \c 100.
+
+    \sa maximum64
  */
 int QWinTaskbarProgress::maximum() const
 {
     Q_D(const QWinTaskbarProgress);
-    return d->maximum;
+    return clampedToInt(d->maximum);
 }
 
 void QWinTaskbarProgress::setMaximum(int maximum)
+{
+    setMaximum64(maximum);
+}
+
+/*!
+    \property QWinTaskbarProgress::maximum64
+    \brief the maximum value of the progress indicator as a 64-bit integer
+
+    The default value is \c 100.
+
+    \since 5.2
+    \sa maximum
+ */
+qint64 QWinTaskbarProgress::maximum64() const
+{
+    Q_D(const QWinTaskbarProgress);
+    return d->maximum;
+}
+
+void QWinTaskbarProgress::setMaximum64(qint64 maximum)
 {
     Q_D(QWinTaskbarProgress);
-    setRange(qMin(d->minimum, maximum), maximum);
+    setRange64(qMin(d->minimum, maximum), maximum);
 }
 
 /*!
@@ -226,21 +363,40 @@ void QWinTaskbarProgress::hide()
     Sets both the \a minimum and \a maximum values.
  */
 void QWinTaskbarProgress::setRange(int minimum, int maximum)
+{
+    setRange64(minimum, maximum);
+}
+
+/*!
+    Sets both the \a minimum and \a maximum values as 64-bit integers.
+
+    \since 5.2
+ */
+void QWinTaskbarProgress::setRange64(qint64 minimum, qint64 maximum)
 {
     Q_D(QWinTaskbarProgress);
+    maximum = qMax(minimum, maximum);
     const bool minChanged = minimum != d->minimum;
     const bool maxChanged = maximum != d->maximum;
     if (minChanged || maxChanged) {
+        const int oldMinimum = clampedToInt(d->minimum);
+        const int oldMaximum = clampedToInt(d->maximum);
         d->minimum = minimum;
-        d->maximum = qMax(minimum, maximum);
+        d->maximum = maximum;
 
         if (d->value < d->minimum || d->value > d->maximum)
             reset();
 
-        if (minChanged)
-            emit minimumChanged(d->minimum);
-        if (maxChanged)
-            emit maximumChanged(d->maximum);
+        if (minChanged) {
+            if (clampedToInt(d->minimum) != oldMinimum)
+                emit minimumChanged(clampedToInt(d->minimum));
+            emit minimum64Changed(d->minimum);
+        }
+        if (maxChanged) {
+            if (clampedToInt(d->maximum) != oldMaximum)
+                emit maximumChanged(clampedToInt(d->maximum));
+            emit maximum64Changed(d->maximum);
+        }
     }
 }
 
@@ -251,7 +407,63 @@ void QWinTaskbarProgress::setRange(int minimum, int maximum)
  */
 void QWinTaskbarProgress::reset()
 {
-    setValue(minimum());
+    setValue64(minimum64());
+}
+
+/*!
+    Returns the reporter the progress indicator takes its value from, or \c 0.
+
+    \since 5.2
+    \sa setReporter()
+ */
+QWinTaskbarProgressReporter *QWinTaskbarProgress::reporter() const
+{
+    Q_D(const QWinTaskbarProgress);
+    return d->reporter;
+}
+
+/*!
+    Makes the progress indicator take its value from \a reporter, which worker
+    threads can update without locking. The reporter is sampled every
+    \a interval milliseconds, and its latest value, bounded to the range of the
+    progress indicator, is set as the \l value64. Intervals below 1 millisecond
+    are raised to 1, so that sampling never keeps the event loop busy. Sampling
+    pauses while the value of the reporter does not change, and resumes with
+    its next update. Pass \c 0 as \a reporter to detach the current reporter.
+
+    The reporter is not owned by the progress indicator. A reporter is attached
+    to one progress indicator at a time, and is detached when either of them
+    is destroyed.
+
+    \since 5.2
+    \sa QWinTaskbarProgressReporter
+ */
+void QWinTaskbarProgress::setReporter(QWinTaskbarProgressReporter *reporter, int interval)
+{
+    Q_D(QWinTaskbarProgress);
+    if (d->reporter != reporter) {
+        if (d->reporter)
+            QWinTaskbarProgressReporterPrivate::get(d->reporter)->setProgress(0);
+        if (reporter) {
+            QWinTaskbarProgressReporterPrivate *reporterPrivate = QWinTaskbarProgressReporterPrivate::get(reporter);
+            if (reporterPrivate->progress)
+                reporterPrivate->progress->setReporter(0);
+            reporterPrivate->setProgress(this);
+        }
+        d->reporter = reporter;
+    }
+    if (!reporter) {
+        if (d->sampler)
+            d->sampler->stop();
+        return;
+    }
+    if (!d->sampler) {
+        d->sampler = new QTimer(this);
+        connect(d->sampler, SIGNAL(timeout()), this, SLOT(_q_sampleReporter()));
+    }
+    d->sampler->start(qMax(1, interval));
+    d->sampledValue = reporter->value();
+    setValue64(qBound(d->minimum, d->sampledValue, d->maximum));
 }
 
 /*!
@@ -343,3 +555,5 @@ void QWinTaskbarProgress::stop()
 }
 
 QT_END_NAMESPACE
+
+#include "moc_qwintaskbarprogress.cpp"
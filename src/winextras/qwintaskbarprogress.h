@@ -49,6 +49,7 @@
 QT_BEGIN_NAMESPACE
 
 class QWinTaskbarProgressPrivate;
+class QWinTaskbarProgressReporter;
 
 class Q_WINEXTRAS_EXPORT QWinTaskbarProgress : public QObject
 {
@@ -56,6 +57,9 @@ class Q_WINEXTRAS_EXPORT QWinTaskbarProgress : public QObject
     Q_PROPERTY(int value READ value WRITE setValue NOTIFY valueChanged)
     Q_PROPERTY(int minimum READ minimum WRITE setMinimum NOTIFY minimumChanged)
     Q_PROPERTY(int maximum READ maximum WRITE setMaximum NOTIFY maximumChanged)
+    Q_PROPERTY(qint64 value64 READ value64 WRITE setValue64 NOTIFY value64Changed)
+    Q_PROPERTY(qint64 minimum64 READ minimum64 WRITE setMinimum64 NOTIFY minimum64Changed)
+    Q_PROPERTY(qint64 maximum64 READ maximum64 WRITE setMaximum64 NOTIFY maximum64Changed)
     Q_PROPERTY(bool visible READ isVisible WRITE setVisible NOTIFY visibilityChanged)
     Q_PROPERTY(bool paused READ isPaused WRITE setPaused NOTIFY pausedChanged)
     Q_PROPERTY(bool stopped READ isStopped NOTIFY stoppedChanged)
@@ -67,15 +71,25 @@ public:
     int value() const;
     int minimum() const;
     int maximum() const;
+    qint64 value64() const;
+    qint64 minimum64() const;
+    qint64 maximum64() const;
     bool isVisible() const;
     bool isPaused() const;
     bool isStopped() const;
 
+    QWinTaskbarProgressReporter *reporter() const;
+    void setReporter(QWinTaskbarProgressReporter *reporter, int interval = 16);
+
 public Q_SLOTS:
     void setValue(int value);
     void setMinimum(int minimum);
     void setMaximum(int maximum);
     void setRange(int minimum, int maximum);
+    void setValue64(qint64 value);
+    void setMinimum64(qint64 minimum);
+    void setMaximum64(qint64 maximum);
+    void setRange64(qint64 minimum, qint64 maximum);
     void reset();
     void show();
     void hide();
@@ -89,6 +103,9 @@ Q_SIGNALS:
     void valueChanged(int value);
     void minimumChanged(int minimum);
     void maximumChanged(int maximum);
+    void value64Changed(qint64 value);
+    void minimum64Changed(qint64 minimum);
+    void maximum64Changed(qint64 maximum);
     void visibilityChanged(bool visible);
     void pausedChanged(bool paused);
     void stoppedChanged(bool stopped);
@@ -97,6 +114,8 @@ private:
     Q_DISABLE_COPY(QWinTaskbarProgress)
     Q_DECLARE_PRIVATE(QWinTaskbarProgress)
     QScopedPointer<QWinTaskbarProgressPrivate> d_ptr;
+
+    Q_PRIVATE_SLOT(d_func(), void _q_sampleReporter())
 };
 
 QT_END_NAMESPACE
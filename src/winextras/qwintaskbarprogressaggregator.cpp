@@ -0,0 +1,403 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwintaskbarprogressaggregator.h"
+#include "qwintaskbarprogress.h"
+#include "qwintaskbarprogresscoalescer_p.h"
+
+#include <QHash>
+#include <QPointer>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QWinTaskbarProgressAggregator
+    \inmodule QtWinExtras
+    \brief The QWinTaskbarProgressAggregator class combines the progress of
+    several jobs into one taskbar progress indicator.
+
+    \since 5.2
+
+    A taskbar button has a single progress indicator, while an application may
+    run many jobs at the same time. QWinTaskbarProgressAggregator lets each job
+    keep its own QWinTaskbarProgress and drives the \l target progress indicator,
+    typically QWinTaskbarButton::progress(), with the combined result:
+
+    \list
+    \li The value is the weighted mean of the completed fraction of every
+        visible job that shows a value. Each job counts with the weight passed
+        to addProgress().
+    \li The state is the most important state of the visible jobs: a stopped
+        job takes precedence over a paused one, which takes precedence over a
+        running one, which takes precedence over an indeterminate one.
+    \li The target is hidden when no job is visible.
+    \endlist
+
+    The target uses the range from \c 0 to resolution(). A change of one job
+    updates the combined result in constant time, regardless of the number of
+    jobs.
+
+    \code
+    QWinTaskbarProgressAggregator *aggregator = new QWinTaskbarProgressAggregator(this);
+    aggregator->setTarget(button->progress());
+    aggregator->addProgress(download->progress(), 3);
+    aggregator->addProgress(indexer->progress());
+    \endcode
+
+    \sa QWinTaskbarProgress
+ */
+
+static const int aggregateResolution = 10000;
+
+static inline bool showsValue(QWinTaskbarProgressState state)
+{
+    return state == QWinTaskbarProgressNormal || state == QWinTaskbarProgressError || state == QWinTaskbarProgressPaused;
+}
+
+struct QWinTaskbarProgressContribution
+{
+    QWinTaskbarProgressState state;
+    int weight;
+    qint64 units; // completed fraction in [0, aggregateResolution]
+};
+
+static inline bool operator==(const QWinTaskbarProgressContribution &lhs, const QWinTaskbarProgressContribution &rhs)
+{
+    return lhs.state == rhs.state && lhs.weight == rhs.weight && lhs.units == rhs.units;
+}
+
+class QWinTaskbarProgressAggregatorPrivate
+{
+    Q_DECLARE_PUBLIC(QWinTaskbarProgressAggregator)
+
+public:
+    QWinTaskbarProgressAggregatorPrivate();
+
+    static QWinTaskbarProgressContribution contribution(const QWinTaskbarProgress *progress, int weight);
+    void insert(const QWinTaskbarProgressContribution &contribution);
+    void remove(const QWinTaskbarProgressContribution &contribution);
+    void update(QObject *progress, const QWinTaskbarProgressContribution &contribution);
+
+    QWinTaskbarProgressState state() const;
+    qint64 value() const;
+    void updateTarget();
+
+    void _q_progressChanged();
+    void _q_progressDestroyed(QObject *object);
+
+    QWinTaskbarProgressAggregator *q_ptr;
+    QPointer<QWinTaskbarProgress> target;
+    QHash<QObject *, QWinTaskbarProgressContribution> contributions;
+
+    // running totals, updated per contribution
+    int stateCounts[QWinTaskbarProgressPaused + 1];
+    qint64 weightSum;
+    qint64 unitSum;
+
+    bool applied;
+    QWinTaskbarProgressState appliedState;
+    qint64 appliedValue;
+};
+
+QWinTaskbarProgressAggregatorPrivate::QWinTaskbarProgressAggregatorPrivate() :
+    q_ptr(0), weightSum(0), unitSum(0), applied(false), appliedState(QWinTaskbarProgressNone), appliedValue(0)
+{
+    for (int i = 0; i <= QWinTaskbarProgressPaused; ++i)
+        stateCounts[i] = 0;
+}
+
+QWinTaskbarProgressContribution QWinTaskbarProgressAggregatorPrivate::contribution(const QWinTaskbarProgress *progress, int weight)
+{
+    QWinTaskbarProgressContribution result;
+    result.state = qt_winProgressState(progress);
+    result.weight = weight;
+    result.units = 0;
+    if (showsValue(result.state)) {
+        quint64 completed;
+        quint64 total;
+        qt_winProgressSpan(progress->minimum64(), progress->maximum64(), progress->value64(), &completed, &total);
+        if (total)
+            result.units = qRound64(double(completed) / double(total) * aggregateResolution);
+    }
+    return result;
+}
+
+void QWinTaskbarProgressAggregatorPrivate::insert(const QWinTaskbarProgressContribution &contribution)
+{
+    ++stateCounts[contribution.state];
+    if (showsValue(contribution.state)) {
+        weightSum += contribution.weight;
+        unitSum += contribution.units * contribution.weight;
+    }
+}
+
+void QWinTaskbarProgressAggregatorPrivate::remove(const QWinTaskbarProgressContribution &contribution)
+{
+    --stateCounts[contribution.state];
+    if (showsValue(contribution.state)) {
+        weightSum -= contribution.weight;
+        unitSum -= contribution.units * contribution.weight;
+    }
+}
+
+void QWinTaskbarProgressAggregatorPrivate::update(QObject *progress, const QWinTaskbarProgressContribution &contribution)
+{
+    QHash<QObject *, QWinTaskbarProgressContribution>::iterator it = contributions.find(progress);
+    if (it == contributions.end() || it.value() == contribution)
+        return;
+    remove(it.value());
+    insert(contribution);
+    it.value() = contribution;
+    updateTarget();
+}
+
+QWinTaskbarProgressState QWinTaskbarProgressAggregatorPrivate::state() const
+{
+    if (stateCounts[QWinTaskbarProgressError])
+        return QWinTaskbarProgressError;
+    if (stateCounts[QWinTaskbarProgressPaused])
+        return QWinTaskbarProgressPaused;
+    if (stateCounts[QWinTaskbarProgressNormal])
+        return QWinTaskbarProgressNormal;
+    if (stateCounts[QWinTaskbarProgressIndeterminate])
+        return QWinTaskbarProgressIndeterminate;
+    return QWinTaskbarProgressNone;
+}
+
+qint64 QWinTaskbarProgressAggregatorPrivate::value() const
+{
+    if (weightSum <= 0)
+        return 0;
+    return (unitSum + weightSum / 2) / weightSum;
+}
+
+void QWinTaskbarProgressAggregatorPrivate::updateTarget()
+{
+    if (!target)
+        return;
+
+    const QWinTaskbarProgressState newState = state();
+    const qint64 newValue = value();
+    if (applied && newState == appliedState && newValue == appliedValue)
+        return;
+    applied = true;
+    appliedState = newState;
+    appliedValue = newValue;
+
+    if (newState == QWinTaskbarProgressNone) {
+        target->hide();
+        return;
+    }
+    if (newState == QWinTaskbarProgressIndeterminate) {
+        target->setRange(0, 0);
+    } else {
+        target->setRange(0, aggregateResolution);
+        target->setValue64(newValue);
+    }
+    if (newState == QWinTaskbarProgressError) {
+        target->stop();
+    } else {
+        if (target->isStopped())
+            target->resume();
+        target->setPaused(newState == QWinTaskbarProgressPaused);
+    }
+    target->show();
+}
+
+void QWinTaskbarProgressAggregatorPrivate::_q_progressChanged()
+{
+    Q_Q(QWinTaskbarProgressAggregator);
+    QObject *object = q->sender();
+    QHash<QObject *, QWinTaskbarProgressContribution>::const_iterator it = contributions.constFind(object);
+    if (it != contributions.constEnd())
+        update(object, contribution(static_cast<QWinTaskbarProgress *>(object), it.value().weight));
+}
+
+void QWinTaskbarProgressAggregatorPrivate::_q_progressDestroyed(QObject *object)
+{
+    QHash<QObject *, QWinTaskbarProgressContribution>::iterator it = contributions.find(object);
+    if (it == contributions.end())
+        return;
+    remove(it.value());
+    contributions.erase(it);
+    updateTarget();
+}
+
+/*!
+    Constructs a QWinTaskbarProgressAggregator with the parent object \a parent.
+ */
+QWinTaskbarProgressAggregator::QWinTaskbarProgressAggregator(QObject *parent) :
+    QObject(parent), d_ptr(new QWinTaskbarProgressAggregatorPrivate)
+{
+    Q_D(QWinTaskbarProgressAggregator);
+    d->q_ptr = this;
+}
+
+/*!
+    Destroys the QWinTaskbarProgressAggregator. The target progress indicator
+    keeps its last state.
+ */
+QWinTaskbarProgressAggregator::~QWinTaskbarProgressAggregator()
+{
+}
+
+/*!
+    \property QWinTaskbarProgressAggregator::target
+    \brief the progress indicator that shows the combined progress
+
+    The target is not owned by the aggregator. The default value is \c 0.
+ */
+QWinTaskbarProgress *QWinTaskbarProgressAggregator::target() const
+{
+    Q_D(const QWinTaskbarProgressAggregator);
+    return d->target;
+}
+
+void QWinTaskbarProgressAggregator::setTarget(QWinTaskbarProgress *target)
+{
+    Q_D(QWinTaskbarProgressAggregator);
+    if (target == d->target)
+        return;
+    d->target = target;
+    d->applied = false;
+    d->updateTarget();
+}
+
+/*!
+    Adds \a progress to the combined progress, counting with \a weight. A
+    negative weight counts as \c 0. Adding a progress indicator twice only
+    changes its weight.
+
+    The aggregator follows the changes of \a progress and forgets it when it is
+    destroyed.
+ */
+void QWinTaskbarProgressAggregator::addProgress(QWinTaskbarProgress *progress, int weight)
+{
+    Q_D(QWinTaskbarProgressAggregator);
+    if (!progress)
+        return;
+    if (d->contributions.contains(progress)) {
+        setWeight(progress, weight);
+        return;
+    }
+
+    connect(progress, SIGNAL(value64Changed(qint64)), this, SLOT(_q_progressChanged()));
+    connect(progress, SIGNAL(minimum64Changed(qint64)), this, SLOT(_q_progressChanged()));
+    connect(progress, SIGNAL(maximum64Changed(qint64)), this, SLOT(_q_progressChanged()));
+    connect(progress, SIGNAL(visibilityChanged(bool)), this, SLOT(_q_progressChanged()));
+    connect(progress, SIGNAL(pausedChanged(bool)), this, SLOT(_q_progressChanged()));
+    connect(progress, SIGNAL(stoppedChanged(bool)), this, SLOT(_q_progressChanged()));
+    connect(progress, SIGNAL(destroyed(QObject*)), this, SLOT(_q_progressDestroyed(QObject*)));
+
+    const QWinTaskbarProgressContribution contribution = d->contribution(progress, qMax(0, weight));
+    d->contributions.insert(progress, contribution);
+    d->insert(contribution);
+    d->updateTarget();
+}
+
+/*!
+    Removes \a progress from the combined progress.
+ */
+void QWinTaskbarProgressAggregator::removeProgress(QWinTaskbarProgress *progress)
+{
+    Q_D(QWinTaskbarProgressAggregator);
+    if (!d->contributions.contains(progress))
+        return;
+    disconnect(progress, 0, this, 0);
+    d->_q_progressDestroyed(progress);
+}
+
+/*!
+    Returns whether \a progress is part of the combined progress.
+ */
+bool QWinTaskbarProgressAggregator::contains(QWinTaskbarProgress *progress) const
+{
+    Q_D(const QWinTaskbarProgressAggregator);
+    return d->contributions.contains(progress);
+}
+
+/*!
+    Returns the number of progress indicators that are combined.
+ */
+int QWinTaskbarProgressAggregator::count() const
+{
+    Q_D(const QWinTaskbarProgressAggregator);
+    return d->contributions.size();
+}
+
+/*!
+    Returns the weight of \a progress, or \c 0 if it is not part of the
+    combined progress.
+ */
+int QWinTaskbarProgressAggregator::weight(QWinTaskbarProgress *progress) const
+{
+    Q_D(const QWinTaskbarProgressAggregator);
+    QHash<QObject *, QWinTaskbarProgressContribution>::const_iterator it = d->contributions.constFind(progress);
+    return it != d->contributions.constEnd() ? it.value().weight : 0;
+}
+
+/*!
+    Sets the weight of \a progress to \a weight.
+ */
+void QWinTaskbarProgressAggregator::setWeight(QWinTaskbarProgress *progress, int weight)
+{
+    Q_D(QWinTaskbarProgressAggregator);
+    QHash<QObject *, QWinTaskbarProgressContribution>::const_iterator it = d->contributions.constFind(progress);
+    if (it == d->contributions.constEnd())
+        return;
+    QWinTaskbarProgressContribution contribution = it.value();
+    contribution.weight = qMax(0, weight);
+    d->update(progress, contribution);
+}
+
+/*!
+    Returns the maximum of the range the target progress indicator is set to.
+    The value \c 0 is shown while no job has completed anything, and this value
+    when all jobs have completed.
+ */
+int QWinTaskbarProgressAggregator::resolution()
+{
+    return aggregateResolution;
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qwintaskbarprogressaggregator.cpp"
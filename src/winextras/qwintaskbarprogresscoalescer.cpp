@@ -0,0 +1,189 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwintaskbarprogresscoalescer_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Returns \a completed out of \a total as a percentage rounded to the
+    nearest integer, halves rounding up, and 0 for an empty \a total.
+    Exact for the whole 64 bit range.
+ */
+int qt_winProgressPercentage(quint64 completed, quint64 total)
+{
+    if (total == 0)
+        return 0;
+    if (completed >= total)
+        return 100;
+    // 100 * completed / total without overflowing 64 bits: long multiplication,
+    // one bit of 100 at a time, keeping the remainder below total.
+    int quotient = 0;
+    quint64 remainder = 0;
+    for (int bit = 6; bit >= 0; --bit) {
+        quotient *= 2;
+        if (remainder >= total - remainder) {
+            remainder -= total - remainder;
+            ++quotient;
+        } else {
+            remainder *= 2;
+        }
+        if (100 & (1 << bit)) {
+            if (remainder >= total - completed) {
+                remainder -= total - completed;
+                ++quotient;
+            } else {
+                remainder += completed;
+            }
+        }
+    }
+    if (remainder >= total - remainder)
+        ++quotient;
+    return quotient;
+}
+
+/*
+    Converts \a value in the range from \a minimum to \a maximum into the
+    \a completed and \a total counts passed to the taskbar. Both are
+    unsigned, so that the full span of a 64 bit range fits; an empty or
+    inverted range yields 0 of 0.
+ */
+void qt_winProgressSpan(qint64 minimum, qint64 maximum, qint64 value, quint64 *completed, quint64 *total)
+{
+    if (maximum <= minimum) {
+        *completed = 0;
+        *total = 0;
+        return;
+    }
+    value = qBound(minimum, value, maximum);
+    *completed = quint64(value) - quint64(minimum);
+    *total = quint64(maximum) - quint64(minimum);
+}
+
+static inline bool showsValue(QWinTaskbarProgressState state)
+{
+    return state == QWinTaskbarProgressNormal || state == QWinTaskbarProgressError || state == QWinTaskbarProgressPaused;
+}
+
+/*
+    Filters the progress updates of a taskbar button before they reach
+    \a sink: an update is dropped when it would not change the state or the
+    percentage shown on the taskbar, and changes of the value alone are
+    forwarded at most once per minimumInterval(). Times are in milliseconds
+    on a monotonic clock and passed in by the caller.
+ */
+QWinTaskbarProgressCoalescer::QWinTaskbarProgressCoalescer(QWinTaskbarProgressSink *sink) :
+    m_sink(sink), m_minimumInterval(0),
+    m_state(QWinTaskbarProgressNone), m_completed(0), m_total(0), m_percentage(0),
+    m_valid(false), m_forwardedState(QWinTaskbarProgressNone), m_forwardedPercentage(0), m_forwardedTime(0),
+    m_pending(false), m_submittedCount(0), m_forwardedCount(0)
+{
+}
+
+void QWinTaskbarProgressCoalescer::setMinimumInterval(int msecs)
+{
+    m_minimumInterval = qMax(0, msecs);
+}
+
+/*
+    Submits an update at time \a now. Returns -1 if it was forwarded or
+    dropped, or the number of milliseconds after which flush() should be
+    called to forward it.
+ */
+int QWinTaskbarProgressCoalescer::submit(QWinTaskbarProgressState state, quint64 completed, quint64 total, qint64 now)
+{
+    ++m_submittedCount;
+    m_state = state;
+    m_completed = completed;
+    m_total = total;
+    m_percentage = showsValue(state) ? qt_winProgressPercentage(completed, total) : 0;
+
+    if (m_valid && m_state == m_forwardedState && m_percentage == m_forwardedPercentage) {
+        m_pending = false;
+        return -1;
+    }
+    m_pending = true;
+    // State changes are forwarded immediately, they are rare and important.
+    if (!m_valid || m_state != m_forwardedState)
+        forward(now);
+    return flush(now);
+}
+
+/*
+    Forwards the pending update if it is due at time \a now. Returns -1 if
+    there is nothing left to forward, or the number of milliseconds after
+    which flush() should be called again.
+ */
+int QWinTaskbarProgressCoalescer::flush(qint64 now)
+{
+    if (!m_pending)
+        return -1;
+    const qint64 due = m_forwardedTime + m_minimumInterval;
+    if (now < due)
+        return int(due - now);
+    forward(now);
+    return -1;
+}
+
+/*
+    Forgets what the taskbar shows, for example after the taskbar button has
+    been recreated, so that the next update is forwarded in full.
+ */
+void QWinTaskbarProgressCoalescer::invalidate()
+{
+    m_valid = false;
+}
+
+void QWinTaskbarProgressCoalescer::forward(qint64 now)
+{
+    if (showsValue(m_state) && m_total > 0)
+        m_sink->setProgressValue(m_completed, m_total);
+    if (!m_valid || m_state != m_forwardedState)
+        m_sink->setProgressState(m_state);
+    m_valid = true;
+    m_forwardedState = m_state;
+    m_forwardedPercentage = m_percentage;
+    m_forwardedTime = now;
+    m_pending = false;
+    ++m_forwardedCount;
+}
+
+QT_END_NAMESPACE
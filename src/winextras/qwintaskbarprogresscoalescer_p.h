@@ -0,0 +1,117 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINTASKBARPROGRESSCOALESCER_P_H
+#define QWINTASKBARPROGRESSCOALESCER_P_H
+
+#include <QtCore/qglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+// Mirrors TBPFLAG.
+enum QWinTaskbarProgressState
+{
+    QWinTaskbarProgressNone,
+    QWinTaskbarProgressIndeterminate,
+    QWinTaskbarProgressNormal,
+    QWinTaskbarProgressError,
+    QWinTaskbarProgressPaused
+};
+
+class QWinTaskbarProgress;
+
+// Defined in qwintaskbarprogress.cpp.
+QWinTaskbarProgressState qt_winProgressState(const QWinTaskbarProgress *progress);
+
+// Receives the progress updates that reach the taskbar, ITaskbarList3 on Windows.
+class QWinTaskbarProgressSink
+{
+public:
+    virtual ~QWinTaskbarProgressSink() {}
+    virtual void setProgressValue(quint64 completed, quint64 total) = 0;
+    virtual void setProgressState(QWinTaskbarProgressState state) = 0;
+};
+
+int qt_winProgressPercentage(quint64 completed, quint64 total);
+void qt_winProgressSpan(qint64 minimum, qint64 maximum, qint64 value, quint64 *completed, quint64 *total);
+
+class QWinTaskbarProgressCoalescer
+{
+public:
+    explicit QWinTaskbarProgressCoalescer(QWinTaskbarProgressSink *sink);
+
+    void setMinimumInterval(int msecs);
+    int minimumInterval() const { return m_minimumInterval; }
+
+    int submit(QWinTaskbarProgressState state, quint64 completed, quint64 total, qint64 now);
+    int flush(qint64 now);
+    void invalidate();
+
+    bool hasPendingUpdate() const { return m_pending; }
+    quint64 submittedCount() const { return m_submittedCount; }
+    quint64 forwardedCount() const { return m_forwardedCount; }
+
+private:
+    void forward(qint64 now);
+
+    QWinTaskbarProgressSink *m_sink;
+    int m_minimumInterval;
+
+    // the latest submitted update
+    QWinTaskbarProgressState m_state;
+    quint64 m_completed;
+    quint64 m_total;
+    int m_percentage;
+
+    // what the taskbar shows
+    bool m_valid;
+    QWinTaskbarProgressState m_forwardedState;
+    int m_forwardedPercentage;
+    qint64 m_forwardedTime;
+
+    bool m_pending;
+    quint64 m_submittedCount;
+    quint64 m_forwardedCount;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINTASKBARPROGRESSCOALESCER_P_H
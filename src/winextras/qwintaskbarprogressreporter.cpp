@@ -0,0 +1,184 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwintaskbarprogressreporter.h"
+#include "qwintaskbarprogressreporter_p.h"
+#include "qwintaskbarprogress.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QWinTaskbarProgressReporter
+    \inmodule QtWinExtras
+    \brief The QWinTaskbarProgressReporter class lets worker threads report
+    progress to a QWinTaskbarProgress without locking.
+
+    \since 5.2
+
+    QWinTaskbarProgress must be used from the GUI thread. A worker thread that
+    reports the progress of each chunk of work through queued signals floods the
+    GUI event loop with events, most of which only get overwritten by the next
+    one. QWinTaskbarProgressReporter holds a single 64-bit value instead, which
+    any number of threads can update concurrently with setValue() or add(),
+    using atomic operations only.
+
+    The GUI thread samples the value on a timer once the reporter has been
+    attached with QWinTaskbarProgress::setReporter(), and only the latest value
+    reaches the taskbar. The timer stops while the value does not change, for
+    example once the work is finished, and the next update starts it again.
+
+    \code
+    QWinTaskbarProgressReporter *reporter = new QWinTaskbarProgressReporter;
+    progress->setRange64(0, totalBytes);
+    progress->setReporter(reporter);
+
+    // in any number of worker threads
+    reporter->add(chunk.size());
+    \endcode
+
+    \sa QWinTaskbarProgress
+ */
+
+QWinTaskbarProgressReporterPrivate::QWinTaskbarProgressReporterPrivate() :
+    progress(0)
+{
+    value.store(0);
+}
+
+/*
+    Called by the GUI thread when the reporter is attached to or detached from
+    \a progress.
+ */
+void QWinTaskbarProgressReporterPrivate::setProgress(QWinTaskbarProgress *progress)
+{
+    QMutexLocker locker(&mutex);
+    this->progress = progress;
+    sleeping.fetchAndStoreOrdered(0);
+}
+
+/*
+    Called by the GUI thread when the value is still \a sample and the progress
+    stops sampling. Returns false if the value has changed meanwhile without
+    waking the progress, in which case it has to keep sampling.
+ */
+bool QWinTaskbarProgressReporterPrivate::sleep(qint64 sample)
+{
+    sleeping.fetchAndStoreOrdered(1);
+    return value.loadAcquire() == sample || !sleeping.testAndSetOrdered(1, 0);
+}
+
+/*
+    Called by the updating thread after the value is stored. Only the first
+    update after the progress stopped sampling takes the lock.
+ */
+void QWinTaskbarProgressReporterPrivate::wake()
+{
+    if (sleeping.load() && sleeping.testAndSetOrdered(1, 0)) {
+        QMutexLocker locker(&mutex);
+        if (progress)
+            QMetaObject::invokeMethod(progress, "_q_sampleReporter", Qt::QueuedConnection);
+    }
+}
+
+/*!
+    Constructs a QWinTaskbarProgressReporter with the value \c 0.
+ */
+QWinTaskbarProgressReporter::QWinTaskbarProgressReporter() :
+    d_ptr(new QWinTaskbarProgressReporterPrivate)
+{
+}
+
+/*!
+    Destroys the QWinTaskbarProgressReporter and detaches it from the
+    QWinTaskbarProgress it is attached to. No thread may use it anymore, and
+    an attached reporter must be destroyed in the GUI thread.
+ */
+QWinTaskbarProgressReporter::~QWinTaskbarProgressReporter()
+{
+    Q_D(QWinTaskbarProgressReporter);
+    if (d->progress)
+        d->progress->setReporter(0);
+}
+
+/*!
+    Returns the latest reported value. This function is thread-safe.
+ */
+qint64 QWinTaskbarProgressReporter::value() const
+{
+    Q_D(const QWinTaskbarProgressReporter);
+    return d->value.loadAcquire();
+}
+
+/*!
+    Reports \a value as the current value. This function is thread-safe and
+    lock-free, except for the first update after the value has been idle,
+    which wakes up the sampling.
+ */
+void QWinTaskbarProgressReporter::setValue(qint64 value)
+{
+    Q_D(QWinTaskbarProgressReporter);
+    // ordered, so that wake() does not miss a progress going to sleep
+    d->value.fetchAndStoreOrdered(value);
+    d->wake();
+}
+
+/*!
+    Adds \a delta to the current value and returns the new value. This is the
+    function to use when several threads each contribute a part of the work.
+    This function is thread-safe and lock-free like setValue().
+ */
+qint64 QWinTaskbarProgressReporter::add(qint64 delta)
+{
+    Q_D(QWinTaskbarProgressReporter);
+    const qint64 value = d->value.fetchAndAddOrdered(delta) + delta;
+    d->wake();
+    return value;
+}
+
+/*!
+    Reports \c 0 as the current value. This function is thread-safe.
+ */
+void QWinTaskbarProgressReporter::reset()
+{
+    setValue(0);
+}
+
+QT_END_NAMESPACE
@@ -49,15 +49,64 @@
 #include <QCoreApplication>
 #include <QTimer>
 #include <QDebug>
+#include <QAbstractNativeEventFilter>
 
 #include "qwinevent.h"
 #include "qwinfunctions.h"
 #include "qwineventfilter_p.h"
+#include "qwinshelltrace_p.h"
+#include "qwinshellexecutor_p.h"
+#include "qwinfunctions_p.h"
 
 QT_BEGIN_NAMESPACE
 
 static const int windowsLimitedThumbbarSize = 7;
 
+Q_STATIC_ASSERT(QWinThumbnailToolBarCommandMessage == WM_COMMAND);
+Q_STATIC_ASSERT(QWinThumbnailToolBarClickedNotification == THBN_CLICKED);
+Q_STATIC_ASSERT(QWinThumbnailToolBarState::SlotCount == windowsLimitedThumbbarSize);
+Q_STATIC_ASSERT(QWinThumbnailButtonDisabled == THBF_DISABLED);
+Q_STATIC_ASSERT(QWinThumbnailButtonDismissOnClick == THBF_DISMISSONCLICK);
+Q_STATIC_ASSERT(QWinThumbnailButtonNoBackground == THBF_NOBACKGROUND);
+Q_STATIC_ASSERT(QWinThumbnailButtonHidden == THBF_HIDDEN);
+Q_STATIC_ASSERT(QWinThumbnailButtonNonInteractive == THBF_NONINTERACTIVE);
+Q_STATIC_ASSERT(QWinThumbnailButtonIconField == THB_ICON);
+Q_STATIC_ASSERT(QWinThumbnailButtonToolTipField == THB_TOOLTIP);
+Q_STATIC_ASSERT(QWinThumbnailButtonFlagsField == THB_FLAGS);
+
+// Room for two icons per button, as in a play/pause toggle.
+static const int iconCacheCapacity = 2 * windowsLimitedThumbbarSize;
+
+Q_GLOBAL_STATIC(QWinThumbnailToolBarRouter, thumbnailToolBarRouter)
+
+// One filter for the clicks of all toolbars, installed with the first toolbar.
+class QWinThumbnailToolBarFilter : public QAbstractNativeEventFilter
+{
+public:
+    bool nativeEventFilter(const QByteArray &, void *message, long *result) Q_DECL_OVERRIDE
+    {
+        const MSG *msg = static_cast<const MSG *>(message);
+        if (!thumbnailToolBarRouter()->route(quintptr(msg->hwnd), msg->message, msg->wParam))
+            return false;
+        if (result)
+            *result = 0;
+        return true;
+    }
+
+    static void setup()
+    {
+        if (!instance) {
+            instance = new QWinThumbnailToolBarFilter;
+            QCoreApplication::instance()->installNativeEventFilter(instance);
+        }
+    }
+
+private:
+    static QWinThumbnailToolBarFilter *instance;
+};
+
+QWinThumbnailToolBarFilter *QWinThumbnailToolBarFilter::instance = 0;
+
 /*!
     \class QWinThumbnailToolBar
     \inmodule QtWinExtras
@@ -212,89 +261,156 @@ void QWinThumbnailToolBar::clear()
     setButtons(QList<QWinThumbnailToolButton *>());
 }
 
-static inline ITaskbarList4 *createTaskbarList()
-{
-    ITaskbarList4 *result = 0;
-    HRESULT hresult = CoCreateInstance(CLSID_TaskbarList, 0, CLSCTX_INPROC_SERVER, IID_ITaskbarList4, reinterpret_cast<void **>(&result));
-    if (FAILED(hresult)) {
-        const QString err = QtWin::errorStringFromHresult(hresult);
-        qWarning("QWinThumbnailToolBar: IID_ITaskbarList4 was not created: %#010x, %s.",
-                 (unsigned)hresult, qPrintable(err));
-        return 0;
-    }
-    hresult = result->HrInit();
-    if (FAILED(hresult)) {
-        result->Release();
-        const QString err = QtWin::errorStringFromHresult(hresult);
-        qWarning("QWinThumbnailToolBar: IID_ITaskbarList4 was not initialized: %#010x, %s.",
-                 (unsigned)hresult, qPrintable(err));
-        return 0;
-    }
-    return result;
-}
-
 QWinThumbnailToolBarPrivate::QWinThumbnailToolBarPrivate() :
-    QObject(0), updateScheduled(false), window(0), pTbList(createTaskbarList()), q_ptr(0)
+    QObject(0), updateScheduled(false), window(0), backend(qt_winShellBackend()), registeredHandle(0),
+    iconCache(iconCacheCapacity, qt_winDestroyIconOnShellThread), q_ptr(0)
 {
     buttonList.reserve(windowsLimitedThumbbarSize);
-    QCoreApplication::instance()->installNativeEventFilter(this);
+    QWinThumbnailToolBarFilter::setup();
 }
 
 QWinThumbnailToolBarPrivate::~QWinThumbnailToolBarPrivate()
 {
-    if (pTbList)
-        pTbList->Release();
-    QCoreApplication::instance()->removeNativeEventFilter(this);
+    if (QWinShellTraceWriter *trace = qt_winShellTraceWriter())
+        trace->writeDestroyed(this);
+    qt_winShellExecutor()->cancel(this);
+    unregisterHandle();
+}
+
+void QWinThumbnailToolBarPrivate::registerHandle()
+{
+    const quintptr handle = quintptr(window->winId());
+    if (handle == registeredHandle)
+        return;
+    unregisterHandle();
+    thumbnailToolBarRouter()->insert(handle, this);
+    registeredHandle = handle;
 }
 
+void QWinThumbnailToolBarPrivate::unregisterHandle()
+{
+    if (!registeredHandle)
+        return;
+    if (!thumbnailToolBarRouter.isDestroyed())
+        thumbnailToolBarRouter()->remove(registeredHandle, this);
+    registeredHandle = 0;
+}
+
+// Sends buttons to the shell on the shell thread. The state of the toolbar
+// is recorded as sent when the job is posted; if the shell fails, the next
+// update sends everything again.
+class QWinThumbnailButtonsJob : public QWinShellJob
+{
+public:
+    QWinThumbnailButtonsJob(QWinThumbnailToolBarPrivate *toolbar, bool add, quintptr window,
+                            const QWinThumbnailButton *buttons, int count) :
+        m_toolbar(toolbar), m_backend(toolbar->backend), m_add(add), m_window(window), m_hresult(S_OK)
+    {
+        for (int i = 0; i < count; ++i)
+            m_buttons.append(buttons[i]);
+    }
+
+    void run() Q_DECL_OVERRIDE
+    {
+        if (m_add)
+            m_hresult = m_backend->addThumbnailButtons(m_window, m_buttons.constData(), m_buttons.size());
+        else
+            m_hresult = m_backend->updateThumbnailButtons(m_window, m_buttons.constData(), m_buttons.size());
+    }
+
+    void finish() Q_DECL_OVERRIDE
+    {
+        if (SUCCEEDED(m_hresult))
+            return;
+        qWarning() << QWinThumbnailToolBarPrivate::msgComFailed(m_add ? "ThumbBarAddButtons" : "ThumbBarUpdateButtons", m_hresult);
+        m_toolbar->sentState.invalidate();
+    }
+
+private:
+    QWinThumbnailToolBarPrivate *m_toolbar;
+    QWinShellBackend *m_backend;
+    const bool m_add;
+    const quintptr m_window;
+    QVector<QWinThumbnailButton> m_buttons;
+    HRESULT m_hresult;
+};
+
 void QWinThumbnailToolBarPrivate::initToolbar()
 {
-    if (!pTbList || !window)
+    if (!window)
         return;
-    THUMBBUTTON buttons[windowsLimitedThumbbarSize];
-    initButtons(buttons);
-    HRESULT hresult = pTbList->ThumbBarAddButtons(reinterpret_cast<HWND>(window->winId()), windowsLimitedThumbbarSize, buttons);
-    if (FAILED(hresult))
-        qWarning() << msgComFailed("ThumbBarAddButtons", hresult);
+    if (QWinShellTraceWriter *trace = qt_winShellTraceWriter())
+        trace->writeToolbarAdded(this);
+    registerHandle();
+    QWinThumbnailButton buttons[windowsLimitedThumbbarSize];
+    QWinThumbnailToolBarState::resetButtons(buttons);
+    sentState.reset();
+    qt_winShellExecutor()->post(new QWinThumbnailButtonsJob(this, true, quintptr(window->winId()), buttons, windowsLimitedThumbbarSize), this);
 }
 
 void QWinThumbnailToolBarPrivate::clearToolbar()
 {
-    if (!pTbList || !window)
+    unregisterHandle();
+    if (!window)
         return;
-    THUMBBUTTON buttons[windowsLimitedThumbbarSize];
-    initButtons(buttons);
-    HRESULT hresult = pTbList->ThumbBarUpdateButtons(reinterpret_cast<HWND>(window->winId()), windowsLimitedThumbbarSize, buttons);
-    if (FAILED(hresult))
-        qWarning() << msgComFailed("ThumbBarUpdateButtons", hresult);
+    if (QWinShellTraceWriter *trace = qt_winShellTraceWriter())
+        trace->writeToolbarCleared(this);
+    QWinThumbnailButton buttons[windowsLimitedThumbbarSize];
+    QWinThumbnailToolBarState::resetButtons(buttons);
+    sentState.reset();
+    qt_winShellExecutor()->post(new QWinThumbnailButtonsJob(this, false, quintptr(window->winId()), buttons, windowsLimitedThumbbarSize), this);
 }
 
 void QWinThumbnailToolBarPrivate::_q_updateToolbar()
 {
     updateScheduled = false;
-    if (!pTbList || !window)
+    if (!window)
         return;
-    THUMBBUTTON buttons[windowsLimitedThumbbarSize];
-    initButtons(buttons);
+    QWinThumbnailButtonState wanted[windowsLimitedThumbbarSize];
+    QWinThumbnailToolButton *slotButtons[windowsLimitedThumbbarSize] = { 0 };
     const int thumbbarSize = qMin(buttonList.size(), windowsLimitedThumbbarSize);
     // filling from the right fixes some strange bug which makes last button bg look like first btn bg
     for (int i = (windowsLimitedThumbbarSize - thumbbarSize); i < windowsLimitedThumbbarSize; i++) {
         QWinThumbnailToolButton *button = buttonList.at(i - (windowsLimitedThumbbarSize - thumbbarSize));
-        buttons[i].dwFlags = makeNativeButtonFlags(button);
-        buttons[i].dwMask  = makeButtonMask(button);
-        if (!button->icon().isNull()) {;
-            buttons[i].hIcon = QtWin::toHICON(button->icon().pixmap(GetSystemMetrics(SM_CXSMICON)));
-            if (!buttons[i].hIcon)
-                buttons[i].hIcon = (HICON)LoadImage(0, IDI_APPLICATION, IMAGE_ICON, SM_CXSMICON, SM_CYSMICON, LR_SHARED);
-        }
-        if (!button->toolTip().isEmpty()) {
-            buttons[i].szTip[button->toolTip().left(sizeof(buttons[i].szTip)/sizeof(buttons[i].szTip[0]) - 1).toWCharArray(buttons[i].szTip)] = 0;
-        }
+        slotButtons[i] = button;
+        wanted[i].flags = makeNativeButtonFlags(button);
+        wanted[i].iconKey = button->icon().isNull() ? 0 : button->icon().cacheKey();
+        wanted[i].toolTip = button->toolTip();
+    }
+    if (QWinShellTraceWriter *trace = qt_winShellTraceWriter())
+        trace->writeThumbnailButtons(this, wanted);
+
+    // only the changed fields of the changed buttons are sent
+    QWinThumbnailButton buttons[windowsLimitedThumbbarSize];
+    const int changeCount = sentState.buttons(wanted, buttons);
+    if (!changeCount)
+        return;
+
+    const int iconSize = GetSystemMetrics(SM_CXSMICON);
+    for (int i = 0; i < changeCount; i++) {
+        if (buttons[i].mask & QWinThumbnailButtonIconField)
+            buttons[i].icon = reinterpret_cast<quintptr>(iconHandle(slotButtons[buttons[i].id]->icon(), iconSize));
+    }
+    sentState.commit(wanted);
+    qt_winShellExecutor()->post(new QWinThumbnailButtonsJob(this, false, quintptr(window->winId()), buttons, changeCount), this);
+}
+
+/*
+    Returns the native icon for \a icon, converting it once and keeping it
+    in a cache owned by the toolbar.
+ */
+HICON QWinThumbnailToolBarPrivate::iconHandle(const QIcon &icon, int size)
+{
+    if (icon.isNull())
+        return 0;
+    HICON hicon = reinterpret_cast<HICON>(iconCache.find(icon.cacheKey(), size));
+    if (!hicon) {
+        hicon = QtWin::toHICON(icon.pixmap(size));
+        if (!hicon)
+            return (HICON)LoadImage(0, IDI_APPLICATION, IMAGE_ICON, SM_CXSMICON, SM_CYSMICON, LR_SHARED);
+        iconCache.insert(icon.cacheKey(), size, reinterpret_cast<quintptr>(hicon));
     }
-    HRESULT hresult = pTbList->ThumbBarUpdateButtons(reinterpret_cast<HWND>(window->winId()), windowsLimitedThumbbarSize, buttons);
-    if (FAILED(hresult))
-        qWarning() << msgComFailed("ThumbBarUpdateButtons", hresult);
-    freeButtonResources(buttons);
+    return hicon;
 }
 
 void QWinThumbnailToolBarPrivate::_q_scheduleUpdate()
@@ -315,28 +431,12 @@ bool QWinThumbnailToolBarPrivate::eventFilter(QObject *object, QEvent *event)
     return QObject::eventFilter(object, event);
 }
 
-bool QWinThumbnailToolBarPrivate::nativeEventFilter(const QByteArray &, void *message, long *result)
+void QWinThumbnailToolBarPrivate::thumbnailButtonClicked(int buttonId)
 {
-    MSG *msg = static_cast<MSG *>(message);
-    if (window && msg->message == WM_COMMAND && HIWORD(msg->wParam) == THBN_CLICKED && msg->hwnd == reinterpret_cast<HWND>(window->winId())) {
-        int buttonId = LOWORD(msg->wParam);
-        buttonId = buttonId - (windowsLimitedThumbbarSize - qMin(windowsLimitedThumbbarSize, buttonList.size()));
-        buttonList.at(buttonId)->click();
-        if (result)
-            *result = 0;
-        return true;
-    }
-    return false;
-}
-
-void QWinThumbnailToolBarPrivate::initButtons(THUMBBUTTON *buttons)
-{
-    for (int i = 0; i < windowsLimitedThumbbarSize; i++) {
-        memset(&buttons[i], 0, sizeof buttons[i]);
-        buttons[i].iId = i;
-        buttons[i].dwFlags = THBF_HIDDEN;
-        buttons[i].dwMask  = THB_FLAGS;
-    }
+    // the buttons are filled from the right
+    const int index = buttonId - (windowsLimitedThumbbarSize - qMin(windowsLimitedThumbbarSize, buttonList.size()));
+    if (index >= 0 && index < buttonList.size())
+        buttonList.at(index)->click();
 }
 
 THUMBBUTTONFLAGS QWinThumbnailToolBarPrivate::makeNativeButtonFlags(const QWinThumbnailToolButton *button)
@@ -357,25 +457,6 @@ THUMBBUTTONFLAGS QWinThumbnailToolBarPrivate::makeNativeButtonFlags(const QWinTh
     return nativeFlags;
 }
 
-THUMBBUTTONMASK QWinThumbnailToolBarPrivate::makeButtonMask(const QWinThumbnailToolButton *button)
-{
-    THUMBBUTTONMASK mask = (THUMBBUTTONMASK)0;
-    mask |= THB_FLAGS;
-    if (!button->icon().isNull())
-        mask |= THB_ICON;
-    if (!button->toolTip().isEmpty())
-        mask |= THB_TOOLTIP;
-    return mask;
-}
-
-void QWinThumbnailToolBarPrivate::freeButtonResources(THUMBBUTTON *buttons)
-{
-    for (int i = 0; i < windowsLimitedThumbbarSize; i++) {
-        if (buttons[i].hIcon)
-            DeleteObject(buttons[i].hIcon);
-    }
-}
-
 QString QWinThumbnailToolBarPrivate::msgComFailed(const char *function, HRESULT hresult)
 {
     return QString::fromLatin1("QWinThumbnailToolBar: %1() failed: #%2: %3")
@@ -47,13 +47,16 @@
 #include <QtCore/QHash>
 #include <QtCore/QList>
 #include <QtGui/QIcon>
-#include <QtCore/QAbstractNativeEventFilter>
 
 #include "winshobjidl_p.h"
+#include "qwinthumbnailtoolbarrouter_p.h"
+#include "qwinthumbnailtoolbarstate_p.h"
+#include "qwiniconhandlecache_p.h"
+#include "qwinshellbackend_p.h"
 
 QT_BEGIN_NAMESPACE
 
-class QWinThumbnailToolBarPrivate : public QObject, QAbstractNativeEventFilter
+class QWinThumbnailToolBarPrivate : public QObject, QWinThumbnailToolBarReceiver
 {
 public:
     QWinThumbnailToolBarPrivate();
@@ -64,18 +67,21 @@ public:
     void _q_scheduleUpdate();
     bool eventFilter(QObject *, QEvent *) Q_DECL_OVERRIDE;
 
-    virtual bool nativeEventFilter(const QByteArray &eventType, void *message, long *result) Q_DECL_OVERRIDE;
+    void thumbnailButtonClicked(int buttonId) Q_DECL_OVERRIDE;
+    void registerHandle();
+    void unregisterHandle();
 
-    static void initButtons(THUMBBUTTON *buttons);
     static THUMBBUTTONFLAGS makeNativeButtonFlags(const QWinThumbnailToolButton *button);
-    static THUMBBUTTONMASK makeButtonMask(const QWinThumbnailToolButton *button);
-    static void freeButtonResources(THUMBBUTTON *buttons);
+    HICON iconHandle(const QIcon &icon, int size);
     static QString msgComFailed(const char *function, HRESULT hresult);
 
     bool updateScheduled;
     QList<QWinThumbnailToolButton *> buttonList;
     QWindow *window;
-    ITaskbarList4 * const pTbList;
+    QWinShellBackend * const backend;
+    quintptr registeredHandle;
+    QWinThumbnailToolBarState sentState;
+    QWinIconHandleCache iconCache;
 
 private:
     QWinThumbnailToolBar *q_ptr;
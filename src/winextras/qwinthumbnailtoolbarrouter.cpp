@@ -0,0 +1,83 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinthumbnailtoolbarrouter_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Routes the clicks on the thumbnail toolbar of the window \a handle to
+    \a receiver, replacing any previous receiver for that window.
+ */
+void QWinThumbnailToolBarRouter::insert(quintptr handle, QWinThumbnailToolBarReceiver *receiver)
+{
+    m_receivers.insert(handle, receiver);
+}
+
+/*
+    Stops routing the clicks for \a handle, unless they have been taken over
+    by another receiver than \a receiver meanwhile.
+ */
+void QWinThumbnailToolBarRouter::remove(quintptr handle, QWinThumbnailToolBarReceiver *receiver)
+{
+    QHash<quintptr, QWinThumbnailToolBarReceiver *>::iterator it = m_receivers.find(handle);
+    if (it != m_receivers.end() && it.value() == receiver)
+        m_receivers.erase(it);
+}
+
+/*
+    Returns true if the message was a click on a thumbnail toolbar button and
+    has been delivered to its receiver.
+ */
+bool QWinThumbnailToolBarRouter::route(quintptr handle, quint32 message, quintptr wParam) const
+{
+    if (message != QWinThumbnailToolBarCommandMessage
+        || ((wParam >> 16) & 0xffff) != QWinThumbnailToolBarClickedNotification) {
+        return false;
+    }
+    QWinThumbnailToolBarReceiver *receiver = m_receivers.value(handle);
+    if (!receiver)
+        return false;
+    receiver->thumbnailButtonClicked(int(wParam & 0xffff));
+    return true;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,82 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINTHUMBNAILTOOLBARROUTER_P_H
+#define QWINTHUMBNAILTOOLBARROUTER_P_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/QHash>
+
+QT_BEGIN_NAMESPACE
+
+// Mirror WM_COMMAND and THBN_CLICKED.
+enum {
+    QWinThumbnailToolBarCommandMessage = 0x0111,
+    QWinThumbnailToolBarClickedNotification = 0x1800
+};
+
+class QWinThumbnailToolBarReceiver
+{
+public:
+    virtual ~QWinThumbnailToolBarReceiver() {}
+    virtual void thumbnailButtonClicked(int buttonId) = 0;
+};
+
+// Routes the button clicks of all thumbnail toolbars, which arrive as
+// WM_COMMAND messages to their windows, through one lookup by window handle.
+class QWinThumbnailToolBarRouter
+{
+public:
+    void insert(quintptr handle, QWinThumbnailToolBarReceiver *receiver);
+    void remove(quintptr handle, QWinThumbnailToolBarReceiver *receiver);
+
+    QWinThumbnailToolBarReceiver *receiver(quintptr handle) const { return m_receivers.value(handle); }
+    int count() const { return m_receivers.size(); }
+
+    bool route(quintptr handle, quint32 message, quintptr wParam) const;
+
+private:
+    QHash<quintptr, QWinThumbnailToolBarReceiver *> m_receivers;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINTHUMBNAILTOOLBARROUTER_P_H
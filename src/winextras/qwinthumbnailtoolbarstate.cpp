@@ -0,0 +1,171 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinthumbnailtoolbarstate_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Returns the fields that need to be sent to turn \a sent into \a wanted.
+    The icon and the tooltip of a hidden button are not sent before it is
+    shown.
+ */
+quint32 qt_winThumbnailButtonChanges(const QWinThumbnailButtonState &sent, const QWinThumbnailButtonState &wanted)
+{
+    quint32 fields = 0;
+    if (sent.flags != wanted.flags)
+        fields |= QWinThumbnailButtonFlagsField;
+    if (wanted.flags & QWinThumbnailButtonHidden)
+        return fields;
+    if (sent.iconKey != wanted.iconKey)
+        fields |= QWinThumbnailButtonIconField;
+    if (sent.toolTip != wanted.toolTip)
+        fields |= QWinThumbnailButtonToolTipField;
+    return fields;
+}
+
+QWinThumbnailToolBarState::QWinThumbnailToolBarState()
+{
+    for (int i = 0; i < SlotCount; ++i)
+        m_unknown[i] = 0;
+}
+
+/*
+    Writes SlotCount hidden buttons without icon or tooltip to \a buttons.
+ */
+void QWinThumbnailToolBarState::resetButtons(QWinThumbnailButton *buttons)
+{
+    for (int i = 0; i < SlotCount; ++i) {
+        buttons[i] = QWinThumbnailButton();
+        buttons[i].id = i;
+        buttons[i].mask = QWinThumbnailButtonFlagsField;
+        buttons[i].flags = QWinThumbnailButtonHidden;
+    }
+}
+
+/*
+    Forgets what has been sent, after all slots have been reset to hidden
+    buttons without icon or tooltip.
+ */
+void QWinThumbnailToolBarState::reset()
+{
+    for (int i = 0; i < SlotCount; ++i) {
+        m_sent[i] = QWinThumbnailButtonState();
+        m_unknown[i] = 0;
+    }
+}
+
+/*
+    Forgets what the shell shows after an update failed, so that every
+    field is sent again. As usual, the icon and the tooltip of a hidden
+    button wait until it is shown.
+ */
+void QWinThumbnailToolBarState::invalidate()
+{
+    for (int i = 0; i < SlotCount; ++i)
+        m_unknown[i] = QWinThumbnailButtonFlagsField | QWinThumbnailButtonIconField | QWinThumbnailButtonToolTipField;
+}
+
+quint32 QWinThumbnailToolBarState::changedFields(int slot, const QWinThumbnailButtonState &wanted) const
+{
+    quint32 unknown = m_unknown[slot];
+    if (wanted.flags & QWinThumbnailButtonHidden)
+        unknown &= QWinThumbnailButtonFlagsField;
+    return qt_winThumbnailButtonChanges(m_sent[slot], wanted) | unknown;
+}
+
+/*
+    Writes the slots that differ between what has been sent and the SlotCount
+    states in \a wanted to \a changes, and returns their number.
+ */
+int QWinThumbnailToolBarState::changes(const QWinThumbnailButtonState *wanted, Change *changes) const
+{
+    int count = 0;
+    for (int i = 0; i < SlotCount; ++i) {
+        const quint32 fields = changedFields(i, wanted[i]);
+        if (fields) {
+            changes[count].slot = i;
+            changes[count].fields = fields;
+            ++count;
+        }
+    }
+    return count;
+}
+
+/*
+    Writes the buttons to send to turn what has been sent into \a wanted to
+    \a buttons, and returns their number. The icons are left to the caller,
+    for the buttons whose mask has QWinThumbnailButtonIconField set.
+ */
+int QWinThumbnailToolBarState::buttons(const QWinThumbnailButtonState *wanted, QWinThumbnailButton *buttons) const
+{
+    Change changed[SlotCount];
+    const int count = changes(wanted, changed);
+    for (int i = 0; i < count; ++i) {
+        const QWinThumbnailButtonState &state = wanted[changed[i].slot];
+        buttons[i] = QWinThumbnailButton();
+        buttons[i].id = changed[i].slot;
+        buttons[i].mask = changed[i].fields;
+        buttons[i].flags = state.flags;
+        if (changed[i].fields & QWinThumbnailButtonToolTipField)
+            buttons[i].toolTip = state.toolTip;
+    }
+    return count;
+}
+
+/*
+    Records that the changes to \a wanted have been sent.
+ */
+void QWinThumbnailToolBarState::commit(const QWinThumbnailButtonState *wanted)
+{
+    for (int i = 0; i < SlotCount; ++i) {
+        const quint32 fields = changedFields(i, wanted[i]);
+        m_unknown[i] &= ~fields;
+        if (fields & QWinThumbnailButtonFlagsField)
+            m_sent[i].flags = wanted[i].flags;
+        if (fields & QWinThumbnailButtonIconField)
+            m_sent[i].iconKey = wanted[i].iconKey;
+        if (fields & QWinThumbnailButtonToolTipField)
+            m_sent[i].toolTip = wanted[i].toolTip;
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,129 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINTHUMBNAILTOOLBARSTATE_P_H
+#define QWINTHUMBNAILTOOLBARSTATE_P_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/QString>
+
+QT_BEGIN_NAMESPACE
+
+// Mirror THUMBBUTTONFLAGS.
+enum QWinThumbnailButtonFlag
+{
+    QWinThumbnailButtonEnabled = 0x0,
+    QWinThumbnailButtonDisabled = 0x1,
+    QWinThumbnailButtonDismissOnClick = 0x2,
+    QWinThumbnailButtonNoBackground = 0x4,
+    QWinThumbnailButtonHidden = 0x8,
+    QWinThumbnailButtonNonInteractive = 0x10
+};
+
+// Mirror THUMBBUTTONMASK.
+enum QWinThumbnailButtonField
+{
+    QWinThumbnailButtonIconField = 0x2,
+    QWinThumbnailButtonToolTipField = 0x4,
+    QWinThumbnailButtonFlagsField = 0x8
+};
+
+// What a slot of the thumbnail toolbar shows. Icons are identified by their
+// QIcon::cacheKey(), 0 for none.
+struct QWinThumbnailButtonState
+{
+    QWinThumbnailButtonState() : flags(QWinThumbnailButtonHidden), iconKey(0) {}
+
+    quint32 flags;
+    qint64 iconKey;
+    QString toolTip;
+};
+
+// Mirrors THUMBBUTTON. The fields that are not in mask are ignored.
+struct QWinThumbnailButton
+{
+    QWinThumbnailButton() : id(0), mask(0), flags(0), icon(0) {}
+
+    int id;
+    quint32 mask;   // QWinThumbnailButtonField
+    quint32 flags;  // QWinThumbnailButtonFlag
+    quintptr icon;  // HICON
+    QString toolTip;
+};
+
+quint32 qt_winThumbnailButtonChanges(const QWinThumbnailButtonState &sent, const QWinThumbnailButtonState &wanted);
+
+// Remembers what has been sent for each of the slots of a thumbnail toolbar,
+// so that an update only sends the fields of the slots that changed.
+class QWinThumbnailToolBarState
+{
+public:
+    enum { SlotCount = 7 };
+
+    struct Change
+    {
+        int slot;
+        quint32 fields;
+    };
+
+    QWinThumbnailToolBarState();
+
+    static void resetButtons(QWinThumbnailButton *buttons);
+
+    void reset();
+    void invalidate();
+    int changes(const QWinThumbnailButtonState *wanted, Change *changes) const;
+    int buttons(const QWinThumbnailButtonState *wanted, QWinThumbnailButton *buttons) const;
+    void commit(const QWinThumbnailButtonState *wanted);
+
+    const QWinThumbnailButtonState &sent(int slot) const { return m_sent[slot]; }
+
+private:
+    quint32 changedFields(int slot, const QWinThumbnailButtonState &wanted) const;
+
+    QWinThumbnailButtonState m_sent[SlotCount];
+    // the fields the shell may not show as sent, QWinThumbnailButtonField
+    quint32 m_unknown[SlotCount];
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINTHUMBNAILTOOLBARSTATE_P_H
@@ -0,0 +1,105 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinwindowindex_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Creates an index that calls \a scan to insert all current windows when it
+    meets an unknown handle.
+ */
+QWinWindowIndex::QWinWindowIndex(ScanFunction scan) :
+    m_scan(scan), m_scanCount(0)
+{
+}
+
+/*
+    Returns the window owning \a handle, or 0 if there is none.
+ */
+QObject *QWinWindowIndex::find(quintptr handle)
+{
+    QHash<quintptr, QPointer<QObject> >::iterator it = m_windows.find(handle);
+    if (it != m_windows.end()) {
+        if (QObject *window = it.value())
+            return window;
+        m_windows.erase(it);
+    }
+    if (m_foreign.contains(handle))
+        return 0;
+
+    ++m_scanCount;
+    m_windows.clear();
+    m_scan(this);
+
+    it = m_windows.find(handle);
+    if (it != m_windows.end())
+        return it.value();
+    m_foreign.insert(handle);
+    return 0;
+}
+
+void QWinWindowIndex::insert(quintptr handle, QObject *window)
+{
+    m_windows.insert(handle, window);
+    m_foreign.remove(handle);
+}
+
+/*
+    Called when the native window \a handle is created or shown. It may belong
+    to a window that was not there during the last scan.
+ */
+void QWinWindowIndex::handleCreated(quintptr handle)
+{
+    m_foreign.remove(handle);
+}
+
+/*
+    Called when the native window \a handle is destroyed. The handle value may
+    be reused by the next native window.
+ */
+void QWinWindowIndex::handleDestroyed(quintptr handle)
+{
+    m_windows.remove(handle);
+    m_foreign.remove(handle);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,84 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINWINDOWINDEX_P_H
+#define QWINWINDOWINDEX_P_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/QHash>
+#include <QtCore/QPointer>
+#include <QtCore/QSet>
+
+QT_BEGIN_NAMESPACE
+
+// Maps native window handles to the windows owning them. The index is filled
+// by scanning the top level windows when a handle is not known yet, and kept
+// up to date by the creation and destruction messages of native windows.
+// Handles that turn out not to belong to any window are remembered, so that
+// they do not trigger a scan every time.
+class QWinWindowIndex
+{
+public:
+    typedef void (*ScanFunction)(QWinWindowIndex *index);
+
+    explicit QWinWindowIndex(ScanFunction scan);
+
+    QObject *find(quintptr handle);
+    void insert(quintptr handle, QObject *window);
+
+    void handleCreated(quintptr handle);
+    void handleDestroyed(quintptr handle);
+
+    int count() const { return m_windows.size(); }
+    int scanCount() const { return m_scanCount; }
+
+private:
+    Q_DISABLE_COPY(QWinWindowIndex)
+
+    ScanFunction m_scan;
+    QHash<quintptr, QPointer<QObject> > m_windows;
+    QSet<quintptr> m_foreign;
+    int m_scanCount;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINWINDOWINDEX_P_H
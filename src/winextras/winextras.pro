@@ -1,4 +1,5 @@
 TARGET = QtWinExtras
+QT += core-private
 
 load(qt_module)
 
@@ -14,7 +15,31 @@ SOURCES += \
     qwineventfilter.cpp \
     qwinthumbnailtoolbar.cpp \
     qwinthumbnailtoolbutton.cpp \
-    qwinevent.cpp
+    qwinevent.cpp \
+    qwinpixelconversion.cpp \
+    qwinregiondata.cpp \
+    qwinhresult.cpp \
+    qwiniconstore.cpp \
+    qwinjumplistsnapshot.cpp \
+    qwincommandline.cpp \
+    qwintaskbarprogresscoalescer.cpp \
+    qwintaskbarprogressreporter.cpp \
+    qwintaskbarprogressaggregator.cpp \
+    qwiniconhandlecache.cpp \
+    qwinwindowindex.cpp \
+    qwinthumbnailtoolbarrouter.cpp \
+    qwinthumbnailtoolbarstate.cpp \
+    qwindwmstate.cpp \
+    qwindwmattributebatch.cpp \
+    qwinjumplistcommitter.cpp \
+    qwinnativeshellbackend.cpp \
+    qwinshellbackend.cpp \
+    qwinshellmetrics.cpp \
+    qwininstrumentedshellbackend.cpp \
+    qwinshelltrace.cpp \
+    qwinshelltracereplayer.cpp \
+    qwinjumplistdocumentloader.cpp \
+    qwinshellexecutor.cpp
 
 HEADERS += \
     qwinfunctions.h \
@@ -23,6 +48,9 @@ HEADERS += \
     qwintaskbarbutton_p.h \
     qwintaskbarbutton.h \
     qwintaskbarprogress.h \
+    qwintaskbarprogressreporter.h \
+    qwintaskbarprogressreporter_p.h \
+    qwintaskbarprogressaggregator.h \
     qwinjumplist.h \
     qwinjumplist_p.h \
     qwinjumplistcategory.h \
@@ -36,7 +64,32 @@ HEADERS += \
     qwinthumbnailtoolbar_p.h \
     qwinthumbnailtoolbutton.h \
     qwinthumbnailtoolbutton_p.h \
-    qwinevent.h
+    qwinevent.h \
+    qwinpixelconversion_p.h \
+    qwinregiondata_p.h \
+    qwinhresult_p.h \
+    qwiniconstore_p.h \
+    qwinjumplistsnapshot_p.h \
+    qwincommandline_p.h \
+    qwintaskbarprogresscoalescer_p.h \
+    qwiniconhandlecache_p.h \
+    qwinwindowindex_p.h \
+    qwinthumbnailtoolbarrouter_p.h \
+    qwinthumbnailtoolbarstate_p.h \
+    qwindwmstate_p.h \
+    qwindwmattributebatch_p.h \
+    qwinshellbackend_p.h \
+    qwinjumplistcommitter_p.h \
+    qwinnativeshellbackend_p.h \
+    qwinshellmetrics_p.h \
+    qwininstrumentedshellbackend_p.h \
+    qwinshelltrace_p.h \
+    qwinshelltracereplayer_p.h \
+    qwinjumplistdocumentloader_p.h \
+    qwinshellexecutor_p.h
+
+AVX2_SOURCES += qwinpixelconversion_avx2.cpp
+load(simd)
 
 QMAKE_DOCS = $$PWD/doc/qtwinextras.qdocconf
 
@@ -1,5 +1,32 @@
 TEMPLATE = subdirs
+
+# platform independent parts, built from the sources
 SUBDIRS += \
+    qwinpixelconversion \
+    qwinregiondata \
+    qwinhresult \
+    qwiniconstore \
+    qwinjumplistsnapshot \
+    qwincommandline \
+    qwintaskbarprogresscoalescer \
+    qwintaskbarprogressrange \
+    qwintaskbarprogressreporter \
+    qwintaskbarprogressaggregator \
+    qwiniconhandlecache \
+    qwinwindowindex \
+    qwinthumbnailtoolbarrouter \
+    qwinthumbnailtoolbarstate \
+    qwindwmstate \
+    qwindwmattributebatch \
+    qquickiconcache \
+    qwinrecordingshellbackend \
+    qwinjumplistcommitter \
+    qwinshellmetrics \
+    qwinshelltrace \
+    qwinjumplistdocumentloader \
+    qwinshellexecutor
+
+win32: SUBDIRS += \
     headersclean \
     cmake \
     qwinthumbnailtoolbar \
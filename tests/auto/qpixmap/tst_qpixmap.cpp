@@ -60,6 +60,10 @@ private slots:
     void toHBITMAP();
     void fromHBITMAP_data();
     void fromHBITMAP();
+    void toHBITMAPFormat_data();
+    void toHBITMAPFormat();
+    void fromHBITMAPFormat_data();
+    void fromHBITMAPFormat();
 
     void toHICON_data();
     void toHICON();
@@ -161,6 +165,110 @@ void tst_QPixmap::fromHBITMAP()
     ReleaseDC(0, displayDc);
 }
 
+// Pixels whose channels are 0 or 255 survive premultiplying and
+// unpremultiplying unchanged, so the bits can be compared exactly.
+static const uint straightPixels[] = { 0xff102030, 0x00000000, 0x33ff00ff, 0x80ff0000 };
+static const int pixelCount = sizeof(straightPixels) / sizeof(straightPixels[0]);
+
+static QVector<uint> pixelVector(const uint *pixels)
+{
+    QVector<uint> result(pixelCount);
+    for (int i = 0; i < pixelCount; ++i)
+        result[i] = pixels[i];
+    return result;
+}
+
+void tst_QPixmap::toHBITMAPFormat_data()
+{
+    QTest::addColumn<int>("format");
+    QTest::addColumn<QVector<uint> >("expected");
+
+    // What QtGui 5.2 did: straight ARGB for all but HBitmapPremultipliedAlpha,
+    // alpha is not dropped for HBitmapNoAlpha.
+    static const uint premultipliedPixels[] = { 0xff102030, 0x00000000, 0x33330033, 0x80800000 };
+    QTest::newRow("NoAlpha") << int(QtWin::HBitmapNoAlpha) << pixelVector(straightPixels);
+    QTest::newRow("PremultipliedAlpha") << int(QtWin::HBitmapPremultipliedAlpha) << pixelVector(premultipliedPixels);
+    QTest::newRow("Alpha") << int(QtWin::HBitmapAlpha) << pixelVector(straightPixels);
+}
+
+void tst_QPixmap::toHBITMAPFormat()
+{
+    QFETCH(int, format);
+    QFETCH(QVector<uint>, expected);
+
+    QImage image(pixelCount, 1, QImage::Format_ARGB32);
+    for (int i = 0; i < pixelCount; ++i)
+        image.setPixel(i, 0, straightPixels[i]);
+    const HBITMAP bitmap = QtWin::toHBITMAP(QPixmap::fromImage(image), QtWin::HBitmapFormat(format));
+    QVERIFY(bitmap != 0);
+
+    BITMAPINFO bmi;
+    memset(&bmi, 0, sizeof(bmi));
+    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bmi.bmiHeader.biWidth = pixelCount;
+    bmi.bmiHeader.biHeight = -1;
+    bmi.bmiHeader.biPlanes = 1;
+    bmi.bmiHeader.biBitCount = 32;
+    bmi.bmiHeader.biCompression = BI_RGB;
+    QVector<uint> actual(pixelCount);
+    const HDC displayDc = GetDC(0);
+    const int lines = GetDIBits(displayDc, bitmap, 0, 1, actual.data(), &bmi, DIB_RGB_COLORS);
+    ReleaseDC(0, displayDc);
+    DeleteObject(bitmap);
+
+    QCOMPARE(lines, 1);
+    QCOMPARE(actual, expected);
+}
+
+void tst_QPixmap::fromHBITMAPFormat_data()
+{
+    QTest::addColumn<int>("format");
+    QTest::addColumn<int>("imageFormat");
+    QTest::addColumn<QVector<uint> >("expected");
+
+    // What QtGui 5.2 did: the pixels are taken as premultiplied for all but
+    // HBitmapNoAlpha, and colored pixels without alpha are made opaque.
+    static const uint opaquePixels[] = { 0xff102030, 0xff000000, 0xff330033, 0xff102030 };
+    static const uint premultipliedPixels[] = { 0xff102030, 0x00000000, 0x33330033, 0xff102030 };
+    QTest::newRow("NoAlpha") << int(QtWin::HBitmapNoAlpha)
+        << int(QImage::Format_RGB32) << pixelVector(opaquePixels);
+    QTest::newRow("PremultipliedAlpha") << int(QtWin::HBitmapPremultipliedAlpha)
+        << int(QImage::Format_ARGB32_Premultiplied) << pixelVector(premultipliedPixels);
+    QTest::newRow("Alpha") << int(QtWin::HBitmapAlpha)
+        << int(QImage::Format_ARGB32_Premultiplied) << pixelVector(premultipliedPixels);
+}
+
+void tst_QPixmap::fromHBITMAPFormat()
+{
+    QFETCH(int, format);
+    QFETCH(int, imageFormat);
+    QFETCH(QVector<uint>, expected);
+
+    static const uint dibPixels[] = { 0xff102030, 0x00000000, 0x33330033, 0x00102030 };
+    BITMAPINFO bmi;
+    memset(&bmi, 0, sizeof(bmi));
+    bmi.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    bmi.bmiHeader.biWidth = pixelCount;
+    bmi.bmiHeader.biHeight = -1;
+    bmi.bmiHeader.biPlanes = 1;
+    bmi.bmiHeader.biBitCount = 32;
+    bmi.bmiHeader.biCompression = BI_RGB;
+    uint *bits = 0;
+    const HDC displayDc = GetDC(0);
+    const HBITMAP bitmap = CreateDIBSection(displayDc, &bmi, DIB_RGB_COLORS, reinterpret_cast<void **>(&bits), 0, 0);
+    ReleaseDC(0, displayDc);
+    QVERIFY(bitmap && bits);
+    memcpy(bits, dibPixels, sizeof(dibPixels));
+
+    const QImage image = QtWin::fromHBITMAP(bitmap, QtWin::HBitmapFormat(format)).toImage();
+    DeleteObject(bitmap);
+
+    QCOMPARE(int(image.format()), imageFormat);
+    QCOMPARE(image.size(), QSize(pixelCount, 1));
+    const uint *scanLine = reinterpret_cast<const uint *>(image.constScanLine(0));
+    QCOMPARE(pixelVector(scanLine), expected);
+}
+
 static bool compareImages(const QImage &actual, const QImage &expected,
                           QByteArray *errorMessage)
 {
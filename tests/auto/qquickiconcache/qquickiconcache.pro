@@ -0,0 +1,14 @@
+CONFIG += testcase
+TARGET = tst_qquickiconcache
+QT = core gui network qml quick testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qquickiconcache.cpp \
+    $$WINEXTRAS_IMPORTS_SOURCE_DIR/qquickiconcache.cpp
+
+HEADERS += \
+    $$WINEXTRAS_IMPORTS_SOURCE_DIR/qquickiconcache_p.h
+
+RESOURCES += qquickiconcache.qrc
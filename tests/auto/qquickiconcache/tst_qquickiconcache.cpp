@@ -0,0 +1,518 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtQml/QQmlEngine>
+#include <QtQml/QQmlNetworkAccessManagerFactory>
+#include <QtNetwork/QNetworkAccessManager>
+#include <QtNetwork/QNetworkRequest>
+#include <QtNetwork/QNetworkReply>
+
+#include "qquickiconcache_p.h"
+
+// A reply from a server that never answers.
+class StalledReply : public QNetworkReply
+{
+public:
+    StalledReply(const QUrl &url, QObject *parent) : QNetworkReply(parent)
+    {
+        setUrl(url);
+        open(QIODevice::ReadOnly);
+    }
+
+    void abort()
+    {
+        setError(OperationCanceledError, QStringLiteral("Operation canceled"));
+        setFinished(true);
+        emit finished();
+    }
+
+protected:
+    qint64 readData(char *, qint64) { return -1; }
+};
+
+// A reply with the contents of a file, which finishes when the test says so.
+class HeldReply : public QNetworkReply
+{
+public:
+    HeldReply(const QUrl &url, const QString &fileName, QObject *parent) : QNetworkReply(parent), m_offset(0)
+    {
+        setUrl(url);
+        QFile file(fileName);
+        if (file.open(QIODevice::ReadOnly))
+            m_data = file.readAll();
+        open(QIODevice::ReadOnly);
+    }
+
+    void release()
+    {
+        setFinished(true);
+        emit finished();
+    }
+
+    void abort() {}
+
+protected:
+    qint64 readData(char *data, qint64 maxSize)
+    {
+        const qint64 size = qMin(maxSize, qint64(m_data.size() - m_offset));
+        memcpy(data, m_data.constData() + m_offset, size);
+        m_offset += size;
+        return size;
+    }
+
+private:
+    QByteArray m_data;
+    int m_offset;
+};
+
+// Serves http://icons.test/<name> from the test data, without any network.
+// Requests for /stall never finish, and the ones for /held/<name> when the
+// test releases them. Once stalling is set, no request finishes.
+class LocalNetworkAccessManager : public QNetworkAccessManager
+{
+public:
+    LocalNetworkAccessManager(const QString &dataDirectory, QObject *parent) :
+        QNetworkAccessManager(parent), m_dataDirectory(dataDirectory), m_requestCount(0), m_stalling(false) {}
+
+    int requestCount() const { return m_requestCount; }
+    HeldReply *heldReply() const { return m_heldReply; }
+    void setStalling(bool stalling) { m_stalling = stalling; }
+
+protected:
+    QNetworkReply *createRequest(Operation op, const QNetworkRequest &request, QIODevice *outgoingData)
+    {
+        ++m_requestCount;
+        const QString path = request.url().path();
+        if (m_stalling || path == QLatin1String("/stall"))
+            return new StalledReply(request.url(), this);
+        if (path.startsWith(QLatin1String("/held/"))) {
+            m_heldReply = new HeldReply(request.url(), m_dataDirectory + path.mid(5), this);
+            return m_heldReply;
+        }
+        const QUrl url = QUrl::fromLocalFile(m_dataDirectory + request.url().path());
+        return QNetworkAccessManager::createRequest(op, QNetworkRequest(url), outgoingData);
+    }
+
+private:
+    const QString m_dataDirectory;
+    int m_requestCount;
+    bool m_stalling;
+    QPointer<HeldReply> m_heldReply;
+};
+
+class LocalNetworkAccessManagerFactory : public QQmlNetworkAccessManagerFactory
+{
+public:
+    explicit LocalNetworkAccessManagerFactory(const QString &dataDirectory) :
+        m_dataDirectory(dataDirectory), m_manager(0) {}
+
+    QNetworkAccessManager *create(QObject *parent)
+    {
+        m_manager = new LocalNetworkAccessManager(m_dataDirectory, parent);
+        return m_manager;
+    }
+
+    LocalNetworkAccessManager *manager() const { return m_manager; }
+
+private:
+    const QString m_dataDirectory;
+    LocalNetworkAccessManager *m_manager;
+};
+
+// Stands in for a QQuickIconLoader.
+class Receiver : public QQuickIconReceiver
+{
+public:
+    void iconLoaded(const QIcon &icon) { icons.append(icon); }
+
+    QList<QIcon> icons;
+};
+
+// Files are decoded on a thread pool, so their loads finish asynchronously.
+static bool waitForLoad(const QQuickIconCache &cache, const QUrl &url, const QSize &size)
+{
+    for (int i = 0; i < 500 && cache.isLoading(url, size); ++i)
+        QTest::qWait(10);
+    return !cache.isLoading(url, size);
+}
+
+class tst_QQuickIconCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_QQuickIconCache() : m_dataDirectory(QFINDTESTDATA("data")) {}
+
+private slots:
+    void initTestCase();
+    void load_data();
+    void load();
+    void requestedSize();
+    void missingFile();
+    void mergedNetworkLoads();
+    void cancelWhileDelivering();
+    void cancelNetworkLoad();
+    void cancelQueuedLoad();
+    void cancelDecoding();
+    void staleDecoding();
+    void concurrencyLimit();
+    void networkTimeout();
+    void evictedByCost();
+    void clear();
+
+private:
+    static QUrl networkUrl(const QString &name) { return QUrl(QStringLiteral("http://icons.test/") + name); }
+    QUrl fileUrl(const QString &name) const { return QUrl::fromLocalFile(m_dataDirectory + QLatin1Char('/') + name); }
+
+    const QString m_dataDirectory;
+};
+
+void tst_QQuickIconCache::initTestCase()
+{
+    QVERIFY(!m_dataDirectory.isEmpty());
+}
+
+void tst_QQuickIconCache::load_data()
+{
+    QTest::addColumn<QUrl>("url");
+    QTest::newRow("file") << fileUrl(QStringLiteral("icon.png"));
+    QTest::newRow("qrc") << QUrl(QStringLiteral("qrc:/data/icon.png"));
+}
+
+void tst_QQuickIconCache::load()
+{
+    QFETCH(QUrl, url);
+    QQuickIconCache cache;
+    Receiver receiver;
+
+    QVERIFY(cache.find(url, QSize()).isNull());
+    cache.load(url, QSize(), 0, &receiver);
+    QCOMPARE(receiver.icons.size(), 0);
+    QVERIFY(waitForLoad(cache, url, QSize()));
+    QCOMPARE(receiver.icons.size(), 1);
+    const QIcon icon = receiver.icons.at(0);
+    QVERIFY(!icon.isNull());
+
+    // every later user of the same source shares the loaded icon
+    for (int i = 0; i < 9; ++i)
+        QCOMPARE(cache.find(url, QSize()).cacheKey(), icon.cacheKey());
+    QCOMPARE(cache.count(), 1);
+    QCOMPARE(cache.totalCost(), 64 * 64 * 4);
+    QCOMPARE(cache.loadCount(), 1);
+    QCOMPARE(cache.hitCount(), 9);
+    QCOMPARE(cache.missCount(), 1);
+    QCOMPARE(cache.hitRate(), qreal(0.9));
+}
+
+void tst_QQuickIconCache::requestedSize()
+{
+    QQuickIconCache cache;
+    const QUrl url = fileUrl(QStringLiteral("wide.png"));
+    cache.load(url, QSize(), 0, 0);
+    cache.load(url, QSize(16, 16), 0, 0);
+    QVERIFY(waitForLoad(cache, url, QSize()));
+    QVERIFY(waitForLoad(cache, url, QSize(16, 16)));
+    QCOMPARE(cache.count(), 2);
+
+    QCOMPARE(cache.find(url, QSize()).availableSizes(), QList<QSize>() << QSize(64, 32));
+    QCOMPARE(cache.find(url, QSize(16, 16)).availableSizes(), QList<QSize>() << QSize(16, 8));
+    QCOMPARE(cache.totalCost(), 64 * 32 * 4 + 16 * 8 * 4);
+}
+
+void tst_QQuickIconCache::missingFile()
+{
+    QQuickIconCache cache;
+    Receiver receiver;
+    const QUrl url = fileUrl(QStringLiteral("missing.png"));
+
+    cache.load(url, QSize(), 0, &receiver);
+    QVERIFY(waitForLoad(cache, url, QSize()));
+    QCOMPARE(receiver.icons.size(), 1);
+    QVERIFY(receiver.icons.at(0).isNull());
+    QCOMPARE(cache.count(), 0);
+
+    // failures are tried again
+    cache.load(url, QSize(), 0, &receiver);
+    QCOMPARE(cache.loadCount(), 2);
+}
+
+void tst_QQuickIconCache::mergedNetworkLoads()
+{
+    LocalNetworkAccessManagerFactory factory(m_dataDirectory);
+    QQmlEngine engine;
+    engine.setNetworkAccessManagerFactory(&factory);
+    engine.networkAccessManager();
+
+    QQuickIconCache cache;
+    const QUrl url(QStringLiteral("http://icons.test/icon.png"));
+    const QUrl stalled = networkUrl(QStringLiteral("stall"));
+
+    // dozens of delegates asking for the same source, and one waiting for another
+    Receiver receivers[24];
+    for (int i = 0; i < 24; ++i) {
+        if (cache.find(url, QSize()).isNull())
+            cache.load(url, QSize(), &engine, &receivers[i]);
+    }
+    Receiver other;
+    cache.load(stalled, QSize(), &engine, &other);
+    QVERIFY(cache.isLoading(url, QSize()));
+    QCOMPARE(cache.loadCount(), 2);
+    QCOMPARE(cache.mergedCount(), 23);
+
+    // only the receivers of the load are called, each of them once
+    QTRY_VERIFY(!cache.isLoading(url, QSize()));
+    for (int i = 0; i < 24; ++i) {
+        QCOMPARE(receivers[i].icons.size(), 1);
+        QVERIFY(!receivers[i].icons.at(0).isNull());
+    }
+    QVERIFY(other.icons.isEmpty());
+    cache.cancel(stalled, QSize(), &other);
+    QCOMPARE(factory.manager()->requestCount(), 2);
+    QVERIFY(!cache.find(url, QSize()).isNull());
+}
+
+// A receiver going away while the receivers of its load are called.
+class CancellingReceiver : public Receiver
+{
+public:
+    CancellingReceiver(QQuickIconCache *cache, const QUrl &url, Receiver *other) :
+        m_cache(cache), m_url(url), m_other(other) {}
+
+    void iconLoaded(const QIcon &icon)
+    {
+        Receiver::iconLoaded(icon);
+        m_cache->cancel(m_url, QSize(), m_other);
+    }
+
+private:
+    QQuickIconCache *m_cache;
+    const QUrl m_url;
+    Receiver *m_other;
+};
+
+void tst_QQuickIconCache::cancelWhileDelivering()
+{
+    QQuickIconCache cache;
+    const QUrl url = fileUrl(QStringLiteral("icon.png"));
+    Receiver cancelled;
+    CancellingReceiver first(&cache, url, &cancelled);
+    Receiver last;
+    cache.load(url, QSize(), 0, &first);
+    cache.load(url, QSize(), 0, &cancelled);
+    cache.load(url, QSize(), 0, &last);
+
+    QVERIFY(waitForLoad(cache, url, QSize()));
+    QCOMPARE(first.icons.size(), 1);
+    QVERIFY(cancelled.icons.isEmpty());
+    QCOMPARE(last.icons.size(), 1);
+    QCOMPARE(cache.cancelledCount(), 0);
+}
+
+void tst_QQuickIconCache::cancelNetworkLoad()
+{
+    LocalNetworkAccessManagerFactory factory(m_dataDirectory);
+    QQmlEngine engine;
+    engine.setNetworkAccessManagerFactory(&factory);
+
+    QQuickIconCache cache;
+    Receiver receiver;
+    const QUrl url = networkUrl(QStringLiteral("stall"));
+    cache.load(url, QSize(), &engine, &receiver);
+    cache.load(url, QSize(), &engine, &receiver);
+    QCOMPARE(cache.activeReplyCount(), 1);
+
+    // the source of one of two delegates changes
+    cache.cancel(url, QSize(), &receiver);
+    QVERIFY(cache.isLoading(url, QSize()));
+    QCOMPARE(cache.activeReplyCount(), 1);
+
+    cache.cancel(url, QSize(), &receiver);
+    QVERIFY(!cache.isLoading(url, QSize()));
+    QCOMPARE(cache.activeReplyCount(), 0);
+    QCOMPARE(cache.cancelledCount(), 1);
+    QTest::qWait(10);
+    QCOMPARE(receiver.icons.size(), 0);
+}
+
+void tst_QQuickIconCache::cancelQueuedLoad()
+{
+    LocalNetworkAccessManagerFactory factory(m_dataDirectory);
+    QQmlEngine engine;
+    engine.setNetworkAccessManagerFactory(&factory);
+
+    QQuickIconCache cache;
+    cache.setMaxActiveReplies(1);
+    cache.load(networkUrl(QStringLiteral("icon.png")), QSize(), &engine, 0);
+    cache.load(networkUrl(QStringLiteral("wide.png")), QSize(), &engine, 0);
+    QCOMPARE(cache.queuedCount(), 1);
+
+    cache.cancel(networkUrl(QStringLiteral("wide.png")), QSize(), 0);
+    QCOMPARE(cache.queuedCount(), 0);
+    QTRY_VERIFY(!cache.isLoading(networkUrl(QStringLiteral("icon.png")), QSize()));
+    QCOMPARE(factory.manager()->requestCount(), 1);
+    QCOMPARE(cache.count(), 1);
+}
+
+void tst_QQuickIconCache::cancelDecoding()
+{
+    QQuickIconCache cache;
+    Receiver receiver;
+    const QUrl url = fileUrl(QStringLiteral("icon.png"));
+    cache.load(url, QSize(), 0, &receiver);
+    cache.cancel(url, QSize(), &receiver);
+    QVERIFY(!cache.isLoading(url, QSize()));
+
+    QTRY_COMPARE(cache.decodingCount(), 0);
+    QCOMPARE(receiver.icons.size(), 0);
+    QCOMPARE(cache.count(), 0);
+}
+
+// The images of a cancelled load do not finish a later load of the same
+// icon that is still waiting for its reply.
+void tst_QQuickIconCache::staleDecoding()
+{
+    LocalNetworkAccessManagerFactory factory(m_dataDirectory);
+    QQmlEngine engine;
+    engine.setNetworkAccessManagerFactory(&factory);
+
+    QQuickIconCache cache;
+    Receiver cancelled;
+    const QUrl url = networkUrl(QStringLiteral("held/icon.png"));
+    cache.load(url, QSize(), &engine, &cancelled);
+    QVERIFY(factory.manager()->heldReply());
+    factory.manager()->heldReply()->release();
+    QCOMPARE(cache.decodingCount(), 1);
+    cache.cancel(url, QSize(), &cancelled);
+
+    factory.manager()->setStalling(true);
+    Receiver receiver;
+    cache.load(url, QSize(), &engine, &receiver);
+    QTRY_COMPARE(cache.decodingCount(), 0);
+    QVERIFY(cache.isLoading(url, QSize()));
+    QCOMPARE(cache.activeReplyCount(), 1);
+    QVERIFY(cancelled.icons.isEmpty());
+    QVERIFY(receiver.icons.isEmpty());
+    QCOMPARE(cache.count(), 0);
+
+    cache.cancel(url, QSize(), &receiver);
+    QCOMPARE(cache.activeReplyCount(), 0);
+}
+
+void tst_QQuickIconCache::concurrencyLimit()
+{
+    LocalNetworkAccessManagerFactory factory(m_dataDirectory);
+    QQmlEngine engine;
+    engine.setNetworkAccessManagerFactory(&factory);
+
+    QQuickIconCache cache;
+    cache.setMaxActiveReplies(2);
+    Receiver receiver;
+    for (int i = 0; i < 5; ++i)
+        cache.load(networkUrl(QStringLiteral("icon.png?%1").arg(i)), QSize(), &engine, &receiver);
+    QCOMPARE(cache.activeReplyCount(), 2);
+    QCOMPARE(cache.queuedCount(), 3);
+    QCOMPARE(factory.manager()->requestCount(), 2);
+
+    QTRY_COMPARE(receiver.icons.size(), 5);
+    QCOMPARE(cache.activeReplyCount(), 0);
+    QCOMPARE(cache.queuedCount(), 0);
+    QCOMPARE(factory.manager()->requestCount(), 5);
+    QCOMPARE(cache.count(), 5);
+}
+
+void tst_QQuickIconCache::networkTimeout()
+{
+    LocalNetworkAccessManagerFactory factory(m_dataDirectory);
+    QQmlEngine engine;
+    engine.setNetworkAccessManagerFactory(&factory);
+
+    QQuickIconCache cache;
+    cache.setNetworkTimeout(50);
+    Receiver receiver;
+    const QUrl url = networkUrl(QStringLiteral("stall"));
+    QTest::ignoreMessage(QtWarningMsg, "Cannot load \"http://icons.test/stall\" (timed out after 50 ms)");
+    cache.load(url, QSize(), &engine, &receiver);
+
+    QTRY_COMPARE(receiver.icons.size(), 1);
+    QVERIFY(receiver.icons.at(0).isNull());
+    QVERIFY(!cache.isLoading(url, QSize()));
+    QCOMPARE(cache.activeReplyCount(), 0);
+    QCOMPARE(cache.timedOutCount(), 1);
+}
+
+void tst_QQuickIconCache::evictedByCost()
+{
+    QQuickIconCache cache(64 * 64 * 4 + 64 * 32 * 4);
+    const QUrl icon = fileUrl(QStringLiteral("icon.png"));
+    const QUrl wide = fileUrl(QStringLiteral("wide.png"));
+    cache.load(icon, QSize(), 0, 0);
+    cache.load(wide, QSize(), 0, 0);
+    QVERIFY(waitForLoad(cache, icon, QSize()));
+    QVERIFY(waitForLoad(cache, wide, QSize()));
+    QCOMPARE(cache.count(), 2);
+
+    // the least recently used icon goes first
+    QVERIFY(!cache.find(icon, QSize()).isNull());
+    cache.load(wide, QSize(32, 32), 0, 0);
+    QVERIFY(waitForLoad(cache, wide, QSize(32, 32)));
+    QVERIFY(cache.totalCost() <= cache.maxCost());
+    QVERIFY(!cache.find(icon, QSize()).isNull());
+    QVERIFY(cache.find(wide, QSize()).isNull());
+}
+
+void tst_QQuickIconCache::clear()
+{
+    QQuickIconCache cache;
+    const QUrl url = fileUrl(QStringLiteral("icon.png"));
+    cache.load(url, QSize(), 0, 0);
+    QVERIFY(waitForLoad(cache, url, QSize()));
+    QCOMPARE(cache.count(), 1);
+
+    cache.clear();
+    QCOMPARE(cache.count(), 0);
+    QCOMPARE(cache.totalCost(), 0);
+    QVERIFY(cache.find(url, QSize()).isNull());
+}
+
+QTEST_MAIN(tst_QQuickIconCache)
+
+#include "tst_qquickiconcache.moc"
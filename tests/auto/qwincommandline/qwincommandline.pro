@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwincommandline
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwincommandline.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwincommandline.cpp
@@ -0,0 +1,128 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwincommandline_p.h"
+
+// What QWinJumpList used before, kept as the reference for the escaping rules.
+static QString referenceCreateArguments(const QStringList &arguments)
+{
+    QString args;
+    for (int i=0; i<arguments.size(); ++i) {
+        QString tmp = arguments.at(i);
+        tmp.replace(QRegExp(QLatin1String("(\\\\*)\"")), QLatin1String("\\1\\1\\\""));
+        if (tmp.isEmpty() || tmp.contains(QLatin1Char(' ')) || tmp.contains(QLatin1Char('\t'))) {
+            int i = tmp.length();
+            while (i > 0 && tmp.at(i - 1) == QLatin1Char('\\'))
+                --i;
+            tmp.insert(i, QLatin1Char('"'));
+            tmp.prepend(QLatin1Char('"'));
+        }
+        args += QLatin1Char(' ') + tmp;
+    }
+    return args;
+}
+
+class tst_QWinCommandLine : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void createArguments_data();
+    void createArguments();
+    void createArgumentsRandom();
+};
+
+void tst_QWinCommandLine::createArguments_data()
+{
+    QTest::addColumn<QStringList>("arguments");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("none") << QStringList() << QString();
+    QTest::newRow("empty") << (QStringList() << QString()) << QStringLiteral(" \"\"");
+    QTest::newRow("plain") << (QStringList() << QStringLiteral("-a") << QStringLiteral("b")) << QStringLiteral(" -a b");
+    QTest::newRow("space") << (QStringList() << QStringLiteral("a b")) << QStringLiteral(" \"a b\"");
+    QTest::newRow("tab") << (QStringList() << QStringLiteral("a\tb")) << QStringLiteral(" \"a\tb\"");
+    QTest::newRow("quote") << (QStringList() << QStringLiteral("a\"b")) << QStringLiteral(" a\\\"b");
+    QTest::newRow("backslash quote") << (QStringList() << QStringLiteral("a\\\"b")) << QStringLiteral(" a\\\\\\\"b");
+    QTest::newRow("backslashes") << (QStringList() << QStringLiteral("a\\\\b")) << QStringLiteral(" a\\\\b");
+    QTest::newRow("trailing backslash") << (QStringList() << QStringLiteral("C:\\a b\\")) << QStringLiteral(" \"C:\\a b\"\\");
+    QTest::newRow("trailing backslashes") << (QStringList() << QStringLiteral("a b\\\\")) << QStringLiteral(" \"a b\"\\\\");
+    QTest::newRow("trailing quote") << (QStringList() << QStringLiteral("a b\"")) << QStringLiteral(" \"a b\\\"\"");
+    QTest::newRow("unquoted trailing backslash") << (QStringList() << QStringLiteral("C:\\")) << QStringLiteral(" C:\\");
+    QTest::newRow("non-latin1") << (QStringList() << QString::fromUtf8("\xe6\x97\xa5 \xe6\x9c\xac")) << QString::fromUtf8(" \"\xe6\x97\xa5 \xe6\x9c\xac\"");
+}
+
+void tst_QWinCommandLine::createArguments()
+{
+    QFETCH(QStringList, arguments);
+    QFETCH(QString, expected);
+
+    QCOMPARE(qt_winCreateArguments(arguments), expected);
+    QCOMPARE(qt_winCreateArguments(arguments), referenceCreateArguments(arguments));
+}
+
+void tst_QWinCommandLine::createArgumentsRandom()
+{
+    static const char alphabet[] = { 'a', 'Z', ' ', '\t', '\\', '"', '\'' };
+    qsrand(4711);
+    for (int run = 0; run < 20000; ++run) {
+        QStringList arguments;
+        const int count = qrand() % 5;
+        for (int a = 0; a < count; ++a) {
+            QString argument;
+            const int length = qrand() % 12;
+            for (int c = 0; c < length; ++c)
+                argument += QLatin1Char(alphabet[qrand() % sizeof(alphabet)]);
+            arguments.append(argument);
+        }
+        const QString actual = qt_winCreateArguments(arguments);
+        const QString expected = referenceCreateArguments(arguments);
+        if (actual != expected)
+            QFAIL(qPrintable(QString::fromLatin1("[%1]: \"%2\" instead of \"%3\"")
+                             .arg(arguments.join(QLatin1Char('|')), actual, expected)));
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinCommandLine)
+
+#include "tst_qwincommandline.moc"
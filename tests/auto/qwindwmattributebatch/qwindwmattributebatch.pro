@@ -0,0 +1,12 @@
+CONFIG += testcase
+TARGET = tst_qwindwmattributebatch
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwindwmattributebatch.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwindwmattributebatch.cpp
+
+HEADERS += \
+    $$WINEXTRAS_SOURCE_DIR/qwindwmattributebatch_p.h
@@ -0,0 +1,239 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QMargins>
+
+#include "qwindwmattributebatch_p.h"
+
+struct AppliedAttribute
+{
+    QObject *window;
+    QWinDwmAttributeBatch::Attribute attribute;
+    QVariant value;
+};
+
+// Records the native calls instead of making them.
+static QList<AppliedAttribute> appliedAttributes;
+
+static void recordAttribute(QObject *window, QWinDwmAttributeBatch::Attribute attribute, const QVariant &value)
+{
+    AppliedAttribute applied = { window, attribute, value };
+    appliedAttributes.append(applied);
+}
+
+class tst_QWinDwmAttributeBatch : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void flushedByEventLoop();
+    void lastValueWins();
+    void unchangedSkipped();
+    void applyOrder();
+    void flushWindow();
+    void forget();
+    void forgetAttribute();
+    void invalidate();
+    void destroyedWindow();
+};
+
+void tst_QWinDwmAttributeBatch::init()
+{
+    appliedAttributes.clear();
+}
+
+void tst_QWinDwmAttributeBatch::flushedByEventLoop()
+{
+    QWinDwmAttributeBatch batch(recordAttribute);
+    QObject window;
+    batch.setAttribute(&window, QWinDwmAttributeBatch::BlurBehind, true);
+    QVERIFY(batch.isPending(&window));
+    QVERIFY(appliedAttributes.isEmpty());
+
+    QTRY_COMPARE(appliedAttributes.size(), 1);
+    QVERIFY(!batch.isPending(&window));
+    QCOMPARE(appliedAttributes.at(0).window, &window);
+    QCOMPARE(appliedAttributes.at(0).attribute, QWinDwmAttributeBatch::BlurBehind);
+    QCOMPARE(appliedAttributes.at(0).value, QVariant(true));
+}
+
+void tst_QWinDwmAttributeBatch::lastValueWins()
+{
+    QWinDwmAttributeBatch batch(recordAttribute);
+    QObject window;
+
+    // setting the four margins from QML
+    batch.setAttribute(&window, QWinDwmAttributeBatch::FrameMargins, QVariant::fromValue(QMargins(0, 10, 0, 0)));
+    batch.setAttribute(&window, QWinDwmAttributeBatch::FrameMargins, QVariant::fromValue(QMargins(0, 10, 20, 0)));
+    batch.setAttribute(&window, QWinDwmAttributeBatch::FrameMargins, QVariant::fromValue(QMargins(0, 10, 20, 30)));
+    batch.setAttribute(&window, QWinDwmAttributeBatch::FrameMargins, QVariant::fromValue(QMargins(40, 10, 20, 30)));
+    batch.flush();
+
+    QCOMPARE(appliedAttributes.size(), 1);
+    QCOMPARE(appliedAttributes.at(0).value.value<QMargins>(), QMargins(40, 10, 20, 30));
+    QCOMPARE(batch.requestCount(), 4);
+    QCOMPARE(batch.applyCount(), 1);
+    QCOMPARE(batch.avoidedCount(), 3);
+}
+
+void tst_QWinDwmAttributeBatch::unchangedSkipped()
+{
+    QWinDwmAttributeBatch batch(recordAttribute);
+    QObject window;
+    batch.setAttribute(&window, QWinDwmAttributeBatch::PeekDisallowed, true);
+    batch.setAttribute(&window, QWinDwmAttributeBatch::Flip3DPolicy, 1);
+    batch.flush();
+    QCOMPARE(appliedAttributes.size(), 2);
+
+    // updating everything on a scene change
+    batch.setAttribute(&window, QWinDwmAttributeBatch::PeekDisallowed, true);
+    batch.setAttribute(&window, QWinDwmAttributeBatch::Flip3DPolicy, 2);
+    batch.flush();
+    QCOMPARE(appliedAttributes.size(), 3);
+    QCOMPARE(appliedAttributes.at(2).attribute, QWinDwmAttributeBatch::Flip3DPolicy);
+    QCOMPARE(appliedAttributes.at(2).value, QVariant(2));
+
+    // changing a value and back again before the flush
+    batch.setAttribute(&window, QWinDwmAttributeBatch::PeekDisallowed, false);
+    batch.setAttribute(&window, QWinDwmAttributeBatch::PeekDisallowed, true);
+    batch.flush();
+    QCOMPARE(appliedAttributes.size(), 3);
+    QCOMPARE(batch.avoidedCount(), 3);
+}
+
+void tst_QWinDwmAttributeBatch::applyOrder()
+{
+    QWinDwmAttributeBatch batch(recordAttribute);
+    QObject window;
+    batch.setAttribute(&window, QWinDwmAttributeBatch::FrameMargins, QVariant::fromValue(QMargins(-1, -1, -1, -1)));
+    batch.setAttribute(&window, QWinDwmAttributeBatch::BlurBehind, true);
+    batch.setAttribute(&window, QWinDwmAttributeBatch::ExcludedFromPeek, true);
+    batch.flush();
+
+    QCOMPARE(appliedAttributes.size(), 3);
+    QCOMPARE(appliedAttributes.at(0).attribute, QWinDwmAttributeBatch::ExcludedFromPeek);
+    QCOMPARE(appliedAttributes.at(1).attribute, QWinDwmAttributeBatch::BlurBehind);
+    QCOMPARE(appliedAttributes.at(2).attribute, QWinDwmAttributeBatch::FrameMargins);
+}
+
+void tst_QWinDwmAttributeBatch::flushWindow()
+{
+    QWinDwmAttributeBatch batch(recordAttribute);
+    QObject window1;
+    QObject window2;
+    batch.setAttribute(&window1, QWinDwmAttributeBatch::ExcludedFromPeek, true);
+    batch.setAttribute(&window2, QWinDwmAttributeBatch::ExcludedFromPeek, true);
+
+    batch.flush(&window2);
+    QCOMPARE(appliedAttributes.size(), 1);
+    QCOMPARE(appliedAttributes.at(0).window, &window2);
+    QVERIFY(batch.isPending(&window1));
+    QVERIFY(!batch.isPending(&window2));
+
+    QTRY_COMPARE(appliedAttributes.size(), 2);
+    QCOMPARE(appliedAttributes.at(1).window, &window1);
+}
+
+void tst_QWinDwmAttributeBatch::forget()
+{
+    QWinDwmAttributeBatch batch(recordAttribute);
+    QObject window;
+    batch.setAttribute(&window, QWinDwmAttributeBatch::BlurBehind, true);
+    batch.flush();
+
+    // composition has been enabled again
+    batch.forget(&window);
+    batch.setAttribute(&window, QWinDwmAttributeBatch::BlurBehind, true);
+    batch.flush();
+    QCOMPARE(appliedAttributes.size(), 2);
+}
+
+void tst_QWinDwmAttributeBatch::forgetAttribute()
+{
+    QWinDwmAttributeBatch batch(recordAttribute);
+    QObject window;
+    batch.setAttribute(&window, QWinDwmAttributeBatch::BlurBehind, true);
+    batch.setAttribute(&window, QWinDwmAttributeBatch::FrameMargins, QVariant::fromValue(QMargins(1, 2, 3, 4)));
+    batch.flush();
+
+    // the frame has been reset by a direct call
+    batch.forget(&window, QWinDwmAttributeBatch::FrameMargins);
+    batch.setAttribute(&window, QWinDwmAttributeBatch::BlurBehind, true);
+    batch.setAttribute(&window, QWinDwmAttributeBatch::FrameMargins, QVariant::fromValue(QMargins(1, 2, 3, 4)));
+    batch.flush();
+    QCOMPARE(appliedAttributes.size(), 3);
+    QCOMPARE(appliedAttributes.at(2).attribute, QWinDwmAttributeBatch::FrameMargins);
+    QCOMPARE(appliedAttributes.at(2).value.value<QMargins>(), QMargins(1, 2, 3, 4));
+}
+
+void tst_QWinDwmAttributeBatch::invalidate()
+{
+    QWinDwmAttributeBatch batch(recordAttribute);
+    QObject window1;
+    QObject window2;
+    batch.setAttribute(&window1, QWinDwmAttributeBatch::PeekDisallowed, true);
+    batch.setAttribute(&window2, QWinDwmAttributeBatch::PeekDisallowed, true);
+    batch.flush();
+
+    // a native window has been recreated
+    batch.invalidate();
+    batch.setAttribute(&window1, QWinDwmAttributeBatch::PeekDisallowed, true);
+    batch.setAttribute(&window2, QWinDwmAttributeBatch::PeekDisallowed, true);
+    batch.flush();
+    QCOMPARE(appliedAttributes.size(), 4);
+}
+
+void tst_QWinDwmAttributeBatch::destroyedWindow()
+{
+    QWinDwmAttributeBatch batch(recordAttribute);
+    QObject *window = new QObject;
+    batch.setAttribute(window, QWinDwmAttributeBatch::BlurBehind, true);
+    delete window;
+
+    batch.flush();
+    QVERIFY(appliedAttributes.isEmpty());
+}
+
+QTEST_GUILESS_MAIN(tst_QWinDwmAttributeBatch)
+
+#include "tst_qwindwmattributebatch.moc"
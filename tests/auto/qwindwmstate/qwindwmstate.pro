@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwindwmstate
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwindwmstate.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwindwmstate.cpp
@@ -0,0 +1,218 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwindwmstate_p.h"
+
+// What the fake desktop window manager reports.
+static quint32 dwmColorization = 0;
+static bool dwmOpaqueBlend = false;
+static quint32 dwmRealColorization = 0;
+static bool dwmCompositionEnabled = false;
+static bool dwmAvailable = true;
+
+static bool queryColorization(quint32 *argb, bool *opaqueBlend)
+{
+    if (!dwmAvailable)
+        return false;
+    *argb = dwmColorization;
+    *opaqueBlend = dwmOpaqueBlend;
+    return true;
+}
+
+static bool queryRealColorization(quint32 *argb)
+{
+    if (!dwmAvailable)
+        return false;
+    *argb = dwmRealColorization;
+    return true;
+}
+
+static bool queryComposition(bool *enabled)
+{
+    if (!dwmAvailable)
+        return false;
+    *enabled = dwmCompositionEnabled;
+    return true;
+}
+
+class tst_QWinDwmState : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void queriedOnce();
+    void colorizationChanged();
+    void compositionChanged();
+    void invalidate();
+    void failuresNotCached();
+
+private:
+    static quint32 colorization(QWinDwmState &state, bool *opaqueBlend = 0);
+    static quint32 realColorization(QWinDwmState &state);
+};
+
+quint32 tst_QWinDwmState::colorization(QWinDwmState &state, bool *opaqueBlend)
+{
+    quint32 argb;
+    state.colorization(&argb, opaqueBlend);
+    return argb;
+}
+
+quint32 tst_QWinDwmState::realColorization(QWinDwmState &state)
+{
+    quint32 argb;
+    state.realColorization(&argb);
+    return argb;
+}
+
+void tst_QWinDwmState::init()
+{
+    dwmColorization = 0x6b74b8fc;
+    dwmOpaqueBlend = false;
+    dwmRealColorization = 0xc46ea5ff;
+    dwmCompositionEnabled = true;
+    dwmAvailable = true;
+}
+
+void tst_QWinDwmState::queriedOnce()
+{
+    QWinDwmState state(queryColorization, queryRealColorization, queryComposition);
+    QCOMPARE(state.queryCount(), 0);
+
+    for (int i = 0; i < 3; ++i) {
+        bool opaque = true;
+        QCOMPARE(colorization(state, &opaque), quint32(0x6b74b8fc));
+        QVERIFY(!opaque);
+        QCOMPARE(realColorization(state), quint32(0xc46ea5ff));
+        QVERIFY(state.isCompositionEnabled());
+    }
+    QCOMPARE(state.queryCount(), 3);
+
+    // reads between messages do not see changes made behind the filter's back
+    dwmCompositionEnabled = false;
+    QVERIFY(state.isCompositionEnabled());
+}
+
+void tst_QWinDwmState::colorizationChanged()
+{
+    QWinDwmState state(queryColorization, queryRealColorization, queryComposition);
+    QCOMPARE(colorization(state), quint32(0x6b74b8fc));
+    QCOMPARE(realColorization(state), quint32(0xc46ea5ff));
+    QVERIFY(state.isCompositionEnabled());
+
+    // the message carries the new color, only the registry is read again
+    dwmColorization = 0xffff0000;
+    dwmRealColorization = 0xffff0001;
+    state.colorizationChanged(0xffff0000, true);
+    QCOMPARE(state.queryCount(), 3);
+
+    bool opaque = false;
+    QCOMPARE(colorization(state, &opaque), quint32(0xffff0000));
+    QVERIFY(opaque);
+    QVERIFY(state.isCompositionEnabled());
+    QCOMPARE(state.queryCount(), 3);
+    QCOMPARE(realColorization(state), quint32(0xffff0001));
+    QCOMPARE(state.queryCount(), 4);
+}
+
+void tst_QWinDwmState::compositionChanged()
+{
+    QWinDwmState state(queryColorization, queryRealColorization, queryComposition);
+    QCOMPARE(colorization(state), quint32(0x6b74b8fc));
+    QCOMPARE(realColorization(state), quint32(0xc46ea5ff));
+    QVERIFY(state.isCompositionEnabled());
+
+    dwmCompositionEnabled = false;
+    dwmColorization = 0xff000000;
+    state.compositionChanged();
+
+    QVERIFY(!state.isCompositionEnabled());
+    QCOMPARE(colorization(state), quint32(0xff000000));
+    QCOMPARE(realColorization(state), quint32(0xc46ea5ff));
+    QCOMPARE(state.queryCount(), 5);
+}
+
+void tst_QWinDwmState::invalidate()
+{
+    QWinDwmState state(queryColorization, queryRealColorization, queryComposition);
+    QCOMPARE(colorization(state), quint32(0x6b74b8fc));
+    QCOMPARE(realColorization(state), quint32(0xc46ea5ff));
+    QVERIFY(state.isCompositionEnabled());
+
+    dwmColorization = 1;
+    dwmRealColorization = 2;
+    dwmCompositionEnabled = false;
+    state.invalidate();
+
+    QCOMPARE(colorization(state), quint32(1));
+    QCOMPARE(realColorization(state), quint32(2));
+    QVERIFY(!state.isCompositionEnabled());
+    QCOMPARE(state.queryCount(), 6);
+}
+
+void tst_QWinDwmState::failuresNotCached()
+{
+    QWinDwmState state(queryColorization, queryRealColorization, queryComposition);
+    dwmAvailable = false;
+
+    quint32 argb = 1;
+    bool opaque = true;
+    QVERIFY(!state.colorization(&argb, &opaque));
+    QCOMPARE(argb, quint32(0));
+    QVERIFY(!opaque);
+    QVERIFY(!state.realColorization(&argb));
+    QVERIFY(!state.isCompositionEnabled());
+    QCOMPARE(state.queryCount(), 3);
+
+    dwmAvailable = true;
+    QVERIFY(state.colorization(&argb, &opaque));
+    QCOMPARE(argb, quint32(0x6b74b8fc));
+    QVERIFY(state.realColorization(&argb));
+    QVERIFY(state.isCompositionEnabled());
+    QCOMPARE(state.queryCount(), 6);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinDwmState)
+
+#include "tst_qwindwmstate.moc"
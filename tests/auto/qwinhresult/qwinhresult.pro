@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwinhresult
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinhresult.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresult.cpp
@@ -0,0 +1,170 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QSet>
+
+#include "qwinhresult_p.h"
+
+class tst_QWinHresult : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void tableIsSorted();
+    void namesAreUnique();
+    void name();
+    void nameOfUnknown();
+    void nameIsShared();
+    void fromName();
+    void fromUnknownName();
+    void fields_data();
+    void fields();
+};
+
+void tst_QWinHresult::tableIsSorted()
+{
+    QVERIFY(qt_winHresultNameCount > 1000);
+    for (int i = 1; i < qt_winHresultNameCount; ++i) {
+        if (qt_winHresultNames[i - 1].code >= qt_winHresultNames[i].code)
+            QFAIL(qt_winHresultNames[i].name);
+    }
+}
+
+void tst_QWinHresult::namesAreUnique()
+{
+    QSet<QByteArray> names;
+    for (int i = 0; i < qt_winHresultNameCount; ++i) {
+        const QByteArray name(qt_winHresultNames[i].name);
+        QVERIFY2(!name.isEmpty(), QByteArray::number(qt_winHresultNames[i].code, 16).constData());
+        QVERIFY2(!names.contains(name), name.constData());
+        names.insert(name);
+    }
+}
+
+void tst_QWinHresult::name()
+{
+    for (int i = 0; i < qt_winHresultNameCount; ++i) {
+        QCOMPARE(qt_winFindHresult(qt_winHresultNames[i].code), qt_winHresultNames + i);
+        QCOMPARE(qt_winHresultName(qt_winHresultNames[i].code), QString::fromLatin1(qt_winHresultNames[i].name));
+    }
+    QCOMPARE(qt_winHresultName(0x80070057), QStringLiteral("E_INVALIDARG"));
+    QCOMPARE(qt_winHresultName(0x8000FFFF), QStringLiteral("E_UNEXPECTED"));
+}
+
+void tst_QWinHresult::nameOfUnknown()
+{
+    QSet<quint32> codes;
+    for (int i = 0; i < qt_winHresultNameCount; ++i)
+        codes.insert(qt_winHresultNames[i].code);
+
+    // the neighbours of every entry, and the ends of the range
+    QList<quint32> unknown;
+    unknown << 0 << 1 << 0xffffffff;
+    for (int i = 0; i < qt_winHresultNameCount; ++i)
+        unknown << qt_winHresultNames[i].code - 1 << qt_winHresultNames[i].code + 1;
+    foreach (quint32 code, unknown) {
+        if (codes.contains(code))
+            continue;
+        QVERIFY(!qt_winFindHresult(code));
+        QVERIFY(qt_winHresultName(code).isNull());
+    }
+}
+
+void tst_QWinHresult::nameIsShared()
+{
+    const QString first = qt_winHresultName(0x80004005);
+    const QString second = qt_winHresultName(0x80004005);
+    QCOMPARE(first, QStringLiteral("E_FAIL"));
+    QCOMPARE(first.constData(), second.constData());
+}
+
+void tst_QWinHresult::fromName()
+{
+    for (int i = 0; i < qt_winHresultNameCount; ++i) {
+        quint32 code = 0;
+        QVERIFY2(qt_winHresultFromName(QString::fromLatin1(qt_winHresultNames[i].name), &code),
+                 qt_winHresultNames[i].name);
+        QCOMPARE(code, qt_winHresultNames[i].code);
+    }
+    QVERIFY(qt_winHresultFromName(QStringLiteral("E_NOTIMPL"), 0));
+}
+
+void tst_QWinHresult::fromUnknownName()
+{
+    quint32 code = 42;
+    QVERIFY(!qt_winHresultFromName(QString(), &code));
+    QVERIFY(!qt_winHresultFromName(QStringLiteral("E_"), &code));
+    QVERIFY(!qt_winHresultFromName(QStringLiteral("e_fail"), &code));
+    QVERIFY(!qt_winHresultFromName(QStringLiteral("E_FAIL "), &code));
+    QVERIFY(!qt_winHresultFromName(QStringLiteral("ZZZ"), &code));
+    QCOMPARE(code, quint32(42));
+}
+
+void tst_QWinHresult::fields_data()
+{
+    QTest::addColumn<quint32>("hresult");
+    QTest::addColumn<bool>("failure");
+    QTest::addColumn<int>("facility");
+    QTest::addColumn<int>("code");
+
+    QTest::newRow("S_OK") << quint32(0) << false << 0 << 0;
+    QTest::newRow("STG_S_CONVERTED") << quint32(0x00030200) << false << 3 << 0x200;
+    QTest::newRow("E_INVALIDARG") << quint32(0x80070057) << true << 7 << 0x57;
+    QTest::newRow("E_UNEXPECTED") << quint32(0x8000FFFF) << true << 0 << 0xffff;
+    QTest::newRow("ERROR_AUDITING_DISABLED") << quint32(0xC0090001) << true << 9 << 1;
+}
+
+void tst_QWinHresult::fields()
+{
+    QFETCH(quint32, hresult);
+    QFETCH(bool, failure);
+    QFETCH(int, facility);
+    QFETCH(int, code);
+
+    QCOMPARE(qt_winHresultIsFailure(hresult), failure);
+    QCOMPARE(qt_winHresultFacility(hresult), facility);
+    QCOMPARE(qt_winHresultCode(hresult), code);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinHresult)
+
+#include "tst_qwinhresult.moc"
@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwiniconhandlecache
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwiniconhandlecache.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwiniconhandlecache.cpp
@@ -0,0 +1,177 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwiniconhandlecache_p.h"
+
+static QList<quintptr> destroyed;
+
+static void recordDestroy(quintptr handle)
+{
+    destroyed << handle;
+}
+
+class tst_QWinIconHandleCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void hitAndMiss();
+    void keyIncludesSize();
+    void evictsLeastRecentlyUsed();
+    void replace();
+    void setCapacity();
+    void zeroCapacity();
+    void destructorReleases();
+};
+
+void tst_QWinIconHandleCache::init()
+{
+    destroyed.clear();
+}
+
+void tst_QWinIconHandleCache::hitAndMiss()
+{
+    QWinIconHandleCache cache(4, recordDestroy);
+    QCOMPARE(cache.find(1, 16), quintptr(0));
+    QCOMPARE(cache.missCount(), quint64(1));
+
+    cache.insert(1, 16, 0x100);
+    QCOMPARE(cache.count(), 1);
+    QCOMPARE(cache.find(1, 16), quintptr(0x100));
+    QCOMPARE(cache.find(1, 16), quintptr(0x100));
+    QCOMPARE(cache.hitCount(), quint64(2));
+    QCOMPARE(cache.missCount(), quint64(1));
+    QVERIFY(destroyed.isEmpty());
+
+    // null handles are not cached
+    cache.insert(2, 16, 0);
+    QCOMPARE(cache.count(), 1);
+}
+
+void tst_QWinIconHandleCache::keyIncludesSize()
+{
+    QWinIconHandleCache cache(4, recordDestroy);
+    cache.insert(1, 16, 0x100);
+    cache.insert(1, 32, 0x200);
+    QCOMPARE(cache.find(1, 16), quintptr(0x100));
+    QCOMPARE(cache.find(1, 32), quintptr(0x200));
+    QCOMPARE(cache.find(1, 24), quintptr(0));
+}
+
+void tst_QWinIconHandleCache::evictsLeastRecentlyUsed()
+{
+    QWinIconHandleCache cache(3, recordDestroy);
+    cache.insert(1, 16, 0x100);
+    cache.insert(2, 16, 0x200);
+    cache.insert(3, 16, 0x300);
+
+    // 1 becomes the most recently used, so 2 is evicted next
+    QCOMPARE(cache.find(1, 16), quintptr(0x100));
+    cache.insert(4, 16, 0x400);
+    QCOMPARE(destroyed, QList<quintptr>() << 0x200);
+    QCOMPARE(cache.count(), 3);
+    QCOMPARE(cache.find(2, 16), quintptr(0));
+
+    cache.insert(5, 16, 0x500);
+    QCOMPARE(destroyed, QList<quintptr>() << 0x200 << 0x300);
+    QCOMPARE(cache.find(1, 16), quintptr(0x100));
+    QCOMPARE(cache.find(4, 16), quintptr(0x400));
+    QCOMPARE(cache.find(5, 16), quintptr(0x500));
+}
+
+void tst_QWinIconHandleCache::replace()
+{
+    QWinIconHandleCache cache(2, recordDestroy);
+    cache.insert(1, 16, 0x100);
+    cache.insert(2, 16, 0x200);
+    cache.insert(1, 16, 0x101);
+    QCOMPARE(destroyed, QList<quintptr>() << 0x100);
+    QCOMPARE(cache.count(), 2);
+    QCOMPARE(cache.find(1, 16), quintptr(0x101));
+    QCOMPARE(cache.find(2, 16), quintptr(0x200));
+
+    // inserting the cached handle again does not destroy it
+    cache.insert(2, 16, 0x200);
+    QCOMPARE(destroyed.size(), 1);
+}
+
+void tst_QWinIconHandleCache::setCapacity()
+{
+    QWinIconHandleCache cache(4, recordDestroy);
+    for (int i = 1; i <= 4; ++i)
+        cache.insert(i, 16, 0x100 * i);
+    cache.setCapacity(2);
+    QCOMPARE(cache.capacity(), 2);
+    QCOMPARE(destroyed, QList<quintptr>() << 0x100 << 0x200);
+    QCOMPARE(cache.find(4, 16), quintptr(0x400));
+    QCOMPARE(cache.find(3, 16), quintptr(0x300));
+
+    cache.clear();
+    QCOMPARE(cache.count(), 0);
+    QCOMPARE(destroyed.size(), 4);
+}
+
+void tst_QWinIconHandleCache::zeroCapacity()
+{
+    QWinIconHandleCache cache(0, recordDestroy);
+    cache.insert(1, 16, 0x100);
+    QCOMPARE(cache.count(), 0);
+    QCOMPARE(destroyed, QList<quintptr>() << 0x100);
+}
+
+void tst_QWinIconHandleCache::destructorReleases()
+{
+    {
+        QWinIconHandleCache cache(4, recordDestroy);
+        cache.insert(1, 16, 0x100);
+        cache.insert(2, 16, 0x200);
+    }
+    QCOMPARE(destroyed.size(), 2);
+    QVERIFY(destroyed.contains(0x100));
+    QVERIFY(destroyed.contains(0x200));
+}
+
+QTEST_APPLESS_MAIN(tst_QWinIconHandleCache)
+
+#include "tst_qwiniconhandlecache.moc"
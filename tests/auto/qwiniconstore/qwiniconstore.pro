@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwiniconstore
+QT = core gui testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwiniconstore.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwiniconstore.cpp
@@ -0,0 +1,349 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QTemporaryDir>
+#include <QtGui/QImage>
+#include <QtGui/QImageWriter>
+
+#include "qwiniconstore_p.h"
+
+static QImage icon(QRgb color, int size = 32)
+{
+    QImage image(size, size, QImage::Format_ARGB32);
+    image.fill(color);
+    image.setPixel(0, 0, qRgba(1, 2, 3, 4));
+    return image;
+}
+
+static QStringList iconFiles(const QString &path)
+{
+    return QDir(path).entryList(QStringList(QStringLiteral("*.ico")), QDir::Files);
+}
+
+class tst_QWinIconStore : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void init();
+    void cleanup();
+
+    void fileName();
+    void insert();
+    void insertNull();
+    void collectGarbage();
+    void collectGarbageDiscarded();
+    void releaseReferences();
+    void replacedReferences();
+    void collectUnreferenced();
+    void twoStores();
+    void takeOverDirectory();
+
+private:
+    QTemporaryDir *m_directory;
+};
+
+void tst_QWinIconStore::initTestCase()
+{
+    if (!QImageWriter::supportedImageFormats().contains("ico"))
+        QSKIP("The ico image format is not supported.");
+}
+
+void tst_QWinIconStore::init()
+{
+    m_directory = new QTemporaryDir;
+    QVERIFY(m_directory->isValid());
+}
+
+void tst_QWinIconStore::cleanup()
+{
+    delete m_directory;
+    m_directory = 0;
+}
+
+void tst_QWinIconStore::fileName()
+{
+    const QString red = QWinIconStore::fileName(icon(qRgb(255, 0, 0)));
+    QVERIFY(red.endsWith(QLatin1String(".ico")));
+    QCOMPARE(red, QWinIconStore::fileName(icon(qRgb(255, 0, 0))));
+    QVERIFY(red != QWinIconStore::fileName(icon(qRgb(0, 255, 0))));
+    QVERIFY(red != QWinIconStore::fileName(icon(qRgb(255, 0, 0), 16)));
+
+    // same pixels, different formats and strides
+    QImage rgb32(13, 7, QImage::Format_RGB32);
+    rgb32.fill(qRgb(10, 20, 30));
+    QCOMPARE(QWinIconStore::fileName(rgb32), QWinIconStore::fileName(rgb32.convertToFormat(QImage::Format_ARGB32)));
+    QCOMPARE(QWinIconStore::fileName(rgb32), QWinIconStore::fileName(rgb32.convertToFormat(QImage::Format_RGB888)));
+
+    // width and height are part of the hash, not just the pixel count
+    QImage wide(4, 1, QImage::Format_ARGB32);
+    wide.fill(0);
+    QImage tall(1, 4, QImage::Format_ARGB32);
+    tall.fill(0);
+    QVERIFY(QWinIconStore::fileName(wide) != QWinIconStore::fileName(tall));
+}
+
+void tst_QWinIconStore::insert()
+{
+    QWinIconStore store(m_directory->path() + QStringLiteral("/icons"));
+
+    const QString red = store.insert(icon(qRgb(255, 0, 0)));
+    QVERIFY(!red.isEmpty());
+    QVERIFY(QFile::exists(red));
+    QCOMPARE(QFileInfo(red).fileName(), QWinIconStore::fileName(icon(qRgb(255, 0, 0))));
+    QCOMPARE(store.writeCount(), 1);
+    QCOMPARE(store.reuseCount(), 0);
+
+    const QDateTime written = QFileInfo(red).lastModified();
+    QCOMPARE(store.insert(icon(qRgb(255, 0, 0))), red);
+    QCOMPARE(store.writeCount(), 1);
+    QCOMPARE(store.reuseCount(), 1);
+    QCOMPARE(QFileInfo(red).lastModified(), written);
+
+    const QString green = store.insert(icon(qRgb(0, 255, 0)));
+    QVERIFY(green != red);
+    QCOMPARE(store.writeCount(), 2);
+
+    QVERIFY(store.directoryPath().startsWith(m_directory->path() + QStringLiteral("/icons/")));
+    QCOMPARE(iconFiles(store.directoryPath()).size(), 2);
+    QCOMPARE(QDir(store.directoryPath()).entryList(QDir::Files).size(), 2);
+}
+
+void tst_QWinIconStore::insertNull()
+{
+    QWinIconStore store(m_directory->path());
+    QVERIFY(store.insert(QImage()).isEmpty());
+    QCOMPARE(store.writeCount(), 0);
+}
+
+void tst_QWinIconStore::collectGarbage()
+{
+    QWinIconStore store(m_directory->path());
+
+    // leftovers of a previous run, and unrelated files
+    QFile stale(store.directoryPath() + QStringLiteral("1234abcd.ico"));
+    QVERIFY(stale.open(QIODevice::WriteOnly));
+    stale.close();
+    QFile unrelated(store.directoryPath() + QStringLiteral("readme.txt"));
+    QVERIFY(unrelated.open(QIODevice::WriteOnly));
+    unrelated.close();
+
+    int owner1 = 0;
+    int owner2 = 0;
+    const QString red = store.insert(icon(qRgb(255, 0, 0)));
+    store.reference(red);
+    const QString green = store.insert(icon(qRgb(0, 255, 0)));
+    store.reference(green);
+    store.commitReferences(QStringLiteral("Org.App1"), &owner1);
+    const QString blue = store.insert(icon(qRgb(0, 0, 255)));
+    store.reference(blue);
+    store.commitReferences(QStringLiteral("Org.App2"), &owner2);
+
+    QCOMPARE(store.collectGarbage(), 1);
+    QVERIFY(!stale.exists());
+    QVERIFY(unrelated.exists());
+    QVERIFY(QFile::exists(red));
+    QVERIFY(QFile::exists(green));
+    QVERIFY(QFile::exists(blue));
+
+    // nothing changed
+    QCOMPARE(store.collectGarbage(), 0);
+
+    // owner1 drops the green icon, blue is still used by owner2
+    QCOMPARE(store.insert(icon(qRgb(255, 0, 0))), red);
+    QCOMPARE(store.insert(icon(qRgb(0, 0, 255))), blue);
+    store.reference(red);
+    store.reference(blue);
+    store.commitReferences(QStringLiteral("Org.App1"), &owner1);
+    QCOMPARE(store.collectGarbage(), 1);
+    QVERIFY(QFile::exists(red));
+    QVERIFY(!QFile::exists(green));
+    QVERIFY(QFile::exists(blue));
+
+    // owner2 drops blue, but owner1 still uses it
+    store.commitReferences(QStringLiteral("Org.App2"), &owner2);
+    QCOMPARE(store.collectGarbage(), 0);
+    QVERIFY(QFile::exists(blue));
+    QCOMPARE(iconFiles(store.directoryPath()).size(), 2);
+}
+
+void tst_QWinIconStore::collectGarbageDiscarded()
+{
+    QWinIconStore store(m_directory->path());
+    int owner = 0;
+
+    const QString red = store.insert(icon(qRgb(255, 0, 0)));
+    store.reference(red);
+    store.commitReferences(QStringLiteral("Org.App"), &owner);
+    const QString green = store.insert(icon(qRgb(0, 255, 0)));
+    store.reference(green);
+
+    // pending icons of a list that is being built are kept
+    QCOMPARE(store.collectGarbage(), 0);
+    QVERIFY(QFile::exists(green));
+
+    // the icons of a list that failed to commit are removed, the committed ones are kept
+    store.discardPending();
+    QCOMPARE(store.collectGarbage(), 1);
+    QVERIFY(QFile::exists(red));
+    QVERIFY(!QFile::exists(green));
+}
+
+void tst_QWinIconStore::releaseReferences()
+{
+    QWinIconStore store(m_directory->path());
+    int owner = 0;
+
+    const QString red = store.insert(icon(qRgb(255, 0, 0)));
+    store.reference(red);
+    store.commitReferences(QStringLiteral("Org.App"), &owner);
+    QCOMPARE(store.collectGarbage(), 0);
+    QVERIFY(QFile::exists(red));
+
+    store.releaseReferences(QStringLiteral("Org.App"), &owner);
+    QCOMPARE(store.collectGarbage(), 1);
+    QVERIFY(!QFile::exists(red));
+    QVERIFY(iconFiles(store.directoryPath()).isEmpty());
+}
+
+// The shell keeps one list per AppID, whoever committed it.
+void tst_QWinIconStore::replacedReferences()
+{
+    QWinIconStore store(m_directory->path());
+    int owner1 = 0;
+    int owner2 = 0;
+
+    const QString red = store.insert(icon(qRgb(255, 0, 0)));
+    store.reference(red);
+    store.commitReferences(QStringLiteral("Org.App"), &owner1);
+    const QString green = store.insert(icon(qRgb(0, 255, 0)));
+    store.reference(green);
+    store.commitReferences(QStringLiteral("Org.App"), &owner2);
+    QCOMPARE(store.collectGarbage(), 1);
+    QVERIFY(!QFile::exists(red));
+
+    // the list of owner1 has been replaced, releasing it keeps the one of owner2
+    store.releaseReferences(QStringLiteral("Org.App"), &owner1);
+    QCOMPARE(store.collectGarbage(), 0);
+    QVERIFY(QFile::exists(green));
+
+    store.releaseReferences(QStringLiteral("Org.App"), &owner2);
+    QCOMPARE(store.collectGarbage(), 1);
+    QVERIFY(!QFile::exists(green));
+}
+
+void tst_QWinIconStore::collectUnreferenced()
+{
+    QWinIconStore store(m_directory->path());
+    int owner = 0;
+
+    const QString red = store.insert(icon(qRgb(255, 0, 0)));
+    const QString green = store.insert(icon(qRgb(0, 255, 0)));
+    store.reference(red);
+    store.commitReferences(QStringLiteral("Org.App"), &owner);
+    QCOMPARE(store.collectGarbage(), 1);
+    QVERIFY(QFile::exists(red));
+    QVERIFY(!QFile::exists(green));
+}
+
+// Two instances of an application share the directory, and the shell reads
+// the icons of their jump lists at any time.
+void tst_QWinIconStore::twoStores()
+{
+    QWinIconStore first(m_directory->path());
+    QWinIconStore second(m_directory->path());
+    QVERIFY(first.directoryPath() != second.directoryPath());
+    int owner = 0;
+
+    const QString red = first.insert(icon(qRgb(255, 0, 0)));
+    first.reference(red);
+    first.commitReferences(QStringLiteral("Org.App"), &owner);
+    QCOMPARE(first.collectGarbage(), 0);
+
+    const QString otherRed = second.insert(icon(qRgb(255, 0, 0)));
+    QVERIFY(otherRed != red);
+    QCOMPARE(second.writeCount(), 1);
+    const QString green = second.insert(icon(qRgb(0, 255, 0)));
+    second.reference(green);
+    second.commitReferences(QStringLiteral("Org.App"), &owner);
+    QCOMPARE(second.collectGarbage(), 1);
+    QVERIFY(QFile::exists(red));
+    QVERIFY(!QFile::exists(otherRed));
+    QVERIFY(QFile::exists(green));
+
+    second.releaseReferences(QStringLiteral("Org.App"), &owner);
+    QCOMPARE(second.collectGarbage(), 1);
+    QVERIFY(QFile::exists(red));
+    QCOMPARE(first.collectGarbage(), 0);
+}
+
+void tst_QWinIconStore::takeOverDirectory()
+{
+    QString directoryPath;
+    QString red;
+    {
+        QWinIconStore store(m_directory->path());
+        int owner = 0;
+        directoryPath = store.directoryPath();
+        red = store.insert(icon(qRgb(255, 0, 0)));
+        store.reference(red);
+        store.commitReferences(QStringLiteral("Org.App"), &owner);
+        store.collectGarbage();
+    }
+    QVERIFY(QFile::exists(red));
+
+    // the next store collects the leftovers of the previous one
+    QWinIconStore store(m_directory->path());
+    QCOMPARE(store.directoryPath(), directoryPath);
+    int owner = 0;
+    const QString green = store.insert(icon(qRgb(0, 255, 0)));
+    store.reference(green);
+    store.commitReferences(QStringLiteral("Org.App"), &owner);
+    QCOMPARE(store.collectGarbage(), 1);
+    QVERIFY(!QFile::exists(red));
+    QVERIFY(QFile::exists(green));
+}
+
+QTEST_GUILESS_MAIN(tst_QWinIconStore)
+
+#include "tst_qwiniconstore.moc"
@@ -0,0 +1,15 @@
+CONFIG += testcase
+TARGET = tst_qwinjumplistcommitter
+QT = core gui testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinjumplistcommitter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistcommitter.cpp \
+    $$WINEXTRAS_TEST_SOURCE_DIR/qwinrecordingshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinthumbnailtoolbarstate.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistsnapshot.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwiniconstore.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresult.cpp
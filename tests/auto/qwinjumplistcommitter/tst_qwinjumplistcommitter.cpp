@@ -0,0 +1,329 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QTemporaryDir>
+#include <QtGui/QImageWriter>
+
+#include "qwinjumplistcommitter_p.h"
+#include "qwinrecordingshellbackend_p.h"
+#include "qwiniconstore_p.h"
+
+typedef QWinRecordingShellBackend Backend;
+
+static const qint32 failure = qint32(0x80004005); // E_FAIL
+
+class CountingIcons : public QWinJumpListIconSource
+{
+public:
+    QImage icon(int item) Q_DECL_OVERRIDE
+    {
+        requested.append(item);
+        QImage image(16, 16, QImage::Format_ARGB32);
+        image.fill(qRgb(item * 10, 0, 0));
+        return image;
+    }
+
+    QList<int> requested;
+};
+
+static QWinJumpListItemSnapshot item(QWinJumpListItem::Type type, const QString &text, qint64 iconKey = 0)
+{
+    QWinJumpListItemSnapshot item;
+    item.type = type;
+    if (type == QWinJumpListItem::Link) {
+        item.filePath = QStringLiteral("C:/app.exe");
+        item.title = text;
+        item.arguments << text;
+        item.iconKey = iconKey;
+    } else if (type == QWinJumpListItem::Destination) {
+        item.filePath = text;
+    }
+    return item;
+}
+
+// Recent, Files (items 0 and 1) and Tasks (items 2, 3 and 4).
+static QWinJumpListSnapshot jumpList()
+{
+    QWinJumpListSnapshot snapshot;
+    snapshot.identifier = QStringLiteral("Org.App");
+
+    QWinJumpListCategorySnapshot recent;
+    recent.type = QWinJumpListCategory::Recent;
+    snapshot.categories.append(recent);
+
+    QWinJumpListCategorySnapshot files;
+    files.title = QStringLiteral("Files");
+    files.items.append(item(QWinJumpListItem::Destination, QStringLiteral("C:/a.txt")));
+    files.items.append(item(QWinJumpListItem::Destination, QStringLiteral("C:/b.txt")));
+    snapshot.categories.append(files);
+
+    QWinJumpListCategorySnapshot tasks;
+    tasks.type = QWinJumpListCategory::Tasks;
+    tasks.items.append(item(QWinJumpListItem::Link, QStringLiteral("New"), 1));
+    tasks.items.append(item(QWinJumpListItem::Separator, QString()));
+    tasks.items.append(item(QWinJumpListItem::Link, QStringLiteral("Open")));
+    snapshot.categories.append(tasks);
+    return snapshot;
+}
+
+static QStringList iconFiles(const QString &path)
+{
+    return QDir(path).entryList(QStringList(QStringLiteral("*.ico")), QDir::Files);
+}
+
+class tst_QWinJumpListCommitter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void firstCommit();
+    void unchanged();
+    void reuseUnchanged();
+    void failedCommit();
+    void failedBeginList();
+    void releaseCommitted();
+    void iconFileLifetime();
+    void destroyedCommitterIcons();
+
+private:
+    QTemporaryDir *m_directory;
+    QWinIconStore *m_iconStore;
+};
+
+void tst_QWinJumpListCommitter::init()
+{
+    m_directory = new QTemporaryDir;
+    QVERIFY(m_directory->isValid());
+    m_iconStore = new QWinIconStore(m_directory->path());
+}
+
+void tst_QWinJumpListCommitter::cleanup()
+{
+    delete m_iconStore;
+    m_iconStore = 0;
+    delete m_directory;
+    m_directory = 0;
+}
+
+void tst_QWinJumpListCommitter::firstCommit()
+{
+    Backend backend;
+    QWinJumpListCommitter committer(&backend, m_iconStore);
+    CountingIcons icons;
+    QVERIFY(!committer.isCommitted());
+
+    const QWinJumpListSnapshot snapshot = jumpList();
+    QCOMPARE(committer.commit(snapshot, &icons), QWinJumpListCommitter::Committed);
+    QVERIFY(committer.isCommitted());
+    QVERIFY(committer.committedSnapshot() == snapshot);
+    QVERIFY(backend.committedList() == snapshot);
+    QCOMPARE(backend.commitCount(), 1);
+
+    // five items and two collections, the known category has none
+    QCOMPARE(committer.createdObjectCount(), 7);
+    QCOMPARE(committer.reusedObjectCount(), 0);
+    QCOMPARE(backend.liveObjectCount(), 7);
+    QCOMPARE(backend.callCount(Backend::AppendKnownCategory), 1);
+    QCOMPARE(backend.callCount(Backend::AppendCategory), 1);
+    QCOMPARE(backend.callCount(Backend::AddUserTasks), 1);
+
+    // only the link with an icon
+    QCOMPARE(icons.requested, QList<int>() << 2);
+}
+
+void tst_QWinJumpListCommitter::unchanged()
+{
+    Backend backend;
+    QWinJumpListCommitter committer(&backend, m_iconStore);
+    CountingIcons icons;
+    QCOMPARE(committer.commit(jumpList(), &icons), QWinJumpListCommitter::Committed);
+
+    backend.resetRecording();
+    QCOMPARE(committer.commit(jumpList(), &icons), QWinJumpListCommitter::Unchanged);
+    QCOMPARE(backend.totalCallCount(), 0);
+    QCOMPARE(backend.commitCount(), 1);
+
+    // an empty list is committed once too
+    Backend emptyBackend;
+    QWinJumpListCommitter emptyCommitter(&emptyBackend, m_iconStore);
+    QCOMPARE(emptyCommitter.commit(QWinJumpListSnapshot(), &icons), QWinJumpListCommitter::Committed);
+    QCOMPARE(emptyCommitter.commit(QWinJumpListSnapshot(), &icons), QWinJumpListCommitter::Unchanged);
+    QCOMPARE(emptyBackend.commitCount(), 1);
+}
+
+void tst_QWinJumpListCommitter::reuseUnchanged()
+{
+    Backend backend;
+    QWinJumpListCommitter committer(&backend, m_iconStore);
+    CountingIcons icons;
+    QWinJumpListSnapshot snapshot = jumpList();
+    QCOMPARE(committer.commit(snapshot, &icons), QWinJumpListCommitter::Committed);
+
+    snapshot.categories[2].items[2].title = QStringLiteral("Open...");
+    icons.requested.clear();
+    backend.resetRecording();
+    QCOMPARE(committer.commit(snapshot, &icons), QWinJumpListCommitter::Committed);
+    QVERIFY(backend.committedList() == snapshot);
+
+    // the changed link and the tasks are created, the rest is reused
+    QCOMPARE(backend.callCount(Backend::CreateLink), 1);
+    QCOMPARE(backend.callCount(Backend::CreateCollection), 1);
+    QCOMPARE(backend.callCount(Backend::CreateDestination), 0);
+    QCOMPARE(backend.callCount(Backend::CreateSeparator), 0);
+    QCOMPARE(committer.createdObjectCount(), 7 + 2);
+    QCOMPARE(committer.reusedObjectCount(), 5);
+    QVERIFY(icons.requested.isEmpty());
+
+    // and what is not used anymore is released
+    QCOMPARE(backend.liveObjectCount(), 7);
+}
+
+void tst_QWinJumpListCommitter::failedCommit()
+{
+    Backend backend;
+    QWinJumpListCommitter committer(&backend, m_iconStore);
+    CountingIcons icons;
+    const QWinJumpListSnapshot committed = jumpList();
+    QCOMPARE(committer.commit(committed, &icons), QWinJumpListCommitter::Committed);
+
+    QWinJumpListSnapshot snapshot = committed;
+    snapshot.categories[1].items.append(item(QWinJumpListItem::Destination, QStringLiteral("C:/c.txt")));
+    backend.setResult(Backend::CommitList, failure);
+    QTest::ignoreMessage(QtWarningMsg, "QWinJumpList: CommitList() failed: 0x80004005, E_FAIL.");
+    QCOMPARE(committer.commit(snapshot, &icons), QWinJumpListCommitter::Failed);
+    QVERIFY(committer.committedSnapshot() == committed);
+    QVERIFY(backend.committedList() == committed);
+    QCOMPARE(backend.liveObjectCount(), 7);
+
+    backend.setResult(Backend::CommitList, 0);
+    QCOMPARE(committer.commit(snapshot, &icons), QWinJumpListCommitter::Committed);
+    QVERIFY(backend.committedList() == snapshot);
+    QCOMPARE(backend.liveObjectCount(), 8);
+}
+
+void tst_QWinJumpListCommitter::failedBeginList()
+{
+    Backend backend;
+    QWinJumpListCommitter committer(&backend, m_iconStore);
+    CountingIcons icons;
+    backend.setResult(Backend::BeginList, failure);
+    QTest::ignoreMessage(QtWarningMsg, "QWinJumpList: BeginList() failed: 0x80004005, E_FAIL.");
+    QCOMPARE(committer.commit(jumpList(), &icons), QWinJumpListCommitter::Failed);
+    QVERIFY(!committer.isCommitted());
+    QCOMPARE(backend.totalCallCount(), 1);
+    QVERIFY(icons.requested.isEmpty());
+}
+
+void tst_QWinJumpListCommitter::releaseCommitted()
+{
+    Backend backend;
+    CountingIcons icons;
+    {
+        QWinJumpListCommitter committer(&backend, m_iconStore);
+        QCOMPARE(committer.commit(jumpList(), &icons), QWinJumpListCommitter::Committed);
+        committer.releaseCommitted();
+        QVERIFY(!committer.isCommitted());
+        QCOMPARE(backend.liveObjectCount(), 0);
+
+        // everything is passed again
+        QCOMPARE(committer.commit(jumpList(), &icons), QWinJumpListCommitter::Committed);
+        QCOMPARE(committer.createdObjectCount(), 14);
+        QCOMPARE(backend.commitCount(), 2);
+    }
+    // and released with the committer
+    QCOMPARE(backend.liveObjectCount(), 0);
+}
+
+void tst_QWinJumpListCommitter::iconFileLifetime()
+{
+    if (!QImageWriter::supportedImageFormats().contains("ico"))
+        QSKIP("The ico image format is not supported.");
+
+    Backend backend;
+    QWinJumpListCommitter committer(&backend, m_iconStore);
+    CountingIcons icons;
+    QWinJumpListSnapshot snapshot = jumpList();
+    QCOMPARE(committer.commit(snapshot, &icons), QWinJumpListCommitter::Committed);
+    QCOMPARE(iconFiles(m_iconStore->directoryPath()).size(), 1);
+    QCOMPARE(m_iconStore->writeCount(), 1);
+
+    // the icon file goes with the last link using it
+    snapshot.categories[2].items.removeFirst();
+    QCOMPARE(committer.commit(snapshot, &icons), QWinJumpListCommitter::Committed);
+    QVERIFY(iconFiles(m_iconStore->directoryPath()).isEmpty());
+}
+
+void tst_QWinJumpListCommitter::destroyedCommitterIcons()
+{
+    if (!QImageWriter::supportedImageFormats().contains("ico"))
+        QSKIP("The ico image format is not supported.");
+
+    Backend backend;
+    CountingIcons icons;
+    QWinJumpListCommitter *committer = new QWinJumpListCommitter(&backend, m_iconStore);
+    QCOMPARE(committer->commit(jumpList(), &icons), QWinJumpListCommitter::Committed);
+    QCOMPARE(iconFiles(m_iconStore->directoryPath()).size(), 1);
+    QCOMPARE(m_iconStore->collectGarbage(), 0);
+
+    // the jump list is gone, its icons are left to the next collection
+    delete committer;
+    QCOMPARE(iconFiles(m_iconStore->directoryPath()).size(), 1);
+    QCOMPARE(m_iconStore->collectGarbage(), 1);
+    QVERIFY(iconFiles(m_iconStore->directoryPath()).isEmpty());
+
+    // a committer that has been replaced for the same AppID keeps the icons of the other
+    QWinJumpListCommitter first(&backend, m_iconStore);
+    committer = new QWinJumpListCommitter(&backend, m_iconStore);
+    QCOMPARE(first.commit(jumpList(), &icons), QWinJumpListCommitter::Committed);
+    QCOMPARE(committer->commit(jumpList(), &icons), QWinJumpListCommitter::Committed);
+    first.releaseCommitted();
+    QCOMPARE(m_iconStore->collectGarbage(), 0);
+    delete committer;
+    QCOMPARE(m_iconStore->collectGarbage(), 1);
+}
+
+QTEST_GUILESS_MAIN(tst_QWinJumpListCommitter)
+
+#include "tst_qwinjumplistcommitter.moc"
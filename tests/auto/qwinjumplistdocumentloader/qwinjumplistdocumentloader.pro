@@ -0,0 +1,14 @@
+CONFIG += testcase
+TARGET = tst_qwinjumplistdocumentloader
+QT = core gui testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinjumplistdocumentloader.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistdocumentloader.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinshellexecutor.cpp \
+    $$WINEXTRAS_TEST_SOURCE_DIR/qwinrecordingshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinthumbnailtoolbarstate.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistsnapshot.cpp
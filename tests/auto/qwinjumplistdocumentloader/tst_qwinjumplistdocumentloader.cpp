@@ -0,0 +1,273 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinjumplistdocumentloader_p.h"
+#include "qwinrecordingshellbackend_p.h"
+#include "qwinshellexecutor_p.h"
+
+typedef QWinRecordingShellBackend Backend;
+
+static const qint32 failure = qint32(0x80004005); // E_FAIL
+static const int slowLatency = 200000; // usecs
+
+class Receiver : public QWinJumpListDocumentReceiver
+{
+public:
+    Receiver() : calls(0), hresult(0) {}
+
+    void documentsLoaded(qint32 result, const QVector<QWinShellDocument> &loaded) Q_DECL_OVERRIDE
+    {
+        ++calls;
+        hresult = result;
+        documents = loaded;
+    }
+
+    int calls;
+    qint32 hresult;
+    QVector<QWinShellDocument> documents;
+};
+
+class NoJob : public QWinShellJob
+{
+public:
+    void run() Q_DECL_OVERRIDE {}
+};
+
+static QVector<QWinShellDocument> documents(const QString &prefix, int count)
+{
+    QVector<QWinShellDocument> documents;
+    for (int i = 0; i < count; ++i) {
+        QWinShellDocument document;
+        document.filePath = prefix + QString::number(i);
+        documents.append(document);
+    }
+    return documents;
+}
+
+static QStringList filePaths(const QVector<QWinShellDocument> &documents)
+{
+    QStringList paths;
+    foreach (const QWinShellDocument &document, documents)
+        paths.append(document.filePath);
+    return paths;
+}
+
+class tst_QWinJumpListDocumentLoader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void load();
+    void loadAsync();
+    void loadAsyncDoesNotBlock();
+    void loadAsyncFailure();
+    void loadAsyncTwice();
+    void loadCancelsAsync();
+    void cancel();
+    void destroyWhileLoading();
+};
+
+void tst_QWinJumpListDocumentLoader::load()
+{
+    Backend backend;
+    backend.setDocuments(QStringLiteral("Org.App"), Backend::FrequentDocuments, documents(QStringLiteral("C:/f"), 2));
+    QWinShellExecutor executor;
+    Receiver receiver;
+    QWinJumpListDocumentLoader loader(&executor, &backend, &receiver);
+
+    QVector<QWinShellDocument> loaded;
+    QCOMPARE(loader.load(QStringLiteral("Org.App"), Backend::FrequentDocuments, &loaded), qint32(0));
+    QCOMPARE(filePaths(loaded), QStringList() << QStringLiteral("C:/f0") << QStringLiteral("C:/f1"));
+    QVERIFY(!loader.isLoading());
+    QCoreApplication::processEvents();
+    QCOMPARE(receiver.calls, 0);
+    QCOMPARE(backend.callCount(Backend::Documents), 1);
+}
+
+void tst_QWinJumpListDocumentLoader::loadAsync()
+{
+    Backend backend;
+    backend.setDocuments(QStringLiteral("Org.App"), Backend::RecentDocuments, documents(QStringLiteral("C:/r"), 3));
+    QWinShellExecutor executor;
+    Receiver receiver;
+    QWinJumpListDocumentLoader loader(&executor, &backend, &receiver);
+
+    loader.loadAsync(QStringLiteral("Org.App"), Backend::RecentDocuments);
+    QVERIFY(loader.isLoading());
+    QTRY_COMPARE(receiver.calls, 1);
+    QVERIFY(!loader.isLoading());
+    QCOMPARE(receiver.hresult, qint32(0));
+    QCOMPARE(filePaths(receiver.documents), QStringList() << QStringLiteral("C:/r0") << QStringLiteral("C:/r1") << QStringLiteral("C:/r2"));
+    QCOMPARE(backend.callCount(Backend::Documents), 1);
+}
+
+// The point of loading in the background: a slow shell does not hold up
+// the thread the loader lives in, nor its other calls to the shell.
+void tst_QWinJumpListDocumentLoader::loadAsyncDoesNotBlock()
+{
+    Backend backend;
+    backend.setLatency(Backend::Documents, slowLatency);
+    backend.setDocuments(QStringLiteral("Org.App"), Backend::RecentDocuments, documents(QStringLiteral("C:/r"), 100));
+    QWinShellExecutor executor;
+    Receiver receiver;
+    QWinJumpListDocumentLoader loader(&executor, &backend, &receiver);
+
+    QElapsedTimer timer;
+    timer.start();
+    loader.loadAsync(QStringLiteral("Org.App"), Backend::RecentDocuments);
+    backend.setProgressValue(1, 1, 2);
+    const qint64 blocked = timer.elapsed();
+    QVERIFY2(blocked < slowLatency / 2000, QByteArray::number(blocked));
+    QCOMPARE(receiver.calls, 0);
+
+    QTRY_COMPARE(receiver.calls, 1);
+    QVERIFY(timer.elapsed() >= slowLatency / 1000);
+    QCOMPARE(receiver.documents.size(), 100);
+    QCOMPARE(backend.callCount(Backend::SetProgressValue), 1);
+}
+
+void tst_QWinJumpListDocumentLoader::loadAsyncFailure()
+{
+    Backend backend;
+    backend.setDocuments(QStringLiteral("Org.App"), Backend::RecentDocuments, documents(QStringLiteral("C:/r"), 3));
+    backend.setResult(Backend::Documents, failure);
+    QWinShellExecutor executor;
+    Receiver receiver;
+    QWinJumpListDocumentLoader loader(&executor, &backend, &receiver);
+
+    loader.loadAsync(QStringLiteral("Org.App"), Backend::RecentDocuments);
+    QTRY_COMPARE(receiver.calls, 1);
+    QCOMPARE(receiver.hresult, failure);
+    QVERIFY(receiver.documents.isEmpty());
+}
+
+// Only the last load is delivered.
+void tst_QWinJumpListDocumentLoader::loadAsyncTwice()
+{
+    Backend backend;
+    backend.setLatency(Backend::Documents, slowLatency / 4);
+    backend.setDocuments(QStringLiteral("Org.App"), Backend::RecentDocuments, documents(QStringLiteral("C:/r"), 1));
+    backend.setDocuments(QStringLiteral("Org.App"), Backend::FrequentDocuments, documents(QStringLiteral("C:/f"), 1));
+    QWinShellExecutor executor;
+    Receiver receiver;
+    QWinJumpListDocumentLoader loader(&executor, &backend, &receiver);
+
+    loader.loadAsync(QStringLiteral("Org.App"), Backend::RecentDocuments);
+    loader.loadAsync(QStringLiteral("Org.App"), Backend::FrequentDocuments);
+    QTRY_COMPARE(receiver.calls, 1);
+    QCOMPARE(filePaths(receiver.documents), QStringList(QStringLiteral("C:/f0")));
+
+    executor.waitForDone();
+    QCOMPARE(receiver.calls, 1);
+}
+
+void tst_QWinJumpListDocumentLoader::loadCancelsAsync()
+{
+    Backend backend;
+    backend.setLatency(Backend::Documents, slowLatency / 4);
+    backend.setDocuments(QStringLiteral("Org.App"), Backend::RecentDocuments, documents(QStringLiteral("C:/r"), 2));
+    QWinShellExecutor executor;
+    Receiver receiver;
+    QWinJumpListDocumentLoader loader(&executor, &backend, &receiver);
+
+    loader.loadAsync(QStringLiteral("Org.App"), Backend::RecentDocuments);
+    QVector<QWinShellDocument> loaded;
+    QCOMPARE(loader.load(QStringLiteral("Org.App"), Backend::RecentDocuments, &loaded), qint32(0));
+    QCOMPARE(loaded.size(), 2);
+    QVERIFY(!loader.isLoading());
+
+    executor.waitForDone();
+    QCOMPARE(receiver.calls, 0);
+}
+
+void tst_QWinJumpListDocumentLoader::cancel()
+{
+    Backend backend;
+    QWinShellExecutor executor;
+    Receiver receiver;
+    QWinJumpListDocumentLoader loader(&executor, &backend, &receiver);
+
+    // cancelled before the documents are listed
+    backend.setLatency(Backend::Documents, slowLatency / 4);
+    loader.loadAsync(QStringLiteral("Org.App"), Backend::RecentDocuments);
+    loader.cancel();
+    QVERIFY(!loader.isLoading());
+    executor.waitForDone();
+    QCOMPARE(receiver.calls, 0);
+
+    // cancelled after the documents were listed, before they were delivered
+    backend.setLatency(Backend::Documents, 0);
+    loader.loadAsync(QStringLiteral("Org.App"), Backend::RecentDocuments);
+    NoJob previousJobsDone;
+    executor.call(&previousJobsDone);
+    loader.cancel();
+    QCoreApplication::processEvents();
+    QCOMPARE(receiver.calls, 0);
+
+    loader.cancel();
+    QCOMPARE(backend.callCount(Backend::Documents), 2);
+}
+
+void tst_QWinJumpListDocumentLoader::destroyWhileLoading()
+{
+    Backend backend;
+    backend.setLatency(Backend::Documents, slowLatency / 4);
+    QWinShellExecutor executor;
+    Receiver receiver;
+    QWinJumpListDocumentLoader *loader = new QWinJumpListDocumentLoader(&executor, &backend, &receiver);
+
+    QElapsedTimer timer;
+    timer.start();
+    loader->loadAsync(QStringLiteral("Org.App"), Backend::RecentDocuments);
+    delete loader;
+    // does not wait for the shell
+    QVERIFY(timer.elapsed() < slowLatency / 8000);
+
+    executor.waitForDone();
+    QCOMPARE(receiver.calls, 0);
+    QCOMPARE(backend.callCount(Backend::Documents), 1);
+}
+
+QTEST_GUILESS_MAIN(tst_QWinJumpListDocumentLoader)
+
+#include "tst_qwinjumplistdocumentloader.moc"
@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwinjumplistsnapshot
+QT = core gui testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinjumplistsnapshot.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistsnapshot.cpp
@@ -0,0 +1,238 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinjumplistsnapshot_p.h"
+
+static QWinJumpListItemSnapshot link(const QString &title, const QStringList &arguments = QStringList())
+{
+    QWinJumpListItemSnapshot item;
+    item.type = QWinJumpListItem::Link;
+    item.filePath = QStringLiteral("C:/app.exe");
+    item.title = title;
+    item.arguments = arguments;
+    return item;
+}
+
+static QWinJumpListCategorySnapshot category(QWinJumpListCategory::Type type, const QString &title = QString(),
+                                             const QVector<QWinJumpListItemSnapshot> &items = QVector<QWinJumpListItemSnapshot>())
+{
+    QWinJumpListCategorySnapshot category;
+    category.type = type;
+    category.title = title;
+    category.items = items;
+    return category;
+}
+
+static QWinJumpListSnapshot jumpList()
+{
+    QWinJumpListSnapshot snapshot;
+    snapshot.identifier = QStringLiteral("QtProject.Test");
+    snapshot.categories << category(QWinJumpListCategory::Recent)
+                        << category(QWinJumpListCategory::Custom, QStringLiteral("Projects"),
+                                    QVector<QWinJumpListItemSnapshot>() << link(QStringLiteral("one")) << link(QStringLiteral("two")))
+                        << category(QWinJumpListCategory::Tasks, QString(),
+                                    QVector<QWinJumpListItemSnapshot>() << link(QStringLiteral("new"), QStringList(QStringLiteral("--new")))
+                                                                        << link(QStringLiteral("open"), QStringList(QStringLiteral("--open"))));
+    return snapshot;
+}
+
+typedef QVector<int> IntVector;
+
+class tst_QWinJumpListSnapshot : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void itemEquality();
+    void itemCount();
+    void unchanged();
+    void empty();
+    void identifier();
+    void knownCategory();
+    void categoryRemoved();
+    void itemChanged();
+    void itemMoved();
+    void duplicateItems();
+    void matchedCategoriesFirst();
+};
+
+void tst_QWinJumpListSnapshot::itemEquality()
+{
+    const QWinJumpListItemSnapshot item = link(QStringLiteral("one"), QStringList(QStringLiteral("-a")));
+    QWinJumpListItemSnapshot other = item;
+    QVERIFY(item == other);
+    QCOMPARE(qHash(item), qHash(other));
+
+    other.iconKey = 1;
+    QVERIFY(item != other);
+    other = item;
+    other.description = QStringLiteral("description");
+    QVERIFY(item != other);
+    other = item;
+    other.workingDirectory = QStringLiteral("C:/");
+    QVERIFY(item != other);
+    other = item;
+    other.arguments << QStringLiteral("-b");
+    QVERIFY(item != other);
+    other = item;
+    other.type = QWinJumpListItem::Destination;
+    QVERIFY(item != other);
+}
+
+void tst_QWinJumpListSnapshot::itemCount()
+{
+    QCOMPARE(QWinJumpListSnapshot().itemCount(), 0);
+    QCOMPARE(jumpList().itemCount(), 4);
+}
+
+void tst_QWinJumpListSnapshot::unchanged()
+{
+    const QWinJumpListDiff diff = qt_winDiffJumpLists(jumpList(), jumpList());
+    QVERIFY(!diff.changed);
+    QCOMPARE(diff.categories, IntVector() << 0 << 1 << 2);
+    QCOMPARE(diff.items, IntVector() << 0 << 1 << 2 << 3);
+    QCOMPARE(diff.reusedCategoryCount(), 3);
+    QCOMPARE(diff.reusedItemCount(), 4);
+}
+
+void tst_QWinJumpListSnapshot::empty()
+{
+    QWinJumpListDiff diff = qt_winDiffJumpLists(QWinJumpListSnapshot(), QWinJumpListSnapshot());
+    QVERIFY(!diff.changed);
+    QVERIFY(diff.categories.isEmpty());
+    QVERIFY(diff.items.isEmpty());
+
+    diff = qt_winDiffJumpLists(QWinJumpListSnapshot(), jumpList());
+    QVERIFY(diff.changed);
+    QCOMPARE(diff.categories, IntVector() << -1 << -1 << -1);
+    QCOMPARE(diff.items, IntVector() << -1 << -1 << -1 << -1);
+
+    diff = qt_winDiffJumpLists(jumpList(), QWinJumpListSnapshot());
+    QVERIFY(diff.changed);
+    QVERIFY(diff.categories.isEmpty());
+}
+
+void tst_QWinJumpListSnapshot::identifier()
+{
+    QWinJumpListSnapshot to = jumpList();
+    to.identifier = QStringLiteral("QtProject.Other");
+    const QWinJumpListDiff diff = qt_winDiffJumpLists(jumpList(), to);
+    QVERIFY(diff.changed);
+    QCOMPARE(diff.reusedCategoryCount(), 3);
+    QCOMPARE(diff.reusedItemCount(), 4);
+}
+
+void tst_QWinJumpListSnapshot::knownCategory()
+{
+    // The items of known categories are managed by the shell, toggling one shifts the others.
+    QWinJumpListSnapshot to = jumpList();
+    to.categories.insert(1, category(QWinJumpListCategory::Frequent));
+    const QWinJumpListDiff diff = qt_winDiffJumpLists(jumpList(), to);
+    QVERIFY(diff.changed);
+    QCOMPARE(diff.categories, IntVector() << 0 << -1 << 1 << 2);
+    QCOMPARE(diff.items, IntVector() << 0 << 1 << 2 << 3);
+}
+
+void tst_QWinJumpListSnapshot::categoryRemoved()
+{
+    QWinJumpListSnapshot to = jumpList();
+    to.categories.remove(1);
+    const QWinJumpListDiff diff = qt_winDiffJumpLists(jumpList(), to);
+    QVERIFY(diff.changed);
+    QCOMPARE(diff.categories, IntVector() << 0 << 2);
+    QCOMPARE(diff.items, IntVector() << 2 << 3);
+}
+
+void tst_QWinJumpListSnapshot::itemChanged()
+{
+    QWinJumpListSnapshot to = jumpList();
+    to.categories[2].items[1].title = QStringLiteral("open...");
+    const QWinJumpListDiff diff = qt_winDiffJumpLists(jumpList(), to);
+    QVERIFY(diff.changed);
+    QCOMPARE(diff.categories, IntVector() << 0 << 1 << -1);
+    QCOMPARE(diff.items, IntVector() << 0 << 1 << 2 << -1);
+    QCOMPARE(diff.reusedItemCount(), 3);
+}
+
+void tst_QWinJumpListSnapshot::itemMoved()
+{
+    QWinJumpListSnapshot to = jumpList();
+    to.categories[1].items.append(to.categories[2].items.takeFirst());
+    const QWinJumpListDiff diff = qt_winDiffJumpLists(jumpList(), to);
+    QVERIFY(diff.changed);
+    QCOMPARE(diff.categories, IntVector() << 0 << -1 << -1);
+    QCOMPARE(diff.items, IntVector() << 0 << 1 << 2 << 3);
+}
+
+void tst_QWinJumpListSnapshot::duplicateItems()
+{
+    QWinJumpListSnapshot from;
+    from.categories << category(QWinJumpListCategory::Tasks, QString(),
+                                QVector<QWinJumpListItemSnapshot>() << link(QStringLiteral("a")) << link(QStringLiteral("a")));
+    QWinJumpListSnapshot to;
+    to.categories << category(QWinJumpListCategory::Tasks, QString(),
+                              QVector<QWinJumpListItemSnapshot>() << link(QStringLiteral("a")) << link(QStringLiteral("b"))
+                                                                  << link(QStringLiteral("a")) << link(QStringLiteral("a")));
+    const QWinJumpListDiff diff = qt_winDiffJumpLists(from, to);
+    QVERIFY(diff.changed);
+    // every old item is reused at most once
+    QCOMPARE(diff.items, IntVector() << 0 << -1 << 1 << -1);
+}
+
+void tst_QWinJumpListSnapshot::matchedCategoriesFirst()
+{
+    // A new category must not take the items of a category that is kept as a whole.
+    const QVector<QWinJumpListItemSnapshot> items = QVector<QWinJumpListItemSnapshot>() << link(QStringLiteral("x"));
+    QWinJumpListSnapshot from;
+    from.categories << category(QWinJumpListCategory::Custom, QStringLiteral("A"), items);
+    QWinJumpListSnapshot to;
+    to.categories << category(QWinJumpListCategory::Custom, QStringLiteral("B"), items)
+                  << category(QWinJumpListCategory::Custom, QStringLiteral("A"), items);
+    const QWinJumpListDiff diff = qt_winDiffJumpLists(from, to);
+    QCOMPARE(diff.categories, IntVector() << -1 << 0);
+    QCOMPARE(diff.items, IntVector() << -1 << 0);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinJumpListSnapshot)
+
+#include "tst_qwinjumplistsnapshot.moc"
@@ -0,0 +1,12 @@
+CONFIG += testcase
+TARGET = tst_qwinpixelconversion
+QT = core core-private testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinpixelconversion.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion.cpp
+
+AVX2_SOURCES += $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion_avx2.cpp
+load(simd)
@@ -0,0 +1,280 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QVector>
+
+#include "qwinpixelconversion_p.h"
+
+static quint32 referencePremultiply(quint32 p)
+{
+    const quint32 alpha = p >> 24;
+    quint32 result = alpha << 24;
+    for (int shift = 0; shift < 24; shift += 8) {
+        const quint32 t = ((p >> shift) & 0xff) * alpha;
+        result |= ((t + (t >> 8) + 0x80) >> 8) << shift;
+    }
+    return result;
+}
+
+static quint32 referenceUnpremultiply(quint32 p)
+{
+    const quint32 alpha = p >> 24;
+    if (alpha == 0)
+        return 0;
+    quint32 result = alpha << 24;
+    for (int shift = 0; shift < 24; shift += 8) {
+        const quint32 c = ((p >> shift) & 0xff);
+        result |= qMin<quint32>((c * (0x00ff00ff / alpha) + 0x8000) >> 16, 255) << shift;
+    }
+    return result;
+}
+
+static quint32 referenceConvert(quint32 p, QWinPixelOperation operation)
+{
+    switch (operation) {
+    case QWinPixelCopy:
+        return p;
+    case QWinPixelPremultiply:
+        return referencePremultiply(p);
+    case QWinPixelUnpremultiply:
+        return referenceUnpremultiply(p);
+    case QWinPixelSwapRedBlue:
+        return (p & 0xff00ff00) | ((p & 0x00ff0000) >> 16) | ((p & 0x000000ff) << 16);
+    case QWinPixelForceOpaque:
+        return p | 0xff000000;
+    case QWinPixelFixupDibAlpha:
+        return (p >> 24) == 0 && (p & 0x00ffffff) ? (p | 0xff000000) : p;
+    }
+    return p;
+}
+
+// Random pixels with a fair share of fully opaque and fully transparent ones,
+// which take the shortcuts in the vectorized code.
+static QVector<quint32> randomPixels(int count)
+{
+    QVector<quint32> pixels(count);
+    for (int i = 0; i < count; ++i) {
+        quint32 p = (quint32(qrand() & 0xffff) << 16) | quint32(qrand() & 0xffff);
+        switch (qrand() % 4) {
+        case 0:
+            p |= 0xff000000;
+            break;
+        case 1:
+            p &= 0x00ffffff;
+            break;
+        default:
+            break;
+        }
+        pixels[i] = p;
+    }
+    return pixels;
+}
+
+Q_DECLARE_METATYPE(QWinPixelOperation)
+
+class tst_QWinPixelConversion : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void convert_data();
+    void convert();
+    void convertInPlace_data();
+    void convertInPlace();
+    void premultiplyRoundTrip();
+    void unpremultiplyAllValues();
+    void haveAlpha();
+    void convertRows_data();
+    void convertRows();
+};
+
+void tst_QWinPixelConversion::initTestCase()
+{
+    qsrand(42);
+}
+
+void tst_QWinPixelConversion::convert_data()
+{
+    QTest::addColumn<QWinPixelOperation>("operation");
+
+    QTest::newRow("copy") << QWinPixelCopy;
+    QTest::newRow("premultiply") << QWinPixelPremultiply;
+    QTest::newRow("unpremultiply") << QWinPixelUnpremultiply;
+    QTest::newRow("swapRedBlue") << QWinPixelSwapRedBlue;
+    QTest::newRow("forceOpaque") << QWinPixelForceOpaque;
+    QTest::newRow("fixupDibAlpha") << QWinPixelFixupDibAlpha;
+}
+
+void tst_QWinPixelConversion::convert()
+{
+    QFETCH(QWinPixelOperation, operation);
+
+    // All lengths around the vector widths, at all 32 bit misalignments of a 32 byte vector.
+    for (int count = 0; count < 70; ++count) {
+        for (int offset = 0; offset < 8; ++offset) {
+            const QVector<quint32> source = randomPixels(count + offset);
+            QVector<quint32> destination(count + offset, 0xdeadbeef);
+            qt_winConvertPixels(destination.data() + offset, source.constData() + offset, count, operation);
+            for (int i = 0; i < offset; ++i)
+                QCOMPARE(destination.at(i), quint32(0xdeadbeef));
+            for (int i = offset; i < count + offset; ++i) {
+                if (destination.at(i) != referenceConvert(source.at(i), operation)) {
+                    QFAIL(qPrintable(QString::fromLatin1("count %1, offset %2: %3 converted to %4 instead of %5")
+                                     .arg(count).arg(offset)
+                                     .arg(source.at(i), 8, 16, QLatin1Char('0'))
+                                     .arg(destination.at(i), 8, 16, QLatin1Char('0'))
+                                     .arg(referenceConvert(source.at(i), operation), 8, 16, QLatin1Char('0'))));
+                }
+            }
+        }
+    }
+}
+
+void tst_QWinPixelConversion::convertInPlace_data()
+{
+    convert_data();
+}
+
+void tst_QWinPixelConversion::convertInPlace()
+{
+    QFETCH(QWinPixelOperation, operation);
+
+    const QVector<quint32> source = randomPixels(1027);
+    QVector<quint32> pixels = source;
+    qt_winConvertPixels(pixels.data(), pixels.constData(), pixels.size(), operation);
+    for (int i = 0; i < source.size(); ++i)
+        QCOMPARE(pixels.at(i), referenceConvert(source.at(i), operation));
+}
+
+void tst_QWinPixelConversion::premultiplyRoundTrip()
+{
+    // Every valid premultiplied pixel survives unpremultiplying and premultiplying again.
+    QVector<quint32> premultiplied;
+    for (quint32 alpha = 0; alpha < 256; ++alpha) {
+        for (quint32 c = 0; c <= alpha; ++c)
+            premultiplied.append((alpha << 24) | (c << 16) | ((alpha - c) << 8) | (c / 2));
+    }
+    QVector<quint32> pixels(premultiplied.size());
+    qt_winUnpremultiplyPixels(pixels.data(), premultiplied.constData(), pixels.size());
+    qt_winPremultiplyPixels(pixels.data(), pixels.constData(), pixels.size());
+    for (int i = 0; i < pixels.size(); ++i)
+        QCOMPARE(pixels.at(i), premultiplied.at(i));
+}
+
+void tst_QWinPixelConversion::unpremultiplyAllValues()
+{
+    for (quint32 alpha = 0; alpha < 256; ++alpha) {
+        QVector<quint32> pixels(256);
+        for (quint32 c = 0; c < 256; ++c)
+            pixels[c] = (alpha << 24) | (c << 16) | ((255 - c) << 8) | c;
+        QVector<quint32> result(256);
+        qt_winUnpremultiplyPixels(result.data(), pixels.constData(), pixels.size());
+        for (int c = 0; c < 256; ++c)
+            QCOMPARE(result.at(c), referenceUnpremultiply(pixels.at(c)));
+    }
+}
+
+void tst_QWinPixelConversion::haveAlpha()
+{
+    for (int count = 1; count < 70; ++count) {
+        QVector<quint32> pixels(count, 0x00ffffff);
+        QVERIFY(!qt_winPixelsHaveAlpha(pixels.constData(), count));
+        for (int i = 0; i < count; ++i) {
+            pixels[i] = 0x01000000;
+            QVERIFY(qt_winPixelsHaveAlpha(pixels.constData(), count));
+            pixels[i] = 0x00ffffff;
+        }
+    }
+    QVERIFY(!qt_winPixelsHaveAlpha(0, 0));
+}
+
+void tst_QWinPixelConversion::convertRows_data()
+{
+    QTest::addColumn<int>("width");
+    QTest::addColumn<int>("height");
+    QTest::addColumn<int>("padding");
+    QTest::addColumn<bool>("flip");
+    QTest::addColumn<bool>("inPlace");
+
+    QTest::newRow("1x1") << 1 << 1 << 0 << false << false;
+    QTest::newRow("16x16") << 16 << 16 << 0 << false << false;
+    QTest::newRow("13x7-padded") << 13 << 7 << 3 << false << false;
+    QTest::newRow("16x16-flipped") << 16 << 16 << 0 << true << false;
+    QTest::newRow("13x7-padded-flipped") << 13 << 7 << 3 << true << false;
+    QTest::newRow("13x7-flipped-in-place") << 13 << 7 << 0 << true << true;
+    QTest::newRow("13x8-flipped-in-place") << 13 << 8 << 2 << true << true;
+    QTest::newRow("1x1-flipped-in-place") << 1 << 1 << 0 << true << true;
+}
+
+void tst_QWinPixelConversion::convertRows()
+{
+    QFETCH(int, width);
+    QFETCH(int, height);
+    QFETCH(int, padding);
+    QFETCH(bool, flip);
+    QFETCH(bool, inPlace);
+
+    const int stride = width + padding;
+    const int bytesPerLine = stride * int(sizeof(quint32));
+    const QVector<quint32> source = randomPixels(stride * height);
+    QVector<quint32> destination = inPlace ? source : QVector<quint32>(stride * height, 0xdeadbeef);
+
+    uchar *destinationBits = reinterpret_cast<uchar *>(destination.data());
+    const uchar *sourceBits = inPlace ? destinationBits : reinterpret_cast<const uchar *>(source.constData());
+    qt_winConvertPixelRows(destinationBits, bytesPerLine,
+                           sourceBits, bytesPerLine, width, height, QWinPixelPremultiply, flip);
+
+    for (int y = 0; y < height; ++y) {
+        const int sourceY = flip ? height - 1 - y : y;
+        for (int x = 0; x < width; ++x)
+            QCOMPARE(destination.at(y * stride + x), referencePremultiply(source.at(sourceY * stride + x)));
+        // the padding is left alone
+        for (int x = width; x < stride; ++x)
+            QCOMPARE(destination.at(y * stride + x), inPlace ? source.at(y * stride + x) : quint32(0xdeadbeef));
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinPixelConversion)
+
+#include "tst_qwinpixelconversion.moc"
@@ -0,0 +1,12 @@
+CONFIG += testcase
+TARGET = tst_qwinrecordingshellbackend
+QT = core gui testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinrecordingshellbackend.cpp \
+    $$WINEXTRAS_TEST_SOURCE_DIR/qwinrecordingshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinthumbnailtoolbarstate.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistsnapshot.cpp
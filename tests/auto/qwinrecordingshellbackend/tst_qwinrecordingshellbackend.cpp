@@ -0,0 +1,354 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinrecordingshellbackend_p.h"
+
+typedef QWinRecordingShellBackend Backend;
+
+static const qint32 failure = qint32(0x80004005); // E_FAIL
+static const quintptr window = 0x1234;
+
+static QWinJumpListItemSnapshot link(const QString &title)
+{
+    QWinJumpListItemSnapshot item;
+    item.type = QWinJumpListItem::Link;
+    item.filePath = QStringLiteral("C:/app.exe");
+    item.title = title;
+    item.arguments << QStringLiteral("--open") << title;
+    return item;
+}
+
+class tst_QWinRecordingShellBackend : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void recordsCalls();
+    void payloadSizes();
+    void latency();
+    void failures();
+    void thumbnailButtons();
+    void objectLifetime();
+    void jumpList();
+    void jumpListOutOfOrder();
+    void documents();
+    void windowAttributes();
+    void resetRecording();
+};
+
+void tst_QWinRecordingShellBackend::recordsCalls()
+{
+    Backend backend;
+    QCOMPARE(backend.totalCallCount(), 0);
+
+    QCOMPARE(backend.setProgressState(window, QWinTaskbarProgressNormal), qint32(0));
+    QCOMPARE(backend.setProgressValue(window, 3, 10), qint32(0));
+    QCOMPARE(backend.setProgressValue(window, 4, 10), qint32(0));
+    QCOMPARE(backend.setOverlayIcon(window, 42, QStringLiteral("Busy")), qint32(0));
+
+    QCOMPARE(backend.callCount(Backend::SetProgressState), 1);
+    QCOMPARE(backend.callCount(Backend::SetProgressValue), 2);
+    QCOMPARE(backend.callCount(Backend::SetOverlayIcon), 1);
+    QCOMPARE(backend.totalCallCount(), 4);
+    QCOMPARE(backend.calls(), QVector<Backend::Call>() << Backend::SetProgressState << Backend::SetProgressValue
+                                                       << Backend::SetProgressValue << Backend::SetOverlayIcon);
+
+    QCOMPARE(backend.progressState(window), QWinTaskbarProgressNormal);
+    QCOMPARE(backend.progressCompleted(window), quint64(4));
+    QCOMPARE(backend.progressTotal(window), quint64(10));
+    QCOMPARE(backend.overlayIcon(window), quintptr(42));
+    QCOMPARE(backend.overlayDescription(window), QStringLiteral("Busy"));
+    QCOMPARE(backend.progressState(window + 1), QWinTaskbarProgressNone);
+
+    QCOMPARE(Backend::callName(Backend::SetProgressValue), "SetProgressValue");
+    QCOMPARE(Backend::callName(Backend::UpdateThumbnailButtons), "ThumbBarUpdateButtons");
+    QCOMPARE(Backend::callName(Backend::ColorizationColor), "DwmGetColorizationColor");
+}
+
+void tst_QWinRecordingShellBackend::payloadSizes()
+{
+    Backend backend;
+    backend.setProgressValue(window, 1, 2);
+    QCOMPARE(backend.payloadSize(Backend::SetProgressValue), qint64(sizeof(quintptr) + 2 * sizeof(quint64)));
+
+    // strings count as UTF-16
+    backend.setOverlayIcon(window, 0, QStringLiteral("abc"));
+    backend.setOverlayIcon(window, 0, QString());
+    QCOMPARE(backend.payloadSize(Backend::SetOverlayIcon), qint64(2 * 2 * sizeof(quintptr) + 3 * 2));
+
+    QWinThumbnailButton buttons[2];
+    buttons[1].toolTip = QStringLiteral("Play");
+    backend.addThumbnailButtons(window, buttons, 2);
+    const qint64 plainButton = 3 * sizeof(quint32) + sizeof(quintptr);
+    QCOMPARE(backend.payloadSize(Backend::AddThumbnailButtons), qint64(sizeof(quintptr) + 2 * plainButton + 4 * 2));
+
+    QCOMPARE(backend.totalPayloadSize(), backend.payloadSize(Backend::SetProgressValue)
+             + backend.payloadSize(Backend::SetOverlayIcon) + backend.payloadSize(Backend::AddThumbnailButtons));
+}
+
+void tst_QWinRecordingShellBackend::latency()
+{
+    Backend backend;
+    backend.setProgressValue(window, 1, 2);
+    QVERIFY(backend.elapsed(Backend::SetProgressValue) >= 0);
+    QCOMPARE(backend.elapsed(Backend::CommitList), qint64(0));
+
+    backend.setLatency(Backend::CommitList, 5000);
+    QElapsedTimer timer;
+    timer.start();
+    backend.beginList(QString());
+    backend.commitList();
+    QVERIFY(timer.elapsed() >= 5);
+    QVERIFY(backend.elapsed(Backend::CommitList) >= qint64(5000000));
+    QVERIFY(backend.elapsed(Backend::BeginList) < qint64(5000000));
+    QVERIFY(backend.totalElapsed() >= backend.elapsed(Backend::CommitList));
+
+    backend.setLatency(0);
+    backend.resetRecording();
+    backend.commitList();
+    QVERIFY(backend.elapsed(Backend::CommitList) < qint64(5000000));
+}
+
+void tst_QWinRecordingShellBackend::failures()
+{
+    Backend backend;
+    backend.setProgressValue(window, 1, 2);
+    backend.setResult(Backend::SetProgressValue, failure);
+    QCOMPARE(backend.setProgressValue(window, 5, 10), failure);
+    QCOMPARE(backend.callCount(Backend::SetProgressValue), 2);
+    QCOMPARE(backend.progressCompleted(window), quint64(1));
+
+    backend.setResult(Backend::CreateLink, failure);
+    QCOMPARE(backend.createLink(link(QStringLiteral("a")), QString()), Backend::Object(0));
+    QCOMPARE(backend.liveObjectCount(), 0);
+
+    backend.setResult(Backend::CreateLink, 0);
+    QVERIFY(backend.createLink(link(QStringLiteral("a")), QString()));
+    QCOMPARE(backend.liveObjectCount(), 1);
+}
+
+void tst_QWinRecordingShellBackend::thumbnailButtons()
+{
+    Backend backend;
+    QWinThumbnailButton buttons[QWinThumbnailToolBarState::SlotCount];
+
+    // buttons have to be added first
+    QWinThumbnailToolBarState::resetButtons(buttons);
+    QVERIFY(backend.updateThumbnailButtons(window, buttons, 1) < 0);
+    QCOMPARE(backend.addThumbnailButtons(window, buttons, QWinThumbnailToolBarState::SlotCount), qint32(0));
+
+    QWinThumbnailToolBarState state;
+    QWinThumbnailButtonState wanted[QWinThumbnailToolBarState::SlotCount];
+    wanted[6].flags = QWinThumbnailButtonEnabled;
+    wanted[6].iconKey = 1;
+    wanted[6].toolTip = QStringLiteral("Play");
+    const int count = state.buttons(wanted, buttons);
+    QCOMPARE(count, 1);
+    buttons[0].icon = 99;
+    QCOMPARE(backend.updateThumbnailButtons(window, buttons, count), qint32(0));
+
+    const QVector<QWinThumbnailButton> sent = backend.thumbnailButtons(window);
+    QCOMPARE(sent.size(), int(QWinThumbnailToolBarState::SlotCount));
+    QCOMPARE(sent.at(5).flags, quint32(QWinThumbnailButtonHidden));
+    QCOMPARE(sent.at(6).flags, quint32(QWinThumbnailButtonEnabled));
+    QCOMPARE(sent.at(6).icon, quintptr(99));
+    QCOMPARE(sent.at(6).toolTip, QStringLiteral("Play"));
+
+    // fields not in the mask are left alone
+    state.commit(wanted);
+    wanted[6].flags = QWinThumbnailButtonDisabled;
+    QCOMPARE(state.buttons(wanted, buttons), 1);
+    backend.updateThumbnailButtons(window, buttons, 1);
+    QCOMPARE(backend.thumbnailButtons(window).at(6).flags, quint32(QWinThumbnailButtonDisabled));
+    QCOMPARE(backend.thumbnailButtons(window).at(6).icon, quintptr(99));
+    QCOMPARE(backend.thumbnailButtons(window).at(6).toolTip, QStringLiteral("Play"));
+}
+
+void tst_QWinRecordingShellBackend::objectLifetime()
+{
+    Backend backend;
+    Backend::Object objects[3];
+    objects[0] = backend.createLink(link(QStringLiteral("a")), QString());
+    objects[1] = backend.createSeparator();
+    objects[2] = backend.createDestination(QStringLiteral("C:/file.txt"));
+    QVERIFY(objects[0] && objects[1] && objects[2]);
+    QCOMPARE(backend.liveObjectCount(), 3);
+
+    // the collection keeps its objects alive
+    const Backend::Object collection = backend.createCollection(objects, 3);
+    QVERIFY(collection);
+    for (int i = 0; i < 3; ++i)
+        backend.release(objects[i]);
+    QCOMPARE(backend.liveObjectCount(), 4);
+
+    backend.addRef(collection);
+    backend.release(collection);
+    QCOMPARE(backend.liveObjectCount(), 4);
+    backend.release(collection);
+    QCOMPARE(backend.liveObjectCount(), 0);
+    QCOMPARE(backend.callCount(Backend::Release), 5);
+}
+
+void tst_QWinRecordingShellBackend::jumpList()
+{
+    Backend backend;
+    const Backend::Object task = backend.createLink(link(QStringLiteral("New")), QString());
+    const Backend::Object tasks = backend.createCollection(&task, 1);
+    const Backend::Object file = backend.createDestination(QStringLiteral("C:/file.txt"));
+    const Backend::Object files = backend.createCollection(&file, 1);
+
+    QCOMPARE(backend.beginList(QStringLiteral("Org.App")), qint32(0));
+    QCOMPARE(backend.appendKnownCategory(Backend::RecentCategory), qint32(0));
+    QCOMPARE(backend.appendCategory(QStringLiteral("Files"), files), qint32(0));
+    QCOMPARE(backend.addUserTasks(tasks), qint32(0));
+    QCOMPARE(backend.commitCount(), 0);
+    QCOMPARE(backend.commitList(), qint32(0));
+    QCOMPARE(backend.commitCount(), 1);
+
+    const QWinJumpListSnapshot &list = backend.committedList();
+    QCOMPARE(list.identifier, QStringLiteral("Org.App"));
+    QCOMPARE(list.categories.size(), 3);
+    QCOMPARE(list.categories.at(0).type, QWinJumpListCategory::Recent);
+    QCOMPARE(list.categories.at(1).type, QWinJumpListCategory::Custom);
+    QCOMPARE(list.categories.at(1).title, QStringLiteral("Files"));
+    QCOMPARE(list.categories.at(1).items.size(), 1);
+    QCOMPARE(list.categories.at(1).items.at(0).type, QWinJumpListItem::Destination);
+    QCOMPARE(list.categories.at(1).items.at(0).filePath, QStringLiteral("C:/file.txt"));
+    QCOMPARE(list.categories.at(2).type, QWinJumpListCategory::Tasks);
+    QVERIFY(list.categories.at(2).items.at(0) == link(QStringLiteral("New")));
+}
+
+void tst_QWinRecordingShellBackend::jumpListOutOfOrder()
+{
+    Backend backend;
+    QVERIFY(backend.commitList() < 0);
+    QVERIFY(backend.appendKnownCategory(Backend::FrequentCategory) < 0);
+
+    // only collections can be appended
+    const Backend::Object separator = backend.createSeparator();
+    backend.beginList(QString());
+    QVERIFY(backend.addUserTasks(separator) < 0);
+    QCOMPARE(backend.commitList(), qint32(0));
+    QVERIFY(backend.committedList().categories.isEmpty());
+    QVERIFY(backend.commitList() < 0);
+}
+
+void tst_QWinRecordingShellBackend::documents()
+{
+    Backend backend;
+    const QString appId = QStringLiteral("Org.App");
+    QWinShellDocument document;
+    document.filePath = QStringLiteral("C:/file.txt");
+    backend.setDocuments(appId, Backend::FrequentDocuments, QVector<QWinShellDocument>() << document);
+
+    QVector<QWinShellDocument> documents;
+    QCOMPARE(backend.documents(appId, Backend::RecentDocuments, &documents), qint32(0));
+    QVERIFY(documents.isEmpty());
+    QCOMPARE(backend.documents(appId, Backend::FrequentDocuments, &documents), qint32(0));
+    QCOMPARE(documents.size(), 1);
+    QCOMPARE(documents.at(0).filePath, document.filePath);
+    QCOMPARE(backend.payloadSize(Backend::Documents), qint64(2 * (2 * appId.size()) + 2 * document.filePath.size()));
+
+    QCOMPARE(backend.addRecentDocument(appId, link(QStringLiteral("a")), QStringLiteral("C:/a.ico")), qint32(0));
+    QCOMPARE(backend.documents(appId, Backend::RecentDocuments, &documents), qint32(0));
+    QCOMPARE(documents.size(), 1);
+    QCOMPARE(documents.at(0).type, QWinJumpListItem::Link);
+    QCOMPARE(documents.at(0).arguments, QStringLiteral("--open a"));
+    QCOMPARE(documents.at(0).iconPath, QStringLiteral("C:/a.ico"));
+
+    QCOMPARE(backend.clearDocuments(appId), qint32(0));
+    backend.documents(appId, Backend::RecentDocuments, &documents);
+    QVERIFY(documents.isEmpty());
+    backend.documents(appId, Backend::FrequentDocuments, &documents);
+    QVERIFY(documents.isEmpty());
+}
+
+void tst_QWinRecordingShellBackend::windowAttributes()
+{
+    Backend backend;
+    quint32 value = 1;
+    QCOMPARE(backend.setWindowAttribute(window, 12, &value, sizeof(value)), qint32(0));
+    value = 0;
+    QCOMPARE(backend.windowAttribute(window, 12, &value, sizeof(value)), qint32(0));
+    QCOMPARE(value, quint32(1));
+
+    // never set
+    value = 5;
+    QCOMPARE(backend.windowAttribute(window, 8, &value, sizeof(value)), qint32(0));
+    QCOMPARE(value, quint32(0));
+
+    bool enabled = false;
+    backend.setCompositionEnabled(true);
+    QCOMPARE(backend.isCompositionEnabled(&enabled), qint32(0));
+    QVERIFY(enabled);
+    backend.enableComposition(false);
+    backend.isCompositionEnabled(&enabled);
+    QVERIFY(!enabled);
+
+    quint32 argb = 0;
+    bool opaque = false;
+    backend.setColorization(0xff336699, true);
+    QCOMPARE(backend.colorizationColor(&argb, &opaque), qint32(0));
+    QCOMPARE(argb, quint32(0xff336699));
+    QVERIFY(opaque);
+}
+
+void tst_QWinRecordingShellBackend::resetRecording()
+{
+    Backend backend;
+    backend.setProgressValue(window, 1, 2);
+    backend.createSeparator();
+    backend.resetRecording();
+    QCOMPARE(backend.totalCallCount(), 0);
+    QCOMPARE(backend.totalPayloadSize(), qint64(0));
+    QCOMPARE(backend.totalElapsed(), qint64(0));
+    QVERIFY(backend.calls().isEmpty());
+
+    // the state of the shell is kept
+    QCOMPARE(backend.progressCompleted(window), quint64(1));
+    QCOMPARE(backend.liveObjectCount(), 1);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinRecordingShellBackend)
+
+#include "tst_qwinrecordingshellbackend.moc"
@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwinregiondata
+QT = core gui testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinregiondata.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinregiondata.cpp
@@ -0,0 +1,220 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtGui/QRegion>
+
+#include "qwinregiondata_p.h"
+
+// A grid of cells, every other one set: one band per row with many rects each.
+static QRegion checkerboard(int columns, int rows, int cellSize = 4)
+{
+    QVector<QRect> rects;
+    for (int row = 0; row < rows; ++row) {
+        for (int column = row % 2; column < columns; column += 2)
+            rects.append(QRect(column * cellSize, row * cellSize, cellSize, cellSize));
+    }
+    QRegion region;
+    region.setRects(rects.constData(), rects.size());
+    return region;
+}
+
+// Writes \a rects as RGNDATA, in the given order and without any merging.
+static QVector<quint32> regionData(const QVector<QRect> &rects)
+{
+    QVector<quint32> buffer(qt_winRegionDataSize(rects.size()) / sizeof(quint32));
+    QWinRegionDataHeader *header = reinterpret_cast<QWinRegionDataHeader *>(buffer.data());
+    header->dwSize = sizeof(QWinRegionDataHeader);
+    header->iType = QWinRegionDataRectangles;
+    header->nCount = rects.size();
+    header->nRgnSize = rects.size() * sizeof(QWinRegionRect);
+    QWinRegionRect *out = reinterpret_cast<QWinRegionRect *>(header + 1);
+    for (int i = 0; i < rects.size(); ++i) {
+        out[i].left = rects.at(i).left();
+        out[i].top = rects.at(i).top();
+        out[i].right = rects.at(i).right() + 1;
+        out[i].bottom = rects.at(i).bottom() + 1;
+    }
+    return buffer;
+}
+
+typedef QVector<QRect> RectVector;
+Q_DECLARE_METATYPE(RectVector)
+
+class tst_QWinRegionData : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void encode_data();
+    void encode();
+    void roundTrip_data();
+    void roundTrip();
+    void decode_data();
+    void decode();
+    void decodeInvalid();
+};
+
+void tst_QWinRegionData::encode_data()
+{
+    QTest::addColumn<QRegion>("region");
+
+    QTest::newRow("empty") << QRegion();
+    QTest::newRow("rect") << QRegion(10, 20, 30, 40);
+    QTest::newRow("negative") << QRegion(-100, -50, 30, 40);
+    QTest::newRow("ellipse") << QRegion(0, 0, 200, 100, QRegion::Ellipse);
+    QTest::newRow("disjoint") << (QRegion(0, 0, 10, 10) + QRegion(20, 5, 10, 10) + QRegion(3, 40, 1, 1));
+    QTest::newRow("checkerboard-10k") << checkerboard(200, 100);
+}
+
+void tst_QWinRegionData::encode()
+{
+    QFETCH(QRegion, region);
+
+    QWinRegionDataBuffer buffer;
+    qt_winRegionToRegionData(region, &buffer);
+
+    const QVector<QRect> rects = region.rects();
+    QVERIFY(int(buffer.size() * sizeof(quint32)) >= qt_winRegionDataSize(rects.size()));
+
+    const QWinRegionDataHeader *header = qt_winRegionDataHeader(buffer.constData());
+    QCOMPARE(header->dwSize, quint32(sizeof(QWinRegionDataHeader)));
+    QCOMPARE(header->iType, quint32(QWinRegionDataRectangles));
+    QCOMPARE(int(header->nCount), rects.size());
+    QCOMPARE(int(header->nRgnSize), int(rects.size() * sizeof(QWinRegionRect)));
+
+    // GDI rectangles exclude their right and bottom edges
+    if (!rects.isEmpty()) {
+        const QRect bounds = region.boundingRect();
+        QCOMPARE(header->rcBound.left, bounds.left());
+        QCOMPARE(header->rcBound.top, bounds.top());
+        QCOMPARE(header->rcBound.right, bounds.right() + 1);
+        QCOMPARE(header->rcBound.bottom, bounds.bottom() + 1);
+    }
+
+    const QWinRegionRect *encoded = qt_winRegionDataRects(buffer.constData());
+    for (int i = 0; i < rects.size(); ++i) {
+        const QRect rect(encoded[i].left, encoded[i].top,
+                         encoded[i].right - encoded[i].left, encoded[i].bottom - encoded[i].top);
+        QCOMPARE(rect, rects.at(i));
+        // y-x banded: sorted by top, then by left within a band
+        if (i > 0) {
+            QVERIFY(encoded[i].top >= encoded[i - 1].top);
+            if (encoded[i].top == encoded[i - 1].top)
+                QVERIFY(encoded[i].left >= encoded[i - 1].right);
+        }
+    }
+}
+
+void tst_QWinRegionData::roundTrip_data()
+{
+    encode_data();
+}
+
+void tst_QWinRegionData::roundTrip()
+{
+    QFETCH(QRegion, region);
+
+    QWinRegionDataBuffer buffer;
+    qt_winRegionToRegionData(region, &buffer);
+    const QRegion decoded = qt_winRegionFromRegionData(buffer.constData(), qt_winRegionDataSize(region.rectCount()));
+    QCOMPARE(decoded, region);
+    QCOMPARE(decoded.rects(), region.rects());
+}
+
+void tst_QWinRegionData::decode_data()
+{
+    QTest::addColumn<RectVector>("rects");
+
+    QTest::newRow("none") << RectVector();
+    QTest::newRow("band") << (RectVector() << QRect(0, 0, 10, 10) << QRect(20, 0, 10, 10));
+    QTest::newRow("touching in band") << (RectVector() << QRect(0, 0, 10, 10) << QRect(10, 0, 10, 10));
+    QTest::newRow("stacked bands") << (RectVector() << QRect(0, 0, 10, 10) << QRect(20, 0, 10, 10)
+                                       << QRect(0, 10, 10, 10) << QRect(20, 10, 10, 10));
+    QTest::newRow("separate bands") << (RectVector() << QRect(0, 0, 10, 10) << QRect(0, 11, 10, 10));
+    QTest::newRow("different bands") << (RectVector() << QRect(0, 0, 10, 10) << QRect(0, 10, 12, 10)
+                                         << QRect(0, 20, 12, 10));
+    QTest::newRow("empty rects") << (RectVector() << QRect(5, 5, 0, 4) << QRect(0, 0, 3, 3));
+    QTest::newRow("overlapping") << (RectVector() << QRect(0, 0, 10, 10) << QRect(5, 5, 10, 10));
+    QTest::newRow("unsorted") << (RectVector() << QRect(20, 0, 10, 10) << QRect(0, 0, 10, 10));
+    QTest::newRow("unbanded") << (RectVector() << QRect(0, 0, 10, 10) << QRect(20, 0, 10, 20));
+}
+
+void tst_QWinRegionData::decode()
+{
+    QFETCH(RectVector, rects);
+
+    QRegion expected;
+    foreach (const QRect &rect, rects)
+        expected += rect;
+
+    const QVector<quint32> buffer = regionData(rects);
+    const QRegion decoded = qt_winRegionFromRegionData(buffer.constData(), buffer.size() * sizeof(quint32));
+    QCOMPARE(decoded, expected);
+    QCOMPARE(decoded.rects(), expected.rects());
+}
+
+void tst_QWinRegionData::decodeInvalid()
+{
+    const QVector<quint32> valid = regionData(RectVector() << QRect(0, 0, 10, 10) << QRect(0, 20, 10, 10));
+    const int size = valid.size() * sizeof(quint32);
+    QCOMPARE(qt_winRegionFromRegionData(valid.constData(), size).rectCount(), 2);
+
+    // truncated
+    QVERIFY(qt_winRegionFromRegionData(valid.constData(), size - 1).isEmpty());
+    QVERIFY(qt_winRegionFromRegionData(valid.constData(), sizeof(QWinRegionDataHeader) - 1).isEmpty());
+
+    QVector<quint32> invalid = valid;
+    reinterpret_cast<QWinRegionDataHeader *>(invalid.data())->iType = 0;
+    QVERIFY(qt_winRegionFromRegionData(invalid.constData(), size).isEmpty());
+
+    invalid = valid;
+    reinterpret_cast<QWinRegionDataHeader *>(invalid.data())->nCount = 0x7fffffff;
+    QVERIFY(qt_winRegionFromRegionData(invalid.constData(), size).isEmpty());
+
+    invalid = valid;
+    reinterpret_cast<QWinRegionDataHeader *>(invalid.data())->dwSize = size + 4;
+    QVERIFY(qt_winRegionFromRegionData(invalid.constData(), size).isEmpty());
+}
+
+QTEST_APPLESS_MAIN(tst_QWinRegionData)
+
+#include "tst_qwinregiondata.moc"
@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwinshellexecutor
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinshellexecutor.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinshellexecutor.cpp
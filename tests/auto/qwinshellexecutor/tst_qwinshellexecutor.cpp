@@ -0,0 +1,259 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinshellexecutor_p.h"
+
+// Records where and in which order the jobs run and finish.
+struct Log
+{
+    QMutex mutex;
+    QStringList runs;
+    QStringList finishes;
+    QSet<QThread *> runThreads;
+    QSet<QThread *> finishThreads;
+};
+
+class LoggingJob : public QWinShellJob
+{
+public:
+    LoggingJob(Log *log, const QString &name, int usecs = 0) : m_log(log), m_name(name), m_usecs(usecs) {}
+
+    void run() Q_DECL_OVERRIDE
+    {
+        if (m_usecs)
+            QThread::usleep(m_usecs);
+        QMutexLocker locker(&m_log->mutex);
+        m_log->runs.append(m_name);
+        m_log->runThreads.insert(QThread::currentThread());
+    }
+
+    void finish() Q_DECL_OVERRIDE
+    {
+        QMutexLocker locker(&m_log->mutex);
+        m_log->finishes.append(m_name);
+        m_log->finishThreads.insert(QThread::currentThread());
+    }
+
+private:
+    Log *m_log;
+    const QString m_name;
+    const int m_usecs;
+};
+
+class CountingJob : public QWinShellJob
+{
+public:
+    explicit CountingJob(QAtomicInt *count) : m_count(count) {}
+
+    void run() Q_DECL_OVERRIDE { m_count->ref(); }
+
+private:
+    QAtomicInt *m_count;
+};
+
+class tst_QWinShellExecutor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void synchronous();
+    void runsInOrderOnShellThread();
+    void postDoesNotWait();
+    void finishesOnPostingThread();
+    void call();
+    void cancel();
+    void cancelAfterRun();
+    void destructionRunsQueuedJobs();
+    void sharedExecutor();
+};
+
+void tst_QWinShellExecutor::synchronous()
+{
+    QWinShellExecutor executor(QWinShellExecutor::Synchronous);
+    QCOMPARE(executor.mode(), QWinShellExecutor::Synchronous);
+    QVERIFY(!executor.shellThread());
+
+    Log log;
+    executor.post(new LoggingJob(&log, QStringLiteral("a")));
+    QCOMPARE(log.runs, QStringList(QStringLiteral("a")));
+    QCOMPARE(log.finishes, QStringList(QStringLiteral("a")));
+    QCOMPARE(log.runThreads, QSet<QThread *>() << QThread::currentThread());
+    QCOMPARE(executor.pendingCount(), 0);
+
+    LoggingJob job(&log, QStringLiteral("b"));
+    executor.call(&job);
+    QCOMPARE(log.finishes, QStringList() << QStringLiteral("a") << QStringLiteral("b"));
+}
+
+void tst_QWinShellExecutor::runsInOrderOnShellThread()
+{
+    QWinShellExecutor executor;
+    QCOMPARE(executor.mode(), QWinShellExecutor::Threaded);
+    QVERIFY(executor.shellThread());
+    QVERIFY(executor.shellThread() != QThread::currentThread());
+
+    Log log;
+    QStringList names;
+    for (int i = 0; i < 50; ++i) {
+        names.append(QString::number(i));
+        executor.post(new LoggingJob(&log, names.last(), i % 3 ? 0 : 100));
+    }
+    executor.waitForDone();
+    QCOMPARE(log.runs, names);
+    QCOMPARE(log.finishes, names);
+    QCOMPARE(log.runThreads, QSet<QThread *>() << executor.shellThread());
+    QCOMPARE(executor.pendingCount(), 0);
+}
+
+// Posting a job costs the same, however slow the job is.
+void tst_QWinShellExecutor::postDoesNotWait()
+{
+    QWinShellExecutor executor;
+    Log log;
+    QElapsedTimer timer;
+    timer.start();
+    executor.post(new LoggingJob(&log, QStringLiteral("slow"), 200000));
+    executor.post(new LoggingJob(&log, QStringLiteral("after")));
+    QVERIFY2(timer.elapsed() < 100, QByteArray::number(timer.elapsed()));
+    QCOMPARE(executor.pendingCount(), 2);
+
+    executor.waitForDone();
+    QVERIFY(timer.elapsed() >= 200);
+    QCOMPARE(log.runs, QStringList() << QStringLiteral("slow") << QStringLiteral("after"));
+}
+
+void tst_QWinShellExecutor::finishesOnPostingThread()
+{
+    QWinShellExecutor executor;
+    Log log;
+    executor.post(new LoggingJob(&log, QStringLiteral("a")));
+    QTRY_COMPARE(log.finishes, QStringList(QStringLiteral("a")));
+    QCOMPARE(log.finishThreads, QSet<QThread *>() << QThread::currentThread());
+    QCOMPARE(executor.pendingCount(), 0);
+}
+
+// A blocking call runs after the jobs posted before it, but does not
+// finish them.
+void tst_QWinShellExecutor::call()
+{
+    QWinShellExecutor executor;
+    Log log;
+    executor.post(new LoggingJob(&log, QStringLiteral("posted"), 50000));
+    LoggingJob job(&log, QStringLiteral("called"));
+    executor.call(&job);
+    QCOMPARE(log.runs, QStringList() << QStringLiteral("posted") << QStringLiteral("called"));
+    QCOMPARE(log.finishes, QStringList(QStringLiteral("called")));
+    QCOMPARE(log.runThreads, QSet<QThread *>() << executor.shellThread());
+
+    executor.waitForDone();
+    QCOMPARE(log.finishes, QStringList() << QStringLiteral("called") << QStringLiteral("posted"));
+}
+
+void tst_QWinShellExecutor::cancel()
+{
+    QWinShellExecutor executor;
+    Log log;
+    int owner1 = 0;
+    int owner2 = 0;
+    executor.post(new LoggingJob(&log, QStringLiteral("1a"), 50000), &owner1);
+    executor.post(new LoggingJob(&log, QStringLiteral("2"), 0), &owner2);
+    executor.post(new LoggingJob(&log, QStringLiteral("1b"), 0), &owner1);
+    executor.post(new LoggingJob(&log, QStringLiteral("none"), 0));
+    executor.cancel(&owner1);
+    executor.cancel(0);
+    executor.waitForDone();
+
+    // cancelled jobs still run
+    QCOMPARE(log.runs, QStringList() << QStringLiteral("1a") << QStringLiteral("2") << QStringLiteral("1b") << QStringLiteral("none"));
+    QCOMPARE(log.finishes, QStringList() << QStringLiteral("2") << QStringLiteral("none"));
+    QCOMPARE(executor.pendingCount(), 0);
+
+    // later jobs of the owner are not affected
+    executor.post(new LoggingJob(&log, QStringLiteral("1c")), &owner1);
+    executor.waitForDone();
+    QCOMPARE(log.finishes.last(), QStringLiteral("1c"));
+}
+
+void tst_QWinShellExecutor::cancelAfterRun()
+{
+    QWinShellExecutor executor;
+    Log log;
+    int owner = 0;
+    executor.post(new LoggingJob(&log, QStringLiteral("a")), &owner);
+    LoggingJob barrier(&log, QStringLiteral("barrier"));
+    executor.call(&barrier);
+    QCOMPARE(log.runs, QStringList() << QStringLiteral("a") << QStringLiteral("barrier"));
+
+    executor.cancel(&owner);
+    QCoreApplication::processEvents();
+    QCOMPARE(log.finishes, QStringList(QStringLiteral("barrier")));
+    QCOMPARE(executor.pendingCount(), 0);
+}
+
+void tst_QWinShellExecutor::destructionRunsQueuedJobs()
+{
+    QAtomicInt count;
+    Log log;
+    {
+        QWinShellExecutor executor;
+        executor.post(new LoggingJob(&log, QStringLiteral("slow"), 50000));
+        for (int i = 0; i < 10; ++i)
+            executor.post(new CountingJob(&count));
+    }
+    QCOMPARE(count.load(), 10);
+    QCOMPARE(log.finishes, QStringList(QStringLiteral("slow")));
+}
+
+void tst_QWinShellExecutor::sharedExecutor()
+{
+    QWinShellExecutor *executor = qt_winShellExecutor();
+    QVERIFY(executor);
+    QCOMPARE(qt_winShellExecutor(), executor);
+    QCOMPARE(executor->parent(), QCoreApplication::instance());
+    QCOMPARE(executor->mode(), qgetenv("QT_WINEXTRAS_SHELL_THREAD") == "0"
+             ? QWinShellExecutor::Synchronous : QWinShellExecutor::Threaded);
+}
+
+QTEST_GUILESS_MAIN(tst_QWinShellExecutor)
+
+#include "tst_qwinshellexecutor.moc"
@@ -0,0 +1,15 @@
+CONFIG += testcase
+TARGET = tst_qwinshellmetrics
+QT = core gui testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinshellmetrics.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinshellmetrics.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwininstrumentedshellbackend.cpp \
+    $$WINEXTRAS_TEST_SOURCE_DIR/qwinrecordingshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinthumbnailtoolbarstate.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistsnapshot.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresult.cpp
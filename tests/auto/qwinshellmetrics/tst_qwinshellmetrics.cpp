@@ -0,0 +1,292 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinshellmetrics_p.h"
+#include "qwininstrumentedshellbackend_p.h"
+#include "qwinrecordingshellbackend_p.h"
+
+typedef QWinShellBackend Backend;
+
+static const qint32 failure = qint32(0x80004005); // E_FAIL
+static const qint32 accessDenied = qint32(0x80070005); // E_ACCESSDENIED
+static const quintptr window = 0x1234;
+
+class tst_QWinShellMetrics : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void bucket_data();
+    void bucket();
+    void bucketLimit();
+    void record();
+    void reset();
+    void disabled();
+    void enabled();
+    void failedObjects();
+    void latency();
+    void toJson();
+};
+
+void tst_QWinShellMetrics::bucket_data()
+{
+    QTest::addColumn<qint64>("nsecs");
+    QTest::addColumn<int>("bucket");
+
+    QTest::newRow("zero") << qint64(0) << 0;
+    QTest::newRow("negative") << qint64(-5) << 0;
+    QTest::newRow("999ns") << qint64(999) << 0;
+    QTest::newRow("1us") << qint64(1000) << 1;
+    QTest::newRow("1.9us") << qint64(1999) << 1;
+    QTest::newRow("2us") << qint64(2000) << 2;
+    QTest::newRow("3.9us") << qint64(3999) << 2;
+    QTest::newRow("4us") << qint64(4000) << 3;
+    QTest::newRow("1ms") << qint64(1000000) << 10;
+    QTest::newRow("1s") << qint64(1000000000) << 20;
+    QTest::newRow("1min") << Q_INT64_C(60000000000) << int(QWinShellMetrics::BucketCount - 1);
+}
+
+void tst_QWinShellMetrics::bucket()
+{
+    QFETCH(qint64, nsecs);
+    QFETCH(int, bucket);
+
+    QCOMPARE(QWinShellMetrics::bucket(nsecs), bucket);
+}
+
+void tst_QWinShellMetrics::bucketLimit()
+{
+    QCOMPARE(QWinShellMetrics::bucketLimit(0), qint64(1));
+    QCOMPARE(QWinShellMetrics::bucketLimit(1), qint64(2));
+    QCOMPARE(QWinShellMetrics::bucketLimit(10), qint64(1024));
+    QCOMPARE(QWinShellMetrics::bucketLimit(QWinShellMetrics::BucketCount - 1), qint64(-1));
+
+    // every bucket but the last ends where the next one starts
+    for (int i = 0; i < QWinShellMetrics::BucketCount - 1; ++i) {
+        QCOMPARE(QWinShellMetrics::bucket(QWinShellMetrics::bucketLimit(i) * 1000 - 1), i);
+        QCOMPARE(QWinShellMetrics::bucket(QWinShellMetrics::bucketLimit(i) * 1000), i + 1);
+    }
+}
+
+void tst_QWinShellMetrics::record()
+{
+    QWinShellMetrics metrics;
+    metrics.record(Backend::CommitList, 0, 1500);
+    metrics.record(Backend::CommitList, failure, 3000);
+    metrics.record(Backend::CommitList, failure, 500);
+    metrics.record(Backend::CommitList, accessDenied, 2500);
+    metrics.record(Backend::SetProgressValue, 1, 100); // S_FALSE succeeded
+
+    QCOMPARE(metrics.callCount(Backend::CommitList), 4);
+    QCOMPARE(metrics.failureCount(Backend::CommitList), 3);
+    QCOMPARE(metrics.elapsed(Backend::CommitList), qint64(7500));
+    QCOMPARE(metrics.failures(Backend::CommitList).value(failure), 2);
+    QCOMPARE(metrics.failures(Backend::CommitList).value(accessDenied), 1);
+    QCOMPARE(metrics.failures(Backend::CommitList).size(), 2);
+
+    QVector<int> histogram = metrics.histogram(Backend::CommitList);
+    QCOMPARE(histogram.size(), int(QWinShellMetrics::BucketCount));
+    QCOMPARE(histogram.at(0), 1);
+    QCOMPARE(histogram.at(1), 1);
+    QCOMPARE(histogram.at(2), 2);
+    QCOMPARE(histogram.at(3), 0);
+
+    QCOMPARE(metrics.callCount(Backend::SetProgressValue), 1);
+    QCOMPARE(metrics.failureCount(Backend::SetProgressValue), 0);
+    QCOMPARE(metrics.callCount(Backend::BeginList), 0);
+}
+
+void tst_QWinShellMetrics::reset()
+{
+    QWinShellMetrics metrics;
+    metrics.setEnabled(true);
+    metrics.record(Backend::CommitList, failure, 1500);
+    metrics.reset();
+
+    QCOMPARE(metrics.callCount(Backend::CommitList), 0);
+    QCOMPARE(metrics.failureCount(Backend::CommitList), 0);
+    QVERIFY(metrics.failures(Backend::CommitList).isEmpty());
+    QCOMPARE(metrics.elapsed(Backend::CommitList), qint64(0));
+    QCOMPARE(metrics.histogram(Backend::CommitList).count(0), int(QWinShellMetrics::BucketCount));
+    QVERIFY(metrics.isEnabled());
+}
+
+void tst_QWinShellMetrics::disabled()
+{
+    QWinRecordingShellBackend native;
+    QWinShellMetrics metrics;
+    metrics.setEnabled(false);
+    QWinInstrumentedShellBackend backend(&native, &metrics);
+    native.setResult(Backend::CommitList, failure);
+
+    QCOMPARE(backend.setProgressValue(window, 3, 10), qint32(0));
+    QCOMPARE(backend.beginList(QString()), qint32(0));
+    QCOMPARE(backend.commitList(), failure);
+    const Backend::Object separator = backend.createSeparator();
+    QVERIFY(separator);
+    backend.release(separator);
+
+    // passed on, but not recorded
+    QCOMPARE(native.progressCompleted(window), quint64(3));
+    QCOMPARE(native.totalCallCount(), 5);
+    QCOMPARE(native.liveObjectCount(), 0);
+    for (int i = 0; i < Backend::CallCount; ++i)
+        QCOMPARE(metrics.callCount(Backend::Call(i)), 0);
+}
+
+void tst_QWinShellMetrics::enabled()
+{
+    QWinRecordingShellBackend native;
+    QWinShellMetrics metrics;
+    metrics.setEnabled(true);
+    QWinInstrumentedShellBackend backend(&native, &metrics);
+    native.setResult(Backend::CommitList, failure);
+
+    QCOMPARE(backend.setProgressValue(window, 3, 10), qint32(0));
+    QCOMPARE(backend.setProgressValue(window, 4, 10), qint32(0));
+    QCOMPARE(backend.beginList(QString()), qint32(0));
+    QCOMPARE(backend.commitList(), failure);
+    const Backend::Object separator = backend.createSeparator();
+    QVERIFY(separator);
+    backend.addRef(separator);
+    backend.release(separator);
+    backend.release(separator);
+    bool composition = false;
+    QCOMPARE(backend.isCompositionEnabled(&composition), qint32(0));
+    QVERIFY(composition);
+
+    QCOMPARE(native.progressCompleted(window), quint64(4));
+    QCOMPARE(native.liveObjectCount(), 0);
+    for (int i = 0; i < Backend::CallCount; ++i)
+        QCOMPARE(metrics.callCount(Backend::Call(i)), native.callCount(Backend::Call(i)));
+    QCOMPARE(metrics.callCount(Backend::SetProgressValue), 2);
+    QCOMPARE(metrics.callCount(Backend::Release), 2);
+    QCOMPARE(metrics.failureCount(Backend::SetProgressValue), 0);
+    QCOMPARE(metrics.failureCount(Backend::CommitList), 1);
+    QCOMPARE(metrics.failures(Backend::CommitList).value(failure), 1);
+
+    // disabling stops the recording, but keeps what was recorded
+    metrics.setEnabled(false);
+    backend.setProgressValue(window, 5, 10);
+    QCOMPARE(metrics.callCount(Backend::SetProgressValue), 2);
+    QCOMPARE(native.callCount(Backend::SetProgressValue), 3);
+}
+
+void tst_QWinShellMetrics::failedObjects()
+{
+    QWinRecordingShellBackend native;
+    QWinShellMetrics metrics;
+    metrics.setEnabled(true);
+    QWinInstrumentedShellBackend backend(&native, &metrics);
+    native.setResult(Backend::CreateLink, failure);
+
+    QCOMPARE(backend.createLink(QWinJumpListItemSnapshot(), QString()), Backend::Object(0));
+    QCOMPARE(metrics.failureCount(Backend::CreateLink), 1);
+    QCOMPARE(metrics.failures(Backend::CreateLink).value(failure), 1);
+
+    const Backend::Object destination = backend.createDestination(QStringLiteral("C:/file.txt"));
+    QVERIFY(destination);
+    QCOMPARE(metrics.failureCount(Backend::CreateDestination), 0);
+    backend.release(destination);
+}
+
+void tst_QWinShellMetrics::latency()
+{
+    QWinRecordingShellBackend native;
+    QWinShellMetrics metrics;
+    metrics.setEnabled(true);
+    QWinInstrumentedShellBackend backend(&native, &metrics);
+    native.setLatency(Backend::CommitList, 5000);
+
+    backend.beginList(QString());
+    backend.commitList();
+
+    QVERIFY(metrics.elapsed(Backend::CommitList) >= 5000000);
+    const QVector<int> histogram = metrics.histogram(Backend::CommitList);
+    const int slowest = QWinShellMetrics::bucket(5000000);
+    QCOMPARE(histogram.mid(0, slowest).count(0), slowest);
+    QCOMPARE(histogram.mid(slowest).count(1), 1);
+}
+
+void tst_QWinShellMetrics::toJson()
+{
+    QWinShellMetrics metrics;
+    metrics.setEnabled(true);
+    metrics.record(Backend::CommitList, 0, 1500);
+    metrics.record(Backend::CommitList, accessDenied, 2500);
+    metrics.record(Backend::CommitList, failure, 2500);
+    metrics.record(Backend::ExtendFrameIntoClientArea, 0, 300);
+
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(metrics.toJson(), &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    const QJsonObject root = document.object();
+    QCOMPARE(root.value(QStringLiteral("enabled")).toBool(), true);
+
+    const QJsonArray limits = root.value(QStringLiteral("bucketLimits")).toArray();
+    QCOMPARE(limits.size(), int(QWinShellMetrics::BucketCount));
+    QCOMPARE(limits.at(0).toDouble(), 1.0);
+    QCOMPARE(limits.at(limits.size() - 1).toDouble(), -1.0);
+
+    const QJsonObject calls = root.value(QStringLiteral("calls")).toObject();
+    QCOMPARE(calls.keys(), QStringList() << QStringLiteral("CommitList") << QStringLiteral("DwmExtendFrameIntoClientArea"));
+
+    const QJsonObject commitList = calls.value(QStringLiteral("CommitList")).toObject();
+    QCOMPARE(commitList.value(QStringLiteral("count")).toDouble(), 3.0);
+    QCOMPARE(commitList.value(QStringLiteral("failureCount")).toDouble(), 2.0);
+    QCOMPARE(commitList.value(QStringLiteral("elapsed")).toDouble(), 6500.0);
+    QCOMPARE(commitList.value(QStringLiteral("histogram")).toArray().size(), int(QWinShellMetrics::BucketCount));
+
+    // sorted by HRESULT
+    const QJsonArray failures = commitList.value(QStringLiteral("failures")).toArray();
+    QCOMPARE(failures.size(), 2);
+    QCOMPARE(failures.at(0).toObject().value(QStringLiteral("hresult")).toString(), QStringLiteral("0x80004005"));
+    QCOMPARE(failures.at(0).toObject().value(QStringLiteral("name")).toString(), QStringLiteral("E_FAIL"));
+    QCOMPARE(failures.at(0).toObject().value(QStringLiteral("count")).toDouble(), 1.0);
+    QCOMPARE(failures.at(1).toObject().value(QStringLiteral("hresult")).toString(), QStringLiteral("0x80070005"));
+    QCOMPARE(failures.at(1).toObject().value(QStringLiteral("name")).toString(), QStringLiteral("E_ACCESSDENIED"));
+}
+
+QTEST_APPLESS_MAIN(tst_QWinShellMetrics)
+
+#include "tst_qwinshellmetrics.moc"
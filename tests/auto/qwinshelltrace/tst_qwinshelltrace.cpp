@@ -0,0 +1,524 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QBuffer>
+#include <QtCore/QTemporaryDir>
+
+#include "qwinshelltrace_p.h"
+#include "qwinshelltracereplayer_p.h"
+#include "qwinrecordingshellbackend_p.h"
+#include "qwiniconstore_p.h"
+
+typedef QWinRecordingShellBackend Backend;
+
+static QWinShellTraceEvent progressEvent(qint64 time, quint32 target, quint64 completed, quint64 total = 1000,
+                                         QWinTaskbarProgressState state = QWinTaskbarProgressNormal)
+{
+    QWinShellTraceEvent event;
+    event.type = QWinShellTraceEvent::Progress;
+    event.time = time;
+    event.target = target;
+    event.state = state;
+    event.completed = completed;
+    event.total = total;
+    return event;
+}
+
+static QWinShellTraceEvent intervalEvent(qint64 time, quint32 target, int msecs)
+{
+    QWinShellTraceEvent event;
+    event.type = QWinShellTraceEvent::ProgressInterval;
+    event.time = time;
+    event.target = target;
+    event.interval = msecs;
+    return event;
+}
+
+static QWinShellTraceEvent overlayEvent(qint64 time, quint32 target, qint64 iconKey, const QString &description)
+{
+    QWinShellTraceEvent event;
+    event.type = QWinShellTraceEvent::Overlay;
+    event.time = time;
+    event.target = target;
+    event.iconKey = iconKey;
+    event.description = description;
+    return event;
+}
+
+// A play and a stop button in the two rightmost slots.
+static QWinShellTraceEvent buttonsEvent(qint64 time, quint32 target, bool playing)
+{
+    QWinShellTraceEvent event;
+    event.type = QWinShellTraceEvent::ThumbnailButtons;
+    event.time = time;
+    event.target = target;
+    event.buttons.resize(QWinThumbnailToolBarState::SlotCount);
+    QWinThumbnailButtonState &play = event.buttons[QWinThumbnailToolBarState::SlotCount - 2];
+    play.flags = QWinThumbnailButtonEnabled;
+    play.iconKey = playing ? 11 : 12;
+    play.toolTip = playing ? QStringLiteral("Pause") : QStringLiteral("Play");
+    QWinThumbnailButtonState &stop = event.buttons[QWinThumbnailToolBarState::SlotCount - 1];
+    stop.flags = playing ? QWinThumbnailButtonEnabled : QWinThumbnailButtonDisabled;
+    stop.iconKey = 13;
+    stop.toolTip = QStringLiteral("Stop");
+    return event;
+}
+
+static QWinShellTraceEvent jumpListEvent(qint64 time, quint32 target, int recentCount)
+{
+    QWinShellTraceEvent event;
+    event.type = QWinShellTraceEvent::JumpList;
+    event.time = time;
+    event.target = target;
+    event.jumpList.identifier = QStringLiteral("Org.Player");
+
+    QWinJumpListCategorySnapshot playlists;
+    playlists.title = QStringLiteral("Playlists");
+    for (int i = 0; i < recentCount; ++i) {
+        QWinJumpListItemSnapshot item;
+        item.type = QWinJumpListItem::Link;
+        item.filePath = QStringLiteral("C:/Player/player.exe");
+        item.title = QStringLiteral("Playlist %1").arg(i);
+        item.arguments << QStringLiteral("--playlist") << QString::number(i);
+        item.iconKey = 100 + i;
+        playlists.items.append(item);
+    }
+    QWinJumpListItemSnapshot separator;
+    separator.type = QWinJumpListItem::Separator;
+    playlists.items.append(separator);
+    event.jumpList.categories.append(playlists);
+
+    QWinJumpListCategorySnapshot recent;
+    recent.type = QWinJumpListCategory::Recent;
+    event.jumpList.categories.append(recent);
+    return event;
+}
+
+// ToolbarAdded, ToolbarCleared and Destroyed only have a target.
+static QWinShellTraceEvent targetEvent(QWinShellTraceEvent::Type type, qint64 time, quint32 target)
+{
+    QWinShellTraceEvent event;
+    event.type = type;
+    event.time = time;
+    event.target = target;
+    return event;
+}
+
+static QByteArray encode(const QVector<QWinShellTraceEvent> &events)
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    QWinShellTraceWriter writer(&buffer);
+    foreach (const QWinShellTraceEvent &event, events)
+        writer.write(event);
+    return buffer.data();
+}
+
+static void compareEvents(const QWinShellTraceEvent &actual, const QWinShellTraceEvent &expected)
+{
+    QCOMPARE(actual.type, expected.type);
+    QCOMPARE(actual.time, expected.time);
+    QCOMPARE(actual.target, expected.target);
+    QCOMPARE(actual.state, expected.state);
+    QCOMPARE(actual.completed, expected.completed);
+    QCOMPARE(actual.total, expected.total);
+    QCOMPARE(actual.interval, expected.interval);
+    QCOMPARE(actual.iconKey, expected.iconKey);
+    QCOMPARE(actual.description, expected.description);
+    QCOMPARE(actual.buttons.size(), expected.buttons.size());
+    for (int i = 0; i < expected.buttons.size(); ++i)
+        QCOMPARE(qt_winThumbnailButtonChanges(actual.buttons.at(i), expected.buttons.at(i)), quint32(0));
+    QVERIFY(actual.jumpList == expected.jumpList);
+}
+
+class tst_QWinShellTrace : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void roundTrip();
+    void strings();
+    void compactProgress();
+    void writerTargets();
+    void destroyedTargets();
+    void corrupt_data();
+    void corrupt();
+    void replayProgress();
+    void replayOverlay();
+    void replayThumbnailButtons();
+    void replayToolbarReset();
+    void replayDestroyed();
+    void replayJumpList();
+    void replayTrace();
+};
+
+void tst_QWinShellTrace::roundTrip()
+{
+    QVector<QWinShellTraceEvent> events;
+    events << intervalEvent(0, 0, 100)
+           << progressEvent(5, 0, 250)
+           << progressEvent(5, 0, Q_UINT64_C(0xffffffffffffffff), Q_UINT64_C(0xffffffffffffffff), QWinTaskbarProgressPaused)
+           << overlayEvent(17, 0, -42, QString::fromUtf8("Sp\xc3\xa4ter"))
+           << buttonsEvent(300, 1, true)
+           << jumpListEvent(Q_INT64_C(86400000), 2, 3)
+           << overlayEvent(Q_INT64_C(86400001), 0, 0, QString())
+           << targetEvent(QWinShellTraceEvent::ToolbarCleared, Q_INT64_C(86400001), 1)
+           << targetEvent(QWinShellTraceEvent::ToolbarAdded, Q_INT64_C(86400002), 1)
+           << targetEvent(QWinShellTraceEvent::Destroyed, Q_INT64_C(86400003), 0);
+
+    QWinShellTraceReader reader(encode(events));
+    QWinShellTraceEvent event;
+    foreach (const QWinShellTraceEvent &expected, events) {
+        QVERIFY(reader.readNext(&event));
+        compareEvents(event, expected);
+    }
+    QVERIFY(!reader.readNext(&event));
+    QVERIFY(reader.atEnd());
+    QVERIFY(!reader.hasError());
+}
+
+void tst_QWinShellTrace::strings()
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    QWinShellTraceWriter writer(&buffer);
+    const qint64 headerSize = writer.size();
+    QCOMPARE(headerSize, qint64(5));
+
+    writer.write(jumpListEvent(0, 0, 10));
+    const qint64 firstSize = writer.size() - headerSize;
+    writer.write(jumpListEvent(0, 0, 10));
+    const qint64 secondSize = writer.size() - headerSize - firstSize;
+    QCOMPARE(qint64(buffer.size()), writer.size());
+
+    // the same list again only refers to the strings written the first time
+    QVERIFY(secondSize < firstSize / 2);
+
+    QWinShellTraceReader reader(buffer.data());
+    QWinShellTraceEvent first;
+    QWinShellTraceEvent second;
+    QVERIFY(reader.readNext(&first));
+    QVERIFY(reader.readNext(&second));
+    QVERIFY(first.jumpList == second.jumpList);
+    QCOMPARE(second.jumpList.categories.at(0).items.at(9).title, QStringLiteral("Playlist 9"));
+}
+
+void tst_QWinShellTrace::compactProgress()
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    QWinShellTraceWriter writer(&buffer);
+    const qint64 headerSize = writer.size();
+    for (int i = 0; i < 100; ++i)
+        writer.write(progressEvent(i, 0, i * 10));
+
+    // type, time, target, state, two bytes of value and of total
+    QVERIFY(writer.size() - headerSize <= 100 * 8);
+}
+
+void tst_QWinShellTrace::writerTargets()
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    QWinShellTraceWriter writer(&buffer);
+    int button;
+    int toolbar;
+    writer.writeProgress(&button, QWinTaskbarProgressNormal, 1, 2);
+    writer.writeThumbnailButtons(&toolbar, buttonsEvent(0, 0, false).buttons.constData());
+    writer.writeProgressInterval(&button, 50);
+    writer.writeOverlay(&button, 7, QStringLiteral("Busy"));
+
+    QWinShellTraceReader reader(buffer.data());
+    QWinShellTraceEvent event;
+    QVector<quint32> targets;
+    qint64 time = 0;
+    while (reader.readNext(&event)) {
+        targets.append(event.target);
+        QVERIFY(event.time >= time);
+        time = event.time;
+    }
+    QVERIFY(!reader.hasError());
+    QCOMPARE(targets, QVector<quint32>() << 0 << 1 << 0 << 0);
+    QCOMPARE(event.type, QWinShellTraceEvent::Overlay);
+    QCOMPARE(event.description, QStringLiteral("Busy"));
+}
+
+// An object created where a destroyed one was is a new target.
+void tst_QWinShellTrace::destroyedTargets()
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    QWinShellTraceWriter writer(&buffer);
+    int button;
+    int toolbar;
+    writer.writeDestroyed(&button);
+    writer.writeProgress(&button, QWinTaskbarProgressNormal, 1, 2);
+    writer.writeToolbarAdded(&toolbar);
+    writer.writeDestroyed(&button);
+    writer.writeDestroyed(&button);
+    writer.writeProgress(&button, QWinTaskbarProgressNormal, 1, 2);
+    writer.writeToolbarCleared(&toolbar);
+
+    QWinShellTraceReader reader(buffer.data());
+    QWinShellTraceEvent event;
+    QVector<QWinShellTraceEvent::Type> types;
+    QVector<quint32> targets;
+    while (reader.readNext(&event)) {
+        types.append(event.type);
+        targets.append(event.target);
+    }
+    QVERIFY(!reader.hasError());
+    QCOMPARE(types, QVector<QWinShellTraceEvent::Type>() << QWinShellTraceEvent::Progress
+             << QWinShellTraceEvent::ToolbarAdded << QWinShellTraceEvent::Destroyed
+             << QWinShellTraceEvent::Progress << QWinShellTraceEvent::ToolbarCleared);
+    QCOMPARE(targets, QVector<quint32>() << 0 << 1 << 0 << 2 << 1);
+}
+
+void tst_QWinShellTrace::corrupt_data()
+{
+    QTest::addColumn<QByteArray>("data");
+
+    const QByteArray valid = encode(QVector<QWinShellTraceEvent>() << overlayEvent(1, 0, 5, QStringLiteral("Busy")));
+    QTest::newRow("empty") << QByteArray();
+    QTest::newRow("magic") << QByteArray("QWSX\x01", 5);
+    QTest::newRow("version") << QByteArray("QWST\x03", 5);
+    QTest::newRow("truncated") << valid.left(valid.size() - 2);
+    QTest::newRow("type") << QByteArray("QWST\x01\x09\x00\x00", 8);
+    QTest::newRow("string index") << QByteArray("QWST\x01\x03\x00\x00\x00\x05", 10);
+    QTest::newRow("string size") << QByteArray("QWST\x01\x03\x00\x00\x00\x01\x7f" "ab", 13);
+    QTest::newRow("state") << QByteArray("QWST\x01\x01\x00\x00\x09\x00\x00", 11);
+    QTest::newRow("number") << QByteArray("QWST\x01\x01\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01", 17);
+}
+
+void tst_QWinShellTrace::corrupt()
+{
+    QFETCH(QByteArray, data);
+
+    QWinShellTraceReader reader(data);
+    QWinShellTraceEvent event;
+    while (reader.readNext(&event)) {}
+    QVERIFY(reader.hasError());
+    QVERIFY(!reader.errorString().isEmpty());
+    QVERIFY(reader.atEnd());
+}
+
+void tst_QWinShellTrace::replayProgress()
+{
+    QTemporaryDir directory;
+    QWinIconStore iconStore(directory.path());
+    Backend backend;
+    QWinShellTraceReplayer replayer(&backend, &iconStore);
+
+    // a tick every millisecond for a second, at most one update every 100ms
+    replayer.replay(intervalEvent(0, 0, 100));
+    for (int i = 0; i <= 1000; ++i)
+        replayer.replay(progressEvent(i, 0, i));
+    replayer.finish();
+
+    QCOMPARE(replayer.eventCount(QWinShellTraceEvent::Progress), 1001);
+    QCOMPARE(replayer.redundantEventCount(QWinShellTraceEvent::Progress), 900);
+    QCOMPARE(backend.callCount(Backend::SetProgressState), 1);
+    QVERIFY(backend.callCount(Backend::SetProgressValue) <= 12);
+    QCOMPARE(qt_winProgressPercentage(backend.progressCompleted(1), 1000), 100);
+    QCOMPARE(backend.progressState(1), QWinTaskbarProgressNormal);
+
+    // the last update came less than 100ms ago, finish() sends the next ones
+    replayer.replay(progressEvent(1001, 0, 500));
+    replayer.replay(progressEvent(1002, 0, 600));
+    QCOMPARE(qt_winProgressPercentage(backend.progressCompleted(1), 1000), 100);
+    replayer.finish();
+    QCOMPARE(backend.progressCompleted(1), quint64(600));
+    QCOMPARE(replayer.duration(), qint64(1100));
+}
+
+void tst_QWinShellTrace::replayOverlay()
+{
+    QTemporaryDir directory;
+    QWinIconStore iconStore(directory.path());
+    Backend backend;
+    QWinShellTraceReplayer replayer(&backend, &iconStore);
+
+    replayer.replay(overlayEvent(0, 0, 5, QStringLiteral("Busy")));
+    replayer.replay(overlayEvent(1, 0, 5, QStringLiteral("Busy")));
+    replayer.replay(overlayEvent(2, 0, 0, QString()));
+    replayer.replay(overlayEvent(2, 1, 0, QString()));
+
+    // overlays are passed on as they are asked for
+    QCOMPARE(backend.callCount(Backend::SetOverlayIcon), 4);
+    QCOMPARE(replayer.redundantEventCount(QWinShellTraceEvent::Overlay), 1);
+    QCOMPARE(backend.overlayIcon(1), quintptr(0));
+    QCOMPARE(replayer.duration(), qint64(2));
+}
+
+void tst_QWinShellTrace::replayThumbnailButtons()
+{
+    QTemporaryDir directory;
+    QWinIconStore iconStore(directory.path());
+    Backend backend;
+    QWinShellTraceReplayer replayer(&backend, &iconStore);
+
+    replayer.replay(buttonsEvent(0, 0, false));
+    QCOMPARE(backend.callCount(Backend::AddThumbnailButtons), 1);
+    QCOMPARE(backend.callCount(Backend::UpdateThumbnailButtons), 1);
+    QVector<QWinThumbnailButton> buttons = backend.thumbnailButtons(1);
+    QCOMPARE(buttons.size(), int(QWinThumbnailToolBarState::SlotCount));
+    QCOMPARE(buttons.last().toolTip, QStringLiteral("Stop"));
+    QCOMPARE(buttons.last().icon, quintptr(13));
+    QCOMPARE(buttons.last().flags, quint32(QWinThumbnailButtonDisabled));
+
+    replayer.replay(buttonsEvent(1, 0, false));
+    QCOMPARE(backend.callCount(Backend::UpdateThumbnailButtons), 1);
+    QCOMPARE(replayer.redundantEventCount(QWinShellTraceEvent::ThumbnailButtons), 1);
+
+    backend.resetRecording();
+    replayer.replay(buttonsEvent(2, 0, true));
+    QCOMPARE(backend.callCount(Backend::UpdateThumbnailButtons), 1);
+    buttons = backend.thumbnailButtons(1);
+    QCOMPARE(buttons.at(QWinThumbnailToolBarState::SlotCount - 2).icon, quintptr(11));
+    QCOMPARE(buttons.last().flags, quint32(QWinThumbnailButtonEnabled));
+    QCOMPARE(replayer.eventCount(), 3);
+}
+
+// A toolbar moved to another window sends all its buttons again.
+void tst_QWinShellTrace::replayToolbarReset()
+{
+    QTemporaryDir directory;
+    QWinIconStore iconStore(directory.path());
+    Backend backend;
+    QWinShellTraceReplayer replayer(&backend, &iconStore);
+
+    replayer.replay(targetEvent(QWinShellTraceEvent::ToolbarAdded, 0, 0));
+    replayer.replay(buttonsEvent(0, 0, false));
+    QCOMPARE(backend.callCount(Backend::AddThumbnailButtons), 1);
+    QCOMPARE(backend.callCount(Backend::UpdateThumbnailButtons), 1);
+
+    backend.resetRecording();
+    replayer.replay(targetEvent(QWinShellTraceEvent::ToolbarCleared, 1, 0));
+    QCOMPARE(backend.callCount(Backend::UpdateThumbnailButtons), 1);
+    QCOMPARE(backend.thumbnailButtons(1).last().flags, quint32(QWinThumbnailButtonHidden));
+    replayer.replay(targetEvent(QWinShellTraceEvent::ToolbarAdded, 2, 0));
+    QCOMPARE(backend.callCount(Backend::AddThumbnailButtons), 1);
+
+    // the same buttons as before the reset are sent in full
+    replayer.replay(buttonsEvent(3, 0, false));
+    QCOMPARE(backend.callCount(Backend::UpdateThumbnailButtons), 2);
+    QCOMPARE(backend.thumbnailButtons(1).last().toolTip, QStringLiteral("Stop"));
+    QCOMPARE(replayer.eventCount(QWinShellTraceEvent::ToolbarAdded), 2);
+}
+
+// A target destroyed before its held back progress is sent takes it along.
+void tst_QWinShellTrace::replayDestroyed()
+{
+    QTemporaryDir directory;
+    QWinIconStore iconStore(directory.path());
+    Backend backend;
+    QWinShellTraceReplayer replayer(&backend, &iconStore);
+
+    replayer.replay(intervalEvent(0, 0, 100));
+    replayer.replay(progressEvent(0, 0, 10));
+    replayer.replay(progressEvent(10, 0, 20));
+    QCOMPARE(backend.callCount(Backend::SetProgressValue), 1);
+    replayer.replay(targetEvent(QWinShellTraceEvent::Destroyed, 20, 0));
+    replayer.finish();
+    QCOMPARE(backend.callCount(Backend::SetProgressValue), 1);
+    QCOMPARE(replayer.eventCount(QWinShellTraceEvent::Destroyed), 1);
+
+    // the next target starts from scratch
+    replayer.replay(buttonsEvent(30, 1, false));
+    replayer.replay(targetEvent(QWinShellTraceEvent::Destroyed, 40, 1));
+    replayer.replay(buttonsEvent(50, 2, false));
+    QCOMPARE(backend.callCount(Backend::AddThumbnailButtons), 2);
+    QCOMPARE(replayer.redundantEventCount(QWinShellTraceEvent::ThumbnailButtons), 0);
+}
+
+void tst_QWinShellTrace::replayJumpList()
+{
+    QTemporaryDir directory;
+    QWinIconStore iconStore(directory.path());
+    Backend backend;
+    {
+        QWinShellTraceReplayer replayer(&backend, &iconStore);
+
+        replayer.replay(jumpListEvent(0, 0, 3));
+        replayer.replay(jumpListEvent(10, 0, 3));
+        QCOMPARE(backend.commitCount(), 1);
+        QCOMPARE(replayer.redundantEventCount(QWinShellTraceEvent::JumpList), 1);
+
+        replayer.replay(jumpListEvent(20, 0, 4));
+        QCOMPARE(backend.commitCount(), 2);
+        QVERIFY(backend.committedList() == jumpListEvent(20, 0, 4).jumpList);
+        // the first three playlists are reused
+        QCOMPARE(backend.callCount(Backend::CreateLink), 4);
+    }
+    QCOMPARE(backend.liveObjectCount(), 0);
+}
+
+void tst_QWinShellTrace::replayTrace()
+{
+    QVector<QWinShellTraceEvent> events;
+    events << jumpListEvent(0, 0, 2) << buttonsEvent(0, 1, false) << intervalEvent(0, 2, 50);
+    for (int i = 0; i < 200; ++i)
+        events << progressEvent(i, 2, i, 200);
+    events << overlayEvent(200, 2, 9, QStringLiteral("Done")) << buttonsEvent(250, 1, true);
+
+    QTemporaryDir directory;
+    QWinIconStore iconStore(directory.path());
+    Backend backend;
+    QWinShellTraceReplayer replayer(&backend, &iconStore);
+    QWinShellTraceReader reader(encode(events));
+    QVERIFY(replayer.replay(&reader));
+    replayer.finish();
+
+    QCOMPARE(replayer.eventCount(), events.size());
+    QCOMPARE(replayer.eventCount(QWinShellTraceEvent::Progress), 200);
+    QCOMPARE(replayer.duration(), qint64(250));
+    QCOMPARE(backend.commitCount(), 1);
+    QCOMPARE(backend.progressCompleted(3), quint64(199));
+    QCOMPARE(backend.overlayIcon(3), quintptr(9));
+
+    QWinShellTraceReader corrupt(encode(events).left(100));
+    QVERIFY(!replayer.replay(&corrupt));
+}
+
+QTEST_GUILESS_MAIN(tst_QWinShellTrace)
+
+#include "tst_qwinshelltrace.moc"
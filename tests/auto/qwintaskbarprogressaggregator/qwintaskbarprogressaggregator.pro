@@ -0,0 +1,16 @@
+CONFIG += testcase
+TARGET = tst_qwintaskbarprogressaggregator
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwintaskbarprogressaggregator.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogress.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogressreporter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogresscoalescer.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogressaggregator.cpp
+
+HEADERS += \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogress.h \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogressaggregator.h
@@ -0,0 +1,355 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwintaskbarprogress.h"
+#include "qwintaskbarprogressaggregator.h"
+
+static QWinTaskbarProgress *createProgress(QObject *parent, int value, int maximum = 100)
+{
+    QWinTaskbarProgress *progress = new QWinTaskbarProgress(parent);
+    progress->setRange(0, maximum);
+    progress->setValue(value);
+    progress->show();
+    return progress;
+}
+
+static bool isIndeterminate(const QWinTaskbarProgress *progress)
+{
+    return progress->minimum() == 0 && progress->maximum() == 0;
+}
+
+class tst_QWinTaskbarProgressAggregator : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void empty();
+    void weightedValue();
+    void worstState();
+    void indeterminate();
+    void hiddenExcluded();
+    void removeAndDestroy();
+    void setWeight();
+    void setTarget();
+    void matchesRescan();
+};
+
+void tst_QWinTaskbarProgressAggregator::empty()
+{
+    QWinTaskbarProgress target;
+    target.show();
+    QWinTaskbarProgressAggregator aggregator;
+    aggregator.setTarget(&target);
+    QCOMPARE(aggregator.target(), &target);
+    QCOMPARE(aggregator.count(), 0);
+    QVERIFY(!target.isVisible());
+
+    // hidden jobs do not show the target
+    QWinTaskbarProgress hidden;
+    aggregator.addProgress(&hidden);
+    QCOMPARE(aggregator.count(), 1);
+    QVERIFY(!target.isVisible());
+
+    hidden.show();
+    QVERIFY(target.isVisible());
+    QCOMPARE(target.maximum(), QWinTaskbarProgressAggregator::resolution());
+    QCOMPARE(target.value(), 0);
+}
+
+void tst_QWinTaskbarProgressAggregator::weightedValue()
+{
+    QObject jobs;
+    QWinTaskbarProgress target;
+    QWinTaskbarProgressAggregator aggregator;
+    aggregator.setTarget(&target);
+
+    QWinTaskbarProgress *a = createProgress(&jobs, 50);
+    QWinTaskbarProgress *b = createProgress(&jobs, 100);
+    aggregator.addProgress(a, 1);
+    aggregator.addProgress(b, 3);
+    QCOMPARE(aggregator.weight(a), 1);
+    QCOMPARE(aggregator.weight(b), 3);
+
+    const int resolution = QWinTaskbarProgressAggregator::resolution();
+    QCOMPARE(target.value(), (resolution / 2 + 3 * resolution) / 4);
+
+    a->setValue(100);
+    QCOMPARE(target.value(), resolution);
+
+    // ranges of any size, and other minimums, contribute their fraction
+    a->setRange64(-(Q_INT64_C(1) << 40), Q_INT64_C(1) << 40);
+    a->setValue64(0);
+    b->setValue(0);
+    QCOMPARE(target.value(), resolution / 8);
+}
+
+void tst_QWinTaskbarProgressAggregator::worstState()
+{
+    QObject jobs;
+    QWinTaskbarProgress target;
+    QWinTaskbarProgressAggregator aggregator;
+    aggregator.setTarget(&target);
+
+    QWinTaskbarProgress *running = createProgress(&jobs, 10);
+    QWinTaskbarProgress *busy = createProgress(&jobs, 0, 0);
+    QWinTaskbarProgress *paused = createProgress(&jobs, 20);
+    QWinTaskbarProgress *stopped = createProgress(&jobs, 30);
+    aggregator.addProgress(busy);
+    QVERIFY(isIndeterminate(&target));
+
+    aggregator.addProgress(running);
+    QVERIFY(!isIndeterminate(&target));
+    QVERIFY(!target.isPaused());
+    QVERIFY(!target.isStopped());
+
+    aggregator.addProgress(paused);
+    aggregator.addProgress(stopped);
+    paused->pause();
+    QVERIFY(target.isPaused());
+    stopped->stop();
+    QVERIFY(target.isStopped());
+
+    // error > paused
+    paused->resume();
+    paused->pause();
+    QVERIFY(target.isStopped());
+
+    stopped->resume();
+    QVERIFY(!target.isStopped());
+    QVERIFY(target.isPaused());
+
+    paused->resume();
+    QVERIFY(!target.isPaused());
+    QVERIFY(!target.isStopped());
+    QVERIFY(target.isVisible());
+
+    // only indeterminate jobs are left visible
+    running->hide();
+    paused->hide();
+    stopped->hide();
+    QVERIFY(isIndeterminate(&target));
+    QVERIFY(target.isVisible());
+
+    busy->hide();
+    QVERIFY(!target.isVisible());
+}
+
+void tst_QWinTaskbarProgressAggregator::indeterminate()
+{
+    QObject jobs;
+    QWinTaskbarProgress target;
+    QWinTaskbarProgressAggregator aggregator;
+    aggregator.setTarget(&target);
+
+    QWinTaskbarProgress *a = createProgress(&jobs, 0, 0);
+    QWinTaskbarProgress *b = createProgress(&jobs, 40);
+    aggregator.addProgress(a, 100);
+    aggregator.addProgress(b, 1);
+
+    // indeterminate jobs do not dilute the value
+    QCOMPARE(target.value(), QWinTaskbarProgressAggregator::resolution() * 2 / 5);
+}
+
+void tst_QWinTaskbarProgressAggregator::hiddenExcluded()
+{
+    QObject jobs;
+    QWinTaskbarProgress target;
+    QWinTaskbarProgressAggregator aggregator;
+    aggregator.setTarget(&target);
+
+    QWinTaskbarProgress *a = createProgress(&jobs, 100);
+    QWinTaskbarProgress *b = createProgress(&jobs, 0);
+    aggregator.addProgress(a);
+    aggregator.addProgress(b);
+    QCOMPARE(target.value(), QWinTaskbarProgressAggregator::resolution() / 2);
+
+    b->hide();
+    QCOMPARE(target.value(), QWinTaskbarProgressAggregator::resolution());
+    b->show();
+    QCOMPARE(target.value(), QWinTaskbarProgressAggregator::resolution() / 2);
+}
+
+void tst_QWinTaskbarProgressAggregator::removeAndDestroy()
+{
+    QObject jobs;
+    QWinTaskbarProgress target;
+    QWinTaskbarProgressAggregator aggregator;
+    aggregator.setTarget(&target);
+
+    QWinTaskbarProgress *a = createProgress(&jobs, 100);
+    QWinTaskbarProgress *b = createProgress(&jobs, 0);
+    aggregator.addProgress(a);
+    aggregator.addProgress(b);
+    b->stop();
+    QVERIFY(target.isStopped());
+
+    aggregator.removeProgress(b);
+    QVERIFY(!aggregator.contains(b));
+    QCOMPARE(aggregator.count(), 1);
+    QVERIFY(!target.isStopped());
+    QCOMPARE(target.value(), QWinTaskbarProgressAggregator::resolution());
+
+    // no longer followed
+    b->resume();
+    b->setValue(50);
+    QCOMPARE(target.value(), QWinTaskbarProgressAggregator::resolution());
+
+    delete a;
+    QCOMPARE(aggregator.count(), 0);
+    QVERIFY(!target.isVisible());
+}
+
+void tst_QWinTaskbarProgressAggregator::setWeight()
+{
+    QObject jobs;
+    QWinTaskbarProgress target;
+    QWinTaskbarProgressAggregator aggregator;
+    aggregator.setTarget(&target);
+
+    QWinTaskbarProgress *a = createProgress(&jobs, 100);
+    QWinTaskbarProgress *b = createProgress(&jobs, 0);
+    aggregator.addProgress(a);
+    aggregator.addProgress(b);
+
+    aggregator.setWeight(b, 4);
+    QCOMPARE(aggregator.weight(b), 4);
+    QCOMPARE(target.value(), QWinTaskbarProgressAggregator::resolution() / 5);
+
+    // adding again changes the weight
+    aggregator.addProgress(b, 1);
+    QCOMPARE(aggregator.count(), 2);
+    QCOMPARE(target.value(), QWinTaskbarProgressAggregator::resolution() / 2);
+
+    aggregator.setWeight(b, -1);
+    QCOMPARE(aggregator.weight(b), 0);
+    QCOMPARE(target.value(), QWinTaskbarProgressAggregator::resolution());
+}
+
+void tst_QWinTaskbarProgressAggregator::setTarget()
+{
+    QObject jobs;
+    QWinTaskbarProgressAggregator aggregator;
+    aggregator.addProgress(createProgress(&jobs, 25));
+
+    QWinTaskbarProgress target;
+    aggregator.setTarget(&target);
+    QVERIFY(target.isVisible());
+    QCOMPARE(target.value(), QWinTaskbarProgressAggregator::resolution() / 4);
+
+    {
+        QWinTaskbarProgress other;
+        aggregator.setTarget(&other);
+        QCOMPARE(other.value(), QWinTaskbarProgressAggregator::resolution() / 4);
+    }
+    QVERIFY(!aggregator.target());
+}
+
+void tst_QWinTaskbarProgressAggregator::matchesRescan()
+{
+    const int resolution = QWinTaskbarProgressAggregator::resolution();
+    const int count = 200;
+
+    QObject jobs;
+    QWinTaskbarProgress target;
+    QWinTaskbarProgressAggregator aggregator;
+    aggregator.setTarget(&target);
+
+    QList<QWinTaskbarProgress *> progresses;
+    QList<int> weights;
+    qsrand(42);
+    for (int i = 0; i < count; ++i) {
+        progresses << createProgress(&jobs, 0, 1 + qrand() % 1000);
+        weights << qrand() % 10;
+        aggregator.addProgress(progresses.last(), weights.last());
+    }
+
+    for (int step = 0; step < 5000; ++step) {
+        QWinTaskbarProgress *progress = progresses.at(qrand() % count);
+        switch (qrand() % 8) {
+        case 0:
+            progress->setVisible(!progress->isVisible());
+            break;
+        case 1:
+            progress->setPaused(!progress->isPaused());
+            break;
+        case 2:
+            if (progress->isStopped())
+                progress->resume();
+            else if (qrand() % 4 == 0)
+                progress->stop();
+            break;
+        default:
+            progress->setValue(qrand() % (progress->maximum() + 1));
+            break;
+        }
+
+        // the combined result computed from scratch
+        bool anyVisible = false;
+        bool anyStopped = false;
+        bool anyPaused = false;
+        qint64 weightSum = 0;
+        qint64 unitSum = 0;
+        for (int i = 0; i < count; ++i) {
+            const QWinTaskbarProgress *p = progresses.at(i);
+            if (!p->isVisible())
+                continue;
+            anyVisible = true;
+            anyStopped |= p->isStopped();
+            anyPaused |= p->isPaused();
+            weightSum += weights.at(i);
+            unitSum += weights.at(i) * qRound64(double(p->value()) / p->maximum() * resolution);
+        }
+        const qint64 expected = weightSum ? (unitSum + weightSum / 2) / weightSum : 0;
+
+        QCOMPARE(target.isVisible(), anyVisible);
+        if (!anyVisible)
+            continue;
+        QCOMPARE(target.isStopped(), anyStopped);
+        QCOMPARE(target.isPaused(), !anyStopped && anyPaused);
+        QCOMPARE(target.value64(), expected);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinTaskbarProgressAggregator)
+
+#include "tst_qwintaskbarprogressaggregator.moc"
@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwintaskbarprogresscoalescer
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwintaskbarprogresscoalescer.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogresscoalescer.cpp
@@ -0,0 +1,288 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwintaskbarprogresscoalescer_p.h"
+
+class RecordingSink : public QWinTaskbarProgressSink
+{
+public:
+    void setProgressValue(quint64 completed, quint64 total)
+    {
+        calls << QString::fromLatin1("value %1/%2").arg(completed).arg(total);
+    }
+    void setProgressState(QWinTaskbarProgressState state)
+    {
+        calls << QString::fromLatin1("state %1").arg(int(state));
+    }
+
+    QStringList takeCalls()
+    {
+        QStringList result = calls;
+        calls.clear();
+        return result;
+    }
+
+    QStringList calls;
+};
+
+static QString stateCall(QWinTaskbarProgressState state)
+{
+    return QString::fromLatin1("state %1").arg(int(state));
+}
+
+static QString valueCall(quint64 completed, quint64 total)
+{
+    return QString::fromLatin1("value %1/%2").arg(completed).arg(total);
+}
+
+class tst_QWinTaskbarProgressCoalescer : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void percentage_data();
+    void percentage();
+    void percentageLarge();
+    void dropsUnchangedPercentage();
+    void stateChangesBypassInterval();
+    void rateLimit();
+    void rateLimitKeepsLatest();
+    void pendingDroppedWhenReverted();
+    void invalidate();
+    void hiddenStates();
+    void counters();
+};
+
+void tst_QWinTaskbarProgressCoalescer::percentage_data()
+{
+    QTest::addColumn<quint64>("completed");
+    QTest::addColumn<quint64>("total");
+    QTest::addColumn<int>("expected");
+
+    QTest::newRow("empty") << Q_UINT64_C(0) << Q_UINT64_C(0) << 0;
+    QTest::newRow("zero") << Q_UINT64_C(0) << Q_UINT64_C(100) << 0;
+    QTest::newRow("done") << Q_UINT64_C(100) << Q_UINT64_C(100) << 100;
+    QTest::newRow("overflow") << Q_UINT64_C(150) << Q_UINT64_C(100) << 100;
+    QTest::newRow("third") << Q_UINT64_C(1) << Q_UINT64_C(3) << 33;
+    QTest::newRow("two thirds") << Q_UINT64_C(2) << Q_UINT64_C(3) << 67;
+    QTest::newRow("half rounds up") << Q_UINT64_C(1) << Q_UINT64_C(200) << 1;
+    QTest::newRow("below half") << Q_UINT64_C(4) << Q_UINT64_C(1000) << 0;
+    QTest::newRow("almost done") << Q_UINT64_C(996) << Q_UINT64_C(1000) << 100;
+    QTest::newRow("not quite done") << Q_UINT64_C(994) << Q_UINT64_C(1000) << 99;
+}
+
+void tst_QWinTaskbarProgressCoalescer::percentage()
+{
+    QFETCH(quint64, completed);
+    QFETCH(quint64, total);
+    QFETCH(int, expected);
+
+    QCOMPARE(qt_winProgressPercentage(completed, total), expected);
+}
+
+void tst_QWinTaskbarProgressCoalescer::percentageLarge()
+{
+    const quint64 max = ~Q_UINT64_C(0);
+    QCOMPARE(qt_winProgressPercentage(max / 2, max), 50);
+    QCOMPARE(qt_winProgressPercentage(max / 3, max), 33);
+    QCOMPARE(qt_winProgressPercentage(max - 1, max), 100);
+    QCOMPARE(qt_winProgressPercentage(1, max), 0);
+    QCOMPARE(qt_winProgressPercentage(max / 100 * 42, max), 42);
+
+    // compare against exact arithmetic where 100 * completed fits
+    for (quint64 total = 1; total < 2000; total += 7) {
+        for (quint64 completed = 0; completed <= total; completed += 3) {
+            const int expected = int((200 * completed + total) / (2 * total));
+            QCOMPARE(qt_winProgressPercentage(completed, total), expected);
+        }
+    }
+}
+
+void tst_QWinTaskbarProgressCoalescer::dropsUnchangedPercentage()
+{
+    RecordingSink sink;
+    QWinTaskbarProgressCoalescer coalescer(&sink);
+
+    QCOMPARE(coalescer.submit(QWinTaskbarProgressNormal, 0, 100000, 0), -1);
+    QCOMPARE(sink.takeCalls(), QStringList() << valueCall(0, 100000) << stateCall(QWinTaskbarProgressNormal));
+
+    // 0.4% still shows as 0%
+    for (quint64 completed = 1; completed < 500; ++completed)
+        QCOMPARE(coalescer.submit(QWinTaskbarProgressNormal, completed, 100000, completed), -1);
+    QVERIFY(sink.calls.isEmpty());
+    QVERIFY(!coalescer.hasPendingUpdate());
+
+    QCOMPARE(coalescer.submit(QWinTaskbarProgressNormal, 500, 100000, 600), -1);
+    QCOMPARE(sink.takeCalls(), QStringList() << valueCall(500, 100000));
+}
+
+void tst_QWinTaskbarProgressCoalescer::stateChangesBypassInterval()
+{
+    RecordingSink sink;
+    QWinTaskbarProgressCoalescer coalescer(&sink);
+    coalescer.setMinimumInterval(1000);
+
+    coalescer.submit(QWinTaskbarProgressNormal, 10, 100, 0);
+    sink.takeCalls();
+
+    QCOMPARE(coalescer.submit(QWinTaskbarProgressPaused, 10, 100, 1), -1);
+    QCOMPARE(sink.takeCalls(), QStringList() << valueCall(10, 100) << stateCall(QWinTaskbarProgressPaused));
+
+    QCOMPARE(coalescer.submit(QWinTaskbarProgressNone, 0, 0, 2), -1);
+    QCOMPARE(sink.takeCalls(), QStringList() << stateCall(QWinTaskbarProgressNone));
+}
+
+void tst_QWinTaskbarProgressCoalescer::rateLimit()
+{
+    RecordingSink sink;
+    QWinTaskbarProgressCoalescer coalescer(&sink);
+    coalescer.setMinimumInterval(100);
+    QCOMPARE(coalescer.minimumInterval(), 100);
+
+    coalescer.submit(QWinTaskbarProgressNormal, 0, 100, 1000);
+    sink.takeCalls();
+
+    QCOMPARE(coalescer.submit(QWinTaskbarProgressNormal, 1, 100, 1030), 70);
+    QVERIFY(coalescer.hasPendingUpdate());
+    QVERIFY(sink.calls.isEmpty());
+
+    QCOMPARE(coalescer.flush(1060), 40);
+    QVERIFY(sink.calls.isEmpty());
+
+    QCOMPARE(coalescer.flush(1100), -1);
+    QVERIFY(!coalescer.hasPendingUpdate());
+    QCOMPARE(sink.takeCalls(), QStringList() << valueCall(1, 100));
+
+    // due again right away after a quiet period
+    QCOMPARE(coalescer.submit(QWinTaskbarProgressNormal, 2, 100, 5000), -1);
+    QCOMPARE(sink.takeCalls(), QStringList() << valueCall(2, 100));
+    QCOMPARE(coalescer.flush(5001), -1);
+    QVERIFY(sink.calls.isEmpty());
+}
+
+void tst_QWinTaskbarProgressCoalescer::rateLimitKeepsLatest()
+{
+    RecordingSink sink;
+    QWinTaskbarProgressCoalescer coalescer(&sink);
+    coalescer.setMinimumInterval(50);
+
+    coalescer.submit(QWinTaskbarProgressNormal, 0, 100, 0);
+    sink.takeCalls();
+
+    for (int i = 1; i <= 40; ++i)
+        QVERIFY(coalescer.submit(QWinTaskbarProgressNormal, i, 100, i) > 0);
+    QVERIFY(sink.calls.isEmpty());
+
+    QCOMPARE(coalescer.flush(50), -1);
+    QCOMPARE(sink.takeCalls(), QStringList() << valueCall(40, 100));
+}
+
+void tst_QWinTaskbarProgressCoalescer::pendingDroppedWhenReverted()
+{
+    RecordingSink sink;
+    QWinTaskbarProgressCoalescer coalescer(&sink);
+    coalescer.setMinimumInterval(100);
+
+    coalescer.submit(QWinTaskbarProgressNormal, 5, 100, 0);
+    sink.takeCalls();
+
+    QVERIFY(coalescer.submit(QWinTaskbarProgressNormal, 6, 100, 10) > 0);
+    QCOMPARE(coalescer.submit(QWinTaskbarProgressNormal, 5, 100, 20), -1);
+    QVERIFY(!coalescer.hasPendingUpdate());
+    QCOMPARE(coalescer.flush(200), -1);
+    QVERIFY(sink.calls.isEmpty());
+}
+
+void tst_QWinTaskbarProgressCoalescer::invalidate()
+{
+    RecordingSink sink;
+    QWinTaskbarProgressCoalescer coalescer(&sink);
+    coalescer.setMinimumInterval(100);
+
+    coalescer.submit(QWinTaskbarProgressNormal, 5, 100, 0);
+    sink.takeCalls();
+
+    coalescer.invalidate();
+    QCOMPARE(coalescer.submit(QWinTaskbarProgressNormal, 5, 100, 1), -1);
+    QCOMPARE(sink.takeCalls(), QStringList() << valueCall(5, 100) << stateCall(QWinTaskbarProgressNormal));
+}
+
+void tst_QWinTaskbarProgressCoalescer::hiddenStates()
+{
+    RecordingSink sink;
+    QWinTaskbarProgressCoalescer coalescer(&sink);
+
+    coalescer.submit(QWinTaskbarProgressIndeterminate, 0, 0, 0);
+    QCOMPARE(sink.takeCalls(), QStringList() << stateCall(QWinTaskbarProgressIndeterminate));
+
+    // values are not shown while indeterminate
+    QCOMPARE(coalescer.submit(QWinTaskbarProgressIndeterminate, 50, 100, 1), -1);
+    QVERIFY(sink.calls.isEmpty());
+
+    // an empty range shows no value
+    coalescer.submit(QWinTaskbarProgressNormal, 0, 0, 2);
+    QCOMPARE(sink.takeCalls(), QStringList() << stateCall(QWinTaskbarProgressNormal));
+}
+
+void tst_QWinTaskbarProgressCoalescer::counters()
+{
+    RecordingSink sink;
+    QWinTaskbarProgressCoalescer coalescer(&sink);
+    coalescer.setMinimumInterval(10);
+
+    qint64 now = 0;
+    for (int i = 0; i <= 10000; ++i) {
+        const int wait = coalescer.submit(QWinTaskbarProgressNormal, i, 10000, now);
+        if (wait > 0 && i % 50 == 0) {
+            now += wait;
+            coalescer.flush(now);
+        }
+    }
+    QCOMPARE(coalescer.submittedCount(), quint64(10001));
+    QVERIFY(coalescer.forwardedCount() <= 101);
+    QCOMPARE(coalescer.forwardedCount(), quint64(sink.calls.size() - 1));
+}
+
+QTEST_APPLESS_MAIN(tst_QWinTaskbarProgressCoalescer)
+
+#include "tst_qwintaskbarprogresscoalescer.moc"
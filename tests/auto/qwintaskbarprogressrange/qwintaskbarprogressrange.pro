@@ -0,0 +1,14 @@
+CONFIG += testcase
+TARGET = tst_qwintaskbarprogressrange
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwintaskbarprogressrange.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogress.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogresscoalescer.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogressreporter.cpp
+
+HEADERS += \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogress.h
@@ -0,0 +1,253 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwintaskbarprogress.h"
+#include "qwintaskbarprogresscoalescer_p.h"
+
+#include <limits>
+
+static const qint64 int64Min = std::numeric_limits<qint64>::min();
+static const qint64 int64Max = std::numeric_limits<qint64>::max();
+static const qint64 intMin = std::numeric_limits<int>::min();
+static const qint64 intMax = std::numeric_limits<int>::max();
+static const qint64 fourGiB = Q_INT64_C(4) << 30;
+
+class tst_QWinTaskbarProgressRange : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void largeValues();
+    void intClamping();
+    void intSignals();
+    void rangeReset();
+    void extremeRange();
+    void span_data();
+    void span();
+    void roundingRules_data();
+    void roundingRules();
+};
+
+void tst_QWinTaskbarProgressRange::largeValues()
+{
+    QWinTaskbarProgress progress;
+    QSignalSpy value64Spy(&progress, SIGNAL(value64Changed(qint64)));
+    QSignalSpy maximum64Spy(&progress, SIGNAL(maximum64Changed(qint64)));
+
+    progress.setMaximum64(fourGiB);
+    QCOMPARE(progress.maximum64(), fourGiB);
+    QCOMPARE(maximum64Spy.count(), 1);
+    QCOMPARE(maximum64Spy.last().at(0).toLongLong(), fourGiB);
+
+    progress.setValue64(fourGiB - 1);
+    QCOMPARE(progress.value64(), fourGiB - 1);
+    QCOMPARE(value64Spy.count(), 1);
+    QCOMPARE(value64Spy.last().at(0).toLongLong(), fourGiB - 1);
+
+    // out of range -> no effect
+    progress.setValue64(fourGiB + 1);
+    QCOMPARE(progress.value64(), fourGiB - 1);
+    QCOMPARE(value64Spy.count(), 1);
+
+    progress.setValue64(fourGiB);
+    QCOMPARE(progress.value64(), fourGiB);
+    QCOMPARE(value64Spy.count(), 2);
+}
+
+void tst_QWinTaskbarProgressRange::intClamping()
+{
+    QWinTaskbarProgress progress;
+    progress.setRange64(-fourGiB, fourGiB);
+    QCOMPARE(progress.minimum(), int(intMin));
+    QCOMPARE(progress.maximum(), int(intMax));
+
+    progress.setValue64(intMax + 1);
+    QCOMPARE(progress.value(), int(intMax));
+    progress.setValue64(intMin - 1);
+    QCOMPARE(progress.value(), int(intMin));
+    progress.setValue64(12345);
+    QCOMPARE(progress.value(), 12345);
+
+    // the int setters keep working on the 64-bit range
+    progress.setValue(-7);
+    QCOMPARE(progress.value64(), qint64(-7));
+    progress.setMaximum(1000);
+    QCOMPARE(progress.maximum64(), qint64(1000));
+    QCOMPARE(progress.minimum64(), -fourGiB);
+}
+
+void tst_QWinTaskbarProgressRange::intSignals()
+{
+    QWinTaskbarProgress progress;
+    QSignalSpy valueSpy(&progress, SIGNAL(valueChanged(int)));
+    QSignalSpy value64Spy(&progress, SIGNAL(value64Changed(qint64)));
+    QSignalSpy maximumSpy(&progress, SIGNAL(maximumChanged(int)));
+
+    progress.setMaximum64(fourGiB);
+    QCOMPARE(maximumSpy.count(), 1);
+    QCOMPARE(maximumSpy.last().at(0).toInt(), int(intMax));
+
+    // still clamped to the same int, only the 64-bit signal is emitted
+    progress.setMaximum64(fourGiB * 2);
+    QCOMPARE(maximumSpy.count(), 1);
+
+    progress.setValue64(intMax);
+    QCOMPARE(valueSpy.count(), 1);
+    QCOMPARE(valueSpy.last().at(0).toInt(), int(intMax));
+    progress.setValue64(fourGiB);
+    QCOMPARE(valueSpy.count(), 1);
+    QCOMPARE(value64Spy.count(), 2);
+
+    progress.setValue(50);
+    QCOMPARE(valueSpy.count(), 2);
+    QCOMPARE(valueSpy.last().at(0).toInt(), 50);
+    QCOMPARE(value64Spy.count(), 3);
+}
+
+void tst_QWinTaskbarProgressRange::rangeReset()
+{
+    QWinTaskbarProgress progress;
+    progress.setRange64(0, fourGiB);
+    progress.setValue64(fourGiB - 10);
+
+    // value over the valid range -> reset
+    progress.setMaximum64(fourGiB / 2);
+    QCOMPARE(progress.value64(), qint64(0));
+
+    // inverted range collapses onto the minimum
+    progress.setRange64(fourGiB, 0);
+    QCOMPARE(progress.minimum64(), fourGiB);
+    QCOMPARE(progress.maximum64(), fourGiB);
+    QCOMPARE(progress.value64(), fourGiB);
+}
+
+void tst_QWinTaskbarProgressRange::extremeRange()
+{
+    QWinTaskbarProgress progress;
+    progress.setRange64(int64Min, int64Max);
+    QCOMPARE(progress.minimum64(), int64Min);
+    QCOMPARE(progress.maximum64(), int64Max);
+
+    progress.setValue64(int64Max);
+    QCOMPARE(progress.value64(), int64Max);
+
+    quint64 completed = 0;
+    quint64 total = 0;
+    qt_winProgressSpan(progress.minimum64(), progress.maximum64(), progress.value64(), &completed, &total);
+    QCOMPARE(total, ~Q_UINT64_C(0));
+    QCOMPARE(completed, total);
+    QCOMPARE(qt_winProgressPercentage(completed, total), 100);
+
+    progress.setValue64(0);
+    qt_winProgressSpan(progress.minimum64(), progress.maximum64(), progress.value64(), &completed, &total);
+    QCOMPARE(completed, Q_UINT64_C(1) << 63);
+    QCOMPARE(qt_winProgressPercentage(completed, total), 50);
+}
+
+void tst_QWinTaskbarProgressRange::span_data()
+{
+    QTest::addColumn<qint64>("minimum");
+    QTest::addColumn<qint64>("maximum");
+    QTest::addColumn<qint64>("value");
+    QTest::addColumn<quint64>("completed");
+    QTest::addColumn<quint64>("total");
+
+    QTest::newRow("default") << qint64(0) << qint64(100) << qint64(25) << Q_UINT64_C(25) << Q_UINT64_C(100);
+    QTest::newRow("offset") << qint64(-50) << qint64(50) << qint64(0) << Q_UINT64_C(50) << Q_UINT64_C(100);
+    QTest::newRow("empty") << qint64(0) << qint64(0) << qint64(0) << Q_UINT64_C(0) << Q_UINT64_C(0);
+    QTest::newRow("inverted") << qint64(10) << qint64(5) << qint64(7) << Q_UINT64_C(0) << Q_UINT64_C(0);
+    QTest::newRow("below") << qint64(10) << qint64(20) << qint64(5) << Q_UINT64_C(0) << Q_UINT64_C(10);
+    QTest::newRow("above") << qint64(10) << qint64(20) << qint64(25) << Q_UINT64_C(10) << Q_UINT64_C(10);
+    QTest::newRow("large") << qint64(0) << fourGiB << fourGiB / 4 << quint64(fourGiB / 4) << quint64(fourGiB);
+    QTest::newRow("negative large") << int64Min << qint64(0) << int64Min / 2
+                                    << (Q_UINT64_C(1) << 62) << (Q_UINT64_C(1) << 63);
+    QTest::newRow("full") << int64Min << int64Max << int64Min << Q_UINT64_C(0) << ~Q_UINT64_C(0);
+}
+
+void tst_QWinTaskbarProgressRange::span()
+{
+    QFETCH(qint64, minimum);
+    QFETCH(qint64, maximum);
+    QFETCH(qint64, value);
+    QFETCH(quint64, completed);
+    QFETCH(quint64, total);
+
+    quint64 actualCompleted = 1;
+    quint64 actualTotal = 1;
+    qt_winProgressSpan(minimum, maximum, value, &actualCompleted, &actualTotal);
+    QCOMPARE(actualCompleted, completed);
+    QCOMPARE(actualTotal, total);
+}
+
+void tst_QWinTaskbarProgressRange::roundingRules_data()
+{
+    QTest::addColumn<quint64>("completed");
+    QTest::addColumn<quint64>("total");
+    QTest::addColumn<int>("percentage");
+
+    const quint64 max = ~Q_UINT64_C(0);
+    const quint64 total = Q_UINT64_C(200) << 32;
+    QTest::newRow("half below 1%") << (Q_UINT64_C(1) << 32) - 1 << total << 0;
+    QTest::newRow("half rounds up") << (Q_UINT64_C(1) << 32) << total << 1;
+    QTest::newRow("99.5% rounds up") << total - (Q_UINT64_C(1) << 32) << total << 100;
+    QTest::newRow("just below 99.5%") << total - (Q_UINT64_C(1) << 32) - 1 << total << 99;
+    QTest::newRow("one step of max") << Q_UINT64_C(1) << max << 0;
+    QTest::newRow("max minus one of max") << max - 1 << max << 100;
+    QTest::newRow("half of max") << max / 2 << max << 50;
+    QTest::newRow("half of max plus one") << max / 2 + 1 << max << 50;
+    QTest::newRow("quarter of max") << max / 4 << max << 25;
+    QTest::newRow("beyond max") << max << Q_UINT64_C(1) << 100;
+}
+
+void tst_QWinTaskbarProgressRange::roundingRules()
+{
+    QFETCH(quint64, completed);
+    QFETCH(quint64, total);
+    QFETCH(int, percentage);
+
+    QCOMPARE(qt_winProgressPercentage(completed, total), percentage);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinTaskbarProgressRange)
+
+#include "tst_qwintaskbarprogressrange.moc"
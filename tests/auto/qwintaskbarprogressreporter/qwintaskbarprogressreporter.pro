@@ -0,0 +1,13 @@
+CONFIG += testcase
+TARGET = tst_qwintaskbarprogressreporter
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwintaskbarprogressreporter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogress.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogressreporter.cpp
+
+HEADERS += \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogress.h
@@ -0,0 +1,338 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwintaskbarprogress.h"
+#include "qwintaskbarprogressreporter.h"
+
+static const int threadCount = 8;
+static const int iterations = 100000;
+
+class AddingThread : public QThread
+{
+public:
+    explicit AddingThread(QWinTaskbarProgressReporter *reporter) : m_reporter(reporter) {}
+
+protected:
+    void run()
+    {
+        for (int i = 0; i < iterations; ++i)
+            m_reporter->add(1);
+    }
+
+private:
+    QWinTaskbarProgressReporter *m_reporter;
+};
+
+// Writes values whose halves are equal, so that a torn read is detectable.
+class PatternThread : public QThread
+{
+public:
+    PatternThread(QWinTaskbarProgressReporter *reporter, quint32 seed) : m_reporter(reporter), m_seed(seed) {}
+
+protected:
+    void run()
+    {
+        quint32 x = m_seed;
+        for (int i = 0; i < iterations; ++i) {
+            x = x * 1664525u + 1013904223u;
+            m_reporter->setValue(qint64((quint64(x) << 32) | x));
+        }
+    }
+
+private:
+    QWinTaskbarProgressReporter *m_reporter;
+    quint32 m_seed;
+};
+
+class ValueRecorder : public QObject
+{
+    Q_OBJECT
+
+public:
+    ValueRecorder() : decreased(false), last(0), count(0) {}
+
+    bool decreased;
+    qint64 last;
+    int count;
+
+public slots:
+    void record(qint64 value)
+    {
+        if (value < last)
+            decreased = true;
+        last = value;
+        ++count;
+    }
+};
+
+class tst_QWinTaskbarProgressReporter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void singleThread();
+    void concurrentAdd();
+    void noTornValues();
+    void sampling();
+    void samplingBounded();
+    void detach();
+    void minimumInterval();
+    void idleSampling();
+    void destroyedReporter();
+    void moveReporter();
+};
+
+void tst_QWinTaskbarProgressReporter::singleThread()
+{
+    QWinTaskbarProgressReporter reporter;
+    QCOMPARE(reporter.value(), qint64(0));
+    QCOMPARE(reporter.add(5), qint64(5));
+    QCOMPARE(reporter.add(Q_INT64_C(1) << 40), (Q_INT64_C(1) << 40) + 5);
+    reporter.setValue(-3);
+    QCOMPARE(reporter.value(), qint64(-3));
+    reporter.reset();
+    QCOMPARE(reporter.value(), qint64(0));
+}
+
+void tst_QWinTaskbarProgressReporter::concurrentAdd()
+{
+    const qint64 total = qint64(threadCount) * iterations;
+
+    QWinTaskbarProgressReporter reporter;
+    QWinTaskbarProgress progress;
+    progress.setRange64(0, total);
+    progress.setReporter(&reporter, 1);
+
+    ValueRecorder recorder;
+    connect(&progress, SIGNAL(value64Changed(qint64)), &recorder, SLOT(record(qint64)));
+
+    QList<AddingThread *> threads;
+    for (int i = 0; i < threadCount; ++i)
+        threads << new AddingThread(&reporter);
+    foreach (AddingThread *thread, threads)
+        thread->start();
+
+    bool running = true;
+    while (running) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 5);
+        running = false;
+        foreach (AddingThread *thread, threads)
+            running |= !thread->isFinished();
+    }
+    foreach (AddingThread *thread, threads)
+        thread->wait();
+    qDeleteAll(threads);
+
+    QCOMPARE(reporter.value(), total);
+    QTRY_COMPARE(progress.value64(), total);
+    QVERIFY(!recorder.decreased);
+    // far fewer updates reach the GUI thread than were reported
+    QVERIFY(recorder.count < total);
+
+    progress.setReporter(0);
+}
+
+void tst_QWinTaskbarProgressReporter::noTornValues()
+{
+    QWinTaskbarProgressReporter reporter;
+    QList<PatternThread *> threads;
+    for (int i = 0; i < threadCount / 2; ++i)
+        threads << new PatternThread(&reporter, quint32(i + 1));
+    foreach (PatternThread *thread, threads)
+        thread->start();
+
+    quint64 torn = 0;
+    bool running = true;
+    while (running && !torn) {
+        for (int i = 0; i < 1000; ++i) {
+            const quint64 value = quint64(reporter.value());
+            if (quint32(value >> 32) != quint32(value))
+                torn = value;
+        }
+        running = false;
+        foreach (PatternThread *thread, threads)
+            running |= !thread->isFinished();
+    }
+    foreach (PatternThread *thread, threads)
+        thread->wait();
+    qDeleteAll(threads);
+
+    if (torn)
+        QFAIL(qPrintable(QString::fromLatin1("Torn read: %1").arg(torn, 16, 16, QLatin1Char('0'))));
+}
+
+void tst_QWinTaskbarProgressReporter::sampling()
+{
+    QWinTaskbarProgressReporter reporter;
+    reporter.setValue(10);
+
+    QWinTaskbarProgress progress;
+    QVERIFY(!progress.reporter());
+    QSignalSpy valueSpy(&progress, SIGNAL(valueChanged(int)));
+
+    // sampled right away when attached
+    progress.setReporter(&reporter, 10);
+    QCOMPARE(progress.reporter(), &reporter);
+    QCOMPARE(progress.value(), 10);
+    QCOMPARE(valueSpy.count(), 1);
+
+    reporter.setValue(20);
+    reporter.setValue(30);
+    reporter.setValue(40);
+    QTRY_COMPARE(progress.value(), 40);
+
+    // an unchanged value does not emit again
+    const int count = valueSpy.count();
+    QTest::qWait(50);
+    QCOMPARE(valueSpy.count(), count);
+}
+
+void tst_QWinTaskbarProgressReporter::samplingBounded()
+{
+    QWinTaskbarProgressReporter reporter;
+    QWinTaskbarProgress progress;
+    progress.setRange64(100, 200);
+    progress.setReporter(&reporter, 1);
+    QCOMPARE(progress.value64(), qint64(100));
+
+    reporter.setValue(150);
+    QTRY_COMPARE(progress.value64(), qint64(150));
+    reporter.setValue(1000);
+    QTRY_COMPARE(progress.value64(), qint64(200));
+    reporter.setValue(-1000);
+    QTRY_COMPARE(progress.value64(), qint64(100));
+}
+
+void tst_QWinTaskbarProgressReporter::detach()
+{
+    QWinTaskbarProgressReporter reporter;
+    QWinTaskbarProgress progress;
+    progress.setReporter(&reporter, 1);
+    reporter.setValue(25);
+    QTRY_COMPARE(progress.value(), 25);
+
+    progress.setReporter(0);
+    QVERIFY(!progress.reporter());
+    reporter.setValue(75);
+    QTest::qWait(20);
+    QCOMPARE(progress.value(), 25);
+}
+
+void tst_QWinTaskbarProgressReporter::minimumInterval()
+{
+    QWinTaskbarProgressReporter reporter;
+    QWinTaskbarProgress progress;
+    progress.setReporter(&reporter, 0);
+    QTimer *sampler = progress.findChild<QTimer *>();
+    QVERIFY(sampler);
+    QCOMPARE(sampler->interval(), 1);
+    progress.setReporter(&reporter, -5);
+    QCOMPARE(sampler->interval(), 1);
+    progress.setReporter(&reporter, 40);
+    QCOMPARE(sampler->interval(), 40);
+}
+
+void tst_QWinTaskbarProgressReporter::idleSampling()
+{
+    QWinTaskbarProgressReporter reporter;
+    QWinTaskbarProgress progress;
+    progress.setReporter(&reporter, 1);
+    QTimer *sampler = progress.findChild<QTimer *>();
+    QVERIFY(sampler);
+
+    // the sampler stops while the value does not change
+    QTRY_VERIFY(!sampler->isActive());
+    QCOMPARE(progress.value(), 0);
+
+    // and starts again with the next update, from any thread
+    AddingThread thread(&reporter);
+    thread.start();
+    QVERIFY(thread.wait());
+    QTRY_COMPARE(progress.value64(), qint64(iterations));
+    QTRY_VERIFY(!sampler->isActive());
+
+    reporter.setValue(iterations);
+    QTest::qWait(20);
+    QVERIFY(!sampler->isActive());
+    reporter.setValue(7);
+    QTRY_COMPARE(progress.value(), 7);
+}
+
+void tst_QWinTaskbarProgressReporter::destroyedReporter()
+{
+    QWinTaskbarProgress progress;
+    QWinTaskbarProgressReporter *reporter = new QWinTaskbarProgressReporter;
+    progress.setReporter(reporter, 1);
+    QCOMPARE(progress.reporter(), reporter);
+
+    delete reporter;
+    QVERIFY(!progress.reporter());
+    QTest::qWait(20);
+
+    // and the other way around
+    QWinTaskbarProgressReporter survivor;
+    QWinTaskbarProgress *owner = new QWinTaskbarProgress;
+    owner->setReporter(&survivor, 1);
+    delete owner;
+    survivor.setValue(10);
+    QTest::qWait(20);
+}
+
+void tst_QWinTaskbarProgressReporter::moveReporter()
+{
+    QWinTaskbarProgressReporter reporter;
+    QWinTaskbarProgress first;
+    QWinTaskbarProgress second;
+    first.setReporter(&reporter, 1);
+    second.setReporter(&reporter, 1);
+    QVERIFY(!first.reporter());
+    QCOMPARE(second.reporter(), &reporter);
+
+    reporter.setValue(30);
+    QTRY_COMPARE(second.value(), 30);
+    QCOMPARE(first.value(), 0);
+}
+
+QTEST_GUILESS_MAIN(tst_QWinTaskbarProgressReporter)
+
+#include "tst_qwintaskbarprogressreporter.moc"
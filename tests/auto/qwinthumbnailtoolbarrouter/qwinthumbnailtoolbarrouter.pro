@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwinthumbnailtoolbarrouter
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinthumbnailtoolbarrouter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinthumbnailtoolbarrouter.cpp
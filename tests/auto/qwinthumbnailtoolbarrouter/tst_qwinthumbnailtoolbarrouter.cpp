@@ -0,0 +1,144 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinthumbnailtoolbarrouter_p.h"
+
+class RecordingReceiver : public QWinThumbnailToolBarReceiver
+{
+public:
+    void thumbnailButtonClicked(int buttonId) { clicks << buttonId; }
+
+    QList<int> clicks;
+};
+
+static quintptr clickedParam(int buttonId)
+{
+    return (quintptr(QWinThumbnailToolBarClickedNotification) << 16) | quintptr(buttonId);
+}
+
+class tst_QWinThumbnailToolBarRouter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void route();
+    void otherMessages();
+    void unknownHandle();
+    void remove();
+    void replace();
+};
+
+void tst_QWinThumbnailToolBarRouter::route()
+{
+    RecordingReceiver first;
+    RecordingReceiver second;
+    QWinThumbnailToolBarRouter router;
+    router.insert(0x10, &first);
+    router.insert(0x20, &second);
+    QCOMPARE(router.count(), 2);
+
+    QVERIFY(router.route(0x10, QWinThumbnailToolBarCommandMessage, clickedParam(6)));
+    QVERIFY(router.route(0x20, QWinThumbnailToolBarCommandMessage, clickedParam(0)));
+    QVERIFY(router.route(0x20, QWinThumbnailToolBarCommandMessage, clickedParam(3)));
+    QCOMPARE(first.clicks, QList<int>() << 6);
+    QCOMPARE(second.clicks, QList<int>() << 0 << 3);
+}
+
+void tst_QWinThumbnailToolBarRouter::otherMessages()
+{
+    RecordingReceiver receiver;
+    QWinThumbnailToolBarRouter router;
+    router.insert(0x10, &receiver);
+
+    // WM_PAINT
+    QVERIFY(!router.route(0x10, 0x000F, clickedParam(1)));
+    // a menu command
+    QVERIFY(!router.route(0x10, QWinThumbnailToolBarCommandMessage, 1));
+    // another notification code
+    QVERIFY(!router.route(0x10, QWinThumbnailToolBarCommandMessage, (quintptr(0x1801) << 16) | 1));
+    QVERIFY(receiver.clicks.isEmpty());
+}
+
+void tst_QWinThumbnailToolBarRouter::unknownHandle()
+{
+    RecordingReceiver receiver;
+    QWinThumbnailToolBarRouter router;
+    router.insert(0x10, &receiver);
+
+    QVERIFY(!router.route(0x30, QWinThumbnailToolBarCommandMessage, clickedParam(1)));
+    QVERIFY(receiver.clicks.isEmpty());
+    QVERIFY(!router.receiver(0x30));
+}
+
+void tst_QWinThumbnailToolBarRouter::remove()
+{
+    RecordingReceiver receiver;
+    QWinThumbnailToolBarRouter router;
+    router.insert(0x10, &receiver);
+    router.remove(0x10, &receiver);
+    QCOMPARE(router.count(), 0);
+    QVERIFY(!router.route(0x10, QWinThumbnailToolBarCommandMessage, clickedParam(1)));
+    QVERIFY(receiver.clicks.isEmpty());
+}
+
+void tst_QWinThumbnailToolBarRouter::replace()
+{
+    RecordingReceiver first;
+    RecordingReceiver second;
+    QWinThumbnailToolBarRouter router;
+    router.insert(0x10, &first);
+    router.insert(0x10, &second);
+    QCOMPARE(router.receiver(0x10), static_cast<QWinThumbnailToolBarReceiver *>(&second));
+
+    // the previous receiver cannot remove its successor
+    router.remove(0x10, &first);
+    QCOMPARE(router.count(), 1);
+
+    QVERIFY(router.route(0x10, QWinThumbnailToolBarCommandMessage, clickedParam(2)));
+    QVERIFY(first.clicks.isEmpty());
+    QCOMPARE(second.clicks, QList<int>() << 2);
+}
+
+QTEST_APPLESS_MAIN(tst_QWinThumbnailToolBarRouter)
+
+#include "tst_qwinthumbnailtoolbarrouter.moc"
@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwinthumbnailtoolbarstate
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinthumbnailtoolbarstate.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinthumbnailtoolbarstate.cpp
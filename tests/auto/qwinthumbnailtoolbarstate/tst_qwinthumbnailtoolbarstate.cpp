@@ -0,0 +1,267 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinthumbnailtoolbarstate_p.h"
+
+static const int slotCount = QWinThumbnailToolBarState::SlotCount;
+
+static QWinThumbnailButtonState visibleButton(qint64 iconKey, const QString &toolTip, quint32 flags = QWinThumbnailButtonEnabled)
+{
+    QWinThumbnailButtonState state;
+    state.flags = flags;
+    state.iconKey = iconKey;
+    state.toolTip = toolTip;
+    return state;
+}
+
+class tst_QWinThumbnailToolBarState : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void buttonChanges();
+    void hiddenButtonChanges();
+    void initialUpdate();
+    void toggleSendsOneButton();
+    void unchanged();
+    void commitOnlySentFields();
+    void reset();
+    void invalidate();
+    void buttons();
+    void resetButtons();
+};
+
+void tst_QWinThumbnailToolBarState::buttonChanges()
+{
+    const QWinThumbnailButtonState play = visibleButton(1, QStringLiteral("Play"));
+    QCOMPARE(qt_winThumbnailButtonChanges(play, play), quint32(0));
+
+    QWinThumbnailButtonState pause = play;
+    pause.iconKey = 2;
+    QCOMPARE(qt_winThumbnailButtonChanges(play, pause), quint32(QWinThumbnailButtonIconField));
+
+    pause.toolTip = QStringLiteral("Pause");
+    QCOMPARE(qt_winThumbnailButtonChanges(play, pause),
+             quint32(QWinThumbnailButtonIconField | QWinThumbnailButtonToolTipField));
+
+    QWinThumbnailButtonState disabled = play;
+    disabled.flags = QWinThumbnailButtonDisabled;
+    QCOMPARE(qt_winThumbnailButtonChanges(play, disabled), quint32(QWinThumbnailButtonFlagsField));
+
+    // removing the icon or the tooltip is a change too
+    QCOMPARE(qt_winThumbnailButtonChanges(play, visibleButton(0, QString())),
+             quint32(QWinThumbnailButtonIconField | QWinThumbnailButtonToolTipField));
+}
+
+void tst_QWinThumbnailToolBarState::hiddenButtonChanges()
+{
+    const QWinThumbnailButtonState play = visibleButton(1, QStringLiteral("Play"));
+    const QWinThumbnailButtonState hidden;
+    QCOMPARE(qt_winThumbnailButtonChanges(play, hidden), quint32(QWinThumbnailButtonFlagsField));
+
+    QWinThumbnailButtonState hiddenPlay = play;
+    hiddenPlay.flags |= QWinThumbnailButtonHidden;
+    QCOMPARE(qt_winThumbnailButtonChanges(hidden, hiddenPlay), quint32(0));
+    QCOMPARE(qt_winThumbnailButtonChanges(hidden, play),
+             quint32(QWinThumbnailButtonFlagsField | QWinThumbnailButtonIconField | QWinThumbnailButtonToolTipField));
+}
+
+void tst_QWinThumbnailToolBarState::initialUpdate()
+{
+    QWinThumbnailToolBarState state;
+    QWinThumbnailButtonState wanted[slotCount];
+    wanted[5] = visibleButton(1, QStringLiteral("Play"));
+    wanted[6] = visibleButton(0, QStringLiteral("Next"), QWinThumbnailButtonDismissOnClick);
+
+    QWinThumbnailToolBarState::Change changes[slotCount];
+    QCOMPARE(state.changes(wanted, changes), 2);
+    QCOMPARE(changes[0].slot, 5);
+    QCOMPARE(changes[0].fields, quint32(QWinThumbnailButtonFlagsField | QWinThumbnailButtonIconField | QWinThumbnailButtonToolTipField));
+    QCOMPARE(changes[1].slot, 6);
+    QCOMPARE(changes[1].fields, quint32(QWinThumbnailButtonFlagsField | QWinThumbnailButtonToolTipField));
+}
+
+void tst_QWinThumbnailToolBarState::toggleSendsOneButton()
+{
+    QWinThumbnailToolBarState state;
+    QWinThumbnailButtonState wanted[slotCount];
+    for (int i = 2; i < slotCount; ++i)
+        wanted[i] = visibleButton(i, QString::number(i));
+    state.commit(wanted);
+
+    // play becomes pause
+    wanted[4].iconKey = 100;
+    wanted[4].toolTip = QStringLiteral("Pause");
+    QWinThumbnailToolBarState::Change changes[slotCount];
+    QCOMPARE(state.changes(wanted, changes), 1);
+    QCOMPARE(changes[0].slot, 4);
+    QCOMPARE(changes[0].fields, quint32(QWinThumbnailButtonIconField | QWinThumbnailButtonToolTipField));
+    state.commit(wanted);
+
+    // and back
+    wanted[4].iconKey = 4;
+    QCOMPARE(state.changes(wanted, changes), 1);
+    QCOMPARE(changes[0].fields, quint32(QWinThumbnailButtonIconField));
+}
+
+void tst_QWinThumbnailToolBarState::unchanged()
+{
+    QWinThumbnailToolBarState state;
+    QWinThumbnailButtonState wanted[slotCount];
+    QWinThumbnailToolBarState::Change changes[slotCount];
+    QCOMPARE(state.changes(wanted, changes), 0);
+
+    wanted[6] = visibleButton(1, QStringLiteral("Play"));
+    state.commit(wanted);
+    QCOMPARE(state.changes(wanted, changes), 0);
+}
+
+void tst_QWinThumbnailToolBarState::commitOnlySentFields()
+{
+    QWinThumbnailToolBarState state;
+    QWinThumbnailButtonState wanted[slotCount];
+
+    // the icon of a hidden button is not sent, so it is sent once shown
+    wanted[6] = visibleButton(7, QStringLiteral("Stop"), QWinThumbnailButtonHidden);
+    state.commit(wanted);
+    QCOMPARE(state.sent(6).iconKey, qint64(0));
+
+    wanted[6].flags = QWinThumbnailButtonEnabled;
+    QWinThumbnailToolBarState::Change changes[slotCount];
+    QCOMPARE(state.changes(wanted, changes), 1);
+    QCOMPARE(changes[0].fields, quint32(QWinThumbnailButtonFlagsField | QWinThumbnailButtonIconField | QWinThumbnailButtonToolTipField));
+    state.commit(wanted);
+    QCOMPARE(state.sent(6).iconKey, qint64(7));
+
+    // hiding keeps the icon that is still set on the native button
+    wanted[6].flags = QWinThumbnailButtonHidden;
+    state.commit(wanted);
+    QCOMPARE(state.sent(6).iconKey, qint64(7));
+    wanted[6].flags = QWinThumbnailButtonEnabled;
+    QCOMPARE(state.changes(wanted, changes), 1);
+    QCOMPARE(changes[0].fields, quint32(QWinThumbnailButtonFlagsField));
+}
+
+void tst_QWinThumbnailToolBarState::reset()
+{
+    QWinThumbnailToolBarState state;
+    QWinThumbnailButtonState wanted[slotCount];
+    wanted[6] = visibleButton(1, QStringLiteral("Play"));
+    state.commit(wanted);
+
+    state.reset();
+    QWinThumbnailToolBarState::Change changes[slotCount];
+    QCOMPARE(state.changes(wanted, changes), 1);
+    QCOMPARE(state.sent(6).flags, quint32(QWinThumbnailButtonHidden));
+}
+
+// after a failed update, every field is sent again, and only once
+void tst_QWinThumbnailToolBarState::invalidate()
+{
+    QWinThumbnailToolBarState state;
+    QWinThumbnailButtonState wanted[slotCount];
+    wanted[5] = visibleButton(1, QStringLiteral("Play"));
+    wanted[6] = visibleButton(2, QStringLiteral("Next"));
+    state.commit(wanted);
+
+    state.invalidate();
+    QWinThumbnailToolBarState::Change changes[slotCount];
+    QCOMPARE(state.changes(wanted, changes), slotCount);
+    QCOMPARE(changes[0].fields, quint32(QWinThumbnailButtonFlagsField));
+    QCOMPARE(changes[6].fields, quint32(QWinThumbnailButtonFlagsField | QWinThumbnailButtonIconField | QWinThumbnailButtonToolTipField));
+
+    state.commit(wanted);
+    QCOMPARE(state.changes(wanted, changes), 0);
+
+    // the icon and tooltip of a hidden button stay unknown until it is shown
+    state.invalidate();
+    wanted[6].flags |= QWinThumbnailButtonHidden;
+    state.commit(wanted);
+    QCOMPARE(state.changes(wanted, changes), 0);
+    wanted[6].flags &= ~QWinThumbnailButtonHidden;
+    QCOMPARE(state.changes(wanted, changes), 1);
+    QCOMPARE(changes[0].slot, 6);
+    QCOMPARE(changes[0].fields, quint32(QWinThumbnailButtonFlagsField | QWinThumbnailButtonIconField | QWinThumbnailButtonToolTipField));
+}
+
+void tst_QWinThumbnailToolBarState::buttons()
+{
+    QWinThumbnailToolBarState state;
+    QWinThumbnailButtonState wanted[slotCount];
+    wanted[5] = visibleButton(1, QStringLiteral("Play"));
+    wanted[6] = visibleButton(2, QStringLiteral("Next"));
+    state.commit(wanted);
+
+    wanted[5].iconKey = 3;
+    wanted[6].toolTip = QStringLiteral("Skip");
+    wanted[6].flags = QWinThumbnailButtonDisabled;
+    QWinThumbnailButton buttons[slotCount];
+    QCOMPARE(state.buttons(wanted, buttons), 2);
+    QCOMPARE(buttons[0].id, 5);
+    QCOMPARE(buttons[0].mask, quint32(QWinThumbnailButtonIconField));
+    QCOMPARE(buttons[0].flags, quint32(QWinThumbnailButtonEnabled));
+    QVERIFY(buttons[0].toolTip.isEmpty());
+    QCOMPARE(buttons[0].icon, quintptr(0));
+    QCOMPARE(buttons[1].id, 6);
+    QCOMPARE(buttons[1].mask, quint32(QWinThumbnailButtonFlagsField | QWinThumbnailButtonToolTipField));
+    QCOMPARE(buttons[1].flags, quint32(QWinThumbnailButtonDisabled));
+    QCOMPARE(buttons[1].toolTip, QStringLiteral("Skip"));
+
+    state.commit(wanted);
+    QCOMPARE(state.buttons(wanted, buttons), 0);
+}
+
+void tst_QWinThumbnailToolBarState::resetButtons()
+{
+    QWinThumbnailButton buttons[slotCount];
+    QWinThumbnailToolBarState::resetButtons(buttons);
+    for (int i = 0; i < slotCount; ++i) {
+        QCOMPARE(buttons[i].id, i);
+        QCOMPARE(buttons[i].mask, quint32(QWinThumbnailButtonFlagsField));
+        QCOMPARE(buttons[i].flags, quint32(QWinThumbnailButtonHidden));
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinThumbnailToolBarState)
+
+#include "tst_qwinthumbnailtoolbarstate.moc"
@@ -0,0 +1,9 @@
+CONFIG += testcase
+TARGET = tst_qwinwindowindex
+QT = core testlib
+
+include(../shared/portable.pri)
+
+SOURCES += \
+    tst_qwinwindowindex.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinwindowindex.cpp
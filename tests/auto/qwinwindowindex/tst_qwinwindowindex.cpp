@@ -0,0 +1,168 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinwindowindex_p.h"
+
+// The windows a scan finds, standing in for the top level windows.
+static QHash<quintptr, QObject *> windows;
+
+static void scanWindows(QWinWindowIndex *index)
+{
+    QHash<quintptr, QObject *>::const_iterator it = windows.constBegin();
+    for (; it != windows.constEnd(); ++it)
+        index->insert(it.key(), it.value());
+}
+
+class tst_QWinWindowIndex : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+    void find();
+    void foreignHandles();
+    void createdWindow();
+    void destroyedWindow();
+    void deletedObject();
+    void reusedHandle();
+};
+
+void tst_QWinWindowIndex::init()
+{
+    windows.clear();
+}
+
+void tst_QWinWindowIndex::cleanup()
+{
+    qDeleteAll(windows);
+    windows.clear();
+}
+
+void tst_QWinWindowIndex::find()
+{
+    for (quintptr handle = 0x1000; handle < 0x1100; handle += 0x10)
+        windows.insert(handle, new QObject);
+
+    QWinWindowIndex index(scanWindows);
+    QCOMPARE(index.find(0x1010), windows.value(0x1010));
+    QCOMPARE(index.scanCount(), 1);
+    QCOMPARE(index.count(), windows.size());
+
+    // found without scanning again
+    for (quintptr handle = 0x1000; handle < 0x1100; handle += 0x10)
+        QCOMPARE(index.find(handle), windows.value(handle));
+    QCOMPARE(index.scanCount(), 1);
+}
+
+void tst_QWinWindowIndex::foreignHandles()
+{
+    windows.insert(0x10, new QObject);
+    QWinWindowIndex index(scanWindows);
+
+    QVERIFY(!index.find(0x20));
+    QCOMPARE(index.scanCount(), 1);
+    for (int i = 0; i < 100; ++i)
+        QVERIFY(!index.find(0x20));
+    QCOMPARE(index.scanCount(), 1);
+    QCOMPARE(index.find(0x10), windows.value(0x10));
+    QCOMPARE(index.scanCount(), 1);
+}
+
+void tst_QWinWindowIndex::createdWindow()
+{
+    QWinWindowIndex index(scanWindows);
+    QVERIFY(!index.find(0x30));
+
+    // unknown until the native window is reported as created
+    windows.insert(0x30, new QObject);
+    QVERIFY(!index.find(0x30));
+    index.handleCreated(0x30);
+    QCOMPARE(index.find(0x30), windows.value(0x30));
+    QCOMPARE(index.scanCount(), 2);
+}
+
+void tst_QWinWindowIndex::destroyedWindow()
+{
+    windows.insert(0x10, new QObject);
+    windows.insert(0x20, new QObject);
+    QWinWindowIndex index(scanWindows);
+    QVERIFY(index.find(0x10));
+
+    delete windows.take(0x20);
+    index.handleDestroyed(0x20);
+    QCOMPARE(index.count(), 1);
+    QVERIFY(!index.find(0x20));
+    QCOMPARE(index.scanCount(), 2);
+}
+
+void tst_QWinWindowIndex::deletedObject()
+{
+    windows.insert(0x10, new QObject);
+    QWinWindowIndex index(scanWindows);
+    QVERIFY(index.find(0x10));
+
+    // deleted without a destruction message, the stale entry is not returned
+    delete windows.take(0x10);
+    QVERIFY(!index.find(0x10));
+    QCOMPARE(index.scanCount(), 2);
+}
+
+void tst_QWinWindowIndex::reusedHandle()
+{
+    windows.insert(0x10, new QObject);
+    QWinWindowIndex index(scanWindows);
+    QVERIFY(index.find(0x10));
+
+    QObject *old = windows.take(0x10);
+    index.handleDestroyed(0x10);
+    QObject *reused = new QObject;
+    windows.insert(0x10, reused);
+    index.handleCreated(0x10);
+    QCOMPARE(index.find(0x10), reused);
+    delete old;
+}
+
+QTEST_APPLESS_MAIN(tst_QWinWindowIndex)
+
+#include "tst_qwinwindowindex.moc"
@@ -0,0 +1,17 @@
+# Compiles the platform independent parts of QtWinExtras and of its QML plugin
+# directly into a test, so that they can be tested and benchmarked on any
+# platform.
+
+WINEXTRAS_SOURCE_DIR = $$PWD/../../../src/winextras
+WINEXTRAS_IMPORTS_SOURCE_DIR = $$PWD/../../../src/imports/winextras
+
+# The test doubles, like the recording shell backend, are not part of the
+# module and live next to this file.
+WINEXTRAS_TEST_SOURCE_DIR = $$PWD
+
+INCLUDEPATH += $$WINEXTRAS_SOURCE_DIR $$WINEXTRAS_IMPORTS_SOURCE_DIR $$WINEXTRAS_TEST_SOURCE_DIR $$OUT_PWD/include
+DEFINES += QT_BUILD_WINEXTRAS_LIB
+
+# The module headers are only generated when building the module itself.
+WINEXTRAS_GLOBAL_HEADER = "$${LITERAL_HASH}include \"$$WINEXTRAS_SOURCE_DIR/qwinextrasglobal.h\""
+write_file($$OUT_PWD/include/QtWinExtras/qwinextrasglobal.h, WINEXTRAS_GLOBAL_HEADER)|error("Cannot write the forwarding header.")
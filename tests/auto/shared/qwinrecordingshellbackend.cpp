@@ -0,0 +1,497 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qwinrecordingshellbackend_p.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QThread>
+
+QT_BEGIN_NAMESPACE
+
+static const qint32 unexpectedResult = qint32(0x8000FFFF);  // E_UNEXPECTED
+static const qint32 invalidArgResult = qint32(0x80070057);  // E_INVALIDARG
+
+static inline qint64 stringSize(const QString &string)
+{
+    return string.size() * qint64(sizeof(ushort));
+}
+
+static qint64 itemSize(const QWinJumpListItemSnapshot &item)
+{
+    qint64 size = stringSize(item.filePath) + stringSize(item.workingDirectory)
+            + stringSize(item.title) + stringSize(item.description);
+    foreach (const QString &argument, item.arguments)
+        size += stringSize(argument);
+    return size;
+}
+
+static qint64 buttonSize(const QWinThumbnailButton &button)
+{
+    return 3 * sizeof(quint32) + sizeof(quintptr) + stringSize(button.toolTip);
+}
+
+// Records a call from its construction to its destruction, and makes it
+// take as long as the latency set for it. The backend is locked for as long
+// as the call lasts, apart from the latency.
+class QWinRecordingShellBackend::Recording
+{
+public:
+    Recording(QWinRecordingShellBackend *backend, Call call, qint64 payload) :
+        m_backend(backend), m_call(call), m_locker(&backend->m_mutex)
+    {
+        m_timer.start();
+        Record &record = m_backend->m_records[m_call];
+        ++record.count;
+        record.payload += payload;
+        m_backend->m_calls.append(m_call);
+        if (m_backend->m_latencies[m_call] > 0) {
+            const int latency = m_backend->m_latencies[m_call];
+            m_locker.unlock();
+            QThread::usleep(latency);
+            m_locker.relock();
+        }
+    }
+
+    ~Recording()
+    {
+        m_backend->m_records[m_call].nsecs += m_timer.nsecsElapsed();
+    }
+
+    void addPayload(qint64 payload) { m_backend->m_records[m_call].payload += payload; }
+    qint32 result() const { return m_backend->m_results[m_call]; }
+    bool failed() const { return m_backend->m_results[m_call] < 0; }
+
+private:
+    QWinRecordingShellBackend *m_backend;
+    Call m_call;
+    QMutexLocker m_locker;
+    QElapsedTimer m_timer;
+};
+
+QWinRecordingShellBackend::QWinRecordingShellBackend() :
+    m_listBegun(false), m_commitCount(0), m_nextObject(1),
+    m_compositionEnabled(true), m_colorization(0), m_opaqueBlend(false)
+{
+    for (int i = 0; i < CallCount; ++i) {
+        m_latencies[i] = 0;
+        m_results[i] = 0;
+    }
+}
+
+int QWinRecordingShellBackend::totalCallCount() const
+{
+    int count = 0;
+    for (int i = 0; i < CallCount; ++i)
+        count += m_records[i].count;
+    return count;
+}
+
+qint64 QWinRecordingShellBackend::totalPayloadSize() const
+{
+    qint64 payload = 0;
+    for (int i = 0; i < CallCount; ++i)
+        payload += m_records[i].payload;
+    return payload;
+}
+
+qint64 QWinRecordingShellBackend::totalElapsed() const
+{
+    qint64 nsecs = 0;
+    for (int i = 0; i < CallCount; ++i)
+        nsecs += m_records[i].nsecs;
+    return nsecs;
+}
+
+/*
+    Forgets the recorded calls, but not the state of the shell.
+ */
+void QWinRecordingShellBackend::resetRecording()
+{
+    for (int i = 0; i < CallCount; ++i)
+        m_records[i] = Record();
+    m_calls.clear();
+}
+
+void QWinRecordingShellBackend::setLatency(int usecs)
+{
+    for (int i = 0; i < CallCount; ++i)
+        m_latencies[i] = usecs;
+}
+
+void QWinRecordingShellBackend::setDocuments(const QString &appId, DocumentList list, const QVector<QWinShellDocument> &documents)
+{
+    QMutexLocker locker(&m_mutex);
+    m_documents[list].insert(appId, documents);
+}
+
+void QWinRecordingShellBackend::setColorization(quint32 argb, bool opaqueBlend)
+{
+    m_colorization = argb;
+    m_opaqueBlend = opaqueBlend;
+}
+
+qint32 QWinRecordingShellBackend::setProgressValue(quintptr window, quint64 completed, quint64 total)
+{
+    Recording recording(this, SetProgressValue, sizeof(window) + sizeof(completed) + sizeof(total));
+    if (!recording.failed())
+        m_progress.insert(window, qMakePair(completed, total));
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::setProgressState(quintptr window, QWinTaskbarProgressState state)
+{
+    Recording recording(this, SetProgressState, sizeof(window) + sizeof(quint32));
+    if (!recording.failed())
+        m_progressStates.insert(window, state);
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::setOverlayIcon(quintptr window, quintptr icon, const QString &description)
+{
+    Recording recording(this, SetOverlayIcon, sizeof(window) + sizeof(icon) + stringSize(description));
+    if (!recording.failed()) {
+        m_overlayIcons.insert(window, icon);
+        m_overlayDescriptions.insert(window, description);
+    }
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::addThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count)
+{
+    Recording recording(this, AddThumbnailButtons, sizeof(window));
+    for (int i = 0; i < count; ++i)
+        recording.addPayload(buttonSize(buttons[i]));
+    if (recording.failed())
+        return recording.result();
+    QVector<QWinThumbnailButton> &added = m_thumbnailButtons[window];
+    added.clear();
+    for (int i = 0; i < count; ++i)
+        added.append(buttons[i]);
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::updateThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count)
+{
+    Recording recording(this, UpdateThumbnailButtons, sizeof(window));
+    for (int i = 0; i < count; ++i)
+        recording.addPayload(buttonSize(buttons[i]));
+    if (recording.failed())
+        return recording.result();
+    if (!m_thumbnailButtons.contains(window))
+        return invalidArgResult;
+    QVector<QWinThumbnailButton> &added = m_thumbnailButtons[window];
+    for (int i = 0; i < count; ++i) {
+        for (int b = 0; b < added.size(); ++b) {
+            QWinThumbnailButton &button = added[b];
+            if (button.id != buttons[i].id)
+                continue;
+            if (buttons[i].mask & QWinThumbnailButtonFlagsField)
+                button.flags = buttons[i].flags;
+            if (buttons[i].mask & QWinThumbnailButtonIconField)
+                button.icon = buttons[i].icon;
+            if (buttons[i].mask & QWinThumbnailButtonToolTipField)
+                button.toolTip = buttons[i].toolTip;
+            button.mask |= buttons[i].mask;
+        }
+    }
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::beginList(const QString &appId)
+{
+    Recording recording(this, BeginList, stringSize(appId));
+    if (recording.failed())
+        return recording.result();
+    m_listBegun = true;
+    m_pendingList = QWinJumpListSnapshot();
+    m_pendingList.identifier = appId;
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::appendKnownCategory(KnownCategory category)
+{
+    Recording recording(this, AppendKnownCategory, sizeof(quint32));
+    if (recording.failed())
+        return recording.result();
+    if (!m_listBegun)
+        return unexpectedResult;
+    QWinJumpListCategorySnapshot known;
+    known.type = category == RecentCategory ? QWinJumpListCategory::Recent : QWinJumpListCategory::Frequent;
+    m_pendingList.categories.append(known);
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::appendCategory(const QString &title, Object collection)
+{
+    Recording recording(this, AppendCategory, stringSize(title) + sizeof(collection));
+    if (recording.failed())
+        return recording.result();
+    if (!m_listBegun)
+        return unexpectedResult;
+    if (!m_objects.value(collection).collection)
+        return invalidArgResult;
+    QWinJumpListCategorySnapshot custom;
+    custom.title = title;
+    custom.items = collectionItems(collection);
+    m_pendingList.categories.append(custom);
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::addUserTasks(Object collection)
+{
+    Recording recording(this, AddUserTasks, sizeof(collection));
+    if (recording.failed())
+        return recording.result();
+    if (!m_listBegun)
+        return unexpectedResult;
+    if (!m_objects.value(collection).collection)
+        return invalidArgResult;
+    QWinJumpListCategorySnapshot tasks;
+    tasks.type = QWinJumpListCategory::Tasks;
+    tasks.items = collectionItems(collection);
+    m_pendingList.categories.append(tasks);
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::commitList()
+{
+    Recording recording(this, CommitList, 0);
+    if (recording.failed())
+        return recording.result();
+    if (!m_listBegun)
+        return unexpectedResult;
+    m_listBegun = false;
+    m_committedList = m_pendingList;
+    ++m_commitCount;
+    return recording.result();
+}
+
+QWinShellBackend::Object QWinRecordingShellBackend::createObject(const ObjectData &data)
+{
+    const Object object = m_nextObject++;
+    m_objects.insert(object, data);
+    return object;
+}
+
+QVector<QWinJumpListItemSnapshot> QWinRecordingShellBackend::collectionItems(Object collection) const
+{
+    QVector<QWinJumpListItemSnapshot> items;
+    foreach (Object object, m_objects.value(collection).objects)
+        items.append(m_objects.value(object).item);
+    return items;
+}
+
+QWinShellBackend::Object QWinRecordingShellBackend::createLink(const QWinJumpListItemSnapshot &item, const QString &iconPath)
+{
+    Recording recording(this, CreateLink, itemSize(item) + stringSize(iconPath));
+    if (recording.failed())
+        return 0;
+    ObjectData data;
+    data.item = item;
+    data.item.type = QWinJumpListItem::Link;
+    return createObject(data);
+}
+
+QWinShellBackend::Object QWinRecordingShellBackend::createDestination(const QString &filePath)
+{
+    Recording recording(this, CreateDestination, stringSize(filePath));
+    if (recording.failed())
+        return 0;
+    ObjectData data;
+    data.item.type = QWinJumpListItem::Destination;
+    data.item.filePath = filePath;
+    return createObject(data);
+}
+
+QWinShellBackend::Object QWinRecordingShellBackend::createSeparator()
+{
+    Recording recording(this, CreateSeparator, 0);
+    if (recording.failed())
+        return 0;
+    ObjectData data;
+    data.item.type = QWinJumpListItem::Separator;
+    return createObject(data);
+}
+
+QWinShellBackend::Object QWinRecordingShellBackend::createCollection(const Object *objects, int count)
+{
+    Recording recording(this, CreateCollection, count * qint64(sizeof(Object)));
+    if (recording.failed())
+        return 0;
+    ObjectData data;
+    data.collection = true;
+    for (int i = 0; i < count; ++i) {
+        // like IObjectCollection::AddObject()
+        if (objects[i] && m_objects.contains(objects[i])) {
+            ++m_objects[objects[i]].refs;
+            data.objects.append(objects[i]);
+        }
+    }
+    return createObject(data);
+}
+
+void QWinRecordingShellBackend::addRef(Object object)
+{
+    Recording recording(this, AddRef, sizeof(object));
+    QHash<Object, ObjectData>::iterator it = m_objects.find(object);
+    if (it != m_objects.end())
+        ++it->refs;
+}
+
+void QWinRecordingShellBackend::release(Object object)
+{
+    Recording recording(this, Release, sizeof(object));
+    dereference(object);
+}
+
+void QWinRecordingShellBackend::dereference(Object object)
+{
+    QHash<Object, ObjectData>::iterator it = m_objects.find(object);
+    if (it == m_objects.end() || --it->refs > 0)
+        return;
+    const QVector<Object> objects = it->objects;
+    m_objects.erase(it);
+    foreach (Object child, objects)
+        dereference(child);
+}
+
+qint32 QWinRecordingShellBackend::documents(const QString &appId, DocumentList list, QVector<QWinShellDocument> *documents)
+{
+    Recording recording(this, Documents, stringSize(appId));
+    if (recording.failed())
+        return recording.result();
+    *documents = m_documents[list].value(appId);
+    foreach (const QWinShellDocument &document, *documents) {
+        recording.addPayload(stringSize(document.filePath) + stringSize(document.description)
+                             + stringSize(document.arguments) + stringSize(document.iconPath));
+    }
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::addRecentDocument(const QString &appId, const QWinJumpListItemSnapshot &item, const QString &iconPath)
+{
+    Recording recording(this, AddRecentDocument, stringSize(appId) + itemSize(item) + stringSize(iconPath));
+    if (recording.failed())
+        return recording.result();
+    QWinShellDocument document;
+    document.type = QWinJumpListItem::Link;
+    document.filePath = item.filePath;
+    document.description = item.description;
+    document.arguments = item.arguments.join(QLatin1Char(' '));
+    document.iconPath = iconPath;
+    m_documents[RecentDocuments][appId].prepend(document);
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::clearDocuments(const QString &appId)
+{
+    Recording recording(this, ClearDocuments, stringSize(appId));
+    if (recording.failed())
+        return recording.result();
+    m_documents[RecentDocuments].remove(appId);
+    m_documents[FrequentDocuments].remove(appId);
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::setWindowAttribute(quintptr window, quint32 attribute, const void *value, quint32 size)
+{
+    Recording recording(this, SetWindowAttribute, sizeof(window) + sizeof(attribute) + size);
+    if (!recording.failed())
+        m_attributes.insert(qMakePair(window, attribute), QByteArray(static_cast<const char *>(value), size));
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::windowAttribute(quintptr window, quint32 attribute, void *value, quint32 size)
+{
+    Recording recording(this, WindowAttribute, sizeof(window) + sizeof(attribute) + size);
+    if (recording.failed())
+        return recording.result();
+    const QByteArray data = m_attributes.value(qMakePair(window, attribute), QByteArray(int(size), '\0'));
+    if (quint32(data.size()) != size)
+        return invalidArgResult;
+    memcpy(value, data.constData(), size);
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::extendFrameIntoClientArea(quintptr window, int left, int top, int right, int bottom)
+{
+    Q_UNUSED(left)
+    Q_UNUSED(top)
+    Q_UNUSED(right)
+    Q_UNUSED(bottom)
+    Recording recording(this, ExtendFrameIntoClientArea, sizeof(window) + 4 * sizeof(int));
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::enableBlurBehindWindow(quintptr window, bool enable, quintptr region)
+{
+    Q_UNUSED(enable)
+    Recording recording(this, EnableBlurBehindWindow, sizeof(window) + sizeof(quint32) + sizeof(region));
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::isCompositionEnabled(bool *enabled)
+{
+    Recording recording(this, IsCompositionEnabled, sizeof(quint32));
+    if (!recording.failed())
+        *enabled = m_compositionEnabled;
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::enableComposition(bool enable)
+{
+    Recording recording(this, EnableComposition, sizeof(quint32));
+    if (!recording.failed())
+        m_compositionEnabled = enable;
+    return recording.result();
+}
+
+qint32 QWinRecordingShellBackend::colorizationColor(quint32 *argb, bool *opaqueBlend)
+{
+    Recording recording(this, ColorizationColor, 2 * sizeof(quint32));
+    if (!recording.failed()) {
+        *argb = m_colorization;
+        *opaqueBlend = m_opaqueBlend;
+    }
+    return recording.result();
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,187 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the QtWinExtras module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QWINRECORDINGSHELLBACKEND_P_H
+#define QWINRECORDINGSHELLBACKEND_P_H
+
+#include <QtCore/QHash>
+#include <QtCore/QPair>
+#include <QtCore/QByteArray>
+#include <QtCore/QMutex>
+
+#include "qwinshellbackend_p.h"
+
+QT_BEGIN_NAMESPACE
+
+// A shell in memory: remembers what it was told and records how often each
+// function was called, how many bytes were passed to it and how long it
+// took. Calls can be made to fail or to take longer, to see how the callers
+// cope with a slow or broken shell.
+//
+// Payloads count strings as UTF-16 and handles as pointers, but leave out
+// the fixed size buffers of the native structures.
+//
+// Calls may be made from several threads, but are recorded one at a time;
+// only the latency is spent outside of the lock. The recording is read once
+// the calls are done.
+class Q_WINEXTRAS_EXPORT QWinRecordingShellBackend : public QWinShellBackend
+{
+public:
+    QWinRecordingShellBackend();
+
+    int callCount(Call call) const { return m_records[call].count; }
+    qint64 payloadSize(Call call) const { return m_records[call].payload; }
+    qint64 elapsed(Call call) const { return m_records[call].nsecs; }
+    int totalCallCount() const;
+    qint64 totalPayloadSize() const;
+    qint64 totalElapsed() const;
+    const QVector<Call> &calls() const { return m_calls; }
+    void resetRecording();
+
+    void setLatency(Call call, int usecs) { m_latencies[call] = usecs; }
+    void setLatency(int usecs);
+    void setResult(Call call, qint32 hresult) { m_results[call] = hresult; }
+
+    quint64 progressCompleted(quintptr window) const { return m_progress.value(window).first; }
+    quint64 progressTotal(quintptr window) const { return m_progress.value(window).second; }
+    QWinTaskbarProgressState progressState(quintptr window) const { return m_progressStates.value(window, QWinTaskbarProgressNone); }
+    quintptr overlayIcon(quintptr window) const { return m_overlayIcons.value(window); }
+    QString overlayDescription(quintptr window) const { return m_overlayDescriptions.value(window); }
+    QVector<QWinThumbnailButton> thumbnailButtons(quintptr window) const { return m_thumbnailButtons.value(window); }
+
+    // The categories passed between the last BeginList() and CommitList().
+    const QWinJumpListSnapshot &committedList() const { return m_committedList; }
+    int commitCount() const { return m_commitCount; }
+    int liveObjectCount() const { return m_objects.size(); }
+
+    void setDocuments(const QString &appId, DocumentList list, const QVector<QWinShellDocument> &documents);
+    void setCompositionEnabled(bool enabled) { m_compositionEnabled = enabled; }
+    void setColorization(quint32 argb, bool opaqueBlend);
+
+    qint32 setProgressValue(quintptr window, quint64 completed, quint64 total) Q_DECL_OVERRIDE;
+    qint32 setProgressState(quintptr window, QWinTaskbarProgressState state) Q_DECL_OVERRIDE;
+    qint32 setOverlayIcon(quintptr window, quintptr icon, const QString &description) Q_DECL_OVERRIDE;
+    qint32 addThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count) Q_DECL_OVERRIDE;
+    qint32 updateThumbnailButtons(quintptr window, const QWinThumbnailButton *buttons, int count) Q_DECL_OVERRIDE;
+
+    qint32 beginList(const QString &appId) Q_DECL_OVERRIDE;
+    qint32 appendKnownCategory(KnownCategory category) Q_DECL_OVERRIDE;
+    qint32 appendCategory(const QString &title, Object collection) Q_DECL_OVERRIDE;
+    qint32 addUserTasks(Object collection) Q_DECL_OVERRIDE;
+    qint32 commitList() Q_DECL_OVERRIDE;
+
+    Object createLink(const QWinJumpListItemSnapshot &item, const QString &iconPath) Q_DECL_OVERRIDE;
+    Object createDestination(const QString &filePath) Q_DECL_OVERRIDE;
+    Object createSeparator() Q_DECL_OVERRIDE;
+    Object createCollection(const Object *objects, int count) Q_DECL_OVERRIDE;
+    void addRef(Object object) Q_DECL_OVERRIDE;
+    void release(Object object) Q_DECL_OVERRIDE;
+
+    qint32 documents(const QString &appId, DocumentList list, QVector<QWinShellDocument> *documents) Q_DECL_OVERRIDE;
+    qint32 addRecentDocument(const QString &appId, const QWinJumpListItemSnapshot &item, const QString &iconPath) Q_DECL_OVERRIDE;
+    qint32 clearDocuments(const QString &appId) Q_DECL_OVERRIDE;
+
+    qint32 setWindowAttribute(quintptr window, quint32 attribute, const void *value, quint32 size) Q_DECL_OVERRIDE;
+    qint32 windowAttribute(quintptr window, quint32 attribute, void *value, quint32 size) Q_DECL_OVERRIDE;
+    qint32 extendFrameIntoClientArea(quintptr window, int left, int top, int right, int bottom) Q_DECL_OVERRIDE;
+    qint32 enableBlurBehindWindow(quintptr window, bool enable, quintptr region) Q_DECL_OVERRIDE;
+    qint32 isCompositionEnabled(bool *enabled) Q_DECL_OVERRIDE;
+    qint32 enableComposition(bool enable) Q_DECL_OVERRIDE;
+    qint32 colorizationColor(quint32 *argb, bool *opaqueBlend) Q_DECL_OVERRIDE;
+
+private:
+    Q_DISABLE_COPY(QWinRecordingShellBackend)
+
+    class Recording;
+    friend class Recording;
+
+    struct Record
+    {
+        Record() : count(0), payload(0), nsecs(0) {}
+
+        int count;
+        qint64 payload;
+        qint64 nsecs;
+    };
+
+    struct ObjectData
+    {
+        ObjectData() : refs(1), collection(false) {}
+
+        int refs;
+        bool collection;
+        QWinJumpListItemSnapshot item;
+        QVector<Object> objects;
+    };
+
+    Object createObject(const ObjectData &data);
+    void dereference(Object object);
+    QVector<QWinJumpListItemSnapshot> collectionItems(Object collection) const;
+
+    QMutex m_mutex;
+    Record m_records[CallCount];
+    int m_latencies[CallCount];
+    qint32 m_results[CallCount];
+    QVector<Call> m_calls;
+
+    QHash<quintptr, QPair<quint64, quint64> > m_progress;
+    QHash<quintptr, QWinTaskbarProgressState> m_progressStates;
+    QHash<quintptr, quintptr> m_overlayIcons;
+    QHash<quintptr, QString> m_overlayDescriptions;
+    QHash<quintptr, QVector<QWinThumbnailButton> > m_thumbnailButtons;
+
+    bool m_listBegun;
+    QWinJumpListSnapshot m_pendingList;
+    QWinJumpListSnapshot m_committedList;
+    int m_commitCount;
+    QHash<Object, ObjectData> m_objects;
+    Object m_nextObject;
+    QHash<QString, QVector<QWinShellDocument> > m_documents[2];
+
+    QHash<QPair<quintptr, quint32>, QByteArray> m_attributes;
+    bool m_compositionEnabled;
+    quint32 m_colorization;
+    bool m_opaqueBlend;
+};
+
+QT_END_NAMESPACE
+
+#endif // QWINRECORDINGSHELLBACKEND_P_H
@@ -0,0 +1,14 @@
+TEMPLATE = subdirs
+SUBDIRS += \
+    qwinpixelconversion \
+    qwinregiondata \
+    qwinhresult \
+    qwintaskbarprogressreporter \
+    qwintaskbarprogressaggregator \
+    qwinwindowindex \
+    qwinthumbnailtoolbarrouter \
+    qquickiconcache \
+    qwinjumplistcommitter \
+    qwinshellmetrics \
+    qwinshelltrace \
+    qwinshellexecutor
@@ -0,0 +1,11 @@
+TARGET = tst_bench_qquickiconcache
+QT = core gui network qml quick testlib
+
+include(../../auto/shared/portable.pri)
+
+SOURCES += \
+    tst_bench_qquickiconcache.cpp \
+    $$WINEXTRAS_IMPORTS_SOURCE_DIR/qquickiconcache.cpp
+
+HEADERS += \
+    $$WINEXTRAS_IMPORTS_SOURCE_DIR/qquickiconcache_p.h
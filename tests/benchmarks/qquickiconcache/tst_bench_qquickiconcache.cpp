@@ -0,0 +1,239 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtGui/QGuiApplication>
+#include <QtGui/QIcon>
+#include <QtGui/QImage>
+#include <QtGui/QPixmap>
+#include <QtQml/QQmlEngine>
+#include <QtQml/QQmlComponent>
+#include <QtQuick/QQuickItem>
+
+#include <limits>
+
+#include "qquickiconcache_p.h"
+
+// Stands in for the thumbnail buttons and taskbar overlays of a scene: asks
+// for its icon like QQuickIconLoader does, or decodes it on the GUI thread
+// like QQuickIconLoader did before.
+class IconConsumer : public QQuickItem, public QQuickIconReceiver
+{
+    Q_OBJECT
+    Q_PROPERTY(QUrl source READ source WRITE setSource)
+
+public:
+    static QQuickIconCache *cache;
+    static bool synchronous;
+    static int loadedCount;
+
+    IconConsumer() : m_waiting(false) {}
+
+    ~IconConsumer()
+    {
+        if (m_waiting)
+            cache->cancel(m_source, QSize(), this);
+    }
+
+    QUrl source() const { return m_source; }
+
+    void setSource(const QUrl &source)
+    {
+        m_source = source;
+        if (synchronous) {
+            m_icon = QIcon(QPixmap(source.toLocalFile()));
+            ++loadedCount;
+            return;
+        }
+        m_icon = cache->find(source, QSize());
+        if (!m_icon.isNull()) {
+            ++loadedCount;
+            return;
+        }
+        m_waiting = true;
+        cache->load(source, QSize(), 0, this);
+    }
+
+    void iconLoaded(const QIcon &icon)
+    {
+        m_waiting = false;
+        m_icon = icon;
+        ++loadedCount;
+    }
+
+private:
+    QUrl m_source;
+    QIcon m_icon;
+    bool m_waiting;
+};
+
+QQuickIconCache *IconConsumer::cache = 0;
+bool IconConsumer::synchronous = false;
+int IconConsumer::loadedCount = 0;
+
+class tst_QQuickIconCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void startup_data();
+    void startup();
+    void allLoaded_data();
+    void allLoaded();
+
+private:
+    QObject *createScene(QQmlEngine *engine, int delegates, int icons);
+
+    QTemporaryDir m_iconDirectory;
+    enum { IconCount = 64, IconSize = 256 };
+};
+
+void tst_QQuickIconCache::initTestCase()
+{
+    QVERIFY(m_iconDirectory.isValid());
+    qmlRegisterType<IconConsumer>("IconBenchmark", 1, 0, "IconConsumer");
+
+    // noise keeps the images from compressing into trivial files
+    qsrand(1);
+    for (int i = 0; i < IconCount; ++i) {
+        QImage image(IconSize, IconSize, QImage::Format_ARGB32);
+        for (int y = 0; y < IconSize; ++y) {
+            QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+            for (int x = 0; x < IconSize; ++x)
+                line[x] = qRgba(x, y, qrand() & 0xff, 0xff);
+        }
+        QVERIFY(image.save(m_iconDirectory.path() + QStringLiteral("/icon%1.png").arg(i)));
+    }
+}
+
+QObject *tst_QQuickIconCache::createScene(QQmlEngine *engine, int delegates, int icons)
+{
+    const QString source = QStringLiteral(
+        "import QtQuick 2.0\n"
+        "import IconBenchmark 1.0\n"
+        "Item {\n"
+        "    Repeater {\n"
+        "        model: %1\n"
+        "        IconConsumer { source: \"%2/icon\" + (index % %3) + \".png\" }\n"
+        "    }\n"
+        "}\n").arg(delegates).arg(QUrl::fromLocalFile(m_iconDirectory.path()).toString()).arg(icons);
+    QQmlComponent component(engine);
+    component.setData(source.toUtf8(), QUrl());
+    return component.create();
+}
+
+void tst_QQuickIconCache::startup_data()
+{
+    QTest::addColumn<bool>("synchronous");
+    QTest::addColumn<int>("delegates");
+    QTest::addColumn<int>("icons");
+
+    QTest::newRow("synchronous, 100 delegates, 16 icons") << true << 100 << 16;
+    QTest::newRow("cache, 100 delegates, 16 icons") << false << 100 << 16;
+    QTest::newRow("synchronous, 400 delegates, 64 icons") << true << 400 << 64;
+    QTest::newRow("cache, 400 delegates, 64 icons") << false << 400 << 64;
+}
+
+// How long the GUI thread is blocked creating the scene. Only the creation
+// is timed; the icons are waited for before the next run, outside of it.
+void tst_QQuickIconCache::startup()
+{
+    QFETCH(bool, synchronous);
+    QFETCH(int, delegates);
+    QFETCH(int, icons);
+
+    QQmlEngine engine;
+    IconConsumer::synchronous = synchronous;
+    qint64 fastest = std::numeric_limits<qint64>::max();
+    for (int run = 0; run < 5; ++run) {
+        QQuickIconCache cache;
+        IconConsumer::cache = &cache;
+        IconConsumer::loadedCount = 0;
+        QElapsedTimer timer;
+        timer.start();
+        QObject *scene = createScene(&engine, delegates, icons);
+        fastest = qMin(fastest, timer.nsecsElapsed());
+        QVERIFY(scene);
+        while (IconConsumer::loadedCount < delegates)
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+        delete scene;
+    }
+    QTest::setBenchmarkResult(qreal(fastest) / 1000000, QTest::WalltimeMilliseconds);
+}
+
+void tst_QQuickIconCache::allLoaded_data()
+{
+    startup_data();
+}
+
+// How long it takes until every delegate has its icon.
+void tst_QQuickIconCache::allLoaded()
+{
+    QFETCH(bool, synchronous);
+    QFETCH(int, delegates);
+    QFETCH(int, icons);
+
+    QQmlEngine engine;
+    IconConsumer::synchronous = synchronous;
+    QBENCHMARK {
+        QQuickIconCache cache;
+        IconConsumer::cache = &cache;
+        IconConsumer::loadedCount = 0;
+        QObject *scene = createScene(&engine, delegates, icons);
+        QVERIFY(scene);
+        while (IconConsumer::loadedCount < delegates)
+            QCoreApplication::processEvents(QEventLoop::WaitForMoreEvents);
+        delete scene;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // the scene is never shown, so any machine can run the benchmark
+    if (qgetenv("QT_QPA_PLATFORM").isEmpty())
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    QGuiApplication app(argc, argv);
+    tst_QQuickIconCache test;
+    return QTest::qExec(&test, argc, argv);
+}
+
+#include "tst_bench_qquickiconcache.moc"
@@ -0,0 +1,8 @@
+TARGET = tst_bench_qwinhresult
+QT = core testlib
+
+include(../../auto/shared/portable.pri)
+
+SOURCES += \
+    tst_bench_qwinhresult.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresult.cpp
@@ -0,0 +1,86 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinhresult_p.h"
+
+class tst_QWinHresult : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void name();
+    void nameOfUnknown();
+    void fromName();
+};
+
+void tst_QWinHresult::name()
+{
+    QBENCHMARK {
+        for (int i = 0; i < qt_winHresultNameCount; ++i)
+            qt_winHresultName(qt_winHresultNames[i].code);
+    }
+}
+
+void tst_QWinHresult::nameOfUnknown()
+{
+    QBENCHMARK {
+        for (int i = 0; i < qt_winHresultNameCount; ++i)
+            qt_winHresultName(qt_winHresultNames[i].code + 0x1000);
+    }
+}
+
+void tst_QWinHresult::fromName()
+{
+    QList<QString> names;
+    for (int i = 0; i < qt_winHresultNameCount; ++i)
+        names.append(QString::fromLatin1(qt_winHresultNames[i].name));
+    quint32 code;
+    QBENCHMARK {
+        foreach (const QString &name, names)
+            qt_winHresultFromName(name, &code);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinHresult)
+
+#include "tst_bench_qwinhresult.moc"
@@ -0,0 +1,14 @@
+TARGET = tst_bench_qwinjumplistcommitter
+QT = core gui testlib
+
+include(../../auto/shared/portable.pri)
+
+SOURCES += \
+    tst_bench_qwinjumplistcommitter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistcommitter.cpp \
+    $$WINEXTRAS_TEST_SOURCE_DIR/qwinrecordingshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinthumbnailtoolbarstate.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistsnapshot.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwiniconstore.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresult.cpp
@@ -0,0 +1,185 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QTemporaryDir>
+
+#include "qwinjumplistcommitter_p.h"
+#include "qwinrecordingshellbackend_p.h"
+#include "qwiniconstore_p.h"
+
+// A custom category of recent projects and a few tasks, as an IDE would have.
+static QWinJumpListSnapshot jumpList(int projectCount, int revision)
+{
+    QWinJumpListSnapshot snapshot;
+    snapshot.identifier = QStringLiteral("Org.Ide");
+
+    QWinJumpListCategorySnapshot projects;
+    projects.title = QStringLiteral("Projects");
+    for (int i = 0; i < projectCount; ++i) {
+        QWinJumpListItemSnapshot project;
+        project.type = QWinJumpListItem::Link;
+        project.filePath = QStringLiteral("C:/Program Files/Ide/ide.exe");
+        project.title = QStringLiteral("Project %1").arg(i);
+        project.arguments << QStringLiteral("C:/Projects/project%1/project%1.pro").arg(i);
+        projects.items.append(project);
+    }
+    // the first project is the one that changes
+    if (projectCount)
+        projects.items[0].description = QString::number(revision);
+    snapshot.categories.append(projects);
+
+    QWinJumpListCategorySnapshot tasks;
+    tasks.type = QWinJumpListCategory::Tasks;
+    for (int i = 0; i < 3; ++i) {
+        QWinJumpListItemSnapshot task;
+        task.type = QWinJumpListItem::Link;
+        task.filePath = QStringLiteral("C:/Program Files/Ide/ide.exe");
+        task.title = QStringLiteral("Task %1").arg(i);
+        task.arguments << QStringLiteral("--task") << QString::number(i);
+        tasks.items.append(task);
+    }
+    snapshot.categories.append(tasks);
+    return snapshot;
+}
+
+class tst_QWinJumpListCommitter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void rebuild_data();
+    void rebuild();
+    void oneItemChanged_data();
+    void oneItemChanged();
+    void unchanged_data();
+    void unchanged();
+
+private:
+    void projectCounts();
+
+    QTemporaryDir *m_directory;
+    QWinIconStore *m_iconStore;
+};
+
+void tst_QWinJumpListCommitter::init()
+{
+    m_directory = new QTemporaryDir;
+    QVERIFY(m_directory->isValid());
+    m_iconStore = new QWinIconStore(m_directory->path());
+}
+
+void tst_QWinJumpListCommitter::cleanup()
+{
+    delete m_iconStore;
+    m_iconStore = 0;
+    delete m_directory;
+    m_directory = 0;
+}
+
+void tst_QWinJumpListCommitter::projectCounts()
+{
+    QTest::addColumn<int>("projectCount");
+    QTest::newRow("10") << 10;
+    QTest::newRow("50") << 50;
+}
+
+// What every change cost before: all shell objects created again.
+void tst_QWinJumpListCommitter::rebuild_data()
+{
+    projectCounts();
+}
+
+void tst_QWinJumpListCommitter::rebuild()
+{
+    QFETCH(int, projectCount);
+    QWinRecordingShellBackend backend;
+    QWinJumpListCommitter committer(&backend, m_iconStore);
+    int revision = 0;
+    QBENCHMARK {
+        committer.releaseCommitted();
+        committer.commit(jumpList(projectCount, ++revision), 0);
+    }
+    QCOMPARE(backend.liveObjectCount(), projectCount + 3 + 2);
+}
+
+void tst_QWinJumpListCommitter::oneItemChanged_data()
+{
+    projectCounts();
+}
+
+void tst_QWinJumpListCommitter::oneItemChanged()
+{
+    QFETCH(int, projectCount);
+    QWinRecordingShellBackend backend;
+    QWinJumpListCommitter committer(&backend, m_iconStore);
+    int revision = 0;
+    committer.commit(jumpList(projectCount, revision), 0);
+    QBENCHMARK {
+        committer.commit(jumpList(projectCount, ++revision), 0);
+    }
+    QCOMPARE(backend.liveObjectCount(), projectCount + 3 + 2);
+}
+
+void tst_QWinJumpListCommitter::unchanged_data()
+{
+    projectCounts();
+}
+
+void tst_QWinJumpListCommitter::unchanged()
+{
+    QFETCH(int, projectCount);
+    QWinRecordingShellBackend backend;
+    QWinJumpListCommitter committer(&backend, m_iconStore);
+    const QWinJumpListSnapshot snapshot = jumpList(projectCount, 0);
+    committer.commit(snapshot, 0);
+    QBENCHMARK {
+        committer.commit(snapshot, 0);
+    }
+    QCOMPARE(backend.commitCount(), 1);
+}
+
+QTEST_GUILESS_MAIN(tst_QWinJumpListCommitter)
+
+#include "tst_bench_qwinjumplistcommitter.moc"
@@ -0,0 +1,11 @@
+TARGET = tst_bench_qwinpixelconversion
+QT = core core-private testlib
+
+include(../../auto/shared/portable.pri)
+
+SOURCES += \
+    tst_bench_qwinpixelconversion.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion.cpp
+
+AVX2_SOURCES += $$WINEXTRAS_SOURCE_DIR/qwinpixelconversion_avx2.cpp
+load(simd)
@@ -0,0 +1,113 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QVector>
+
+#include "qwinpixelconversion_p.h"
+
+Q_DECLARE_METATYPE(QWinPixelOperation)
+
+class tst_QWinPixelConversion : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void convertRows_data();
+    void convertRows();
+};
+
+void tst_QWinPixelConversion::convertRows_data()
+{
+    QTest::addColumn<QWinPixelOperation>("operation");
+    QTest::addColumn<int>("size");
+    QTest::addColumn<bool>("flip");
+
+    static const struct {
+        const char *name;
+        QWinPixelOperation operation;
+    } operations[] = {
+        { "copy", QWinPixelCopy },
+        { "premultiply", QWinPixelPremultiply },
+        { "unpremultiply", QWinPixelUnpremultiply },
+        { "swapRedBlue", QWinPixelSwapRedBlue },
+        { "forceOpaque", QWinPixelForceOpaque },
+        { "fixupDibAlpha", QWinPixelFixupDibAlpha }
+    };
+    static const int sizes[] = { 16, 32, 256, 1024 };
+
+    for (size_t o = 0; o < sizeof(operations) / sizeof(operations[0]); ++o) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            for (int flip = 0; flip < 2; ++flip) {
+                const QByteArray name = QByteArray(operations[o].name) + '-' + QByteArray::number(sizes[s])
+                        + (flip ? "-flipped" : "");
+                QTest::newRow(name.constData()) << operations[o].operation << sizes[s] << bool(flip);
+            }
+        }
+    }
+}
+
+void tst_QWinPixelConversion::convertRows()
+{
+    QFETCH(QWinPixelOperation, operation);
+    QFETCH(int, size);
+    QFETCH(bool, flip);
+
+    // A mix of opaque, transparent and translucent pixels, like a typical anti-aliased icon.
+    QVector<quint32> source(size * size);
+    for (int i = 0; i < source.size(); ++i) {
+        const quint32 alpha = (i % 3 == 0) ? 0xff : (i % 3 == 1) ? 0 : quint32(i & 0xff);
+        const quint32 color = quint32(i * 2654435761u) & 0x00ffffff;
+        source[i] = (alpha << 24) | (alpha ? color : 0);
+    }
+    QVector<quint32> destination(source.size());
+    const int bytesPerLine = size * int(sizeof(quint32));
+
+    QBENCHMARK {
+        qt_winConvertPixelRows(reinterpret_cast<uchar *>(destination.data()), bytesPerLine,
+                               reinterpret_cast<const uchar *>(source.constData()), bytesPerLine,
+                               size, size, operation, flip);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinPixelConversion)
+
+#include "tst_bench_qwinpixelconversion.moc"
@@ -0,0 +1,8 @@
+TARGET = tst_bench_qwinregiondata
+QT = core gui testlib
+
+include(../../auto/shared/portable.pri)
+
+SOURCES += \
+    tst_bench_qwinregiondata.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinregiondata.cpp
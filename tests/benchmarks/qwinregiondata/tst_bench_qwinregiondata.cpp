@@ -0,0 +1,137 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtGui/QRegion>
+
+#include "qwinregiondata_p.h"
+
+// A grid of cells, every other one set: one band per row with many rects each.
+static QRegion checkerboard(int columns, int rows, int cellSize = 4)
+{
+    QVector<QRect> rects;
+    for (int row = 0; row < rows; ++row) {
+        for (int column = row % 2; column < columns; column += 2)
+            rects.append(QRect(column * cellSize, row * cellSize, cellSize, cellSize));
+    }
+    QRegion region;
+    region.setRects(rects.constData(), rects.size());
+    return region;
+}
+
+class tst_QWinRegionData : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void encode_data();
+    void encode();
+    void decode_data();
+    void decode();
+    void decodeByUnion_data();
+    void decodeByUnion();
+};
+
+void tst_QWinRegionData::encode_data()
+{
+    QTest::addColumn<QRegion>("region");
+
+    QTest::newRow("rect") << QRegion(0, 0, 100, 100);
+    QTest::newRow("ellipse") << QRegion(0, 0, 800, 600, QRegion::Ellipse);
+    QTest::newRow("checkerboard-1k") << checkerboard(40, 50);
+    QTest::newRow("checkerboard-10k") << checkerboard(200, 100);
+    QTest::newRow("checkerboard-100k") << checkerboard(500, 400);
+}
+
+void tst_QWinRegionData::encode()
+{
+    QFETCH(QRegion, region);
+
+    QWinRegionDataBuffer buffer;
+    QBENCHMARK {
+        qt_winRegionToRegionData(region, &buffer);
+    }
+}
+
+void tst_QWinRegionData::decode_data()
+{
+    encode_data();
+}
+
+void tst_QWinRegionData::decode()
+{
+    QFETCH(QRegion, region);
+
+    QWinRegionDataBuffer buffer;
+    qt_winRegionToRegionData(region, &buffer);
+    const int size = qt_winRegionDataSize(region.rectCount());
+    QBENCHMARK {
+        qt_winRegionFromRegionData(buffer.constData(), size);
+    }
+}
+
+void tst_QWinRegionData::decodeByUnion_data()
+{
+    encode_data();
+}
+
+// What QtWin::fromHRGN() used to do, for comparison.
+void tst_QWinRegionData::decodeByUnion()
+{
+    QFETCH(QRegion, region);
+
+    if (region.rectCount() > 10000)
+        QSKIP("Takes too long");
+
+    QWinRegionDataBuffer buffer;
+    qt_winRegionToRegionData(region, &buffer);
+    const QWinRegionRect *rects = qt_winRegionDataRects(buffer.constData());
+    const int count = region.rectCount();
+    QBENCHMARK {
+        QRegion result;
+        for (int i = 0; i < count; ++i)
+            result += QRect(rects[i].left, rects[i].top, rects[i].right - rects[i].left, rects[i].bottom - rects[i].top);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinRegionData)
+
+#include "tst_bench_qwinregiondata.moc"
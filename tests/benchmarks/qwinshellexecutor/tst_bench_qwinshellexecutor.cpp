@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QTemporaryDir>
+
+#include "qwinshellexecutor_p.h"
+#include "qwinjumplistcommitter_p.h"
+#include "qwinrecordingshellbackend_p.h"
+#include "qwiniconstore_p.h"
+
+// What a busy application sends per frame: a progress update, and every
+// few frames a jump list with a changed item.
+static const int progressLatency = 1000;
+static const int commitLatency = 20000;
+static const int framesPerCommit = 10;
+static const int frameCount = 100;
+
+static QWinJumpListSnapshot jumpList(int revision)
+{
+    QWinJumpListSnapshot snapshot;
+    snapshot.identifier = QStringLiteral("Org.Ide");
+    QWinJumpListCategorySnapshot projects;
+    projects.title = QStringLiteral("Projects");
+    for (int i = 0; i < 10; ++i) {
+        QWinJumpListItemSnapshot project;
+        project.type = QWinJumpListItem::Link;
+        project.filePath = QStringLiteral("C:/Program Files/Ide/ide.exe");
+        project.title = QStringLiteral("Project %1").arg(i);
+        projects.items.append(project);
+    }
+    projects.items[0].description = QString::number(revision);
+    snapshot.categories.append(projects);
+    return snapshot;
+}
+
+class ProgressJob : public QWinShellJob
+{
+public:
+    ProgressJob(QWinShellBackend *backend, quint64 completed) : m_backend(backend), m_completed(completed) {}
+
+    void run() Q_DECL_OVERRIDE
+    {
+        m_backend->setProgressValue(1, m_completed, 100);
+    }
+
+private:
+    QWinShellBackend *m_backend;
+    const quint64 m_completed;
+};
+
+class CommitJob : public QWinShellJob
+{
+public:
+    CommitJob(QWinJumpListCommitter *committer, const QWinJumpListSnapshot &snapshot) :
+        m_committer(committer), m_snapshot(snapshot) {}
+
+    void run() Q_DECL_OVERRIDE
+    {
+        m_committer->commit(m_snapshot, 0);
+    }
+
+private:
+    QWinJumpListCommitter *m_committer;
+    const QWinJumpListSnapshot m_snapshot;
+};
+
+class tst_QWinShellExecutor : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void guiThreadBlocking_data();
+    void guiThreadBlocking();
+};
+
+void tst_QWinShellExecutor::guiThreadBlocking_data()
+{
+    QTest::addColumn<int>("mode");
+    QTest::newRow("direct") << int(QWinShellExecutor::Synchronous);
+    QTest::newRow("executor") << int(QWinShellExecutor::Threaded);
+}
+
+// The time the GUI thread spends on the shell over a number of frames, with
+// a shell that takes its time. The frames are measured once, as every
+// iteration would queue more work for the shell thread; the calls posted
+// to it are run after the measurement.
+void tst_QWinShellExecutor::guiThreadBlocking()
+{
+    QFETCH(int, mode);
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    QWinIconStore iconStore(directory.path());
+    QWinRecordingShellBackend backend;
+    backend.setLatency(QWinShellBackend::SetProgressValue, progressLatency);
+    backend.setLatency(QWinShellBackend::CommitList, commitLatency);
+    QWinJumpListCommitter committer(&backend, &iconStore);
+    QWinShellExecutor executor(QWinShellExecutor::Mode(mode));
+
+    QBENCHMARK_ONCE {
+        for (int frame = 0; frame < frameCount; ++frame) {
+            executor.post(new ProgressJob(&backend, frame));
+            if (frame % framesPerCommit == 0)
+                executor.post(new CommitJob(&committer, jumpList(frame)));
+        }
+    }
+    executor.waitForDone();
+    QCOMPARE(backend.callCount(QWinShellBackend::SetProgressValue), frameCount);
+    QCOMPARE(backend.commitCount(), frameCount / framesPerCommit);
+}
+
+QTEST_GUILESS_MAIN(tst_QWinShellExecutor)
+
+#include "tst_bench_qwinshellexecutor.moc"
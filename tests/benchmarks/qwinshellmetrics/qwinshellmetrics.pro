@@ -0,0 +1,14 @@
+TARGET = tst_bench_qwinshellmetrics
+QT = core gui testlib
+
+include(../../auto/shared/portable.pri)
+
+SOURCES += \
+    tst_bench_qwinshellmetrics.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinshellmetrics.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwininstrumentedshellbackend.cpp \
+    $$WINEXTRAS_TEST_SOURCE_DIR/qwinrecordingshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinshellbackend.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinthumbnailtoolbarstate.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinjumplistsnapshot.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinhresult.cpp
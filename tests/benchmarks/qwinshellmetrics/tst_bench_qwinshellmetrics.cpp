@@ -0,0 +1,102 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinshellmetrics_p.h"
+#include "qwininstrumentedshellbackend_p.h"
+#include "qwinrecordingshellbackend_p.h"
+
+static const quintptr window = 0x1234;
+
+class tst_QWinShellMetrics : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void setProgressValue_data();
+    void setProgressValue();
+    void record();
+};
+
+// The cost the instrumentation adds to the cheapest call, with the
+// recording backend standing in for the shell.
+void tst_QWinShellMetrics::setProgressValue_data()
+{
+    QTest::addColumn<bool>("instrumented");
+    QTest::addColumn<bool>("enabled");
+
+    QTest::newRow("direct") << false << false;
+    QTest::newRow("disabled") << true << false;
+    QTest::newRow("enabled") << true << true;
+}
+
+void tst_QWinShellMetrics::setProgressValue()
+{
+    QFETCH(bool, instrumented);
+    QFETCH(bool, enabled);
+
+    QWinRecordingShellBackend native;
+    QWinShellMetrics metrics;
+    metrics.setEnabled(enabled);
+    QWinInstrumentedShellBackend instrumentedBackend(&native, &metrics);
+    QWinShellBackend *backend = instrumented ? static_cast<QWinShellBackend *>(&instrumentedBackend) : &native;
+
+    quint64 value = 0;
+    QBENCHMARK {
+        for (int i = 0; i < 1000; ++i)
+            backend->setProgressValue(window, ++value % 100, 100);
+        native.resetRecording();
+    }
+}
+
+void tst_QWinShellMetrics::record()
+{
+    QWinShellMetrics metrics;
+    QBENCHMARK {
+        for (int i = 0; i < 1000; ++i)
+            metrics.record(QWinShellBackend::SetProgressValue, 0, 100 * i);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinShellMetrics)
+
+#include "tst_bench_qwinshellmetrics.moc"
@@ -0,0 +1,230 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QBuffer>
+#include <QtCore/QTemporaryDir>
+
+#include "qwinshelltrace_p.h"
+#include "qwinshelltracereplayer_p.h"
+#include "qwinrecordingshellbackend_p.h"
+#include "qwiniconstore_p.h"
+
+enum Target
+{
+    PlayerButton,
+    PlayerToolBar,
+    PlayerJumpList
+};
+
+// A minute of a media player: a progress tick every millisecond, the
+// overlay set every second, the thumbnail toolbar updated twice a second,
+// half of the time without any change, and a playlist added to the jump
+// list every ten seconds.
+static QVector<QWinShellTraceEvent> playerSession()
+{
+    QVector<QWinShellTraceEvent> events;
+    const int duration = 60000;
+    for (int time = 0; time <= duration; ++time) {
+        QWinShellTraceEvent progress;
+        progress.type = QWinShellTraceEvent::Progress;
+        progress.time = time;
+        progress.target = PlayerButton;
+        progress.state = QWinTaskbarProgressNormal;
+        progress.completed = time;
+        progress.total = duration;
+        events.append(progress);
+
+        if (time % 1000 == 0) {
+            QWinShellTraceEvent overlay;
+            overlay.type = QWinShellTraceEvent::Overlay;
+            overlay.time = time;
+            overlay.target = PlayerButton;
+            overlay.iconKey = 1;
+            overlay.description = QStringLiteral("Playing");
+            events.append(overlay);
+        }
+
+        if (time % 500 == 0) {
+            const bool playing = (time / 1000) % 2 == 0;
+            QWinShellTraceEvent toolBar;
+            toolBar.type = QWinShellTraceEvent::ThumbnailButtons;
+            toolBar.time = time;
+            toolBar.target = PlayerToolBar;
+            toolBar.buttons.resize(QWinThumbnailToolBarState::SlotCount);
+            for (int i = 4; i < QWinThumbnailToolBarState::SlotCount; ++i) {
+                toolBar.buttons[i].flags = QWinThumbnailButtonEnabled;
+                toolBar.buttons[i].iconKey = 10 + i;
+            }
+            toolBar.buttons[4].toolTip = QStringLiteral("Previous");
+            toolBar.buttons[5].toolTip = playing ? QStringLiteral("Pause") : QStringLiteral("Play");
+            toolBar.buttons[5].iconKey = playing ? 20 : 21;
+            toolBar.buttons[6].toolTip = QStringLiteral("Next");
+            events.append(toolBar);
+        }
+
+        if (time % 10000 == 0) {
+            QWinShellTraceEvent jumpList;
+            jumpList.type = QWinShellTraceEvent::JumpList;
+            jumpList.time = time;
+            jumpList.target = PlayerJumpList;
+            jumpList.jumpList.identifier = QStringLiteral("Org.Player");
+            QWinJumpListCategorySnapshot playlists;
+            playlists.title = QStringLiteral("Playlists");
+            for (int i = 0; i <= time / 10000; ++i) {
+                QWinJumpListItemSnapshot item;
+                item.filePath = QStringLiteral("C:/Program Files/Player/player.exe");
+                item.title = QStringLiteral("Playlist %1").arg(i);
+                item.arguments << QStringLiteral("--playlist") << QString::number(i);
+                playlists.items.append(item);
+            }
+            jumpList.jumpList.categories.append(playlists);
+            QWinJumpListCategorySnapshot recent;
+            recent.type = QWinJumpListCategory::Recent;
+            jumpList.jumpList.categories.append(recent);
+            events.append(jumpList);
+        }
+    }
+    return events;
+}
+
+static const char *typeNames[] = { "", "Progress", "ProgressInterval", "Overlay", "ThumbnailButtons", "JumpList" };
+
+class tst_QWinShellTrace : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void write();
+    void read();
+    void replay();
+
+private:
+    QVector<QWinShellTraceEvent> m_events;
+    QByteArray m_trace;
+    QTemporaryDir m_directory;
+};
+
+/*
+    Replays the trace QT_WINEXTRAS_SHELL_TRACE wrote to the file named by
+    QT_WINEXTRAS_REPLAY_TRACE, or a generated one, and prints what reached
+    the shell.
+ */
+void tst_QWinShellTrace::initTestCase()
+{
+    const QString fileName = QFile::decodeName(qgetenv("QT_WINEXTRAS_REPLAY_TRACE"));
+    if (fileName.isEmpty()) {
+        m_events = playerSession();
+        QBuffer buffer(&m_trace);
+        buffer.open(QIODevice::WriteOnly);
+        QWinShellTraceWriter writer(&buffer);
+        foreach (const QWinShellTraceEvent &event, m_events)
+            writer.write(event);
+    } else {
+        QFile file(fileName);
+        QVERIFY2(file.open(QIODevice::ReadOnly), qPrintable(file.errorString()));
+        m_trace = file.readAll();
+        QWinShellTraceReader reader(m_trace);
+        QWinShellTraceEvent event;
+        while (reader.readNext(&event))
+            m_events.append(event);
+        QVERIFY2(!reader.hasError(), qPrintable(reader.errorString()));
+    }
+    QVERIFY(m_directory.isValid());
+
+    QWinIconStore iconStore(m_directory.path());
+    QWinRecordingShellBackend backend;
+    QWinShellTraceReplayer replayer(&backend, &iconStore);
+    foreach (const QWinShellTraceEvent &event, m_events)
+        replayer.replay(event);
+    replayer.finish();
+
+    qDebug("%d events over %lld ms in %d bytes, %.1f bytes per event",
+           replayer.eventCount(), replayer.duration(), m_trace.size(),
+           double(m_trace.size()) / qMax(replayer.eventCount(), 1));
+    for (int type = QWinShellTraceEvent::Progress; type <= QWinShellTraceEvent::JumpList; ++type) {
+        const QWinShellTraceEvent::Type eventType = QWinShellTraceEvent::Type(type);
+        if (replayer.eventCount(eventType))
+            qDebug("  %-17s %7d events, %7d redundant", typeNames[type],
+                   replayer.eventCount(eventType), replayer.redundantEventCount(eventType));
+    }
+    qDebug("%d native calls", backend.totalCallCount());
+    for (int call = 0; call < QWinShellBackend::CallCount; ++call) {
+        const QWinShellBackend::Call shellCall = QWinShellBackend::Call(call);
+        if (backend.callCount(shellCall))
+            qDebug("  %-28s %7d calls", QWinShellBackend::callName(shellCall), backend.callCount(shellCall));
+    }
+}
+
+void tst_QWinShellTrace::write()
+{
+    QBENCHMARK {
+        QWinShellTraceWriter writer(0);
+        foreach (const QWinShellTraceEvent &event, m_events)
+            writer.write(event);
+    }
+}
+
+void tst_QWinShellTrace::read()
+{
+    QBENCHMARK {
+        QWinShellTraceReader reader(m_trace);
+        QWinShellTraceEvent event;
+        while (reader.readNext(&event)) {}
+    }
+}
+
+void tst_QWinShellTrace::replay()
+{
+    QWinIconStore iconStore(m_directory.path());
+    QBENCHMARK {
+        QWinRecordingShellBackend backend;
+        QWinShellTraceReplayer replayer(&backend, &iconStore);
+        QWinShellTraceReader reader(m_trace);
+        replayer.replay(&reader);
+        replayer.finish();
+    }
+}
+
+QTEST_GUILESS_MAIN(tst_QWinShellTrace)
+
+#include "tst_bench_qwinshelltrace.moc"
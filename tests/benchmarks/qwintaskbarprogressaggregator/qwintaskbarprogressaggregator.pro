@@ -0,0 +1,15 @@
+TARGET = tst_bench_qwintaskbarprogressaggregator
+QT = core testlib
+
+include(../../auto/shared/portable.pri)
+
+SOURCES += \
+    tst_bench_qwintaskbarprogressaggregator.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogress.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogressreporter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogresscoalescer.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogressaggregator.cpp
+
+HEADERS += \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogress.h \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogressaggregator.h
@@ -0,0 +1,120 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwintaskbarprogress.h"
+#include "qwintaskbarprogressaggregator.h"
+
+static const int updates = 10000;
+
+class tst_QWinTaskbarProgressAggregator : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void update_data();
+    void update();
+    void addRemove();
+};
+
+void tst_QWinTaskbarProgressAggregator::update_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("10 children") << 10;
+    QTest::newRow("1000 children") << 1000;
+    QTest::newRow("10000 children") << 10000;
+}
+
+// Each update of a child should cost the same, whatever the number of children.
+void tst_QWinTaskbarProgressAggregator::update()
+{
+    QFETCH(int, count);
+
+    QObject jobs;
+    QWinTaskbarProgress target;
+    QWinTaskbarProgressAggregator aggregator;
+    aggregator.setTarget(&target);
+
+    QVector<QWinTaskbarProgress *> progresses;
+    for (int i = 0; i < count; ++i) {
+        QWinTaskbarProgress *progress = new QWinTaskbarProgress(&jobs);
+        progress->setRange(0, updates);
+        progress->show();
+        aggregator.addProgress(progress, 1 + i % 4);
+        progresses << progress;
+    }
+
+    int value = 0;
+    QBENCHMARK {
+        value = (value + 1) % updates;
+        for (int i = 0; i < updates; ++i)
+            progresses.at(i % count)->setValue(value);
+    }
+}
+
+void tst_QWinTaskbarProgressAggregator::addRemove()
+{
+    QObject jobs;
+    QWinTaskbarProgress target;
+    QWinTaskbarProgressAggregator aggregator;
+    aggregator.setTarget(&target);
+
+    QVector<QWinTaskbarProgress *> progresses;
+    for (int i = 0; i < updates; ++i) {
+        QWinTaskbarProgress *progress = new QWinTaskbarProgress(&jobs);
+        progress->setValue(i % 100);
+        progress->show();
+        progresses << progress;
+    }
+
+    QBENCHMARK {
+        foreach (QWinTaskbarProgress *progress, progresses)
+            aggregator.addProgress(progress);
+        foreach (QWinTaskbarProgress *progress, progresses)
+            aggregator.removeProgress(progress);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinTaskbarProgressAggregator)
+
+#include "tst_bench_qwintaskbarprogressaggregator.moc"
@@ -0,0 +1,12 @@
+TARGET = tst_bench_qwintaskbarprogressreporter
+QT = core testlib
+
+include(../../auto/shared/portable.pri)
+
+SOURCES += \
+    tst_bench_qwintaskbarprogressreporter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogress.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogressreporter.cpp
+
+HEADERS += \
+    $$WINEXTRAS_SOURCE_DIR/qwintaskbarprogress.h
@@ -0,0 +1,170 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwintaskbarprogress.h"
+#include "qwintaskbarprogressreporter.h"
+
+static const int chunks = 20000;
+
+// Reports each chunk through the reporter, as a download worker would.
+class ReporterThread : public QThread
+{
+public:
+    explicit ReporterThread(QWinTaskbarProgressReporter *reporter) : m_reporter(reporter) {}
+
+protected:
+    void run()
+    {
+        for (int i = 0; i < chunks; ++i)
+            m_reporter->add(1);
+    }
+
+private:
+    QWinTaskbarProgressReporter *m_reporter;
+};
+
+// Reports each chunk with a queued call to the progress indicator, as before.
+class QueuedThread : public QThread
+{
+public:
+    QueuedThread(QWinTaskbarProgress *progress, QAtomicInt *counter) : m_progress(progress), m_counter(counter) {}
+
+protected:
+    void run()
+    {
+        for (int i = 0; i < chunks; ++i) {
+            const qint64 value = m_counter->fetchAndAddOrdered(1) + 1;
+            QMetaObject::invokeMethod(m_progress, "setValue64", Qt::QueuedConnection, Q_ARG(qint64, value));
+        }
+    }
+
+private:
+    QWinTaskbarProgress *m_progress;
+    QAtomicInt *m_counter;
+};
+
+// Keeps the event loop of the GUI thread running while the workers report,
+// then delivers whatever is still queued.
+template <typename Thread>
+static void runThreads(const QList<Thread *> &threads)
+{
+    foreach (Thread *thread, threads)
+        thread->start();
+    bool running = true;
+    while (running) {
+        QCoreApplication::processEvents();
+        running = false;
+        foreach (Thread *thread, threads)
+            running |= !thread->isFinished();
+    }
+    foreach (Thread *thread, threads)
+        thread->wait();
+    QCoreApplication::sendPostedEvents();
+}
+
+class tst_QWinTaskbarProgressReporter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void reporter_data();
+    void reporter();
+    void queuedCalls_data();
+    void queuedCalls();
+};
+
+void tst_QWinTaskbarProgressReporter::reporter_data()
+{
+    QTest::addColumn<int>("threadCount");
+
+    QTest::newRow("1 thread") << 1;
+    QTest::newRow("4 threads") << 4;
+    QTest::newRow("8 threads") << 8;
+}
+
+void tst_QWinTaskbarProgressReporter::reporter()
+{
+    QFETCH(int, threadCount);
+    const qint64 total = qint64(threadCount) * chunks;
+
+    QBENCHMARK {
+        QWinTaskbarProgressReporter reporter;
+        QWinTaskbarProgress progress;
+        progress.setRange64(0, total);
+        progress.setReporter(&reporter, 1);
+
+        QList<ReporterThread *> threads;
+        for (int i = 0; i < threadCount; ++i)
+            threads << new ReporterThread(&reporter);
+        runThreads(threads);
+        qDeleteAll(threads);
+        progress.setReporter(0);
+    }
+}
+
+void tst_QWinTaskbarProgressReporter::queuedCalls_data()
+{
+    reporter_data();
+}
+
+void tst_QWinTaskbarProgressReporter::queuedCalls()
+{
+    QFETCH(int, threadCount);
+    const qint64 total = qint64(threadCount) * chunks;
+
+    QBENCHMARK {
+        QWinTaskbarProgress progress;
+        progress.setRange64(0, total);
+        QAtomicInt counter;
+
+        QList<QueuedThread *> threads;
+        for (int i = 0; i < threadCount; ++i)
+            threads << new QueuedThread(&progress, &counter);
+        runThreads(threads);
+        qDeleteAll(threads);
+    }
+}
+
+QTEST_GUILESS_MAIN(tst_QWinTaskbarProgressReporter)
+
+#include "tst_bench_qwintaskbarprogressreporter.moc"
@@ -0,0 +1,8 @@
+TARGET = tst_bench_qwinthumbnailtoolbarrouter
+QT = core testlib
+
+include(../../auto/shared/portable.pri)
+
+SOURCES += \
+    tst_bench_qwinthumbnailtoolbarrouter.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinthumbnailtoolbarrouter.cpp
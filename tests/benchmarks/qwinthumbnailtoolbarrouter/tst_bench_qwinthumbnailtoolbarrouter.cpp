@@ -0,0 +1,169 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinthumbnailtoolbarrouter_p.h"
+
+struct Message
+{
+    quintptr handle;
+    quint32 message;
+    quintptr wParam;
+};
+
+class CountingReceiver : public QWinThumbnailToolBarReceiver
+{
+public:
+    CountingReceiver() : clicks(0) {}
+    void thumbnailButtonClicked(int) { ++clicks; }
+
+    int clicks;
+};
+
+// What every toolbar did before, as its own application wide filter.
+struct PerToolBarFilter
+{
+    quintptr handle;
+    CountingReceiver *receiver;
+
+    bool filter(const Message &msg) const
+    {
+        if (msg.message == QWinThumbnailToolBarCommandMessage
+            && ((msg.wParam >> 16) & 0xffff) == QWinThumbnailToolBarClickedNotification
+            && msg.handle == handle) {
+            receiver->thumbnailButtonClicked(int(msg.wParam & 0xffff));
+            return true;
+        }
+        return false;
+    }
+};
+
+static const int messageCount = 10000;
+
+// Mostly ordinary messages, with a click for a random toolbar every 16th.
+static QVector<Message> createMessages(int toolBarCount)
+{
+    QVector<Message> messages;
+    messages.reserve(messageCount);
+    qsrand(1);
+    for (int i = 0; i < messageCount; ++i) {
+        const quintptr handle = 0x10000 + 0x10 * quintptr(qrand() % toolBarCount);
+        Message message = { handle, 0x0200 /* WM_MOUSEMOVE */, 0 };
+        if (i % 16 == 0) {
+            message.message = QWinThumbnailToolBarCommandMessage;
+            message.wParam = (quintptr(QWinThumbnailToolBarClickedNotification) << 16) | quintptr(i % 7);
+        }
+        messages << message;
+    }
+    return messages;
+}
+
+class tst_QWinThumbnailToolBarRouter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void route_data();
+    void route();
+    void perToolBarFilters_data();
+    void perToolBarFilters();
+};
+
+void tst_QWinThumbnailToolBarRouter::route_data()
+{
+    QTest::addColumn<int>("toolBarCount");
+
+    QTest::newRow("1 toolbar") << 1;
+    QTest::newRow("10 toolbars") << 10;
+    QTest::newRow("100 toolbars") << 100;
+    QTest::newRow("1000 toolbars") << 1000;
+}
+
+void tst_QWinThumbnailToolBarRouter::route()
+{
+    QFETCH(int, toolBarCount);
+    const QVector<Message> messages = createMessages(toolBarCount);
+
+    QVector<CountingReceiver> receivers(toolBarCount);
+    QWinThumbnailToolBarRouter router;
+    for (int i = 0; i < toolBarCount; ++i)
+        router.insert(0x10000 + 0x10 * quintptr(i), &receivers[i]);
+
+    QBENCHMARK {
+        for (int i = 0; i < messages.size(); ++i) {
+            const Message &message = messages.at(i);
+            router.route(message.handle, message.message, message.wParam);
+        }
+    }
+}
+
+void tst_QWinThumbnailToolBarRouter::perToolBarFilters_data()
+{
+    route_data();
+}
+
+void tst_QWinThumbnailToolBarRouter::perToolBarFilters()
+{
+    QFETCH(int, toolBarCount);
+    const QVector<Message> messages = createMessages(toolBarCount);
+
+    QVector<CountingReceiver> receivers(toolBarCount);
+    QVector<PerToolBarFilter> filters;
+    for (int i = 0; i < toolBarCount; ++i) {
+        const PerToolBarFilter filter = { 0x10000 + 0x10 * quintptr(i), &receivers[i] };
+        filters << filter;
+    }
+
+    QBENCHMARK {
+        for (int i = 0; i < messages.size(); ++i) {
+            const Message &message = messages.at(i);
+            for (int j = 0; j < filters.size(); ++j) {
+                if (filters.at(j).filter(message))
+                    break;
+            }
+        }
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinThumbnailToolBarRouter)
+
+#include "tst_bench_qwinthumbnailtoolbarrouter.moc"
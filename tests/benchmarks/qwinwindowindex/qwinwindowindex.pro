@@ -0,0 +1,8 @@
+TARGET = tst_bench_qwinwindowindex
+QT = core testlib
+
+include(../../auto/shared/portable.pri)
+
+SOURCES += \
+    tst_bench_qwinwindowindex.cpp \
+    $$WINEXTRAS_SOURCE_DIR/qwinwindowindex.cpp
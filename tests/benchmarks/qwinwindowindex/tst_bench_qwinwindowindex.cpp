@@ -0,0 +1,148 @@
+/****************************************************************************
+**
+** Copyright (C) 2013 Digia Plc and/or its subsidiary(-ies).
+** Contact: http://www.qt-project.org/legal
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and Digia.  For licensing terms and
+** conditions see http://qt.digia.com/licensing.  For further information
+** use the contact form at http://qt.digia.com/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 2.1 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU Lesser General Public License version 2.1 requirements
+** will be met: http://www.gnu.org/licenses/old-licenses/lgpl-2.1.html.
+**
+** In addition, as a special exception, Digia gives you certain additional
+** rights.  These rights are described in the Digia Qt LGPL Exception
+** version 1.1, included in the file LGPL_EXCEPTION.txt in this package.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3.0 as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL included in the
+** packaging of this file.  Please review the following information to
+** ensure the GNU General Public License version 3.0 requirements will be
+** met: http://www.gnu.org/copyleft/gpl.html.
+**
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include "qwinwindowindex_p.h"
+
+struct Window
+{
+    quintptr handle;
+    QObject *object;
+};
+
+static QVector<Window> windows;
+
+static void scanWindows(QWinWindowIndex *index)
+{
+    for (int i = 0; i < windows.size(); ++i)
+        index->insert(windows.at(i).handle, windows.at(i).object);
+}
+
+// What QWinEventFilter::findWindow() did before: compare the handle of every
+// top level window.
+static QObject *findLinear(quintptr handle)
+{
+    for (int i = 0; i < windows.size(); ++i) {
+        if (windows.at(i).handle == handle)
+            return windows.at(i).object;
+    }
+    return 0;
+}
+
+class tst_QWinWindowIndex : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+    void find_data();
+    void find();
+    void findLinear_data();
+    void findLinear();
+
+private:
+    void createWindows(int count);
+};
+
+void tst_QWinWindowIndex::createWindows(int count)
+{
+    for (int i = 0; i < count; ++i) {
+        const Window window = { quintptr(0x10000 + 0x10 * i), new QObject };
+        windows << window;
+    }
+}
+
+void tst_QWinWindowIndex::init()
+{
+    windows.clear();
+}
+
+void tst_QWinWindowIndex::cleanup()
+{
+    for (int i = 0; i < windows.size(); ++i)
+        delete windows.at(i).object;
+    windows.clear();
+}
+
+void tst_QWinWindowIndex::find_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("10 windows") << 10;
+    QTest::newRow("1000 windows") << 1000;
+    QTest::newRow("5000 windows") << 5000;
+}
+
+// A broadcast message such as WM_THEMECHANGED looks up every window once.
+void tst_QWinWindowIndex::find()
+{
+    QFETCH(int, count);
+    createWindows(count);
+
+    QWinWindowIndex index(scanWindows);
+    QBENCHMARK {
+        for (int i = 0; i < count; ++i)
+            index.find(windows.at(i).handle);
+    }
+    QCOMPARE(index.scanCount(), 1);
+}
+
+void tst_QWinWindowIndex::findLinear_data()
+{
+    find_data();
+}
+
+void tst_QWinWindowIndex::findLinear()
+{
+    QFETCH(int, count);
+    createWindows(count);
+
+    QBENCHMARK {
+        for (int i = 0; i < count; ++i)
+            ::findLinear(windows.at(i).handle);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QWinWindowIndex)
+
+#include "tst_bench_qwinwindowindex.moc"